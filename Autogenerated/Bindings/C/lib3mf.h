@@ -80,7 +80,7 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_base_classtypeid(Lib3MF_Base pBase, Lib3MF_u
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetofile(Lib3MF_Writer pWriter, const char * pFilename);
 
 /**
-* Retrieves the size of the full 3MF file stream.
+* Retrieves the size of the full 3MF file stream..
 *
 * @param[in] pWriter - Writer instance.
 * @param[out] pStreamSize - the stream size
@@ -99,6 +99,24 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstreamsize(Lib3MF_Writer pWriter,
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetobuffer(Lib3MF_Writer pWriter, const Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer);
 
+/**
+* Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferSize - size of the written buffer in bytes
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetointernalbuffer(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferSize);
+
+/**
+* Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferAddress - address of the first byte of the buffer
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getinternalbufferaddress(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferAddress);
+
 /**
 * Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 *
@@ -156,6 +174,114 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setstrictmodeactive(Lib3MF_Writer pWr
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstrictmodeactive(Lib3MF_Writer pWriter, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to format the XML of the objects of a model part.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of formatting threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to write the non-root model parts of the production extension.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of writer threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to deflate large parts of the package.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of compression threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the compression level of the model parts (root model and non-root models of the production extension).
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the model parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of textures and thumbnails.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_settexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the texture and thumbnail parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_gettexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of all other attachments.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the attachment parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -244,6 +370,56 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_readfromcallback(Lib3MF_Reader pReade
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setprogresscallback(Lib3MF_Reader pReader, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Streams the vertices of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pVertexStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setvertexstreamcallback(Lib3MF_Reader pReader, Lib3MFVertexStreamCallback pVertexStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the triangles of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pTriangleStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_settrianglestreamcallback(Lib3MF_Reader pReader, Lib3MFTriangleStreamCallback pTriangleStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the beams of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBeamStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbeamstreamcallback(Lib3MF_Reader pReader, Lib3MFBeamStreamCallback pBeamStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the components of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pComponentStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setcomponentstreamcallback(Lib3MF_Reader pReader, Lib3MFComponentStreamCallback pComponentStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the build items of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbuilditemstreamcallback(Lib3MF_Reader pReader, Lib3MFBuildItemStreamCallback pBuildItemStreamCallback, Lib3MF_pvoid pUserData);
+
 /**
 * Adds a relationship type which shall be read as attachment in memory while loading
 *
@@ -280,6 +456,78 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pRe
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to parse the non-root model parts of the production extension.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pThreadCount - number of parser threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setlazymeshloadingactive(Lib3MF_Reader pReader, bool bLazyMeshLoadingActive);
+
+/**
+* Queries whether mesh content is parsed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyMeshLoadingActive - returns flag whether mesh content is parsed on first access.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getlazymeshloadingactive(Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive);
+
+/**
+* Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbackgrounddecompressionactive(Lib3MF_Reader pReader, bool bBackgroundDecompressionActive);
+
+/**
+* Queries whether the root model part is decompressed on a background thread
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pBackgroundDecompressionActive - returns flag whether the root model part is decompressed on a background thread.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getbackgrounddecompressionactive(Lib3MF_Reader pReader, bool * pBackgroundDecompressionActive);
+
+/**
+* Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setlazyattachmentloadingactive(Lib3MF_Reader pReader, bool bLazyAttachmentLoadingActive);
+
+/**
+* Queries whether attachments are decompressed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyAttachmentLoadingActive - returns flag whether attachments are decompressed on first access.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getlazyattachmentloadingactive(Lib3MF_Reader pReader, bool * pLazyAttachmentLoadingActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -1561,6 +1809,24 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_levelset_getvolumedata(Lib3MF_LevelSet pLeve
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_levelset_setvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData pTheVolumeData);
 
+/**
+* Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+*
+* @param[in] pLevelSet - LevelSet instance.
+* @param[in] pOrigin - position of the first grid point
+* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+* @param[in] nCountX - number of grid points along x
+* @param[in] nCountY - number of grid points along y
+* @param[in] nCountZ - number of grid points along z
+* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - single  buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_levelset_samplegrid(Lib3MF_LevelSet pLevelSet, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer);
+
 /*************************************************************************************************************************
  Class definition for BeamLattice
 **************************************************************************************************************************/
@@ -4156,6 +4422,25 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_function_findinput(Lib3MF_Function pFunction
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_function_findoutput(Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput);
 
+/**
+* Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+*
+* @param[in] pFunction - Function instance.
+* @param[in] pOutputIdentifier - the identifier of the scalar output to sample
+* @param[in] pOrigin - position of the first grid point
+* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+* @param[in] nCountX - number of grid points along x
+* @param[in] nCountY - number of grid points along y
+* @param[in] nCountZ - number of grid points along z
+* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - single  buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_function_samplegrid(Lib3MF_Function pFunction, const char * pOutputIdentifier, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer);
+
 /*************************************************************************************************************************
  Class definition for ImplicitFunction
 **************************************************************************************************************************/
@@ -4867,6 +5152,19 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_clear(Lib3MF_ImplicitFuncti
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_sortnodestopologically(Lib3MF_ImplicitFunction pImplicitFunction);
 
+/**
+* Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+*
+* @param[in] pImplicitFunction - ImplicitFunction instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of Input values of all points. The count MUST be a multiple of the component count of all inputs.
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double  buffer of Output values of all points.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_evaluatebatch(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
 /*************************************************************************************************************************
  Class definition for FunctionFromImage3D
 **************************************************************************************************************************/
@@ -5984,6 +6282,17 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getbuilditems(Lib3MF_Model pModel, Lib
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getoutbox(Lib3MF_Model pModel, sLib3MFBox * pOutbox);
 
+/**
+* Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+*
+* @param[in] pModel - Model instance.
+* @param[in] nOutboxesBufferSize - Number of elements in buffer
+* @param[out] pOutboxesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutboxesBuffer - Box  buffer of contains the outbox of each build item.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getbuilditemoutboxes(Lib3MF_Model pModel, const Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, sLib3MFBox * pOutboxesBuffer);
+
 /**
 * creates a resource iterator instance with all resources.
 *
@@ -422,7 +422,8 @@ typedef enum eLib3MFProgressIdentifier {
   eProgressIdentifierWRITENODES = 20,
   eProgressIdentifierWRITETRIANGLES = 21,
   eProgressIdentifierWRITESLICES = 22,
-  eProgressIdentifierWRITEKEYSTORE = 23
+  eProgressIdentifierWRITEKEYSTORE = 23,
+  eProgressIdentifierSAMPLEGRID = 24
 } eLib3MFProgressIdentifier;
 
 typedef enum eLib3MFBlendMethod {
@@ -798,6 +799,55 @@ typedef void(*Lib3MFSeekCallback)(Lib3MF_uint64, Lib3MF_pvoid);
 */
 typedef void(*Lib3MFRandomNumberCallback)(Lib3MF_uint64, Lib3MF_uint64, Lib3MF_pvoid, Lib3MF_uint64 *);
 
+/**
+* Lib3MFVertexStreamCallback - Callback to receive a batch of vertices while streaming a mesh object
+*
+* @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the vertices belong to
+* @param[in] nVertexCount - Number of vertices in the batch
+* @param[in] nVertexData - Pointer to an array of VertexCount Position structs
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFVertexStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+
+/**
+* Lib3MFTriangleStreamCallback - Callback to receive a batch of triangles while streaming a mesh object
+*
+* @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the triangles belong to
+* @param[in] nTriangleCount - Number of triangles in the batch
+* @param[in] nTriangleData - Pointer to an array of TriangleCount Triangle structs
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFTriangleStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+
+/**
+* Lib3MFBeamStreamCallback - Callback to receive a batch of beams while streaming a mesh object
+*
+* @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the beams belong to
+* @param[in] nBeamCount - Number of beams in the batch
+* @param[in] nBeamData - Pointer to an array of BeamCount Beam structs
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFBeamStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+
+/**
+* Lib3MFComponentStreamCallback - Callback to receive a component while streaming a components object
+*
+* @param[in] nObjectUniqueID - UniqueResourceID of the components object
+* @param[in] nComponentObjectUniqueID - UniqueResourceID of the referenced object
+* @param[in] nTransformData - Pointer to the Transform struct of the component
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFComponentStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+
+/**
+* Lib3MFBuildItemStreamCallback - Callback to receive a build item while streaming a model
+*
+* @param[in] nObjectUniqueID - UniqueResourceID of the referenced object
+* @param[in] nTransformData - Pointer to the Transform struct of the build item
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFBuildItemStreamCallback)(Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+
 /**
 * Lib3MFKeyWrappingCallback - A callback used to wrap (encrypt) the content key available in keystore resource group
 *
@@ -130,7 +130,8 @@ namespace Lib3MF {
 		WRITENODES = 20,
 		WRITETRIANGLES = 21,
 		WRITESLICES = 22,
-		WRITEKEYSTORE = 23
+		WRITEKEYSTORE = 23,
+		SAMPLEGRID = 24
 	};
 
 	public enum eBlendMethod {
@@ -447,6 +448,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_writetobuffer", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_WriteToBuffer (IntPtr Handle, UInt64 sizeBuffer, out UInt64 neededBuffer, IntPtr dataBuffer);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_writetointernalbuffer", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_WriteToInternalBuffer (IntPtr Handle, out UInt64 ABufferSize);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getinternalbufferaddress", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetInternalBufferAddress (IntPtr Handle, out UInt64 ABufferAddress);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_writetocallback", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_WriteToCallback (IntPtr Handle, IntPtr ATheWriteCallback, IntPtr ATheSeekCallback, UInt64 AUserData);
 
@@ -465,6 +472,42 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getstrictmodeactive", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_GetStrictModeActive (IntPtr Handle, out Byte AStrictModeActive);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setobjectthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetObjectThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getobjectthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetObjectThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setsubmodelthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetSubModelThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getsubmodelthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetSubModelThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setcompressionthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetCompressionThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getcompressionthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetCompressionThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setmodelcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetModelCompressionLevel (IntPtr Handle, UInt32 ACompressionLevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getmodelcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetModelCompressionLevel (IntPtr Handle, out UInt32 ACompressionLevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_settexturecompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetTextureCompressionLevel (IntPtr Handle, UInt32 ACompressionLevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_gettexturecompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetTextureCompressionLevel (IntPtr Handle, out UInt32 ACompressionLevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setattachmentcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetAttachmentCompressionLevel (IntPtr Handle, UInt32 ACompressionLevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getattachmentcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetAttachmentCompressionLevel (IntPtr Handle, out UInt32 ACompressionLevel);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getwarning", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_GetWarning (IntPtr Handle, UInt32 AIndex, out UInt32 AErrorCode, UInt32 sizeWarning, out UInt32 neededWarning, IntPtr dataWarning);
 
@@ -489,6 +532,21 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setprogresscallback", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_SetProgressCallback (IntPtr Handle, IntPtr AProgressCallback, UInt64 AUserData);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setvertexstreamcallback", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetVertexStreamCallback (IntPtr Handle, IntPtr AVertexStreamCallback, UInt64 AUserData);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_settrianglestreamcallback", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetTriangleStreamCallback (IntPtr Handle, IntPtr ATriangleStreamCallback, UInt64 AUserData);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setbeamstreamcallback", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetBeamStreamCallback (IntPtr Handle, IntPtr ABeamStreamCallback, UInt64 AUserData);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setcomponentstreamcallback", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetComponentStreamCallback (IntPtr Handle, IntPtr AComponentStreamCallback, UInt64 AUserData);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setbuilditemstreamcallback", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetBuildItemStreamCallback (IntPtr Handle, IntPtr ABuildItemStreamCallback, UInt64 AUserData);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_addrelationtoread", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_AddRelationToRead (IntPtr Handle, byte[] ARelationShipType);
 
@@ -501,6 +559,30 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getstrictmodeactive", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_GetStrictModeActive (IntPtr Handle, out Byte AStrictModeActive);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setsubmodelthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetSubModelThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getsubmodelthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetSubModelThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setlazymeshloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetLazyMeshLoadingActive (IntPtr Handle, Byte ALazyMeshLoadingActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getlazymeshloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetLazyMeshLoadingActive (IntPtr Handle, out Byte ALazyMeshLoadingActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setbackgrounddecompressionactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetBackgroundDecompressionActive (IntPtr Handle, Byte ABackgroundDecompressionActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getbackgrounddecompressionactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetBackgroundDecompressionActive (IntPtr Handle, out Byte ABackgroundDecompressionActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setlazyattachmentloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetLazyAttachmentLoadingActive (IntPtr Handle, Byte ALazyAttachmentLoadingActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getlazyattachmentloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetLazyAttachmentLoadingActive (IntPtr Handle, out Byte ALazyAttachmentLoadingActive);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getwarning", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_GetWarning (IntPtr Handle, UInt32 AIndex, out UInt32 AErrorCode, UInt32 sizeWarning, out UInt32 neededWarning, IntPtr dataWarning);
 
@@ -876,6 +958,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_levelset_setvolumedata", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 LevelSet_SetVolumeData (IntPtr Handle, IntPtr ATheVolumeData);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_levelset_samplegrid", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 LevelSet_SampleGrid (IntPtr Handle, ref InternalVector AOrigin, ref InternalVector ASpacing, UInt32 ACountX, UInt32 ACountY, UInt32 ACountZ, IntPtr AProgressCallback, UInt64 AUserData, UInt64 sizeValues, out UInt64 neededValues, IntPtr dataValues);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_beamlattice_getminlength", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 BeamLattice_GetMinLength (IntPtr Handle, out Double AMinLength);
 
@@ -1593,6 +1678,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_function_findoutput", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Function_FindOutput (IntPtr Handle, byte[] AIdentifier, out IntPtr AOutput);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_function_samplegrid", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Function_SampleGrid (IntPtr Handle, byte[] AOutputIdentifier, ref InternalVector AOrigin, ref InternalVector ASpacing, UInt32 ACountX, UInt32 ACountY, UInt32 ACountZ, IntPtr AProgressCallback, UInt64 AUserData, UInt64 sizeValues, out UInt64 neededValues, IntPtr dataValues);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitfunction_getidentifier", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 ImplicitFunction_GetIdentifier (IntPtr Handle, UInt32 sizeIdentifier, out UInt32 neededIdentifier, IntPtr dataIdentifier);
 
@@ -1767,6 +1855,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitfunction_sortnodestopologically", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 ImplicitFunction_SortNodesTopologically (IntPtr Handle);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitfunction_evaluatebatch", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitFunction_EvaluateBatch (IntPtr Handle, UInt64 sizeInputs, IntPtr dataInputs, UInt64 sizeOutputs, out UInt64 neededOutputs, IntPtr dataOutputs);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_functionfromimage3d_getimage3d", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 FunctionFromImage3D_GetImage3D (IntPtr Handle, out IntPtr AImage3D);
 
@@ -2094,6 +2185,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getoutbox", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Model_GetOutbox (IntPtr Handle, out InternalBox AOutbox);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getbuilditemoutboxes", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Model_GetBuildItemOutboxes (IntPtr Handle, UInt64 sizeOutboxes, out UInt64 neededOutboxes, IntPtr dataOutboxes);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getresources", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Model_GetResources (IntPtr Handle, out IntPtr AResourceIterator);
 
@@ -2862,6 +2956,22 @@ namespace Lib3MF {
 			dataBuffer.Free();
 		}
 
+		public UInt64 WriteToInternalBuffer ()
+		{
+			UInt64 resultBufferSize = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_WriteToInternalBuffer (Handle, out resultBufferSize));
+			return resultBufferSize;
+		}
+
+		public UInt64 GetInternalBufferAddress ()
+		{
+			UInt64 resultBufferAddress = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetInternalBufferAddress (Handle, out resultBufferAddress));
+			return resultBufferAddress;
+		}
+
 		public void WriteToCallback (IntPtr ATheWriteCallback, IntPtr ATheSeekCallback, UInt64 AUserData)
 		{
 
@@ -2902,6 +3012,90 @@ namespace Lib3MF {
 			return (resultStrictModeActive != 0);
 		}
 
+		public void SetObjectThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetObjectThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetObjectThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetObjectThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetSubModelThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetSubModelThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetSubModelThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetSubModelThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetCompressionThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetCompressionThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetCompressionThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetCompressionThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetModelCompressionLevel (UInt32 ACompressionLevel)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetModelCompressionLevel (Handle, ACompressionLevel));
+		}
+
+		public UInt32 GetModelCompressionLevel ()
+		{
+			UInt32 resultCompressionLevel = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetModelCompressionLevel (Handle, out resultCompressionLevel));
+			return resultCompressionLevel;
+		}
+
+		public void SetTextureCompressionLevel (UInt32 ACompressionLevel)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetTextureCompressionLevel (Handle, ACompressionLevel));
+		}
+
+		public UInt32 GetTextureCompressionLevel ()
+		{
+			UInt32 resultCompressionLevel = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetTextureCompressionLevel (Handle, out resultCompressionLevel));
+			return resultCompressionLevel;
+		}
+
+		public void SetAttachmentCompressionLevel (UInt32 ACompressionLevel)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetAttachmentCompressionLevel (Handle, ACompressionLevel));
+		}
+
+		public UInt32 GetAttachmentCompressionLevel ()
+		{
+			UInt32 resultCompressionLevel = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetAttachmentCompressionLevel (Handle, out resultCompressionLevel));
+			return resultCompressionLevel;
+		}
+
 		public String GetWarning (UInt32 AIndex, out UInt32 AErrorCode)
 		{
 			UInt32 sizeWarning = 0;
@@ -2972,6 +3166,36 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.Reader_SetProgressCallback (Handle, AProgressCallback, AUserData));
 		}
 
+		public void SetVertexStreamCallback (IntPtr AVertexStreamCallback, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetVertexStreamCallback (Handle, AVertexStreamCallback, AUserData));
+		}
+
+		public void SetTriangleStreamCallback (IntPtr ATriangleStreamCallback, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetTriangleStreamCallback (Handle, ATriangleStreamCallback, AUserData));
+		}
+
+		public void SetBeamStreamCallback (IntPtr ABeamStreamCallback, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetBeamStreamCallback (Handle, ABeamStreamCallback, AUserData));
+		}
+
+		public void SetComponentStreamCallback (IntPtr AComponentStreamCallback, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetComponentStreamCallback (Handle, AComponentStreamCallback, AUserData));
+		}
+
+		public void SetBuildItemStreamCallback (IntPtr ABuildItemStreamCallback, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetBuildItemStreamCallback (Handle, ABuildItemStreamCallback, AUserData));
+		}
+
 		public void AddRelationToRead (String ARelationShipType)
 		{
 			byte[] byteRelationShipType = Encoding.UTF8.GetBytes(ARelationShipType + char.MinValue);
@@ -3000,6 +3224,62 @@ namespace Lib3MF {
 			return (resultStrictModeActive != 0);
 		}
 
+		public void SetSubModelThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetSubModelThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetSubModelThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetSubModelThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetLazyMeshLoadingActive (bool ALazyMeshLoadingActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetLazyMeshLoadingActive (Handle, (Byte)( ALazyMeshLoadingActive ? 1 : 0 )));
+		}
+
+		public bool GetLazyMeshLoadingActive ()
+		{
+			Byte resultLazyMeshLoadingActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetLazyMeshLoadingActive (Handle, out resultLazyMeshLoadingActive));
+			return (resultLazyMeshLoadingActive != 0);
+		}
+
+		public void SetBackgroundDecompressionActive (bool ABackgroundDecompressionActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetBackgroundDecompressionActive (Handle, (Byte)( ABackgroundDecompressionActive ? 1 : 0 )));
+		}
+
+		public bool GetBackgroundDecompressionActive ()
+		{
+			Byte resultBackgroundDecompressionActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetBackgroundDecompressionActive (Handle, out resultBackgroundDecompressionActive));
+			return (resultBackgroundDecompressionActive != 0);
+		}
+
+		public void SetLazyAttachmentLoadingActive (bool ALazyAttachmentLoadingActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetLazyAttachmentLoadingActive (Handle, (Byte)( ALazyAttachmentLoadingActive ? 1 : 0 )));
+		}
+
+		public bool GetLazyAttachmentLoadingActive ()
+		{
+			Byte resultLazyAttachmentLoadingActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetLazyAttachmentLoadingActive (Handle, out resultLazyAttachmentLoadingActive));
+			return (resultLazyAttachmentLoadingActive != 0);
+		}
+
 		public String GetWarning (UInt32 AIndex, out UInt32 AErrorCode)
 		{
 			UInt32 sizeWarning = 0;
@@ -4272,6 +4552,21 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.LevelSet_SetVolumeData (Handle, ATheVolumeDataHandle));
 		}
 
+		public void SampleGrid (sVector AOrigin, sVector ASpacing, UInt32 ACountX, UInt32 ACountY, UInt32 ACountZ, IntPtr AProgressCallback, UInt64 AUserData, out Single[] AValues)
+		{
+			Internal.InternalVector intOrigin = Internal.Lib3MFWrapper.convertStructToInternal_Vector (AOrigin);
+			Internal.InternalVector intSpacing = Internal.Lib3MFWrapper.convertStructToInternal_Vector (ASpacing);
+			UInt64 sizeValues = 0;
+			UInt64 neededValues = 0;
+			CheckError(Internal.Lib3MFWrapper.LevelSet_SampleGrid (Handle, ref intOrigin, ref intSpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, sizeValues, out neededValues, IntPtr.Zero));
+			sizeValues = neededValues;
+			AValues = new Single[sizeValues];
+			GCHandle dataValues = GCHandle.Alloc(AValues, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.LevelSet_SampleGrid (Handle, ref intOrigin, ref intSpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, sizeValues, out neededValues, dataValues.AddrOfPinnedObject()));
+			dataValues.Free();
+		}
+
 	}
 
 	public class CBeamLattice : CBase
@@ -6965,6 +7260,22 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.PolymorphicFactory<CImplicitPort>(newOutput);
 		}
 
+		public void SampleGrid (String AOutputIdentifier, sVector AOrigin, sVector ASpacing, UInt32 ACountX, UInt32 ACountY, UInt32 ACountZ, IntPtr AProgressCallback, UInt64 AUserData, out Single[] AValues)
+		{
+			byte[] byteOutputIdentifier = Encoding.UTF8.GetBytes(AOutputIdentifier + char.MinValue);
+			Internal.InternalVector intOrigin = Internal.Lib3MFWrapper.convertStructToInternal_Vector (AOrigin);
+			Internal.InternalVector intSpacing = Internal.Lib3MFWrapper.convertStructToInternal_Vector (ASpacing);
+			UInt64 sizeValues = 0;
+			UInt64 neededValues = 0;
+			CheckError(Internal.Lib3MFWrapper.Function_SampleGrid (Handle, byteOutputIdentifier, ref intOrigin, ref intSpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, sizeValues, out neededValues, IntPtr.Zero));
+			sizeValues = neededValues;
+			AValues = new Single[sizeValues];
+			GCHandle dataValues = GCHandle.Alloc(AValues, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Function_SampleGrid (Handle, byteOutputIdentifier, ref intOrigin, ref intSpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, sizeValues, out neededValues, dataValues.AddrOfPinnedObject()));
+			dataValues.Free();
+		}
+
 	}
 
 	public class CImplicitFunction : CFunction
@@ -7626,6 +7937,21 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.ImplicitFunction_SortNodesTopologically (Handle));
 		}
 
+		public void EvaluateBatch (Double[] AInputs, out Double[] AOutputs)
+		{
+			GCHandle dataInputs = GCHandle.Alloc(AInputs, GCHandleType.Pinned);
+			UInt64 sizeOutputs = 0;
+			UInt64 neededOutputs = 0;
+			CheckError(Internal.Lib3MFWrapper.ImplicitFunction_EvaluateBatch (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, IntPtr.Zero));
+			sizeOutputs = neededOutputs;
+			AOutputs = new Double[sizeOutputs];
+			GCHandle dataOutputs = GCHandle.Alloc(AOutputs, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitFunction_EvaluateBatch (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, dataOutputs.AddrOfPinnedObject()));
+			dataInputs.Free ();
+			dataOutputs.Free();
+		}
+
 	}
 
 	public class CFunctionFromImage3D : CFunction
@@ -8737,6 +9063,22 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.convertInternalToStruct_Box (intresultOutbox);
 		}
 
+		public void GetBuildItemOutboxes (out sBox[] AOutboxes)
+		{
+			UInt64 sizeOutboxes = 0;
+			UInt64 neededOutboxes = 0;
+			CheckError(Internal.Lib3MFWrapper.Model_GetBuildItemOutboxes (Handle, sizeOutboxes, out neededOutboxes, IntPtr.Zero));
+			sizeOutboxes = neededOutboxes;
+			var arrayOutboxes = new Internal.InternalBox[sizeOutboxes];
+			GCHandle dataOutboxes = GCHandle.Alloc(arrayOutboxes, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Model_GetBuildItemOutboxes (Handle, sizeOutboxes, out neededOutboxes, dataOutboxes.AddrOfPinnedObject()));
+			dataOutboxes.Free();
+			AOutboxes = new sBox[sizeOutboxes];
+			for (int index = 0; index < AOutboxes.Length; index++)
+				AOutboxes[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Box(arrayOutboxes[index]);
+		}
+
 		public CResourceIterator GetResources ()
 		{
 			IntPtr newResourceIterator = IntPtr.Zero;
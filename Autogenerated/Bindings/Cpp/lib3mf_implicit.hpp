@@ -1027,12 +1027,26 @@ public:
 	inline void WriteToFile(const std::string & sFilename);
 	inline Lib3MF_uint64 GetStreamSize();
 	inline void WriteToBuffer(std::vector<Lib3MF_uint8> & BufferBuffer);
+	inline Lib3MF_uint64 WriteToInternalBuffer();
+	inline Lib3MF_uint64 GetInternalBufferAddress();
 	inline void WriteToCallback(const WriteCallback pTheWriteCallback, const SeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData);
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
 	inline Lib3MF_uint32 GetDecimalPrecision();
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetObjectThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetObjectThreadCount();
+	inline void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetSubModelThreadCount();
+	inline void SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetCompressionThreadCount();
+	inline void SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetModelCompressionLevel();
+	inline void SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetTextureCompressionLevel();
+	inline void SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetAttachmentCompressionLevel();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
@@ -1057,10 +1071,23 @@ public:
 	inline void ReadFromBuffer(const CInputVector<Lib3MF_uint8> & BufferBuffer);
 	inline void ReadFromCallback(const ReadCallback pTheReadCallback, const Lib3MF_uint64 nStreamSize, const SeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData);
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
+	inline void SetVertexStreamCallback(const VertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetTriangleStreamCallback(const TriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetBeamStreamCallback(const BeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetComponentStreamCallback(const ComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetBuildItemStreamCallback(const BuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData);
 	inline void AddRelationToRead(const std::string & sRelationShipType);
 	inline void RemoveRelationToRead(const std::string & sRelationShipType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetSubModelThreadCount();
+	inline void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive);
+	inline bool GetLazyMeshLoadingActive();
+	inline void SetBackgroundDecompressionActive(const bool bBackgroundDecompressionActive);
+	inline bool GetBackgroundDecompressionActive();
+	inline void SetLazyAttachmentLoadingActive(const bool bLazyAttachmentLoadingActive);
+	inline bool GetLazyAttachmentLoadingActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
@@ -1538,6 +1565,7 @@ public:
 	inline PMeshObject GetMesh();
 	inline PVolumeData GetVolumeData();
 	inline void SetVolumeData(classParam<CVolumeData> pTheVolumeData);
+	inline void SampleGrid(const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3025,6 +3053,7 @@ public:
 	inline void RemoveOutput(classParam<CImplicitPort> pOutput);
 	inline PImplicitPort FindInput(const std::string & sIdentifier);
 	inline PImplicitPort FindOutput(const std::string & sIdentifier);
+	inline void SampleGrid(const std::string & sOutputIdentifier, const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3099,6 +3128,7 @@ public:
 	inline void AddLinkByNames(const std::string & sSource, const std::string & sTarget);
 	inline void Clear();
 	inline void SortNodesTopologically();
+	inline void EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3400,6 +3430,7 @@ public:
 	inline void SetBuildUUID(const std::string & sUUID);
 	inline PBuildItemIterator GetBuildItems();
 	inline sBox GetOutbox();
+	inline void GetBuildItemOutboxes(std::vector<sBox> & OutboxesBuffer);
 	inline PResourceIterator GetResources();
 	inline PObjectIterator GetObjects();
 	inline PMeshObjectIterator GetMeshObjects();
@@ -3893,7 +3924,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 	}
 	
 	/**
-	* CWriter::GetStreamSize - Retrieves the size of the full 3MF file stream.
+	* CWriter::GetStreamSize - Retrieves the size of the full 3MF file stream..
 	* @return the stream size
 	*/
 	Lib3MF_uint64 CWriter::GetStreamSize()
@@ -3917,6 +3948,30 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_writer_writetobuffer(m_pHandle, elementsNeededBuffer, &elementsWrittenBuffer, BufferBuffer.data()));
 	}
 	
+	/**
+	* CWriter::WriteToInternalBuffer - Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+	* @return size of the written buffer in bytes
+	*/
+	Lib3MF_uint64 CWriter::WriteToInternalBuffer()
+	{
+		Lib3MF_uint64 resultBufferSize = 0;
+		CheckError(lib3mf_writer_writetointernalbuffer(m_pHandle, &resultBufferSize));
+		
+		return resultBufferSize;
+	}
+	
+	/**
+	* CWriter::GetInternalBufferAddress - Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+	* @return address of the first byte of the buffer
+	*/
+	Lib3MF_uint64 CWriter::GetInternalBufferAddress()
+	{
+		Lib3MF_uint64 resultBufferAddress = 0;
+		CheckError(lib3mf_writer_getinternalbufferaddress(m_pHandle, &resultBufferAddress));
+		
+		return resultBufferAddress;
+	}
+	
 	/**
 	* CWriter::WriteToCallback - Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 	* @param[in] pTheWriteCallback - Callback to call for writing a data chunk
@@ -3980,6 +4035,132 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CWriter::SetObjectThreadCount - Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+	* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetObjectThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_writer_setobjectthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetObjectThreadCount - Returns the number of threads used to format the XML of the objects of a model part.
+	* @return number of formatting threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetObjectThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_writer_getobjectthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetSubModelThreadCount - Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+	* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_writer_setsubmodelthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetSubModelThreadCount - Returns the number of threads used to write the non-root model parts of the production extension.
+	* @return number of writer threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetSubModelThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_writer_getsubmodelthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetCompressionThreadCount - Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+	* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_writer_setcompressionthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetCompressionThreadCount - Returns the number of threads used to deflate large parts of the package.
+	* @return number of compression threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetCompressionThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_writer_getcompressionthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetModelCompressionLevel - Sets the compression level of the model parts (root model and non-root models of the production extension).
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(lib3mf_writer_setmodelcompressionlevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetModelCompressionLevel - Returns the compression level of the model parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetModelCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(lib3mf_writer_getmodelcompressionlevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
+	/**
+	* CWriter::SetTextureCompressionLevel - Sets the compression level of textures and thumbnails.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(lib3mf_writer_settexturecompressionlevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetTextureCompressionLevel - Returns the compression level of the texture and thumbnail parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetTextureCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(lib3mf_writer_gettexturecompressionlevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
+	/**
+	* CWriter::SetAttachmentCompressionLevel - Sets the compression level of all other attachments.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(lib3mf_writer_setattachmentcompressionlevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetAttachmentCompressionLevel - Returns the compression level of the attachment parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetAttachmentCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(lib3mf_writer_getattachmentcompressionlevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
 	/**
 	* CWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -4075,6 +4256,56 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_reader_setprogresscallback(m_pHandle, pProgressCallback, pUserData));
 	}
 	
+	/**
+	* CReader::SetVertexStreamCallback - Streams the vertices of the next read to a callback
+	* @param[in] pVertexStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetVertexStreamCallback(const VertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_setvertexstreamcallback(m_pHandle, pVertexStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetTriangleStreamCallback - Streams the triangles of the next read to a callback
+	* @param[in] pTriangleStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetTriangleStreamCallback(const TriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_settrianglestreamcallback(m_pHandle, pTriangleStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetBeamStreamCallback - Streams the beams of the next read to a callback
+	* @param[in] pBeamStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetBeamStreamCallback(const BeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_setbeamstreamcallback(m_pHandle, pBeamStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetComponentStreamCallback - Streams the components of the next read to a callback
+	* @param[in] pComponentStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetComponentStreamCallback(const ComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_setcomponentstreamcallback(m_pHandle, pComponentStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetBuildItemStreamCallback - Streams the build items of the next read to a callback
+	* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetBuildItemStreamCallback(const BuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_setbuilditemstreamcallback(m_pHandle, pBuildItemStreamCallback, pUserData));
+	}
+	
 	/**
 	* CReader::AddRelationToRead - Adds a relationship type which shall be read as attachment in memory while loading
 	* @param[in] sRelationShipType - String of the relationship type
@@ -4114,6 +4345,90 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CReader::SetSubModelThreadCount - Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+	* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+	*/
+	void CReader::SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_reader_setsubmodelthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CReader::GetSubModelThreadCount - Returns the number of threads used to parse the non-root model parts of the production extension.
+	* @return number of parser threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CReader::GetSubModelThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_reader_getsubmodelthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CReader::SetLazyMeshLoadingActive - Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+	* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+	*/
+	void CReader::SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive)
+	{
+		CheckError(lib3mf_reader_setlazymeshloadingactive(m_pHandle, bLazyMeshLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyMeshLoadingActive - Queries whether mesh content is parsed on first access
+	* @return returns flag whether mesh content is parsed on first access.
+	*/
+	bool CReader::GetLazyMeshLoadingActive()
+	{
+		bool resultLazyMeshLoadingActive = 0;
+		CheckError(lib3mf_reader_getlazymeshloadingactive(m_pHandle, &resultLazyMeshLoadingActive));
+		
+		return resultLazyMeshLoadingActive;
+	}
+	
+	/**
+	* CReader::SetBackgroundDecompressionActive - Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+	* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+	*/
+	void CReader::SetBackgroundDecompressionActive(const bool bBackgroundDecompressionActive)
+	{
+		CheckError(lib3mf_reader_setbackgrounddecompressionactive(m_pHandle, bBackgroundDecompressionActive));
+	}
+	
+	/**
+	* CReader::GetBackgroundDecompressionActive - Queries whether the root model part is decompressed on a background thread
+	* @return returns flag whether the root model part is decompressed on a background thread.
+	*/
+	bool CReader::GetBackgroundDecompressionActive()
+	{
+		bool resultBackgroundDecompressionActive = 0;
+		CheckError(lib3mf_reader_getbackgrounddecompressionactive(m_pHandle, &resultBackgroundDecompressionActive));
+		
+		return resultBackgroundDecompressionActive;
+	}
+	
+	/**
+	* CReader::SetLazyAttachmentLoadingActive - Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+	* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+	*/
+	void CReader::SetLazyAttachmentLoadingActive(const bool bLazyAttachmentLoadingActive)
+	{
+		CheckError(lib3mf_reader_setlazyattachmentloadingactive(m_pHandle, bLazyAttachmentLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyAttachmentLoadingActive - Queries whether attachments are decompressed on first access
+	* @return returns flag whether attachments are decompressed on first access.
+	*/
+	bool CReader::GetLazyAttachmentLoadingActive()
+	{
+		bool resultLazyAttachmentLoadingActive = 0;
+		CheckError(lib3mf_reader_getlazyattachmentloadingactive(m_pHandle, &resultLazyAttachmentLoadingActive));
+		
+		return resultLazyAttachmentLoadingActive;
+	}
+	
 	/**
 	* CReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -5748,6 +6063,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_levelset_setvolumedata(m_pHandle, hTheVolumeData));
 	}
 	
+	/**
+	* CLevelSet::SampleGrid - Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[out] ValuesBuffer - value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	void CLevelSet::SampleGrid(const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededValues = 0;
+		Lib3MF_uint64 elementsWrittenValues = 0;
+		CheckError(lib3mf_levelset_samplegrid(m_pHandle, &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, 0, &elementsNeededValues, nullptr));
+		ValuesBuffer.resize((size_t) elementsNeededValues);
+		CheckError(lib3mf_levelset_samplegrid(m_pHandle, &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, elementsNeededValues, &elementsWrittenValues, ValuesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CBeamLattice
 	 */
@@ -9152,6 +9487,27 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CImplicitPort>(dynamic_cast<CImplicitPort*>(m_pWrapper->polymorphicFactory(hOutput)));
 	}
 	
+	/**
+	* CFunction::SampleGrid - Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+	* @param[in] sOutputIdentifier - the identifier of the scalar output to sample
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[out] ValuesBuffer - value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	void CFunction::SampleGrid(const std::string & sOutputIdentifier, const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededValues = 0;
+		Lib3MF_uint64 elementsWrittenValues = 0;
+		CheckError(lib3mf_function_samplegrid(m_pHandle, sOutputIdentifier.c_str(), &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, 0, &elementsNeededValues, nullptr));
+		ValuesBuffer.resize((size_t) elementsNeededValues);
+		CheckError(lib3mf_function_samplegrid(m_pHandle, sOutputIdentifier.c_str(), &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, elementsNeededValues, &elementsWrittenValues, ValuesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CImplicitFunction
 	 */
@@ -10176,6 +10532,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_implicitfunction_sortnodestopologically(m_pHandle));
 	}
 	
+	/**
+	* CImplicitFunction::EvaluateBatch - Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+	* @param[in] InputsBuffer - Input values of all points. The count MUST be a multiple of the component count of all inputs.
+	* @param[out] OutputsBuffer - Output values of all points.
+	*/
+	void CImplicitFunction::EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 nInputsSize = InputsBuffer.size();
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(lib3mf_implicitfunction_evaluatebatch(m_pHandle, nInputsSize, InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(lib3mf_implicitfunction_evaluatebatch(m_pHandle, nInputsSize, InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CFunctionFromImage3D
 	 */
@@ -11682,6 +12053,19 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultOutbox;
 	}
 	
+	/**
+	* CModel::GetBuildItemOutboxes - Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+	* @param[out] OutboxesBuffer - contains the outbox of each build item.
+	*/
+	void CModel::GetBuildItemOutboxes(std::vector<sBox> & OutboxesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutboxes = 0;
+		Lib3MF_uint64 elementsWrittenOutboxes = 0;
+		CheckError(lib3mf_model_getbuilditemoutboxes(m_pHandle, 0, &elementsNeededOutboxes, nullptr));
+		OutboxesBuffer.resize((size_t) elementsNeededOutboxes);
+		CheckError(lib3mf_model_getbuilditemoutboxes(m_pHandle, elementsNeededOutboxes, &elementsWrittenOutboxes, OutboxesBuffer.data()));
+	}
+	
 	/**
 	* CModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
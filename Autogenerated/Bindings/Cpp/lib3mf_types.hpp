@@ -423,7 +423,8 @@ namespace Lib3MF {
     WRITENODES = 20,
     WRITETRIANGLES = 21,
     WRITESLICES = 22,
-    WRITEKEYSTORE = 23
+    WRITEKEYSTORE = 23,
+    SAMPLEGRID = 24
   };
   
   enum class eBlendMethod : Lib3MF_int32 {
@@ -680,6 +681,55 @@ namespace Lib3MF {
   */
   typedef void(*RandomNumberCallback)(Lib3MF_uint64, Lib3MF_uint64, Lib3MF_pvoid, Lib3MF_uint64 *);
   
+  /**
+  * VertexStreamCallback - Callback to receive a batch of vertices while streaming a mesh object
+  *
+  * @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the vertices belong to
+  * @param[in] nVertexCount - Number of vertices in the batch
+  * @param[in] nVertexData - Pointer to an array of VertexCount Position structs
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*VertexStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+  
+  /**
+  * TriangleStreamCallback - Callback to receive a batch of triangles while streaming a mesh object
+  *
+  * @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the triangles belong to
+  * @param[in] nTriangleCount - Number of triangles in the batch
+  * @param[in] nTriangleData - Pointer to an array of TriangleCount Triangle structs
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*TriangleStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+  
+  /**
+  * BeamStreamCallback - Callback to receive a batch of beams while streaming a mesh object
+  *
+  * @param[in] nObjectUniqueID - UniqueResourceID of the mesh object the beams belong to
+  * @param[in] nBeamCount - Number of beams in the batch
+  * @param[in] nBeamData - Pointer to an array of BeamCount Beam structs
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*BeamStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+  
+  /**
+  * ComponentStreamCallback - Callback to receive a component while streaming a components object
+  *
+  * @param[in] nObjectUniqueID - UniqueResourceID of the components object
+  * @param[in] nComponentObjectUniqueID - UniqueResourceID of the referenced object
+  * @param[in] nTransformData - Pointer to the Transform struct of the component
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*ComponentStreamCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+  
+  /**
+  * BuildItemStreamCallback - Callback to receive a build item while streaming a model
+  *
+  * @param[in] nObjectUniqueID - UniqueResourceID of the referenced object
+  * @param[in] nTransformData - Pointer to the Transform struct of the build item
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*BuildItemStreamCallback)(Lib3MF_uint32, Lib3MF_uint64, Lib3MF_pvoid);
+  
   /**
   * KeyWrappingCallback - A callback used to wrap (encrypt) the content key available in keystore resource group
   *
@@ -753,6 +803,11 @@ typedef Lib3MF::WriteCallback Lib3MFWriteCallback;
 typedef Lib3MF::ReadCallback Lib3MFReadCallback;
 typedef Lib3MF::SeekCallback Lib3MFSeekCallback;
 typedef Lib3MF::RandomNumberCallback Lib3MFRandomNumberCallback;
+typedef Lib3MF::VertexStreamCallback Lib3MFVertexStreamCallback;
+typedef Lib3MF::TriangleStreamCallback Lib3MFTriangleStreamCallback;
+typedef Lib3MF::BeamStreamCallback Lib3MFBeamStreamCallback;
+typedef Lib3MF::ComponentStreamCallback Lib3MFComponentStreamCallback;
+typedef Lib3MF::BuildItemStreamCallback Lib3MFBuildItemStreamCallback;
 typedef Lib3MF::KeyWrappingCallback Lib3MFKeyWrappingCallback;
 typedef Lib3MF::ContentEncryptionCallback Lib3MFContentEncryptionCallback;
 
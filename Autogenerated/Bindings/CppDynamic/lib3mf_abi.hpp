@@ -69,7 +69,7 @@ extern "C" {
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetofile(Lib3MF_Writer pWriter, const char * pFilename);
 
 /**
-* Retrieves the size of the full 3MF file stream.
+* Retrieves the size of the full 3MF file stream..
 *
 * @param[in] pWriter - Writer instance.
 * @param[out] pStreamSize - the stream size
@@ -88,6 +88,24 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstreamsize(Lib3MF_Writer pWriter,
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetobuffer(Lib3MF_Writer pWriter, const Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer);
 
+/**
+* Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferSize - size of the written buffer in bytes
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_writetointernalbuffer(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferSize);
+
+/**
+* Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferAddress - address of the first byte of the buffer
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getinternalbufferaddress(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferAddress);
+
 /**
 * Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 *
@@ -145,6 +163,114 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setstrictmodeactive(Lib3MF_Writer pWr
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstrictmodeactive(Lib3MF_Writer pWriter, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to format the XML of the objects of a model part.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of formatting threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to write the non-root model parts of the production extension.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of writer threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to deflate large parts of the package.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of compression threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the compression level of the model parts (root model and non-root models of the production extension).
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the model parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of textures and thumbnails.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_settexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the texture and thumbnail parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_gettexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of all other attachments.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the attachment parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -233,6 +359,56 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_readfromcallback(Lib3MF_Reader pReade
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setprogresscallback(Lib3MF_Reader pReader, Lib3MF::ProgressCallback pProgressCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Streams the vertices of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pVertexStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setvertexstreamcallback(Lib3MF_Reader pReader, Lib3MF::VertexStreamCallback pVertexStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the triangles of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pTriangleStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_settrianglestreamcallback(Lib3MF_Reader pReader, Lib3MF::TriangleStreamCallback pTriangleStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the beams of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBeamStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbeamstreamcallback(Lib3MF_Reader pReader, Lib3MF::BeamStreamCallback pBeamStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the components of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pComponentStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setcomponentstreamcallback(Lib3MF_Reader pReader, Lib3MF::ComponentStreamCallback pComponentStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the build items of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbuilditemstreamcallback(Lib3MF_Reader pReader, Lib3MF::BuildItemStreamCallback pBuildItemStreamCallback, Lib3MF_pvoid pUserData);
+
 /**
 * Adds a relationship type which shall be read as attachment in memory while loading
 *
@@ -269,6 +445,78 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pRe
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to parse the non-root model parts of the production extension.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pThreadCount - number of parser threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setlazymeshloadingactive(Lib3MF_Reader pReader, bool bLazyMeshLoadingActive);
+
+/**
+* Queries whether mesh content is parsed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyMeshLoadingActive - returns flag whether mesh content is parsed on first access.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getlazymeshloadingactive(Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive);
+
+/**
+* Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setbackgrounddecompressionactive(Lib3MF_Reader pReader, bool bBackgroundDecompressionActive);
+
+/**
+* Queries whether the root model part is decompressed on a background thread
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pBackgroundDecompressionActive - returns flag whether the root model part is decompressed on a background thread.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getbackgrounddecompressionactive(Lib3MF_Reader pReader, bool * pBackgroundDecompressionActive);
+
+/**
+* Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setlazyattachmentloadingactive(Lib3MF_Reader pReader, bool bLazyAttachmentLoadingActive);
+
+/**
+* Queries whether attachments are decompressed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyAttachmentLoadingActive - returns flag whether attachments are decompressed on first access.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getlazyattachmentloadingactive(Lib3MF_Reader pReader, bool * pLazyAttachmentLoadingActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -4256,6 +4504,17 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getbuilditems(Lib3MF_Model pModel, Lib
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getoutbox(Lib3MF_Model pModel, Lib3MF::sBox * pOutbox);
 
+/**
+* Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+*
+* @param[in] pModel - Model instance.
+* @param[in] nOutboxesBufferSize - Number of elements in buffer
+* @param[out] pOutboxesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutboxesBuffer - Box  buffer of contains the outbox of each build item.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getbuilditemoutboxes(Lib3MF_Model pModel, const Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, Lib3MF::sBox * pOutboxesBuffer);
+
 /**
 * creates a resource iterator instance with all resources.
 *
@@ -67,7 +67,7 @@ typedef Lib3MFResult (*PLib3MFBase_ClassTypeIdPtr) (Lib3MF_Base pBase, Lib3MF_ui
 typedef Lib3MFResult (*PLib3MFWriter_WriteToFilePtr) (Lib3MF_Writer pWriter, const char * pFilename);
 
 /**
-* Retrieves the size of the full 3MF file stream.
+* Retrieves the size of the full 3MF file stream..
 *
 * @param[in] pWriter - Writer instance.
 * @param[out] pStreamSize - the stream size
@@ -86,6 +86,24 @@ typedef Lib3MFResult (*PLib3MFWriter_GetStreamSizePtr) (Lib3MF_Writer pWriter, L
 */
 typedef Lib3MFResult (*PLib3MFWriter_WriteToBufferPtr) (Lib3MF_Writer pWriter, const Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer);
 
+/**
+* Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferSize - size of the written buffer in bytes
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_WriteToInternalBufferPtr) (Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferSize);
+
+/**
+* Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pBufferAddress - address of the first byte of the buffer
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetInternalBufferAddressPtr) (Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferAddress);
+
 /**
 * Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 *
@@ -143,6 +161,114 @@ typedef Lib3MFResult (*PLib3MFWriter_SetStrictModeActivePtr) (Lib3MF_Writer pWri
 */
 typedef Lib3MFResult (*PLib3MFWriter_GetStrictModeActivePtr) (Lib3MF_Writer pWriter, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetObjectThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to format the XML of the objects of a model part.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of formatting threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetObjectThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetSubModelThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to write the non-root model parts of the production extension.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of writer threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetSubModelThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetCompressionThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to deflate large parts of the package.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - number of compression threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetCompressionThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the compression level of the model parts (root model and non-root models of the production extension).
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetModelCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the model parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetModelCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of textures and thumbnails.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetTextureCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the texture and thumbnail parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetTextureCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level of all other attachments.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetAttachmentCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel);
+
+/**
+* Returns the compression level of the attachment parts.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetAttachmentCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -231,6 +357,56 @@ typedef Lib3MFResult (*PLib3MFReader_ReadFromCallbackPtr) (Lib3MF_Reader pReader
 */
 typedef Lib3MFResult (*PLib3MFReader_SetProgressCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::ProgressCallback pProgressCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Streams the vertices of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pVertexStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetVertexStreamCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::VertexStreamCallback pVertexStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the triangles of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pTriangleStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetTriangleStreamCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::TriangleStreamCallback pTriangleStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the beams of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBeamStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetBeamStreamCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::BeamStreamCallback pBeamStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the components of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pComponentStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetComponentStreamCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::ComponentStreamCallback pComponentStreamCallback, Lib3MF_pvoid pUserData);
+
+/**
+* Streams the build items of the next read to a callback
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetBuildItemStreamCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::BuildItemStreamCallback pBuildItemStreamCallback, Lib3MF_pvoid pUserData);
+
 /**
 * Adds a relationship type which shall be read as attachment in memory while loading
 *
@@ -267,6 +443,78 @@ typedef Lib3MFResult (*PLib3MFReader_SetStrictModeActivePtr) (Lib3MF_Reader pRea
 */
 typedef Lib3MFResult (*PLib3MFReader_GetStrictModeActivePtr) (Lib3MF_Reader pReader, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetSubModelThreadCountPtr) (Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used to parse the non-root model parts of the production extension.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pThreadCount - number of parser threads. 0 means all available hardware threads.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetSubModelThreadCountPtr) (Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetLazyMeshLoadingActivePtr) (Lib3MF_Reader pReader, bool bLazyMeshLoadingActive);
+
+/**
+* Queries whether mesh content is parsed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyMeshLoadingActive - returns flag whether mesh content is parsed on first access.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetLazyMeshLoadingActivePtr) (Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive);
+
+/**
+* Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetBackgroundDecompressionActivePtr) (Lib3MF_Reader pReader, bool bBackgroundDecompressionActive);
+
+/**
+* Queries whether the root model part is decompressed on a background thread
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pBackgroundDecompressionActive - returns flag whether the root model part is decompressed on a background thread.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetBackgroundDecompressionActivePtr) (Lib3MF_Reader pReader, bool * pBackgroundDecompressionActive);
+
+/**
+* Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetLazyAttachmentLoadingActivePtr) (Lib3MF_Reader pReader, bool bLazyAttachmentLoadingActive);
+
+/**
+* Queries whether attachments are decompressed on first access
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyAttachmentLoadingActive - returns flag whether attachments are decompressed on first access.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetLazyAttachmentLoadingActivePtr) (Lib3MF_Reader pReader, bool * pLazyAttachmentLoadingActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -1548,6 +1796,24 @@ typedef Lib3MFResult (*PLib3MFLevelSet_GetVolumeDataPtr) (Lib3MF_LevelSet pLevel
 */
 typedef Lib3MFResult (*PLib3MFLevelSet_SetVolumeDataPtr) (Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData pTheVolumeData);
 
+/**
+* Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+*
+* @param[in] pLevelSet - LevelSet instance.
+* @param[in] pOrigin - position of the first grid point
+* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+* @param[in] nCountX - number of grid points along x
+* @param[in] nCountY - number of grid points along y
+* @param[in] nCountZ - number of grid points along z
+* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - single  buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFLevelSet_SampleGridPtr) (Lib3MF_LevelSet pLevelSet, const Lib3MF::sVector * pOrigin, const Lib3MF::sVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer);
+
 /*************************************************************************************************************************
  Class definition for BeamLattice
 **************************************************************************************************************************/
@@ -4143,6 +4409,25 @@ typedef Lib3MFResult (*PLib3MFFunction_FindInputPtr) (Lib3MF_Function pFunction,
 */
 typedef Lib3MFResult (*PLib3MFFunction_FindOutputPtr) (Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput);
 
+/**
+* Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+*
+* @param[in] pFunction - Function instance.
+* @param[in] pOutputIdentifier - the identifier of the scalar output to sample
+* @param[in] pOrigin - position of the first grid point
+* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+* @param[in] nCountX - number of grid points along x
+* @param[in] nCountY - number of grid points along y
+* @param[in] nCountZ - number of grid points along z
+* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - single  buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFFunction_SampleGridPtr) (Lib3MF_Function pFunction, const char * pOutputIdentifier, const Lib3MF::sVector * pOrigin, const Lib3MF::sVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer);
+
 /*************************************************************************************************************************
  Class definition for ImplicitFunction
 **************************************************************************************************************************/
@@ -4854,6 +5139,19 @@ typedef Lib3MFResult (*PLib3MFImplicitFunction_ClearPtr) (Lib3MF_ImplicitFunctio
 */
 typedef Lib3MFResult (*PLib3MFImplicitFunction_SortNodesTopologicallyPtr) (Lib3MF_ImplicitFunction pImplicitFunction);
 
+/**
+* Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+*
+* @param[in] pImplicitFunction - ImplicitFunction instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of Input values of all points. The count MUST be a multiple of the component count of all inputs.
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double  buffer of Output values of all points.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitFunction_EvaluateBatchPtr) (Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
 /*************************************************************************************************************************
  Class definition for FunctionFromImage3D
 **************************************************************************************************************************/
@@ -5971,6 +6269,17 @@ typedef Lib3MFResult (*PLib3MFModel_GetBuildItemsPtr) (Lib3MF_Model pModel, Lib3
 */
 typedef Lib3MFResult (*PLib3MFModel_GetOutboxPtr) (Lib3MF_Model pModel, Lib3MF::sBox * pOutbox);
 
+/**
+* Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+*
+* @param[in] pModel - Model instance.
+* @param[in] nOutboxesBufferSize - Number of elements in buffer
+* @param[out] pOutboxesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutboxesBuffer - Box  buffer of contains the outbox of each build item.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFModel_GetBuildItemOutboxesPtr) (Lib3MF_Model pModel, const Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, Lib3MF::sBox * pOutboxesBuffer);
+
 /**
 * creates a resource iterator instance with all resources.
 *
@@ -6627,12 +6936,26 @@ typedef struct {
 	PLib3MFWriter_WriteToFilePtr m_Writer_WriteToFile;
 	PLib3MFWriter_GetStreamSizePtr m_Writer_GetStreamSize;
 	PLib3MFWriter_WriteToBufferPtr m_Writer_WriteToBuffer;
+	PLib3MFWriter_WriteToInternalBufferPtr m_Writer_WriteToInternalBuffer;
+	PLib3MFWriter_GetInternalBufferAddressPtr m_Writer_GetInternalBufferAddress;
 	PLib3MFWriter_WriteToCallbackPtr m_Writer_WriteToCallback;
 	PLib3MFWriter_SetProgressCallbackPtr m_Writer_SetProgressCallback;
 	PLib3MFWriter_GetDecimalPrecisionPtr m_Writer_GetDecimalPrecision;
 	PLib3MFWriter_SetDecimalPrecisionPtr m_Writer_SetDecimalPrecision;
 	PLib3MFWriter_SetStrictModeActivePtr m_Writer_SetStrictModeActive;
 	PLib3MFWriter_GetStrictModeActivePtr m_Writer_GetStrictModeActive;
+	PLib3MFWriter_SetObjectThreadCountPtr m_Writer_SetObjectThreadCount;
+	PLib3MFWriter_GetObjectThreadCountPtr m_Writer_GetObjectThreadCount;
+	PLib3MFWriter_SetSubModelThreadCountPtr m_Writer_SetSubModelThreadCount;
+	PLib3MFWriter_GetSubModelThreadCountPtr m_Writer_GetSubModelThreadCount;
+	PLib3MFWriter_SetCompressionThreadCountPtr m_Writer_SetCompressionThreadCount;
+	PLib3MFWriter_GetCompressionThreadCountPtr m_Writer_GetCompressionThreadCount;
+	PLib3MFWriter_SetModelCompressionLevelPtr m_Writer_SetModelCompressionLevel;
+	PLib3MFWriter_GetModelCompressionLevelPtr m_Writer_GetModelCompressionLevel;
+	PLib3MFWriter_SetTextureCompressionLevelPtr m_Writer_SetTextureCompressionLevel;
+	PLib3MFWriter_GetTextureCompressionLevelPtr m_Writer_GetTextureCompressionLevel;
+	PLib3MFWriter_SetAttachmentCompressionLevelPtr m_Writer_SetAttachmentCompressionLevel;
+	PLib3MFWriter_GetAttachmentCompressionLevelPtr m_Writer_GetAttachmentCompressionLevel;
 	PLib3MFWriter_GetWarningPtr m_Writer_GetWarning;
 	PLib3MFWriter_GetWarningCountPtr m_Writer_GetWarningCount;
 	PLib3MFWriter_AddKeyWrappingCallbackPtr m_Writer_AddKeyWrappingCallback;
@@ -6641,10 +6964,23 @@ typedef struct {
 	PLib3MFReader_ReadFromBufferPtr m_Reader_ReadFromBuffer;
 	PLib3MFReader_ReadFromCallbackPtr m_Reader_ReadFromCallback;
 	PLib3MFReader_SetProgressCallbackPtr m_Reader_SetProgressCallback;
+	PLib3MFReader_SetVertexStreamCallbackPtr m_Reader_SetVertexStreamCallback;
+	PLib3MFReader_SetTriangleStreamCallbackPtr m_Reader_SetTriangleStreamCallback;
+	PLib3MFReader_SetBeamStreamCallbackPtr m_Reader_SetBeamStreamCallback;
+	PLib3MFReader_SetComponentStreamCallbackPtr m_Reader_SetComponentStreamCallback;
+	PLib3MFReader_SetBuildItemStreamCallbackPtr m_Reader_SetBuildItemStreamCallback;
 	PLib3MFReader_AddRelationToReadPtr m_Reader_AddRelationToRead;
 	PLib3MFReader_RemoveRelationToReadPtr m_Reader_RemoveRelationToRead;
 	PLib3MFReader_SetStrictModeActivePtr m_Reader_SetStrictModeActive;
 	PLib3MFReader_GetStrictModeActivePtr m_Reader_GetStrictModeActive;
+	PLib3MFReader_SetSubModelThreadCountPtr m_Reader_SetSubModelThreadCount;
+	PLib3MFReader_GetSubModelThreadCountPtr m_Reader_GetSubModelThreadCount;
+	PLib3MFReader_SetLazyMeshLoadingActivePtr m_Reader_SetLazyMeshLoadingActive;
+	PLib3MFReader_GetLazyMeshLoadingActivePtr m_Reader_GetLazyMeshLoadingActive;
+	PLib3MFReader_SetBackgroundDecompressionActivePtr m_Reader_SetBackgroundDecompressionActive;
+	PLib3MFReader_GetBackgroundDecompressionActivePtr m_Reader_GetBackgroundDecompressionActive;
+	PLib3MFReader_SetLazyAttachmentLoadingActivePtr m_Reader_SetLazyAttachmentLoadingActive;
+	PLib3MFReader_GetLazyAttachmentLoadingActivePtr m_Reader_GetLazyAttachmentLoadingActive;
 	PLib3MFReader_GetWarningPtr m_Reader_GetWarning;
 	PLib3MFReader_GetWarningCountPtr m_Reader_GetWarningCount;
 	PLib3MFReader_AddKeyWrappingCallbackPtr m_Reader_AddKeyWrappingCallback;
@@ -6770,6 +7106,7 @@ typedef struct {
 	PLib3MFLevelSet_GetMeshPtr m_LevelSet_GetMesh;
 	PLib3MFLevelSet_GetVolumeDataPtr m_LevelSet_GetVolumeData;
 	PLib3MFLevelSet_SetVolumeDataPtr m_LevelSet_SetVolumeData;
+	PLib3MFLevelSet_SampleGridPtr m_LevelSet_SampleGrid;
 	PLib3MFBeamLattice_GetMinLengthPtr m_BeamLattice_GetMinLength;
 	PLib3MFBeamLattice_SetMinLengthPtr m_BeamLattice_SetMinLength;
 	PLib3MFBeamLattice_GetClippingPtr m_BeamLattice_GetClipping;
@@ -7009,6 +7346,7 @@ typedef struct {
 	PLib3MFFunction_RemoveOutputPtr m_Function_RemoveOutput;
 	PLib3MFFunction_FindInputPtr m_Function_FindInput;
 	PLib3MFFunction_FindOutputPtr m_Function_FindOutput;
+	PLib3MFFunction_SampleGridPtr m_Function_SampleGrid;
 	PLib3MFImplicitFunction_GetIdentifierPtr m_ImplicitFunction_GetIdentifier;
 	PLib3MFImplicitFunction_SetIdentifierPtr m_ImplicitFunction_SetIdentifier;
 	PLib3MFImplicitFunction_AddNodePtr m_ImplicitFunction_AddNode;
@@ -7067,6 +7405,7 @@ typedef struct {
 	PLib3MFImplicitFunction_AddLinkByNamesPtr m_ImplicitFunction_AddLinkByNames;
 	PLib3MFImplicitFunction_ClearPtr m_ImplicitFunction_Clear;
 	PLib3MFImplicitFunction_SortNodesTopologicallyPtr m_ImplicitFunction_SortNodesTopologically;
+	PLib3MFImplicitFunction_EvaluateBatchPtr m_ImplicitFunction_EvaluateBatch;
 	PLib3MFFunctionFromImage3D_GetImage3DPtr m_FunctionFromImage3D_GetImage3D;
 	PLib3MFFunctionFromImage3D_SetImage3DPtr m_FunctionFromImage3D_SetImage3D;
 	PLib3MFFunctionFromImage3D_SetFilterPtr m_FunctionFromImage3D_SetFilter;
@@ -7176,6 +7515,7 @@ typedef struct {
 	PLib3MFModel_SetBuildUUIDPtr m_Model_SetBuildUUID;
 	PLib3MFModel_GetBuildItemsPtr m_Model_GetBuildItems;
 	PLib3MFModel_GetOutboxPtr m_Model_GetOutbox;
+	PLib3MFModel_GetBuildItemOutboxesPtr m_Model_GetBuildItemOutboxes;
 	PLib3MFModel_GetResourcesPtr m_Model_GetResources;
 	PLib3MFModel_GetObjectsPtr m_Model_GetObjects;
 	PLib3MFModel_GetMeshObjectsPtr m_Model_GetMeshObjects;
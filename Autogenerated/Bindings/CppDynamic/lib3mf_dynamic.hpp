@@ -1051,12 +1051,26 @@ public:
 	inline void WriteToFile(const std::string & sFilename);
 	inline Lib3MF_uint64 GetStreamSize();
 	inline void WriteToBuffer(std::vector<Lib3MF_uint8> & BufferBuffer);
+	inline Lib3MF_uint64 WriteToInternalBuffer();
+	inline Lib3MF_uint64 GetInternalBufferAddress();
 	inline void WriteToCallback(const WriteCallback pTheWriteCallback, const SeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData);
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
 	inline Lib3MF_uint32 GetDecimalPrecision();
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetObjectThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetObjectThreadCount();
+	inline void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetSubModelThreadCount();
+	inline void SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetCompressionThreadCount();
+	inline void SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetModelCompressionLevel();
+	inline void SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetTextureCompressionLevel();
+	inline void SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel);
+	inline Lib3MF_uint32 GetAttachmentCompressionLevel();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
@@ -1081,10 +1095,23 @@ public:
 	inline void ReadFromBuffer(const CInputVector<Lib3MF_uint8> & BufferBuffer);
 	inline void ReadFromCallback(const ReadCallback pTheReadCallback, const Lib3MF_uint64 nStreamSize, const SeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData);
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
+	inline void SetVertexStreamCallback(const VertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetTriangleStreamCallback(const TriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetBeamStreamCallback(const BeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetComponentStreamCallback(const ComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData);
+	inline void SetBuildItemStreamCallback(const BuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData);
 	inline void AddRelationToRead(const std::string & sRelationShipType);
 	inline void RemoveRelationToRead(const std::string & sRelationShipType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetSubModelThreadCount();
+	inline void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive);
+	inline bool GetLazyMeshLoadingActive();
+	inline void SetBackgroundDecompressionActive(const bool bBackgroundDecompressionActive);
+	inline bool GetBackgroundDecompressionActive();
+	inline void SetLazyAttachmentLoadingActive(const bool bLazyAttachmentLoadingActive);
+	inline bool GetLazyAttachmentLoadingActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
@@ -1562,6 +1589,7 @@ public:
 	inline PMeshObject GetMesh();
 	inline PVolumeData GetVolumeData();
 	inline void SetVolumeData(classParam<CVolumeData> pTheVolumeData);
+	inline void SampleGrid(const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3049,6 +3077,7 @@ public:
 	inline void RemoveOutput(classParam<CImplicitPort> pOutput);
 	inline PImplicitPort FindInput(const std::string & sIdentifier);
 	inline PImplicitPort FindOutput(const std::string & sIdentifier);
+	inline void SampleGrid(const std::string & sOutputIdentifier, const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3123,6 +3152,7 @@ public:
 	inline void AddLinkByNames(const std::string & sSource, const std::string & sTarget);
 	inline void Clear();
 	inline void SortNodesTopologically();
+	inline void EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3424,6 +3454,7 @@ public:
 	inline void SetBuildUUID(const std::string & sUUID);
 	inline PBuildItemIterator GetBuildItems();
 	inline sBox GetOutbox();
+	inline void GetBuildItemOutboxes(std::vector<sBox> & OutboxesBuffer);
 	inline PResourceIterator GetResources();
 	inline PObjectIterator GetObjects();
 	inline PMeshObjectIterator GetMeshObjects();
@@ -3896,12 +3927,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Writer_WriteToFile = nullptr;
 		pWrapperTable->m_Writer_GetStreamSize = nullptr;
 		pWrapperTable->m_Writer_WriteToBuffer = nullptr;
+		pWrapperTable->m_Writer_WriteToInternalBuffer = nullptr;
+		pWrapperTable->m_Writer_GetInternalBufferAddress = nullptr;
 		pWrapperTable->m_Writer_WriteToCallback = nullptr;
 		pWrapperTable->m_Writer_SetProgressCallback = nullptr;
 		pWrapperTable->m_Writer_GetDecimalPrecision = nullptr;
 		pWrapperTable->m_Writer_SetDecimalPrecision = nullptr;
 		pWrapperTable->m_Writer_SetStrictModeActive = nullptr;
 		pWrapperTable->m_Writer_GetStrictModeActive = nullptr;
+		pWrapperTable->m_Writer_SetObjectThreadCount = nullptr;
+		pWrapperTable->m_Writer_GetObjectThreadCount = nullptr;
+		pWrapperTable->m_Writer_SetSubModelThreadCount = nullptr;
+		pWrapperTable->m_Writer_GetSubModelThreadCount = nullptr;
+		pWrapperTable->m_Writer_SetCompressionThreadCount = nullptr;
+		pWrapperTable->m_Writer_GetCompressionThreadCount = nullptr;
+		pWrapperTable->m_Writer_SetModelCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_GetModelCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_SetTextureCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_GetTextureCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_SetAttachmentCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_GetAttachmentCompressionLevel = nullptr;
 		pWrapperTable->m_Writer_GetWarning = nullptr;
 		pWrapperTable->m_Writer_GetWarningCount = nullptr;
 		pWrapperTable->m_Writer_AddKeyWrappingCallback = nullptr;
@@ -3910,10 +3955,23 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Reader_ReadFromBuffer = nullptr;
 		pWrapperTable->m_Reader_ReadFromCallback = nullptr;
 		pWrapperTable->m_Reader_SetProgressCallback = nullptr;
+		pWrapperTable->m_Reader_SetVertexStreamCallback = nullptr;
+		pWrapperTable->m_Reader_SetTriangleStreamCallback = nullptr;
+		pWrapperTable->m_Reader_SetBeamStreamCallback = nullptr;
+		pWrapperTable->m_Reader_SetComponentStreamCallback = nullptr;
+		pWrapperTable->m_Reader_SetBuildItemStreamCallback = nullptr;
 		pWrapperTable->m_Reader_AddRelationToRead = nullptr;
 		pWrapperTable->m_Reader_RemoveRelationToRead = nullptr;
 		pWrapperTable->m_Reader_SetStrictModeActive = nullptr;
 		pWrapperTable->m_Reader_GetStrictModeActive = nullptr;
+		pWrapperTable->m_Reader_SetSubModelThreadCount = nullptr;
+		pWrapperTable->m_Reader_GetSubModelThreadCount = nullptr;
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = nullptr;
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = nullptr;
+		pWrapperTable->m_Reader_SetBackgroundDecompressionActive = nullptr;
+		pWrapperTable->m_Reader_GetBackgroundDecompressionActive = nullptr;
+		pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = nullptr;
+		pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = nullptr;
 		pWrapperTable->m_Reader_GetWarning = nullptr;
 		pWrapperTable->m_Reader_GetWarningCount = nullptr;
 		pWrapperTable->m_Reader_AddKeyWrappingCallback = nullptr;
@@ -4039,6 +4097,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_LevelSet_GetMesh = nullptr;
 		pWrapperTable->m_LevelSet_GetVolumeData = nullptr;
 		pWrapperTable->m_LevelSet_SetVolumeData = nullptr;
+		pWrapperTable->m_LevelSet_SampleGrid = nullptr;
 		pWrapperTable->m_BeamLattice_GetMinLength = nullptr;
 		pWrapperTable->m_BeamLattice_SetMinLength = nullptr;
 		pWrapperTable->m_BeamLattice_GetClipping = nullptr;
@@ -4278,6 +4337,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Function_RemoveOutput = nullptr;
 		pWrapperTable->m_Function_FindInput = nullptr;
 		pWrapperTable->m_Function_FindOutput = nullptr;
+		pWrapperTable->m_Function_SampleGrid = nullptr;
 		pWrapperTable->m_ImplicitFunction_GetIdentifier = nullptr;
 		pWrapperTable->m_ImplicitFunction_SetIdentifier = nullptr;
 		pWrapperTable->m_ImplicitFunction_AddNode = nullptr;
@@ -4336,6 +4396,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_ImplicitFunction_AddLinkByNames = nullptr;
 		pWrapperTable->m_ImplicitFunction_Clear = nullptr;
 		pWrapperTable->m_ImplicitFunction_SortNodesTopologically = nullptr;
+		pWrapperTable->m_ImplicitFunction_EvaluateBatch = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_GetImage3D = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_SetImage3D = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_SetFilter = nullptr;
@@ -4445,6 +4506,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Model_SetBuildUUID = nullptr;
 		pWrapperTable->m_Model_GetBuildItems = nullptr;
 		pWrapperTable->m_Model_GetOutbox = nullptr;
+		pWrapperTable->m_Model_GetBuildItemOutboxes = nullptr;
 		pWrapperTable->m_Model_GetResources = nullptr;
 		pWrapperTable->m_Model_GetObjects = nullptr;
 		pWrapperTable->m_Model_GetMeshObjects = nullptr;
@@ -4598,6 +4660,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Writer_WriteToBuffer == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_WriteToInternalBuffer = (PLib3MFWriter_WriteToInternalBufferPtr) GetProcAddress(hLibrary, "lib3mf_writer_writetointernalbuffer");
+		#else // _WIN32
+		pWrapperTable->m_Writer_WriteToInternalBuffer = (PLib3MFWriter_WriteToInternalBufferPtr) dlsym(hLibrary, "lib3mf_writer_writetointernalbuffer");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_WriteToInternalBuffer == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetInternalBufferAddress = (PLib3MFWriter_GetInternalBufferAddressPtr) GetProcAddress(hLibrary, "lib3mf_writer_getinternalbufferaddress");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetInternalBufferAddress = (PLib3MFWriter_GetInternalBufferAddressPtr) dlsym(hLibrary, "lib3mf_writer_getinternalbufferaddress");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetInternalBufferAddress == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Writer_WriteToCallback = (PLib3MFWriter_WriteToCallbackPtr) GetProcAddress(hLibrary, "lib3mf_writer_writetocallback");
 		#else // _WIN32
@@ -4652,6 +4732,114 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Writer_GetStrictModeActive == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetObjectThreadCount = (PLib3MFWriter_SetObjectThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setobjectthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetObjectThreadCount = (PLib3MFWriter_SetObjectThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setobjectthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetObjectThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetObjectThreadCount = (PLib3MFWriter_GetObjectThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getobjectthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetObjectThreadCount = (PLib3MFWriter_GetObjectThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getobjectthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetObjectThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetSubModelThreadCount = (PLib3MFWriter_SetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setsubmodelthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetSubModelThreadCount = (PLib3MFWriter_SetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setsubmodelthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetSubModelThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetSubModelThreadCount = (PLib3MFWriter_GetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getsubmodelthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetSubModelThreadCount = (PLib3MFWriter_GetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getsubmodelthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetSubModelThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetCompressionThreadCount = (PLib3MFWriter_SetCompressionThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setcompressionthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetCompressionThreadCount = (PLib3MFWriter_SetCompressionThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setcompressionthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetCompressionThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetCompressionThreadCount = (PLib3MFWriter_GetCompressionThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getcompressionthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetCompressionThreadCount = (PLib3MFWriter_GetCompressionThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getcompressionthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetCompressionThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetModelCompressionLevel = (PLib3MFWriter_SetModelCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setmodelcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetModelCompressionLevel = (PLib3MFWriter_SetModelCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setmodelcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetModelCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetModelCompressionLevel = (PLib3MFWriter_GetModelCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getmodelcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetModelCompressionLevel = (PLib3MFWriter_GetModelCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getmodelcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetModelCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetTextureCompressionLevel = (PLib3MFWriter_SetTextureCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_settexturecompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetTextureCompressionLevel = (PLib3MFWriter_SetTextureCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_settexturecompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetTextureCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetTextureCompressionLevel = (PLib3MFWriter_GetTextureCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_gettexturecompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetTextureCompressionLevel = (PLib3MFWriter_GetTextureCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_gettexturecompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetTextureCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetAttachmentCompressionLevel = (PLib3MFWriter_SetAttachmentCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setattachmentcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetAttachmentCompressionLevel = (PLib3MFWriter_SetAttachmentCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setattachmentcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetAttachmentCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetAttachmentCompressionLevel = (PLib3MFWriter_GetAttachmentCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getattachmentcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetAttachmentCompressionLevel = (PLib3MFWriter_GetAttachmentCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getattachmentcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetAttachmentCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Writer_GetWarning = (PLib3MFWriter_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_writer_getwarning");
 		#else // _WIN32
@@ -4724,6 +4912,51 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Reader_SetProgressCallback == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetVertexStreamCallback = (PLib3MFReader_SetVertexStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setvertexstreamcallback");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetVertexStreamCallback = (PLib3MFReader_SetVertexStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setvertexstreamcallback");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetVertexStreamCallback == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetTriangleStreamCallback = (PLib3MFReader_SetTriangleStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_settrianglestreamcallback");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetTriangleStreamCallback = (PLib3MFReader_SetTriangleStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_settrianglestreamcallback");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetTriangleStreamCallback == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetBeamStreamCallback = (PLib3MFReader_SetBeamStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setbeamstreamcallback");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetBeamStreamCallback = (PLib3MFReader_SetBeamStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setbeamstreamcallback");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetBeamStreamCallback == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetComponentStreamCallback = (PLib3MFReader_SetComponentStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setcomponentstreamcallback");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetComponentStreamCallback = (PLib3MFReader_SetComponentStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setcomponentstreamcallback");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetComponentStreamCallback == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetBuildItemStreamCallback = (PLib3MFReader_SetBuildItemStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setbuilditemstreamcallback");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetBuildItemStreamCallback = (PLib3MFReader_SetBuildItemStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setbuilditemstreamcallback");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetBuildItemStreamCallback == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Reader_AddRelationToRead = (PLib3MFReader_AddRelationToReadPtr) GetProcAddress(hLibrary, "lib3mf_reader_addrelationtoread");
 		#else // _WIN32
@@ -4760,6 +4993,78 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Reader_GetStrictModeActive == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetSubModelThreadCount = (PLib3MFReader_SetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_setsubmodelthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetSubModelThreadCount = (PLib3MFReader_SetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_setsubmodelthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetSubModelThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetSubModelThreadCount = (PLib3MFReader_GetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_getsubmodelthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetSubModelThreadCount = (PLib3MFReader_GetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_getsubmodelthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetSubModelThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetBackgroundDecompressionActive = (PLib3MFReader_SetBackgroundDecompressionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setbackgrounddecompressionactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetBackgroundDecompressionActive = (PLib3MFReader_SetBackgroundDecompressionActivePtr) dlsym(hLibrary, "lib3mf_reader_setbackgrounddecompressionactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetBackgroundDecompressionActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetBackgroundDecompressionActive = (PLib3MFReader_GetBackgroundDecompressionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getbackgrounddecompressionactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetBackgroundDecompressionActive = (PLib3MFReader_GetBackgroundDecompressionActivePtr) dlsym(hLibrary, "lib3mf_reader_getbackgrounddecompressionactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetBackgroundDecompressionActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = (PLib3MFReader_SetLazyAttachmentLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazyattachmentloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = (PLib3MFReader_SetLazyAttachmentLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazyattachmentloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = (PLib3MFReader_GetLazyAttachmentLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazyattachmentloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = (PLib3MFReader_GetLazyAttachmentLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazyattachmentloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Reader_GetWarning = (PLib3MFReader_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_reader_getwarning");
 		#else // _WIN32
@@ -5885,6 +6190,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_LevelSet_SetVolumeData == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_LevelSet_SampleGrid = (PLib3MFLevelSet_SampleGridPtr) GetProcAddress(hLibrary, "lib3mf_levelset_samplegrid");
+		#else // _WIN32
+		pWrapperTable->m_LevelSet_SampleGrid = (PLib3MFLevelSet_SampleGridPtr) dlsym(hLibrary, "lib3mf_levelset_samplegrid");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_LevelSet_SampleGrid == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_BeamLattice_GetMinLength = (PLib3MFBeamLattice_GetMinLengthPtr) GetProcAddress(hLibrary, "lib3mf_beamlattice_getminlength");
 		#else // _WIN32
@@ -8036,6 +8350,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Function_FindOutput == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Function_SampleGrid = (PLib3MFFunction_SampleGridPtr) GetProcAddress(hLibrary, "lib3mf_function_samplegrid");
+		#else // _WIN32
+		pWrapperTable->m_Function_SampleGrid = (PLib3MFFunction_SampleGridPtr) dlsym(hLibrary, "lib3mf_function_samplegrid");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Function_SampleGrid == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_ImplicitFunction_GetIdentifier = (PLib3MFImplicitFunction_GetIdentifierPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_getidentifier");
 		#else // _WIN32
@@ -8558,6 +8881,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitFunction_EvaluateBatch = (PLib3MFImplicitFunction_EvaluateBatchPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_evaluatebatch");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitFunction_EvaluateBatch = (PLib3MFImplicitFunction_EvaluateBatchPtr) dlsym(hLibrary, "lib3mf_implicitfunction_evaluatebatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitFunction_EvaluateBatch == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_FunctionFromImage3D_GetImage3D = (PLib3MFFunctionFromImage3D_GetImage3DPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_getimage3d");
 		#else // _WIN32
@@ -9539,6 +9871,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Model_GetOutbox == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Model_GetBuildItemOutboxes = (PLib3MFModel_GetBuildItemOutboxesPtr) GetProcAddress(hLibrary, "lib3mf_model_getbuilditemoutboxes");
+		#else // _WIN32
+		pWrapperTable->m_Model_GetBuildItemOutboxes = (PLib3MFModel_GetBuildItemOutboxesPtr) dlsym(hLibrary, "lib3mf_model_getbuilditemoutboxes");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Model_GetBuildItemOutboxes == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Model_GetResources = (PLib3MFModel_GetResourcesPtr) GetProcAddress(hLibrary, "lib3mf_model_getresources");
 		#else // _WIN32
@@ -10174,6 +10515,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_WriteToBuffer == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_writer_writetointernalbuffer", (void**)&(pWrapperTable->m_Writer_WriteToInternalBuffer));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_WriteToInternalBuffer == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getinternalbufferaddress", (void**)&(pWrapperTable->m_Writer_GetInternalBufferAddress));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetInternalBufferAddress == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_writer_writetocallback", (void**)&(pWrapperTable->m_Writer_WriteToCallback));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_WriteToCallback == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10198,6 +10547,54 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetStrictModeActive == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_writer_setobjectthreadcount", (void**)&(pWrapperTable->m_Writer_SetObjectThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetObjectThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getobjectthreadcount", (void**)&(pWrapperTable->m_Writer_GetObjectThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetObjectThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setsubmodelthreadcount", (void**)&(pWrapperTable->m_Writer_SetSubModelThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetSubModelThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getsubmodelthreadcount", (void**)&(pWrapperTable->m_Writer_GetSubModelThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetSubModelThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setcompressionthreadcount", (void**)&(pWrapperTable->m_Writer_SetCompressionThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetCompressionThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getcompressionthreadcount", (void**)&(pWrapperTable->m_Writer_GetCompressionThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetCompressionThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setmodelcompressionlevel", (void**)&(pWrapperTable->m_Writer_SetModelCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetModelCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getmodelcompressionlevel", (void**)&(pWrapperTable->m_Writer_GetModelCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetModelCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_settexturecompressionlevel", (void**)&(pWrapperTable->m_Writer_SetTextureCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetTextureCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_gettexturecompressionlevel", (void**)&(pWrapperTable->m_Writer_GetTextureCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetTextureCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setattachmentcompressionlevel", (void**)&(pWrapperTable->m_Writer_SetAttachmentCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetAttachmentCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getattachmentcompressionlevel", (void**)&(pWrapperTable->m_Writer_GetAttachmentCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetAttachmentCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_writer_getwarning", (void**)&(pWrapperTable->m_Writer_GetWarning));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetWarning == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10230,6 +10627,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetProgressCallback == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_reader_setvertexstreamcallback", (void**)&(pWrapperTable->m_Reader_SetVertexStreamCallback));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetVertexStreamCallback == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_settrianglestreamcallback", (void**)&(pWrapperTable->m_Reader_SetTriangleStreamCallback));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetTriangleStreamCallback == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setbeamstreamcallback", (void**)&(pWrapperTable->m_Reader_SetBeamStreamCallback));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetBeamStreamCallback == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setcomponentstreamcallback", (void**)&(pWrapperTable->m_Reader_SetComponentStreamCallback));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetComponentStreamCallback == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setbuilditemstreamcallback", (void**)&(pWrapperTable->m_Reader_SetBuildItemStreamCallback));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetBuildItemStreamCallback == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_reader_addrelationtoread", (void**)&(pWrapperTable->m_Reader_AddRelationToRead));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_AddRelationToRead == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10246,6 +10663,38 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetStrictModeActive == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_reader_setsubmodelthreadcount", (void**)&(pWrapperTable->m_Reader_SetSubModelThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetSubModelThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getsubmodelthreadcount", (void**)&(pWrapperTable->m_Reader_GetSubModelThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetSubModelThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setlazymeshloadingactive", (void**)&(pWrapperTable->m_Reader_SetLazyMeshLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getlazymeshloadingactive", (void**)&(pWrapperTable->m_Reader_GetLazyMeshLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setbackgrounddecompressionactive", (void**)&(pWrapperTable->m_Reader_SetBackgroundDecompressionActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetBackgroundDecompressionActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getbackgrounddecompressionactive", (void**)&(pWrapperTable->m_Reader_GetBackgroundDecompressionActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetBackgroundDecompressionActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setlazyattachmentloadingactive", (void**)&(pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getlazyattachmentloadingactive", (void**)&(pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_reader_getwarning", (void**)&(pWrapperTable->m_Reader_GetWarning));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetWarning == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10746,6 +11195,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_LevelSet_SetVolumeData == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_levelset_samplegrid", (void**)&(pWrapperTable->m_LevelSet_SampleGrid));
+		if ( (eLookupError != 0) || (pWrapperTable->m_LevelSet_SampleGrid == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_beamlattice_getminlength", (void**)&(pWrapperTable->m_BeamLattice_GetMinLength));
 		if ( (eLookupError != 0) || (pWrapperTable->m_BeamLattice_GetMinLength == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11702,6 +12155,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Function_FindOutput == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_function_samplegrid", (void**)&(pWrapperTable->m_Function_SampleGrid));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Function_SampleGrid == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_implicitfunction_getidentifier", (void**)&(pWrapperTable->m_ImplicitFunction_GetIdentifier));
 		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitFunction_GetIdentifier == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11934,6 +12391,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_implicitfunction_evaluatebatch", (void**)&(pWrapperTable->m_ImplicitFunction_EvaluateBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitFunction_EvaluateBatch == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_functionfromimage3d_getimage3d", (void**)&(pWrapperTable->m_FunctionFromImage3D_GetImage3D));
 		if ( (eLookupError != 0) || (pWrapperTable->m_FunctionFromImage3D_GetImage3D == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12370,6 +12831,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetOutbox == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_model_getbuilditemoutboxes", (void**)&(pWrapperTable->m_Model_GetBuildItemOutboxes));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetBuildItemOutboxes == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_model_getresources", (void**)&(pWrapperTable->m_Model_GetResources));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetResources == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12672,7 +13137,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 	}
 	
 	/**
-	* CWriter::GetStreamSize - Retrieves the size of the full 3MF file stream.
+	* CWriter::GetStreamSize - Retrieves the size of the full 3MF file stream..
 	* @return the stream size
 	*/
 	Lib3MF_uint64 CWriter::GetStreamSize()
@@ -12696,6 +13161,30 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Writer_WriteToBuffer(m_pHandle, elementsNeededBuffer, &elementsWrittenBuffer, BufferBuffer.data()));
 	}
 	
+	/**
+	* CWriter::WriteToInternalBuffer - Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+	* @return size of the written buffer in bytes
+	*/
+	Lib3MF_uint64 CWriter::WriteToInternalBuffer()
+	{
+		Lib3MF_uint64 resultBufferSize = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_WriteToInternalBuffer(m_pHandle, &resultBufferSize));
+		
+		return resultBufferSize;
+	}
+	
+	/**
+	* CWriter::GetInternalBufferAddress - Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+	* @return address of the first byte of the buffer
+	*/
+	Lib3MF_uint64 CWriter::GetInternalBufferAddress()
+	{
+		Lib3MF_uint64 resultBufferAddress = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetInternalBufferAddress(m_pHandle, &resultBufferAddress));
+		
+		return resultBufferAddress;
+	}
+	
 	/**
 	* CWriter::WriteToCallback - Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 	* @param[in] pTheWriteCallback - Callback to call for writing a data chunk
@@ -12759,6 +13248,132 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CWriter::SetObjectThreadCount - Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+	* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetObjectThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetObjectThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetObjectThreadCount - Returns the number of threads used to format the XML of the objects of a model part.
+	* @return number of formatting threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetObjectThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetObjectThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetSubModelThreadCount - Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+	* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetSubModelThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetSubModelThreadCount - Returns the number of threads used to write the non-root model parts of the production extension.
+	* @return number of writer threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetSubModelThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetSubModelThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetCompressionThreadCount - Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+	* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+	*/
+	void CWriter::SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetCompressionThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetCompressionThreadCount - Returns the number of threads used to deflate large parts of the package.
+	* @return number of compression threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CWriter::GetCompressionThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetCompressionThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetModelCompressionLevel - Sets the compression level of the model parts (root model and non-root models of the production extension).
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetModelCompressionLevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetModelCompressionLevel - Returns the compression level of the model parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetModelCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetModelCompressionLevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
+	/**
+	* CWriter::SetTextureCompressionLevel - Sets the compression level of textures and thumbnails.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetTextureCompressionLevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetTextureCompressionLevel - Returns the compression level of the texture and thumbnail parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetTextureCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetTextureCompressionLevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
+	/**
+	* CWriter::SetAttachmentCompressionLevel - Sets the compression level of all other attachments.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	void CWriter::SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetAttachmentCompressionLevel(m_pHandle, nCompressionLevel));
+	}
+	
+	/**
+	* CWriter::GetAttachmentCompressionLevel - Returns the compression level of the attachment parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	Lib3MF_uint32 CWriter::GetAttachmentCompressionLevel()
+	{
+		Lib3MF_uint32 resultCompressionLevel = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetAttachmentCompressionLevel(m_pHandle, &resultCompressionLevel));
+		
+		return resultCompressionLevel;
+	}
+	
 	/**
 	* CWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -12854,6 +13469,56 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetProgressCallback(m_pHandle, pProgressCallback, pUserData));
 	}
 	
+	/**
+	* CReader::SetVertexStreamCallback - Streams the vertices of the next read to a callback
+	* @param[in] pVertexStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetVertexStreamCallback(const VertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetVertexStreamCallback(m_pHandle, pVertexStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetTriangleStreamCallback - Streams the triangles of the next read to a callback
+	* @param[in] pTriangleStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetTriangleStreamCallback(const TriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetTriangleStreamCallback(m_pHandle, pTriangleStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetBeamStreamCallback - Streams the beams of the next read to a callback
+	* @param[in] pBeamStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetBeamStreamCallback(const BeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetBeamStreamCallback(m_pHandle, pBeamStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetComponentStreamCallback - Streams the components of the next read to a callback
+	* @param[in] pComponentStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetComponentStreamCallback(const ComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetComponentStreamCallback(m_pHandle, pComponentStreamCallback, pUserData));
+	}
+	
+	/**
+	* CReader::SetBuildItemStreamCallback - Streams the build items of the next read to a callback
+	* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	void CReader::SetBuildItemStreamCallback(const BuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetBuildItemStreamCallback(m_pHandle, pBuildItemStreamCallback, pUserData));
+	}
+	
 	/**
 	* CReader::AddRelationToRead - Adds a relationship type which shall be read as attachment in memory while loading
 	* @param[in] sRelationShipType - String of the relationship type
@@ -12893,6 +13558,90 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CReader::SetSubModelThreadCount - Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+	* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+	*/
+	void CReader::SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetSubModelThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CReader::GetSubModelThreadCount - Returns the number of threads used to parse the non-root model parts of the production extension.
+	* @return number of parser threads. 0 means all available hardware threads.
+	*/
+	Lib3MF_uint32 CReader::GetSubModelThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetSubModelThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CReader::SetLazyMeshLoadingActive - Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+	* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+	*/
+	void CReader::SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetLazyMeshLoadingActive(m_pHandle, bLazyMeshLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyMeshLoadingActive - Queries whether mesh content is parsed on first access
+	* @return returns flag whether mesh content is parsed on first access.
+	*/
+	bool CReader::GetLazyMeshLoadingActive()
+	{
+		bool resultLazyMeshLoadingActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetLazyMeshLoadingActive(m_pHandle, &resultLazyMeshLoadingActive));
+		
+		return resultLazyMeshLoadingActive;
+	}
+	
+	/**
+	* CReader::SetBackgroundDecompressionActive - Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+	* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+	*/
+	void CReader::SetBackgroundDecompressionActive(const bool bBackgroundDecompressionActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetBackgroundDecompressionActive(m_pHandle, bBackgroundDecompressionActive));
+	}
+	
+	/**
+	* CReader::GetBackgroundDecompressionActive - Queries whether the root model part is decompressed on a background thread
+	* @return returns flag whether the root model part is decompressed on a background thread.
+	*/
+	bool CReader::GetBackgroundDecompressionActive()
+	{
+		bool resultBackgroundDecompressionActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetBackgroundDecompressionActive(m_pHandle, &resultBackgroundDecompressionActive));
+		
+		return resultBackgroundDecompressionActive;
+	}
+	
+	/**
+	* CReader::SetLazyAttachmentLoadingActive - Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+	* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+	*/
+	void CReader::SetLazyAttachmentLoadingActive(const bool bLazyAttachmentLoadingActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetLazyAttachmentLoadingActive(m_pHandle, bLazyAttachmentLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyAttachmentLoadingActive - Queries whether attachments are decompressed on first access
+	* @return returns flag whether attachments are decompressed on first access.
+	*/
+	bool CReader::GetLazyAttachmentLoadingActive()
+	{
+		bool resultLazyAttachmentLoadingActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetLazyAttachmentLoadingActive(m_pHandle, &resultLazyAttachmentLoadingActive));
+		
+		return resultLazyAttachmentLoadingActive;
+	}
+	
 	/**
 	* CReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -14527,6 +15276,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_LevelSet_SetVolumeData(m_pHandle, hTheVolumeData));
 	}
 	
+	/**
+	* CLevelSet::SampleGrid - Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[out] ValuesBuffer - value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	void CLevelSet::SampleGrid(const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededValues = 0;
+		Lib3MF_uint64 elementsWrittenValues = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_LevelSet_SampleGrid(m_pHandle, &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, 0, &elementsNeededValues, nullptr));
+		ValuesBuffer.resize((size_t) elementsNeededValues);
+		CheckError(m_pWrapper->m_WrapperTable.m_LevelSet_SampleGrid(m_pHandle, &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, elementsNeededValues, &elementsWrittenValues, ValuesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CBeamLattice
 	 */
@@ -17931,6 +18700,27 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CImplicitPort>(dynamic_cast<CImplicitPort*>(m_pWrapper->polymorphicFactory(hOutput)));
 	}
 	
+	/**
+	* CFunction::SampleGrid - Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+	* @param[in] sOutputIdentifier - the identifier of the scalar output to sample
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[out] ValuesBuffer - value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	void CFunction::SampleGrid(const std::string & sOutputIdentifier, const sVector & Origin, const sVector & Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, std::vector<Lib3MF_single> & ValuesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededValues = 0;
+		Lib3MF_uint64 elementsWrittenValues = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Function_SampleGrid(m_pHandle, sOutputIdentifier.c_str(), &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, 0, &elementsNeededValues, nullptr));
+		ValuesBuffer.resize((size_t) elementsNeededValues);
+		CheckError(m_pWrapper->m_WrapperTable.m_Function_SampleGrid(m_pHandle, sOutputIdentifier.c_str(), &Origin, &Spacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, elementsNeededValues, &elementsWrittenValues, ValuesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CImplicitFunction
 	 */
@@ -18955,6 +19745,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitFunction_SortNodesTopologically(m_pHandle));
 	}
 	
+	/**
+	* CImplicitFunction::EvaluateBatch - Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+	* @param[in] InputsBuffer - Input values of all points. The count MUST be a multiple of the component count of all inputs.
+	* @param[out] OutputsBuffer - Output values of all points.
+	*/
+	void CImplicitFunction::EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 nInputsSize = InputsBuffer.size();
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitFunction_EvaluateBatch(m_pHandle, nInputsSize, InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitFunction_EvaluateBatch(m_pHandle, nInputsSize, InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CFunctionFromImage3D
 	 */
@@ -20461,6 +21266,19 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultOutbox;
 	}
 	
+	/**
+	* CModel::GetBuildItemOutboxes - Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+	* @param[out] OutboxesBuffer - contains the outbox of each build item.
+	*/
+	void CModel::GetBuildItemOutboxes(std::vector<sBox> & OutboxesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutboxes = 0;
+		Lib3MF_uint64 elementsWrittenOutboxes = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Model_GetBuildItemOutboxes(m_pHandle, 0, &elementsNeededOutboxes, nullptr));
+		OutboxesBuffer.resize((size_t) elementsNeededOutboxes);
+		CheckError(m_pWrapper->m_WrapperTable.m_Model_GetBuildItemOutboxes(m_pHandle, elementsNeededOutboxes, &elementsWrittenOutboxes, OutboxesBuffer.data()));
+	}
+	
 	/**
 	* CModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
@@ -178,6 +178,7 @@ const (
 	ProgressIdentifier_WRITETRIANGLES = 21
 	ProgressIdentifier_WRITESLICES = 22
 	ProgressIdentifier_WRITEKEYSTORE = 23
+	ProgressIdentifier_SAMPLEGRID = 24
 )
 
 // BlendMethod represents a Lib3MF enum.
@@ -655,6 +656,71 @@ func randomNumberCallback(byteData C.uint64_t, numBytes C.uint64_t, userData C.L
 	randomNumberCallbackFunc(uint64(byteData), uint64(numBytes), uintptr(userData), (*uint64)(bytesWritten))
 }
 
+// VertexStreamCallbackFunc callback to receive a batch of vertices while streaming a mesh object.
+type VertexStreamCallbackFunc = func(objectUniqueID uint32, vertexCount uint32, vertexData uint64, userData uintptr)
+
+var vertexStreamCallbackFunc VertexStreamCallbackFunc
+
+//export vertexStreamCallback
+func vertexStreamCallback(objectUniqueID C.uint32_t, vertexCount C.uint32_t, vertexData C.uint64_t, userData C.Lib3MF_pvoid) {
+	if vertexStreamCallbackFunc == nil {
+		return
+	}
+	vertexStreamCallbackFunc(uint32(objectUniqueID), uint32(vertexCount), uint64(vertexData), uintptr(userData))
+}
+
+// TriangleStreamCallbackFunc callback to receive a batch of triangles while streaming a mesh object.
+type TriangleStreamCallbackFunc = func(objectUniqueID uint32, triangleCount uint32, triangleData uint64, userData uintptr)
+
+var triangleStreamCallbackFunc TriangleStreamCallbackFunc
+
+//export triangleStreamCallback
+func triangleStreamCallback(objectUniqueID C.uint32_t, triangleCount C.uint32_t, triangleData C.uint64_t, userData C.Lib3MF_pvoid) {
+	if triangleStreamCallbackFunc == nil {
+		return
+	}
+	triangleStreamCallbackFunc(uint32(objectUniqueID), uint32(triangleCount), uint64(triangleData), uintptr(userData))
+}
+
+// BeamStreamCallbackFunc callback to receive a batch of beams while streaming a mesh object.
+type BeamStreamCallbackFunc = func(objectUniqueID uint32, beamCount uint32, beamData uint64, userData uintptr)
+
+var beamStreamCallbackFunc BeamStreamCallbackFunc
+
+//export beamStreamCallback
+func beamStreamCallback(objectUniqueID C.uint32_t, beamCount C.uint32_t, beamData C.uint64_t, userData C.Lib3MF_pvoid) {
+	if beamStreamCallbackFunc == nil {
+		return
+	}
+	beamStreamCallbackFunc(uint32(objectUniqueID), uint32(beamCount), uint64(beamData), uintptr(userData))
+}
+
+// ComponentStreamCallbackFunc callback to receive a component while streaming a components object.
+type ComponentStreamCallbackFunc = func(objectUniqueID uint32, componentObjectUniqueID uint32, transformData uint64, userData uintptr)
+
+var componentStreamCallbackFunc ComponentStreamCallbackFunc
+
+//export componentStreamCallback
+func componentStreamCallback(objectUniqueID C.uint32_t, componentObjectUniqueID C.uint32_t, transformData C.uint64_t, userData C.Lib3MF_pvoid) {
+	if componentStreamCallbackFunc == nil {
+		return
+	}
+	componentStreamCallbackFunc(uint32(objectUniqueID), uint32(componentObjectUniqueID), uint64(transformData), uintptr(userData))
+}
+
+// BuildItemStreamCallbackFunc callback to receive a build item while streaming a model.
+type BuildItemStreamCallbackFunc = func(objectUniqueID uint32, transformData uint64, userData uintptr)
+
+var buildItemStreamCallbackFunc BuildItemStreamCallbackFunc
+
+//export buildItemStreamCallback
+func buildItemStreamCallback(objectUniqueID C.uint32_t, transformData C.uint64_t, userData C.Lib3MF_pvoid) {
+	if buildItemStreamCallbackFunc == nil {
+		return
+	}
+	buildItemStreamCallbackFunc(uint32(objectUniqueID), uint64(transformData), uintptr(userData))
+}
+
 // KeyWrappingCallbackFunc a callback used to wrap (encrypt) the content key available in keystore resource group.
 type KeyWrappingCallbackFunc = func(kEKParams AccessRight, inBuffer []uint8, outBuffer []uint8, userData uintptr, status *uint64)
 
@@ -745,7 +811,7 @@ func (inst Writer) WriteToFile(filename string) error {
 	return nil
 }
 
-// GetStreamSize retrieves the size of the full 3MF file stream.
+// GetStreamSize retrieves the size of the full 3MF file stream..
 func (inst Writer) GetStreamSize() (uint64, error) {
 	var streamSize C.uint64_t
 	ret := C.CCall_lib3mf_writer_getstreamsize(inst.wrapperRef.LibraryHandle, inst.Ref, &streamSize)
@@ -772,6 +838,26 @@ func (inst Writer) WriteToBuffer(buffer []uint8) ([]uint8, error) {
 	return buffer[:int(neededforbuffer)], nil
 }
 
+// WriteToInternalBuffer writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+func (inst Writer) WriteToInternalBuffer() (uint64, error) {
+	var bufferSize C.uint64_t
+	ret := C.CCall_lib3mf_writer_writetointernalbuffer(inst.wrapperRef.LibraryHandle, inst.Ref, &bufferSize)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint64(bufferSize), nil
+}
+
+// GetInternalBufferAddress returns the address of the buffer written by the last call of WriteToInternalBuffer.
+func (inst Writer) GetInternalBufferAddress() (uint64, error) {
+	var bufferAddress C.uint64_t
+	ret := C.CCall_lib3mf_writer_getinternalbufferaddress(inst.wrapperRef.LibraryHandle, inst.Ref, &bufferAddress)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint64(bufferAddress), nil
+}
+
 // WriteToCallback writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 func (inst Writer) WriteToCallback(theWriteCallback WriteCallbackFunc, theSeekCallback SeekCallbackFunc, userData uintptr) error {
 	ret := C.CCall_lib3mf_writer_writetocallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFWriteCallback)(unsafe.Pointer(&theWriteCallback)), (C.Lib3MFSeekCallback)(unsafe.Pointer(&theSeekCallback)), (C.Lib3MF_pvoid)(userData))
@@ -831,6 +917,120 @@ func (inst Writer) GetStrictModeActive() (bool, error) {
 	return bool(strictModeActive), nil
 }
 
+// SetObjectThreadCount sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+func (inst Writer) SetObjectThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_writer_setobjectthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetObjectThreadCount returns the number of threads used to format the XML of the objects of a model part.
+func (inst Writer) GetObjectThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_writer_getobjectthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetSubModelThreadCount sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+func (inst Writer) SetSubModelThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_writer_setsubmodelthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetSubModelThreadCount returns the number of threads used to write the non-root model parts of the production extension.
+func (inst Writer) GetSubModelThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_writer_getsubmodelthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetCompressionThreadCount sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+func (inst Writer) SetCompressionThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_writer_setcompressionthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetCompressionThreadCount returns the number of threads used to deflate large parts of the package.
+func (inst Writer) GetCompressionThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_writer_getcompressionthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetModelCompressionLevel sets the compression level of the model parts (root model and non-root models of the production extension).
+func (inst Writer) SetModelCompressionLevel(compressionLevel uint32) error {
+	ret := C.CCall_lib3mf_writer_setmodelcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(compressionLevel))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetModelCompressionLevel returns the compression level of the model parts.
+func (inst Writer) GetModelCompressionLevel() (uint32, error) {
+	var compressionLevel C.uint32_t
+	ret := C.CCall_lib3mf_writer_getmodelcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, &compressionLevel)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(compressionLevel), nil
+}
+
+// SetTextureCompressionLevel sets the compression level of textures and thumbnails.
+func (inst Writer) SetTextureCompressionLevel(compressionLevel uint32) error {
+	ret := C.CCall_lib3mf_writer_settexturecompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(compressionLevel))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetTextureCompressionLevel returns the compression level of the texture and thumbnail parts.
+func (inst Writer) GetTextureCompressionLevel() (uint32, error) {
+	var compressionLevel C.uint32_t
+	ret := C.CCall_lib3mf_writer_gettexturecompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, &compressionLevel)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(compressionLevel), nil
+}
+
+// SetAttachmentCompressionLevel sets the compression level of all other attachments.
+func (inst Writer) SetAttachmentCompressionLevel(compressionLevel uint32) error {
+	ret := C.CCall_lib3mf_writer_setattachmentcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(compressionLevel))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetAttachmentCompressionLevel returns the compression level of the attachment parts.
+func (inst Writer) GetAttachmentCompressionLevel() (uint32, error) {
+	var compressionLevel C.uint32_t
+	ret := C.CCall_lib3mf_writer_getattachmentcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, &compressionLevel)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(compressionLevel), nil
+}
+
 // GetWarning returns Warning and Error Information of the read process.
 func (inst Writer) GetWarning(index uint32) (uint32, string, error) {
 	var errorCode C.uint32_t
@@ -928,6 +1128,56 @@ func (inst Reader) SetProgressCallback(progressCallback ProgressCallbackFunc, us
 	return nil
 }
 
+// SetVertexStreamCallback streams the vertices of the next read to a callback.
+func (inst Reader) SetVertexStreamCallback(vertexStreamCallback VertexStreamCallbackFunc, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_setvertexstreamcallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFVertexStreamCallback)(unsafe.Pointer(&vertexStreamCallback)), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	vertexStreamCallbackFunc = vertexStreamCallback
+	return nil
+}
+
+// SetTriangleStreamCallback streams the triangles of the next read to a callback.
+func (inst Reader) SetTriangleStreamCallback(triangleStreamCallback TriangleStreamCallbackFunc, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_settrianglestreamcallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFTriangleStreamCallback)(unsafe.Pointer(&triangleStreamCallback)), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	triangleStreamCallbackFunc = triangleStreamCallback
+	return nil
+}
+
+// SetBeamStreamCallback streams the beams of the next read to a callback.
+func (inst Reader) SetBeamStreamCallback(beamStreamCallback BeamStreamCallbackFunc, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_setbeamstreamcallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFBeamStreamCallback)(unsafe.Pointer(&beamStreamCallback)), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	beamStreamCallbackFunc = beamStreamCallback
+	return nil
+}
+
+// SetComponentStreamCallback streams the components of the next read to a callback.
+func (inst Reader) SetComponentStreamCallback(componentStreamCallback ComponentStreamCallbackFunc, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_setcomponentstreamcallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFComponentStreamCallback)(unsafe.Pointer(&componentStreamCallback)), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	componentStreamCallbackFunc = componentStreamCallback
+	return nil
+}
+
+// SetBuildItemStreamCallback streams the build items of the next read to a callback.
+func (inst Reader) SetBuildItemStreamCallback(buildItemStreamCallback BuildItemStreamCallbackFunc, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_setbuilditemstreamcallback(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFBuildItemStreamCallback)(unsafe.Pointer(&buildItemStreamCallback)), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	buildItemStreamCallbackFunc = buildItemStreamCallback
+	return nil
+}
+
 // AddRelationToRead adds a relationship type which shall be read as attachment in memory while loading.
 func (inst Reader) AddRelationToRead(relationShipType string) error {
 	ret := C.CCall_lib3mf_reader_addrelationtoread(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.char)(unsafe.Pointer(&[]byte(relationShipType)[0])))
@@ -965,6 +1215,82 @@ func (inst Reader) GetStrictModeActive() (bool, error) {
 	return bool(strictModeActive), nil
 }
 
+// SetSubModelThreadCount sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+func (inst Reader) SetSubModelThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_reader_setsubmodelthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetSubModelThreadCount returns the number of threads used to parse the non-root model parts of the production extension.
+func (inst Reader) GetSubModelThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_reader_getsubmodelthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetLazyMeshLoadingActive defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+func (inst Reader) SetLazyMeshLoadingActive(lazyMeshLoadingActive bool) error {
+	ret := C.CCall_lib3mf_reader_setlazymeshloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(lazyMeshLoadingActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetLazyMeshLoadingActive queries whether mesh content is parsed on first access.
+func (inst Reader) GetLazyMeshLoadingActive() (bool, error) {
+	var lazyMeshLoadingActive C.bool
+	ret := C.CCall_lib3mf_reader_getlazymeshloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, &lazyMeshLoadingActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(lazyMeshLoadingActive), nil
+}
+
+// SetBackgroundDecompressionActive decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+func (inst Reader) SetBackgroundDecompressionActive(backgroundDecompressionActive bool) error {
+	ret := C.CCall_lib3mf_reader_setbackgrounddecompressionactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(backgroundDecompressionActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetBackgroundDecompressionActive queries whether the root model part is decompressed on a background thread.
+func (inst Reader) GetBackgroundDecompressionActive() (bool, error) {
+	var backgroundDecompressionActive C.bool
+	ret := C.CCall_lib3mf_reader_getbackgrounddecompressionactive(inst.wrapperRef.LibraryHandle, inst.Ref, &backgroundDecompressionActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(backgroundDecompressionActive), nil
+}
+
+// SetLazyAttachmentLoadingActive keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+func (inst Reader) SetLazyAttachmentLoadingActive(lazyAttachmentLoadingActive bool) error {
+	ret := C.CCall_lib3mf_reader_setlazyattachmentloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(lazyAttachmentLoadingActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetLazyAttachmentLoadingActive queries whether attachments are decompressed on first access.
+func (inst Reader) GetLazyAttachmentLoadingActive() (bool, error) {
+	var lazyAttachmentLoadingActive C.bool
+	ret := C.CCall_lib3mf_reader_getlazyattachmentloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, &lazyAttachmentLoadingActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(lazyAttachmentLoadingActive), nil
+}
+
 // GetWarning returns Warning and Error Information of the read process.
 func (inst Reader) GetWarning(index uint32) (uint32, string, error) {
 	var errorCode C.uint32_t
@@ -2541,6 +2867,24 @@ func (inst LevelSet) SetVolumeData(theVolumeData VolumeData) error {
 }
 
 
+// SampleGrid evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+func (inst LevelSet) SampleGrid(origin Vector, spacing Vector, countX uint32, countY uint32, countZ uint32, progressCallback ProgressCallbackFunc, userData uintptr, values []float32) ([]float32, error) {
+	var neededforvalues C.uint64_t
+	ret := C.CCall_lib3mf_levelset_samplegrid(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.sLib3MFVector)(unsafe.Pointer(&origin)), (*C.sLib3MFVector)(unsafe.Pointer(&spacing)), C.uint32_t(countX), C.uint32_t(countY), C.uint32_t(countZ), (C.Lib3MFProgressCallback)(unsafe.Pointer(&progressCallback)), (C.Lib3MF_pvoid)(userData), 0, &neededforvalues, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(values) < int(neededforvalues) {
+	 values = append(values, make([]float32, int(neededforvalues)-len(values))...)
+	}
+	ret = C.CCall_lib3mf_levelset_samplegrid(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.sLib3MFVector)(unsafe.Pointer(&origin)), (*C.sLib3MFVector)(unsafe.Pointer(&spacing)), C.uint32_t(countX), C.uint32_t(countY), C.uint32_t(countZ), (C.Lib3MFProgressCallback)(unsafe.Pointer(&progressCallback)), (C.Lib3MF_pvoid)(userData), neededforvalues, nil, (*C.float)(unsafe.Pointer(&values[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	progressCallbackFunc = progressCallback
+	return values[:int(neededforvalues)], nil
+}
+
 // BeamLattice represents a Lib3MF class.
 type BeamLattice struct {
 	Base
@@ -5871,6 +6215,24 @@ func (inst Function) FindOutput(identifier string) (ImplicitPort, error) {
 }
 
 
+// SampleGrid evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+func (inst Function) SampleGrid(outputIdentifier string, origin Vector, spacing Vector, countX uint32, countY uint32, countZ uint32, progressCallback ProgressCallbackFunc, userData uintptr, values []float32) ([]float32, error) {
+	var neededforvalues C.uint64_t
+	ret := C.CCall_lib3mf_function_samplegrid(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.char)(unsafe.Pointer(&[]byte(outputIdentifier)[0])), (*C.sLib3MFVector)(unsafe.Pointer(&origin)), (*C.sLib3MFVector)(unsafe.Pointer(&spacing)), C.uint32_t(countX), C.uint32_t(countY), C.uint32_t(countZ), (C.Lib3MFProgressCallback)(unsafe.Pointer(&progressCallback)), (C.Lib3MF_pvoid)(userData), 0, &neededforvalues, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(values) < int(neededforvalues) {
+	 values = append(values, make([]float32, int(neededforvalues)-len(values))...)
+	}
+	ret = C.CCall_lib3mf_function_samplegrid(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.char)(unsafe.Pointer(&[]byte(outputIdentifier)[0])), (*C.sLib3MFVector)(unsafe.Pointer(&origin)), (*C.sLib3MFVector)(unsafe.Pointer(&spacing)), C.uint32_t(countX), C.uint32_t(countY), C.uint32_t(countZ), (C.Lib3MFProgressCallback)(unsafe.Pointer(&progressCallback)), (C.Lib3MF_pvoid)(userData), neededforvalues, nil, (*C.float)(unsafe.Pointer(&values[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	progressCallbackFunc = progressCallback
+	return values[:int(neededforvalues)], nil
+}
+
 // ImplicitFunction represents a Lib3MF class.
 type ImplicitFunction struct {
 	Function
@@ -6462,6 +6824,23 @@ func (inst ImplicitFunction) SortNodesTopologically() error {
 }
 
 
+// EvaluateBatch evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+func (inst ImplicitFunction) EvaluateBatch(inputs []float64, outputs []float64) ([]float64, error) {
+	var neededforoutputs C.uint64_t
+	ret := C.CCall_lib3mf_implicitfunction_evaluatebatch(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), 0, &neededforoutputs, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(outputs) < int(neededforoutputs) {
+	 outputs = append(outputs, make([]float64, int(neededforoutputs)-len(outputs))...)
+	}
+	ret = C.CCall_lib3mf_implicitfunction_evaluatebatch(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), neededforoutputs, nil, (*C.double)(unsafe.Pointer(&outputs[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return outputs[:int(neededforoutputs)], nil
+}
+
 // FunctionFromImage3D represents a Lib3MF class.
 type FunctionFromImage3D struct {
 	Function
@@ -7800,6 +8179,23 @@ func (inst Model) GetOutbox() (Box, error) {
 	return *(*Box)(unsafe.Pointer(&outbox)), nil
 }
 
+// GetBuildItemOutboxes returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads.
+func (inst Model) GetBuildItemOutboxes(outboxes []Box) ([]Box, error) {
+	var neededforoutboxes C.uint64_t
+	ret := C.CCall_lib3mf_model_getbuilditemoutboxes(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforoutboxes, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(outboxes) < int(neededforoutboxes) {
+	 outboxes = append(outboxes, make([]Box, int(neededforoutboxes)-len(outboxes))...)
+	}
+	ret = C.CCall_lib3mf_model_getbuilditemoutboxes(inst.wrapperRef.LibraryHandle, inst.Ref, neededforoutboxes, nil, (*C.sLib3MFBox)(unsafe.Pointer(&outboxes[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return outboxes[:int(neededforoutboxes)], nil
+}
+
 // GetResources creates a resource iterator instance with all resources.
 func (inst Model) GetResources() (ResourceIterator, error) {
 	var resourceIterator ref
@@ -52,12 +52,26 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Writer_WriteToFile = NULL;
 	pWrapperTable->m_Writer_GetStreamSize = NULL;
 	pWrapperTable->m_Writer_WriteToBuffer = NULL;
+	pWrapperTable->m_Writer_WriteToInternalBuffer = NULL;
+	pWrapperTable->m_Writer_GetInternalBufferAddress = NULL;
 	pWrapperTable->m_Writer_WriteToCallback = NULL;
 	pWrapperTable->m_Writer_SetProgressCallback = NULL;
 	pWrapperTable->m_Writer_GetDecimalPrecision = NULL;
 	pWrapperTable->m_Writer_SetDecimalPrecision = NULL;
 	pWrapperTable->m_Writer_SetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetStrictModeActive = NULL;
+	pWrapperTable->m_Writer_SetObjectThreadCount = NULL;
+	pWrapperTable->m_Writer_GetObjectThreadCount = NULL;
+	pWrapperTable->m_Writer_SetSubModelThreadCount = NULL;
+	pWrapperTable->m_Writer_GetSubModelThreadCount = NULL;
+	pWrapperTable->m_Writer_SetCompressionThreadCount = NULL;
+	pWrapperTable->m_Writer_GetCompressionThreadCount = NULL;
+	pWrapperTable->m_Writer_SetModelCompressionLevel = NULL;
+	pWrapperTable->m_Writer_GetModelCompressionLevel = NULL;
+	pWrapperTable->m_Writer_SetTextureCompressionLevel = NULL;
+	pWrapperTable->m_Writer_GetTextureCompressionLevel = NULL;
+	pWrapperTable->m_Writer_SetAttachmentCompressionLevel = NULL;
+	pWrapperTable->m_Writer_GetAttachmentCompressionLevel = NULL;
 	pWrapperTable->m_Writer_GetWarning = NULL;
 	pWrapperTable->m_Writer_GetWarningCount = NULL;
 	pWrapperTable->m_Writer_AddKeyWrappingCallback = NULL;
@@ -66,10 +80,23 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Reader_ReadFromBuffer = NULL;
 	pWrapperTable->m_Reader_ReadFromCallback = NULL;
 	pWrapperTable->m_Reader_SetProgressCallback = NULL;
+	pWrapperTable->m_Reader_SetVertexStreamCallback = NULL;
+	pWrapperTable->m_Reader_SetTriangleStreamCallback = NULL;
+	pWrapperTable->m_Reader_SetBeamStreamCallback = NULL;
+	pWrapperTable->m_Reader_SetComponentStreamCallback = NULL;
+	pWrapperTable->m_Reader_SetBuildItemStreamCallback = NULL;
 	pWrapperTable->m_Reader_AddRelationToRead = NULL;
 	pWrapperTable->m_Reader_RemoveRelationToRead = NULL;
 	pWrapperTable->m_Reader_SetStrictModeActive = NULL;
 	pWrapperTable->m_Reader_GetStrictModeActive = NULL;
+	pWrapperTable->m_Reader_SetSubModelThreadCount = NULL;
+	pWrapperTable->m_Reader_GetSubModelThreadCount = NULL;
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = NULL;
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = NULL;
+	pWrapperTable->m_Reader_SetBackgroundDecompressionActive = NULL;
+	pWrapperTable->m_Reader_GetBackgroundDecompressionActive = NULL;
+	pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = NULL;
+	pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = NULL;
 	pWrapperTable->m_Reader_GetWarning = NULL;
 	pWrapperTable->m_Reader_GetWarningCount = NULL;
 	pWrapperTable->m_Reader_AddKeyWrappingCallback = NULL;
@@ -195,6 +222,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_LevelSet_GetMesh = NULL;
 	pWrapperTable->m_LevelSet_GetVolumeData = NULL;
 	pWrapperTable->m_LevelSet_SetVolumeData = NULL;
+	pWrapperTable->m_LevelSet_SampleGrid = NULL;
 	pWrapperTable->m_BeamLattice_GetMinLength = NULL;
 	pWrapperTable->m_BeamLattice_SetMinLength = NULL;
 	pWrapperTable->m_BeamLattice_GetClipping = NULL;
@@ -434,6 +462,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Function_RemoveOutput = NULL;
 	pWrapperTable->m_Function_FindInput = NULL;
 	pWrapperTable->m_Function_FindOutput = NULL;
+	pWrapperTable->m_Function_SampleGrid = NULL;
 	pWrapperTable->m_ImplicitFunction_GetIdentifier = NULL;
 	pWrapperTable->m_ImplicitFunction_SetIdentifier = NULL;
 	pWrapperTable->m_ImplicitFunction_AddNode = NULL;
@@ -492,6 +521,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_ImplicitFunction_AddLinkByNames = NULL;
 	pWrapperTable->m_ImplicitFunction_Clear = NULL;
 	pWrapperTable->m_ImplicitFunction_SortNodesTopologically = NULL;
+	pWrapperTable->m_ImplicitFunction_EvaluateBatch = NULL;
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetFilter = NULL;
@@ -601,6 +631,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Model_SetBuildUUID = NULL;
 	pWrapperTable->m_Model_GetBuildItems = NULL;
 	pWrapperTable->m_Model_GetOutbox = NULL;
+	pWrapperTable->m_Model_GetBuildItemOutboxes = NULL;
 	pWrapperTable->m_Model_GetResources = NULL;
 	pWrapperTable->m_Model_GetObjects = NULL;
 	pWrapperTable->m_Model_GetMeshObjects = NULL;
@@ -758,6 +789,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_WriteToBuffer == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_WriteToInternalBuffer = (PLib3MFWriter_WriteToInternalBufferPtr) GetProcAddress(hLibrary, "lib3mf_writer_writetointernalbuffer");
+	#else // _WIN32
+	pWrapperTable->m_Writer_WriteToInternalBuffer = (PLib3MFWriter_WriteToInternalBufferPtr) dlsym(hLibrary, "lib3mf_writer_writetointernalbuffer");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_WriteToInternalBuffer == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetInternalBufferAddress = (PLib3MFWriter_GetInternalBufferAddressPtr) GetProcAddress(hLibrary, "lib3mf_writer_getinternalbufferaddress");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetInternalBufferAddress = (PLib3MFWriter_GetInternalBufferAddressPtr) dlsym(hLibrary, "lib3mf_writer_getinternalbufferaddress");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetInternalBufferAddress == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Writer_WriteToCallback = (PLib3MFWriter_WriteToCallbackPtr) GetProcAddress(hLibrary, "lib3mf_writer_writetocallback");
 	#else // _WIN32
@@ -812,6 +861,114 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_GetStrictModeActive == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetObjectThreadCount = (PLib3MFWriter_SetObjectThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setobjectthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetObjectThreadCount = (PLib3MFWriter_SetObjectThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setobjectthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetObjectThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetObjectThreadCount = (PLib3MFWriter_GetObjectThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getobjectthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetObjectThreadCount = (PLib3MFWriter_GetObjectThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getobjectthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetObjectThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetSubModelThreadCount = (PLib3MFWriter_SetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setsubmodelthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetSubModelThreadCount = (PLib3MFWriter_SetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setsubmodelthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetSubModelThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetSubModelThreadCount = (PLib3MFWriter_GetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getsubmodelthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetSubModelThreadCount = (PLib3MFWriter_GetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getsubmodelthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetSubModelThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetCompressionThreadCount = (PLib3MFWriter_SetCompressionThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setcompressionthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetCompressionThreadCount = (PLib3MFWriter_SetCompressionThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setcompressionthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetCompressionThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetCompressionThreadCount = (PLib3MFWriter_GetCompressionThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getcompressionthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetCompressionThreadCount = (PLib3MFWriter_GetCompressionThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getcompressionthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetCompressionThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetModelCompressionLevel = (PLib3MFWriter_SetModelCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setmodelcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetModelCompressionLevel = (PLib3MFWriter_SetModelCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setmodelcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetModelCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetModelCompressionLevel = (PLib3MFWriter_GetModelCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getmodelcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetModelCompressionLevel = (PLib3MFWriter_GetModelCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getmodelcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetModelCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetTextureCompressionLevel = (PLib3MFWriter_SetTextureCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_settexturecompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetTextureCompressionLevel = (PLib3MFWriter_SetTextureCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_settexturecompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetTextureCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetTextureCompressionLevel = (PLib3MFWriter_GetTextureCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_gettexturecompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetTextureCompressionLevel = (PLib3MFWriter_GetTextureCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_gettexturecompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetTextureCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetAttachmentCompressionLevel = (PLib3MFWriter_SetAttachmentCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setattachmentcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetAttachmentCompressionLevel = (PLib3MFWriter_SetAttachmentCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setattachmentcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetAttachmentCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetAttachmentCompressionLevel = (PLib3MFWriter_GetAttachmentCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getattachmentcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetAttachmentCompressionLevel = (PLib3MFWriter_GetAttachmentCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getattachmentcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetAttachmentCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Writer_GetWarning = (PLib3MFWriter_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_writer_getwarning");
 	#else // _WIN32
@@ -884,6 +1041,51 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_SetProgressCallback == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetVertexStreamCallback = (PLib3MFReader_SetVertexStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setvertexstreamcallback");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetVertexStreamCallback = (PLib3MFReader_SetVertexStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setvertexstreamcallback");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetVertexStreamCallback == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetTriangleStreamCallback = (PLib3MFReader_SetTriangleStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_settrianglestreamcallback");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetTriangleStreamCallback = (PLib3MFReader_SetTriangleStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_settrianglestreamcallback");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetTriangleStreamCallback == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetBeamStreamCallback = (PLib3MFReader_SetBeamStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setbeamstreamcallback");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetBeamStreamCallback = (PLib3MFReader_SetBeamStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setbeamstreamcallback");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetBeamStreamCallback == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetComponentStreamCallback = (PLib3MFReader_SetComponentStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setcomponentstreamcallback");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetComponentStreamCallback = (PLib3MFReader_SetComponentStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setcomponentstreamcallback");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetComponentStreamCallback == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetBuildItemStreamCallback = (PLib3MFReader_SetBuildItemStreamCallbackPtr) GetProcAddress(hLibrary, "lib3mf_reader_setbuilditemstreamcallback");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetBuildItemStreamCallback = (PLib3MFReader_SetBuildItemStreamCallbackPtr) dlsym(hLibrary, "lib3mf_reader_setbuilditemstreamcallback");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetBuildItemStreamCallback == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Reader_AddRelationToRead = (PLib3MFReader_AddRelationToReadPtr) GetProcAddress(hLibrary, "lib3mf_reader_addrelationtoread");
 	#else // _WIN32
@@ -920,6 +1122,78 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_GetStrictModeActive == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetSubModelThreadCount = (PLib3MFReader_SetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_setsubmodelthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetSubModelThreadCount = (PLib3MFReader_SetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_setsubmodelthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetSubModelThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetSubModelThreadCount = (PLib3MFReader_GetSubModelThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_getsubmodelthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetSubModelThreadCount = (PLib3MFReader_GetSubModelThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_getsubmodelthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetSubModelThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetBackgroundDecompressionActive = (PLib3MFReader_SetBackgroundDecompressionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setbackgrounddecompressionactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetBackgroundDecompressionActive = (PLib3MFReader_SetBackgroundDecompressionActivePtr) dlsym(hLibrary, "lib3mf_reader_setbackgrounddecompressionactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetBackgroundDecompressionActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetBackgroundDecompressionActive = (PLib3MFReader_GetBackgroundDecompressionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getbackgrounddecompressionactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetBackgroundDecompressionActive = (PLib3MFReader_GetBackgroundDecompressionActivePtr) dlsym(hLibrary, "lib3mf_reader_getbackgrounddecompressionactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetBackgroundDecompressionActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = (PLib3MFReader_SetLazyAttachmentLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazyattachmentloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive = (PLib3MFReader_SetLazyAttachmentLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazyattachmentloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetLazyAttachmentLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = (PLib3MFReader_GetLazyAttachmentLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazyattachmentloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive = (PLib3MFReader_GetLazyAttachmentLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazyattachmentloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetLazyAttachmentLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Reader_GetWarning = (PLib3MFReader_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_reader_getwarning");
 	#else // _WIN32
@@ -2045,6 +2319,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_LevelSet_SetVolumeData == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_LevelSet_SampleGrid = (PLib3MFLevelSet_SampleGridPtr) GetProcAddress(hLibrary, "lib3mf_levelset_samplegrid");
+	#else // _WIN32
+	pWrapperTable->m_LevelSet_SampleGrid = (PLib3MFLevelSet_SampleGridPtr) dlsym(hLibrary, "lib3mf_levelset_samplegrid");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_LevelSet_SampleGrid == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_BeamLattice_GetMinLength = (PLib3MFBeamLattice_GetMinLengthPtr) GetProcAddress(hLibrary, "lib3mf_beamlattice_getminlength");
 	#else // _WIN32
@@ -4196,6 +4479,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Function_FindOutput == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Function_SampleGrid = (PLib3MFFunction_SampleGridPtr) GetProcAddress(hLibrary, "lib3mf_function_samplegrid");
+	#else // _WIN32
+	pWrapperTable->m_Function_SampleGrid = (PLib3MFFunction_SampleGridPtr) dlsym(hLibrary, "lib3mf_function_samplegrid");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Function_SampleGrid == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_ImplicitFunction_GetIdentifier = (PLib3MFImplicitFunction_GetIdentifierPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_getidentifier");
 	#else // _WIN32
@@ -4718,6 +5010,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitFunction_EvaluateBatch = (PLib3MFImplicitFunction_EvaluateBatchPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_evaluatebatch");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitFunction_EvaluateBatch = (PLib3MFImplicitFunction_EvaluateBatchPtr) dlsym(hLibrary, "lib3mf_implicitfunction_evaluatebatch");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitFunction_EvaluateBatch == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = (PLib3MFFunctionFromImage3D_GetImage3DPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_getimage3d");
 	#else // _WIN32
@@ -5699,6 +6000,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Model_GetOutbox == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Model_GetBuildItemOutboxes = (PLib3MFModel_GetBuildItemOutboxesPtr) GetProcAddress(hLibrary, "lib3mf_model_getbuilditemoutboxes");
+	#else // _WIN32
+	pWrapperTable->m_Model_GetBuildItemOutboxes = (PLib3MFModel_GetBuildItemOutboxesPtr) dlsym(hLibrary, "lib3mf_model_getbuilditemoutboxes");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Model_GetBuildItemOutboxes == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Model_GetResources = (PLib3MFModel_GetResourcesPtr) GetProcAddress(hLibrary, "lib3mf_model_getresources");
 	#else // _WIN32
@@ -6373,6 +6683,24 @@ Lib3MFResult CCall_lib3mf_writer_writetobuffer(Lib3MFHandle libraryHandle, Lib3M
 }
 
 
+Lib3MFResult CCall_lib3mf_writer_writetointernalbuffer(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferSize)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_WriteToInternalBuffer (pWriter, pBufferSize);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getinternalbufferaddress(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferAddress)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetInternalBufferAddress (pWriter, pBufferAddress);
+}
+
+
 Lib3MFResult CCall_lib3mf_writer_writetocallback(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MFWriteCallback pTheWriteCallback, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
 {
 	if (libraryHandle == 0) 
@@ -6427,6 +6755,114 @@ Lib3MFResult CCall_lib3mf_writer_getstrictmodeactive(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_writer_setobjectthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetObjectThreadCount (pWriter, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getobjectthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetObjectThreadCount (pWriter, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setsubmodelthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetSubModelThreadCount (pWriter, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getsubmodelthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetSubModelThreadCount (pWriter, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setcompressionthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetCompressionThreadCount (pWriter, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getcompressionthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetCompressionThreadCount (pWriter, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setmodelcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetModelCompressionLevel (pWriter, nCompressionLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getmodelcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetModelCompressionLevel (pWriter, pCompressionLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_settexturecompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetTextureCompressionLevel (pWriter, nCompressionLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_gettexturecompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetTextureCompressionLevel (pWriter, pCompressionLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setattachmentcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetAttachmentCompressionLevel (pWriter, nCompressionLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getattachmentcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetAttachmentCompressionLevel (pWriter, pCompressionLevel);
+}
+
+
 Lib3MFResult CCall_lib3mf_writer_getwarning(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
 	if (libraryHandle == 0) 
@@ -6499,6 +6935,51 @@ Lib3MFResult CCall_lib3mf_reader_setprogresscallback(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_reader_setvertexstreamcallback(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFVertexStreamCallback pVertexStreamCallback, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetVertexStreamCallback (pReader, pVertexStreamCallback, pUserData);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_settrianglestreamcallback(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFTriangleStreamCallback pTriangleStreamCallback, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetTriangleStreamCallback (pReader, pTriangleStreamCallback, pUserData);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setbeamstreamcallback(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFBeamStreamCallback pBeamStreamCallback, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetBeamStreamCallback (pReader, pBeamStreamCallback, pUserData);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setcomponentstreamcallback(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFComponentStreamCallback pComponentStreamCallback, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetComponentStreamCallback (pReader, pComponentStreamCallback, pUserData);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setbuilditemstreamcallback(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFBuildItemStreamCallback pBuildItemStreamCallback, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetBuildItemStreamCallback (pReader, pBuildItemStreamCallback, pUserData);
+}
+
+
 Lib3MFResult CCall_lib3mf_reader_addrelationtoread(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, const char * pRelationShipType)
 {
 	if (libraryHandle == 0) 
@@ -6535,6 +7016,78 @@ Lib3MFResult CCall_lib3mf_reader_getstrictmodeactive(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_reader_setsubmodelthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetSubModelThreadCount (pReader, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getsubmodelthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetSubModelThreadCount (pReader, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setlazymeshloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool bLazyMeshLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetLazyMeshLoadingActive (pReader, bLazyMeshLoadingActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getlazymeshloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetLazyMeshLoadingActive (pReader, pLazyMeshLoadingActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setbackgrounddecompressionactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool bBackgroundDecompressionActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetBackgroundDecompressionActive (pReader, bBackgroundDecompressionActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getbackgrounddecompressionactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool * pBackgroundDecompressionActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetBackgroundDecompressionActive (pReader, pBackgroundDecompressionActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setlazyattachmentloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool bLazyAttachmentLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetLazyAttachmentLoadingActive (pReader, bLazyAttachmentLoadingActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getlazyattachmentloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool * pLazyAttachmentLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetLazyAttachmentLoadingActive (pReader, pLazyAttachmentLoadingActive);
+}
+
+
 Lib3MFResult CCall_lib3mf_reader_getwarning(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
 	if (libraryHandle == 0) 
@@ -7660,6 +8213,15 @@ Lib3MFResult CCall_lib3mf_levelset_setvolumedata(Lib3MFHandle libraryHandle, Lib
 }
 
 
+Lib3MFResult CCall_lib3mf_levelset_samplegrid(Lib3MFHandle libraryHandle, Lib3MF_LevelSet pLevelSet, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_LevelSet_SampleGrid (pLevelSet, pOrigin, pSpacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_beamlattice_getminlength(Lib3MFHandle libraryHandle, Lib3MF_BeamLattice pBeamLattice, Lib3MF_double * pMinLength)
 {
 	if (libraryHandle == 0) 
@@ -9811,6 +10373,15 @@ Lib3MFResult CCall_lib3mf_function_findoutput(Lib3MFHandle libraryHandle, Lib3MF
 }
 
 
+Lib3MFResult CCall_lib3mf_function_samplegrid(Lib3MFHandle libraryHandle, Lib3MF_Function pFunction, const char * pOutputIdentifier, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Function_SampleGrid (pFunction, pOutputIdentifier, pOrigin, pSpacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_implicitfunction_getidentifier(Lib3MFHandle libraryHandle, Lib3MF_ImplicitFunction pImplicitFunction, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
 	if (libraryHandle == 0) 
@@ -10333,6 +10904,15 @@ Lib3MFResult CCall_lib3mf_implicitfunction_sortnodestopologically(Lib3MFHandle l
 }
 
 
+Lib3MFResult CCall_lib3mf_implicitfunction_evaluatebatch(Lib3MFHandle libraryHandle, Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitFunction_EvaluateBatch (pImplicitFunction, nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_functionfromimage3d_getimage3d(Lib3MFHandle libraryHandle, Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3D * pImage3D)
 {
 	if (libraryHandle == 0) 
@@ -11314,6 +11894,15 @@ Lib3MFResult CCall_lib3mf_model_getoutbox(Lib3MFHandle libraryHandle, Lib3MF_Mod
 }
 
 
+Lib3MFResult CCall_lib3mf_model_getbuilditemoutboxes(Lib3MFHandle libraryHandle, Lib3MF_Model pModel, const Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, sLib3MFBox * pOutboxesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Model_GetBuildItemOutboxes (pModel, nOutboxesBufferSize, pOutboxesNeededCount, pOutboxesBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_model_getresources(Lib3MFHandle libraryHandle, Lib3MF_Model pModel, Lib3MF_ResourceIterator * pResourceIterator)
 {
 	if (libraryHandle == 0) 
@@ -779,6 +779,16 @@ func (implementation *Lib3MFImplementation) Initialize(DLLFileName string) error
 		return errors.New("Could not get function lib3mf_writer_writetobuffer: " + err.Error())
 	}
 
+	implementation.Lib3MF_writer_writetointernalbuffer, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_writetointernalbuffer")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_writetointernalbuffer: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getinternalbufferaddress, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getinternalbufferaddress")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getinternalbufferaddress: " + err.Error())
+	}
+
 	implementation.Lib3MF_writer_writetocallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_writetocallback")
 	if err != nil {
 		return errors.New("Could not get function lib3mf_writer_writetocallback: " + err.Error())
@@ -809,6 +819,66 @@ func (implementation *Lib3MFImplementation) Initialize(DLLFileName string) error
 		return errors.New("Could not get function lib3mf_writer_getstrictmodeactive: " + err.Error())
 	}
 
+	implementation.Lib3MF_writer_setobjectthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_setobjectthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_setobjectthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getobjectthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getobjectthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getobjectthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_setsubmodelthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_setsubmodelthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_setsubmodelthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getsubmodelthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getsubmodelthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getsubmodelthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_setcompressionthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_setcompressionthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_setcompressionthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getcompressionthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getcompressionthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getcompressionthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_setmodelcompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_setmodelcompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_setmodelcompressionlevel: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getmodelcompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getmodelcompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getmodelcompressionlevel: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_settexturecompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_settexturecompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_settexturecompressionlevel: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_gettexturecompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_gettexturecompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_gettexturecompressionlevel: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_setattachmentcompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_setattachmentcompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_setattachmentcompressionlevel: " + err.Error())
+	}
+
+	implementation.Lib3MF_writer_getattachmentcompressionlevel, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getattachmentcompressionlevel")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_writer_getattachmentcompressionlevel: " + err.Error())
+	}
+
 	implementation.Lib3MF_writer_getwarning, err = syscall.GetProcAddress(dllHandle, "lib3mf_writer_getwarning")
 	if err != nil {
 		return errors.New("Could not get function lib3mf_writer_getwarning: " + err.Error())
@@ -849,6 +919,31 @@ func (implementation *Lib3MFImplementation) Initialize(DLLFileName string) error
 		return errors.New("Could not get function lib3mf_reader_setprogresscallback: " + err.Error())
 	}
 
+	implementation.Lib3MF_reader_setvertexstreamcallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setvertexstreamcallback")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setvertexstreamcallback: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_settrianglestreamcallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_settrianglestreamcallback")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_settrianglestreamcallback: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setbeamstreamcallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setbeamstreamcallback")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setbeamstreamcallback: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setcomponentstreamcallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setcomponentstreamcallback")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setcomponentstreamcallback: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setbuilditemstreamcallback, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setbuilditemstreamcallback")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setbuilditemstreamcallback: " + err.Error())
+	}
+
 	implementation.Lib3MF_reader_addrelationtoread, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_addrelationtoread")
 	if err != nil {
 		return errors.New("Could not get function lib3mf_reader_addrelationtoread: " + err.Error())
@@ -869,6 +964,46 @@ func (implementation *Lib3MFImplementation) Initialize(DLLFileName string) error
 		return errors.New("Could not get function lib3mf_reader_getstrictmodeactive: " + err.Error())
 	}
 
+	implementation.Lib3MF_reader_setsubmodelthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setsubmodelthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setsubmodelthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_getsubmodelthreadcount, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_getsubmodelthreadcount")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_getsubmodelthreadcount: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setlazymeshloadingactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setlazymeshloadingactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setlazymeshloadingactive: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_getlazymeshloadingactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_getlazymeshloadingactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_getlazymeshloadingactive: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setbackgrounddecompressionactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setbackgrounddecompressionactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setbackgrounddecompressionactive: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_getbackgrounddecompressionactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_getbackgrounddecompressionactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_getbackgrounddecompressionactive: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_setlazyattachmentloadingactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_setlazyattachmentloadingactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_setlazyattachmentloadingactive: " + err.Error())
+	}
+
+	implementation.Lib3MF_reader_getlazyattachmentloadingactive, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_getlazyattachmentloadingactive")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_reader_getlazyattachmentloadingactive: " + err.Error())
+	}
+
 	implementation.Lib3MF_reader_getwarning, err = syscall.GetProcAddress(dllHandle, "lib3mf_reader_getwarning")
 	if err != nil {
 		return errors.New("Could not get function lib3mf_reader_getwarning: " + err.Error())
@@ -2809,6 +2944,11 @@ func (implementation *Lib3MFImplementation) Initialize(DLLFileName string) error
 		return errors.New("Could not get function lib3mf_model_getoutbox: " + err.Error())
 	}
 
+	implementation.Lib3MF_model_getbuilditemoutboxes, err = syscall.GetProcAddress(dllHandle, "lib3mf_model_getbuilditemoutboxes")
+	if err != nil {
+		return errors.New("Could not get function lib3mf_model_getbuilditemoutboxes: " + err.Error())
+	}
+
 	implementation.Lib3MF_model_getresources, err = syscall.GetProcAddress(dllHandle, "lib3mf_model_getresources")
 	if err != nil {
 		return errors.New("Could not get function lib3mf_model_getresources: " + err.Error())
@@ -3298,6 +3438,40 @@ func (implementation *Lib3MFImplementation) Writer_WriteToBuffer(Writer Lib3MFHa
 	return bufferBuffer, err
 }
 
+func (implementation *Lib3MFImplementation) Writer_WriteToInternalBuffer(Writer Lib3MFHandle) (uint64, error) {
+	var err error = nil
+	var nBufferSize uint64 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_writetointernalbuffer, implementation_writer.GetDLLInHandle(), UInt64OutValue(&nBufferSize))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint64(nBufferSize), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetInternalBufferAddress(Writer Lib3MFHandle) (uint64, error) {
+	var err error = nil
+	var nBufferAddress uint64 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getinternalbufferaddress, implementation_writer.GetDLLInHandle(), UInt64OutValue(&nBufferAddress))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint64(nBufferAddress), err
+}
+
 func (implementation *Lib3MFImplementation) Writer_WriteToCallback(Writer Lib3MFHandle, pTheWriteCallback int64, pTheSeekCallback int64, nUserData uint64) error {
 	var err error = nil
 
@@ -3400,6 +3574,204 @@ func (implementation *Lib3MFImplementation) Writer_GetStrictModeActive(Writer Li
 	return (bStrictModeActive != 0), err
 }
 
+func (implementation *Lib3MFImplementation) Writer_SetObjectThreadCount(Writer Lib3MFHandle, nThreadCount uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_setobjectthreadcount, implementation_writer.GetDLLInHandle(), UInt32InValue(nThreadCount))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetObjectThreadCount(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nThreadCount uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getobjectthreadcount, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nThreadCount))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nThreadCount), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_SetSubModelThreadCount(Writer Lib3MFHandle, nThreadCount uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_setsubmodelthreadcount, implementation_writer.GetDLLInHandle(), UInt32InValue(nThreadCount))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetSubModelThreadCount(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nThreadCount uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getsubmodelthreadcount, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nThreadCount))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nThreadCount), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_SetCompressionThreadCount(Writer Lib3MFHandle, nThreadCount uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_setcompressionthreadcount, implementation_writer.GetDLLInHandle(), UInt32InValue(nThreadCount))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetCompressionThreadCount(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nThreadCount uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getcompressionthreadcount, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nThreadCount))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nThreadCount), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_SetModelCompressionLevel(Writer Lib3MFHandle, nCompressionLevel uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_setmodelcompressionlevel, implementation_writer.GetDLLInHandle(), UInt32InValue(nCompressionLevel))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetModelCompressionLevel(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nCompressionLevel uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getmodelcompressionlevel, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nCompressionLevel))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nCompressionLevel), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_SetTextureCompressionLevel(Writer Lib3MFHandle, nCompressionLevel uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_settexturecompressionlevel, implementation_writer.GetDLLInHandle(), UInt32InValue(nCompressionLevel))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetTextureCompressionLevel(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nCompressionLevel uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_gettexturecompressionlevel, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nCompressionLevel))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nCompressionLevel), err
+}
+
+func (implementation *Lib3MFImplementation) Writer_SetAttachmentCompressionLevel(Writer Lib3MFHandle, nCompressionLevel uint32) error {
+	var err error = nil
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_setattachmentcompressionlevel, implementation_writer.GetDLLInHandle(), UInt32InValue(nCompressionLevel))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Writer_GetAttachmentCompressionLevel(Writer Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nCompressionLevel uint32 = 0
+
+	implementation_writer, err := implementation.GetWrapperHandle(Writer)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_writer_getattachmentcompressionlevel, implementation_writer.GetDLLInHandle(), UInt32OutValue(&nCompressionLevel))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nCompressionLevel), err
+}
+
 func (implementation *Lib3MFImplementation) Writer_GetWarning(Writer Lib3MFHandle, nIndex uint32) (uint32, string, error) {
 	var err error = nil
 	var nErrorCode uint32 = 0
@@ -3538,6 +3910,86 @@ func (implementation *Lib3MFImplementation) Reader_SetProgressCallback(Reader Li
 	return err
 }
 
+func (implementation *Lib3MFImplementation) Reader_SetVertexStreamCallback(Reader Lib3MFHandle, pVertexStreamCallback int64, nUserData uint64) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setvertexstreamcallback, implementation_reader.GetDLLInHandle(), 0, UInt64InValue(nUserData))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetTriangleStreamCallback(Reader Lib3MFHandle, pTriangleStreamCallback int64, nUserData uint64) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_settrianglestreamcallback, implementation_reader.GetDLLInHandle(), 0, UInt64InValue(nUserData))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetBeamStreamCallback(Reader Lib3MFHandle, pBeamStreamCallback int64, nUserData uint64) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setbeamstreamcallback, implementation_reader.GetDLLInHandle(), 0, UInt64InValue(nUserData))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetComponentStreamCallback(Reader Lib3MFHandle, pComponentStreamCallback int64, nUserData uint64) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setcomponentstreamcallback, implementation_reader.GetDLLInHandle(), 0, UInt64InValue(nUserData))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetBuildItemStreamCallback(Reader Lib3MFHandle, pBuildItemStreamCallback int64, nUserData uint64) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setbuilditemstreamcallback, implementation_reader.GetDLLInHandle(), 0, UInt64InValue(nUserData))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
 func (implementation *Lib3MFImplementation) Reader_AddRelationToRead(Reader Lib3MFHandle, sRelationShipType string) error {
 	var err error = nil
 
@@ -3607,6 +4059,150 @@ func (implementation *Lib3MFImplementation) Reader_GetStrictModeActive(Reader Li
 	return (bStrictModeActive != 0), err
 }
 
+func (implementation *Lib3MFImplementation) Reader_SetSubModelThreadCount(Reader Lib3MFHandle, nThreadCount uint32) error {
+	var err error = nil
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setsubmodelthreadcount, implementation_reader.GetDLLInHandle(), UInt32InValue(nThreadCount))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_GetSubModelThreadCount(Reader Lib3MFHandle) (uint32, error) {
+	var err error = nil
+	var nThreadCount uint32 = 0
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return 0, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_getsubmodelthreadcount, implementation_reader.GetDLLInHandle(), UInt32OutValue(&nThreadCount))
+	if err != nil {
+		return 0, err
+	}
+
+	return uint32(nThreadCount), err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetLazyMeshLoadingActive(Reader Lib3MFHandle, bLazyMeshLoadingActive bool) error {
+	var err error = nil
+	var nLazyMeshLoadingActive uint8 = 0
+	if bLazyMeshLoadingActive {
+		nLazyMeshLoadingActive = 1
+	}
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setlazymeshloadingactive, implementation_reader.GetDLLInHandle(), UInt8InValue(nLazyMeshLoadingActive))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_GetLazyMeshLoadingActive(Reader Lib3MFHandle) (bool, error) {
+	var err error = nil
+	var bLazyMeshLoadingActive int64 = 0
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return false, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_getlazymeshloadingactive, implementation_reader.GetDLLInHandle(), Int64OutValue(&bLazyMeshLoadingActive))
+	if err != nil {
+		return false, err
+	}
+
+	return (bLazyMeshLoadingActive != 0), err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetBackgroundDecompressionActive(Reader Lib3MFHandle, bBackgroundDecompressionActive bool) error {
+	var err error = nil
+	var nBackgroundDecompressionActive uint8 = 0
+	if bBackgroundDecompressionActive {
+		nBackgroundDecompressionActive = 1
+	}
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setbackgrounddecompressionactive, implementation_reader.GetDLLInHandle(), UInt8InValue(nBackgroundDecompressionActive))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_GetBackgroundDecompressionActive(Reader Lib3MFHandle) (bool, error) {
+	var err error = nil
+	var bBackgroundDecompressionActive int64 = 0
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return false, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_getbackgrounddecompressionactive, implementation_reader.GetDLLInHandle(), Int64OutValue(&bBackgroundDecompressionActive))
+	if err != nil {
+		return false, err
+	}
+
+	return (bBackgroundDecompressionActive != 0), err
+}
+
+func (implementation *Lib3MFImplementation) Reader_SetLazyAttachmentLoadingActive(Reader Lib3MFHandle, bLazyAttachmentLoadingActive bool) error {
+	var err error = nil
+	var nLazyAttachmentLoadingActive uint8 = 0
+	if bLazyAttachmentLoadingActive {
+		nLazyAttachmentLoadingActive = 1
+	}
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_setlazyattachmentloadingactive, implementation_reader.GetDLLInHandle(), UInt8InValue(nLazyAttachmentLoadingActive))
+	if err != nil {
+		return err
+	}
+
+	return err
+}
+
+func (implementation *Lib3MFImplementation) Reader_GetLazyAttachmentLoadingActive(Reader Lib3MFHandle) (bool, error) {
+	var err error = nil
+	var bLazyAttachmentLoadingActive int64 = 0
+
+	implementation_reader, err := implementation.GetWrapperHandle(Reader)
+	if err != nil {
+		return false, err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_reader_getlazyattachmentloadingactive, implementation_reader.GetDLLInHandle(), Int64OutValue(&bLazyAttachmentLoadingActive))
+	if err != nil {
+		return false, err
+	}
+
+	return (bLazyAttachmentLoadingActive != 0), err
+}
+
 func (implementation *Lib3MFImplementation) Reader_GetWarning(Reader Lib3MFHandle, nIndex uint32) (uint32, string, error) {
 	var err error = nil
 	var nErrorCode uint32 = 0
@@ -10755,6 +11351,27 @@ func (implementation *Lib3MFImplementation) Model_GetOutbox(Model Lib3MFHandle)
 	return sOutbox, err
 }
 
+func (implementation *Lib3MFImplementation) Model_GetBuildItemOutboxes(Model Lib3MFHandle) ([]sLib3MFBox, error) {
+	var err error = nil
+	arrayOutboxes := make([]sLib3MFBox, 0)
+
+	implementation_model, err := implementation.GetWrapperHandle(Model)
+	if err != nil {
+		return make([]sLib3MFBox, 0), err
+	}
+
+	err = implementation.CallFunction(implementation.Lib3MF_model_getbuilditemoutboxes, implementation_model.GetDLLInHandle(), 0, 0, 0)
+	if err != nil {
+		return make([]sLib3MFBox, 0), err
+	}
+	err = implementation.CallFunction(implementation.Lib3MF_model_getbuilditemoutboxes, implementation_model.GetDLLInHandle(), 0, 0, 0)
+	if err != nil {
+		return make([]sLib3MFBox, 0), err
+	}
+
+	return arrayOutboxes, err
+}
+
 func (implementation *Lib3MFImplementation) Model_GetResources(Model Lib3MFHandle) (Lib3MFHandle, error) {
 	var err error = nil
 	hResourceIterator := implementation.NewHandle()
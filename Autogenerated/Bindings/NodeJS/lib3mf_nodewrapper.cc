@@ -1487,12 +1487,26 @@ void CLib3MFWriter::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "WriteToFile", WriteToFile);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStreamSize", GetStreamSize);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "WriteToBuffer", WriteToBuffer);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "WriteToInternalBuffer", WriteToInternalBuffer);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInternalBufferAddress", GetInternalBufferAddress);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "WriteToCallback", WriteToCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetProgressCallback", SetProgressCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetDecimalPrecision", GetDecimalPrecision);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetDecimalPrecision", SetDecimalPrecision);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetStrictModeActive", SetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStrictModeActive", GetStrictModeActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetObjectThreadCount", SetObjectThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetObjectThreadCount", GetObjectThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetSubModelThreadCount", SetSubModelThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetSubModelThreadCount", GetSubModelThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetCompressionThreadCount", SetCompressionThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetCompressionThreadCount", GetCompressionThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetModelCompressionLevel", SetModelCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetModelCompressionLevel", GetModelCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetTextureCompressionLevel", SetTextureCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTextureCompressionLevel", GetTextureCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetAttachmentCompressionLevel", SetAttachmentCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetAttachmentCompressionLevel", GetAttachmentCompressionLevel);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarning", GetWarning);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarningCount", GetWarningCount);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddKeyWrappingCallback", AddKeyWrappingCallback);
@@ -1597,6 +1611,50 @@ void CLib3MFWriter::WriteToBuffer(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFWriter::WriteToInternalBuffer(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        uint64_t nReturnBufferSize = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method WriteToInternalBuffer.");
+        if (wrapperTable->m_Writer_WriteToInternalBuffer == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::WriteToInternalBuffer.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_WriteToInternalBuffer(instanceHandle, &nReturnBufferSize);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, std::to_string(nReturnBufferSize).c_str()));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetInternalBufferAddress(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        uint64_t nReturnBufferAddress = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInternalBufferAddress.");
+        if (wrapperTable->m_Writer_GetInternalBufferAddress == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetInternalBufferAddress.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetInternalBufferAddress(instanceHandle, &nReturnBufferAddress);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, std::to_string(nReturnBufferAddress).c_str()));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFWriter::WriteToCallback(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -1741,6 +1799,282 @@ void CLib3MFWriter::GetStrictModeActive(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFWriter::SetObjectThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetObjectThreadCount.");
+        if (wrapperTable->m_Writer_SetObjectThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetObjectThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetObjectThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetObjectThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetObjectThreadCount.");
+        if (wrapperTable->m_Writer_GetObjectThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetObjectThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetObjectThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetSubModelThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetSubModelThreadCount.");
+        if (wrapperTable->m_Writer_SetSubModelThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetSubModelThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetSubModelThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetSubModelThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetSubModelThreadCount.");
+        if (wrapperTable->m_Writer_GetSubModelThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetSubModelThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetSubModelThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetCompressionThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetCompressionThreadCount.");
+        if (wrapperTable->m_Writer_SetCompressionThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetCompressionThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetCompressionThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetCompressionThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetCompressionThreadCount.");
+        if (wrapperTable->m_Writer_GetCompressionThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetCompressionThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetCompressionThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetModelCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (CompressionLevel)");
+        }
+        unsigned int nCompressionLevel = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetModelCompressionLevel.");
+        if (wrapperTable->m_Writer_SetModelCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetModelCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetModelCompressionLevel(instanceHandle, nCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetModelCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnCompressionLevel = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetModelCompressionLevel.");
+        if (wrapperTable->m_Writer_GetModelCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetModelCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetModelCompressionLevel(instanceHandle, &nReturnCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnCompressionLevel));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetTextureCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (CompressionLevel)");
+        }
+        unsigned int nCompressionLevel = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetTextureCompressionLevel.");
+        if (wrapperTable->m_Writer_SetTextureCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetTextureCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetTextureCompressionLevel(instanceHandle, nCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetTextureCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnCompressionLevel = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTextureCompressionLevel.");
+        if (wrapperTable->m_Writer_GetTextureCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetTextureCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetTextureCompressionLevel(instanceHandle, &nReturnCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnCompressionLevel));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetAttachmentCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (CompressionLevel)");
+        }
+        unsigned int nCompressionLevel = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetAttachmentCompressionLevel.");
+        if (wrapperTable->m_Writer_SetAttachmentCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetAttachmentCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetAttachmentCompressionLevel(instanceHandle, nCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetAttachmentCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnCompressionLevel = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetAttachmentCompressionLevel.");
+        if (wrapperTable->m_Writer_GetAttachmentCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetAttachmentCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetAttachmentCompressionLevel(instanceHandle, &nReturnCompressionLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnCompressionLevel));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFWriter::GetWarning(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -1881,10 +2215,23 @@ void CLib3MFReader::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "ReadFromBuffer", ReadFromBuffer);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "ReadFromCallback", ReadFromCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetProgressCallback", SetProgressCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetVertexStreamCallback", SetVertexStreamCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetTriangleStreamCallback", SetTriangleStreamCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetBeamStreamCallback", SetBeamStreamCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetComponentStreamCallback", SetComponentStreamCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetBuildItemStreamCallback", SetBuildItemStreamCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddRelationToRead", AddRelationToRead);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "RemoveRelationToRead", RemoveRelationToRead);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetStrictModeActive", SetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStrictModeActive", GetStrictModeActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetSubModelThreadCount", SetSubModelThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetSubModelThreadCount", GetSubModelThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetLazyMeshLoadingActive", SetLazyMeshLoadingActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetLazyMeshLoadingActive", GetLazyMeshLoadingActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetBackgroundDecompressionActive", SetBackgroundDecompressionActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetBackgroundDecompressionActive", GetBackgroundDecompressionActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetLazyAttachmentLoadingActive", SetLazyAttachmentLoadingActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetLazyAttachmentLoadingActive", GetLazyAttachmentLoadingActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarning", GetWarning);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarningCount", GetWarningCount);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddKeyWrappingCallback", AddKeyWrappingCallback);
@@ -1927,18 +2274,148 @@ void CLib3MFReader::ReadFromFile(const FunctionCallbackInfo<Value>& args)
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        if (!args[0]->IsString()) {
-            throw std::runtime_error("Expected string parameter 0 (Filename)");
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (Filename)");
+        }
+        v8::String::Utf8Value sutf8Filename(isolate, args[0]);
+        std::string sFilename = *sutf8Filename;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromFile.");
+        if (wrapperTable->m_Reader_ReadFromFile == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromFile.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromFile(instanceHandle, sFilename.c_str());
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::ReadFromBuffer(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromBuffer.");
+        if (wrapperTable->m_Reader_ReadFromBuffer == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromBuffer.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromBuffer(instanceHandle, 0, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::ReadFromCallback(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected uint64 parameter 1 (StreamSize)");
+        }
+        if (!args[3]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 3 (UserData)");
+        }
+        v8::String::Utf8Value sutf8StreamSize(isolate, args[1]);
+        std::string sStreamSize = *sutf8StreamSize;
+        uint64_t nStreamSize = stoull(sStreamSize);
+        v8::String::Utf8Value sutf8UserData(isolate, args[3]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromCallback.");
+        if (wrapperTable->m_Reader_ReadFromCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromCallback.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromCallback(instanceHandle, nullptr, nStreamSize, nullptr, (void*) nUserData);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetProgressCallback(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 1 (UserData)");
+        }
+        v8::String::Utf8Value sutf8UserData(isolate, args[1]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetProgressCallback.");
+        if (wrapperTable->m_Reader_SetProgressCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetProgressCallback.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetProgressCallback(instanceHandle, nullptr, (void*) nUserData);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetVertexStreamCallback(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 1 (UserData)");
+        }
+        v8::String::Utf8Value sutf8UserData(isolate, args[1]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetVertexStreamCallback.");
+        if (wrapperTable->m_Reader_SetVertexStreamCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetVertexStreamCallback.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetVertexStreamCallback(instanceHandle, nullptr, (void*) nUserData);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetTriangleStreamCallback(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 1 (UserData)");
         }
-        v8::String::Utf8Value sutf8Filename(isolate, args[0]);
-        std::string sFilename = *sutf8Filename;
+        v8::String::Utf8Value sutf8UserData(isolate, args[1]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromFile.");
-        if (wrapperTable->m_Reader_ReadFromFile == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromFile.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetTriangleStreamCallback.");
+        if (wrapperTable->m_Reader_SetTriangleStreamCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetTriangleStreamCallback.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromFile(instanceHandle, sFilename.c_str());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetTriangleStreamCallback(instanceHandle, nullptr, (void*) nUserData);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -1947,18 +2424,24 @@ void CLib3MFReader::ReadFromFile(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFReader::ReadFromBuffer(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFReader::SetBeamStreamCallback(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 1 (UserData)");
+        }
+        v8::String::Utf8Value sutf8UserData(isolate, args[1]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromBuffer.");
-        if (wrapperTable->m_Reader_ReadFromBuffer == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromBuffer.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetBeamStreamCallback.");
+        if (wrapperTable->m_Reader_SetBeamStreamCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetBeamStreamCallback.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromBuffer(instanceHandle, 0, nullptr);
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetBeamStreamCallback(instanceHandle, nullptr, (void*) nUserData);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -1967,30 +2450,24 @@ void CLib3MFReader::ReadFromBuffer(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFReader::ReadFromCallback(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFReader::SetComponentStreamCallback(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
         if (!args[1]->IsString()) {
-            throw std::runtime_error("Expected uint64 parameter 1 (StreamSize)");
-        }
-        if (!args[3]->IsString()) {
-            throw std::runtime_error("Expected pointer parameter 3 (UserData)");
+            throw std::runtime_error("Expected pointer parameter 1 (UserData)");
         }
-        v8::String::Utf8Value sutf8StreamSize(isolate, args[1]);
-        std::string sStreamSize = *sutf8StreamSize;
-        uint64_t nStreamSize = stoull(sStreamSize);
-        v8::String::Utf8Value sutf8UserData(isolate, args[3]);
+        v8::String::Utf8Value sutf8UserData(isolate, args[1]);
         std::string sUserData = *sutf8UserData;
         uint64_t nUserData = stoull(sUserData);
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReadFromCallback.");
-        if (wrapperTable->m_Reader_ReadFromCallback == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method Reader::ReadFromCallback.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetComponentStreamCallback.");
+        if (wrapperTable->m_Reader_SetComponentStreamCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetComponentStreamCallback.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_Reader_ReadFromCallback(instanceHandle, nullptr, nStreamSize, nullptr, (void*) nUserData);
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetComponentStreamCallback(instanceHandle, nullptr, (void*) nUserData);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -1999,7 +2476,7 @@ void CLib3MFReader::ReadFromCallback(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFReader::SetProgressCallback(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFReader::SetBuildItemStreamCallback(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
@@ -2012,11 +2489,11 @@ void CLib3MFReader::SetProgressCallback(const FunctionCallbackInfo<Value>& args)
         uint64_t nUserData = stoull(sUserData);
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetProgressCallback.");
-        if (wrapperTable->m_Reader_SetProgressCallback == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method Reader::SetProgressCallback.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetBuildItemStreamCallback.");
+        if (wrapperTable->m_Reader_SetBuildItemStreamCallback == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetBuildItemStreamCallback.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_Reader_SetProgressCallback(instanceHandle, nullptr, (void*) nUserData);
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetBuildItemStreamCallback(instanceHandle, nullptr, (void*) nUserData);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -2121,6 +2598,190 @@ void CLib3MFReader::GetStrictModeActive(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFReader::SetSubModelThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetSubModelThreadCount.");
+        if (wrapperTable->m_Reader_SetSubModelThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetSubModelThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetSubModelThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetSubModelThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetSubModelThreadCount.");
+        if (wrapperTable->m_Reader_GetSubModelThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetSubModelThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetSubModelThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetLazyMeshLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (LazyMeshLoadingActive)");
+        }
+        bool bLazyMeshLoadingActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetLazyMeshLoadingActive.");
+        if (wrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetLazyMeshLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetLazyMeshLoadingActive(instanceHandle, bLazyMeshLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetLazyMeshLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnLazyMeshLoadingActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetLazyMeshLoadingActive.");
+        if (wrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetLazyMeshLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetLazyMeshLoadingActive(instanceHandle, &bReturnLazyMeshLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnLazyMeshLoadingActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetBackgroundDecompressionActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (BackgroundDecompressionActive)");
+        }
+        bool bBackgroundDecompressionActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetBackgroundDecompressionActive.");
+        if (wrapperTable->m_Reader_SetBackgroundDecompressionActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetBackgroundDecompressionActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetBackgroundDecompressionActive(instanceHandle, bBackgroundDecompressionActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetBackgroundDecompressionActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnBackgroundDecompressionActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetBackgroundDecompressionActive.");
+        if (wrapperTable->m_Reader_GetBackgroundDecompressionActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetBackgroundDecompressionActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetBackgroundDecompressionActive(instanceHandle, &bReturnBackgroundDecompressionActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnBackgroundDecompressionActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetLazyAttachmentLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (LazyAttachmentLoadingActive)");
+        }
+        bool bLazyAttachmentLoadingActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetLazyAttachmentLoadingActive.");
+        if (wrapperTable->m_Reader_SetLazyAttachmentLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetLazyAttachmentLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetLazyAttachmentLoadingActive(instanceHandle, bLazyAttachmentLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetLazyAttachmentLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnLazyAttachmentLoadingActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetLazyAttachmentLoadingActive.");
+        if (wrapperTable->m_Reader_GetLazyAttachmentLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetLazyAttachmentLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetLazyAttachmentLoadingActive(instanceHandle, &bReturnLazyAttachmentLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnLazyAttachmentLoadingActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFReader::GetWarning(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -6107,6 +6768,7 @@ void CLib3MFLevelSet::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMesh", GetMesh);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVolumeData", GetVolumeData);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetVolumeData", SetVolumeData);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SampleGrid", SampleGrid);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -6528,6 +7190,52 @@ void CLib3MFLevelSet::SetVolumeData(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+void CLib3MFLevelSet::SampleGrid(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsObject()) {
+            throw std::runtime_error("Expected struct parameter 0 (Origin)");
+        }
+        if (!args[1]->IsObject()) {
+            throw std::runtime_error("Expected struct parameter 1 (Spacing)");
+        }
+        if (!args[2]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 2 (CountX)");
+        }
+        if (!args[3]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 3 (CountY)");
+        }
+        if (!args[4]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 4 (CountZ)");
+        }
+        if (!args[6]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 6 (UserData)");
+        }
+        sLib3MFVector sOrigin = convertObjectToLib3MFVector(isolate, args[0]);
+        sLib3MFVector sSpacing = convertObjectToLib3MFVector(isolate, args[1]);
+        unsigned int nCountX = (unsigned int) args[2]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nCountY = (unsigned int) args[3]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nCountZ = (unsigned int) args[4]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        v8::String::Utf8Value sutf8UserData(isolate, args[6]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SampleGrid.");
+        if (wrapperTable->m_LevelSet_SampleGrid == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method LevelSet::SampleGrid.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_LevelSet_SampleGrid(instanceHandle, &sOrigin, &sSpacing, nCountX, nCountY, nCountZ, nullptr, (void*) nUserData, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 /*************************************************************************************************************************
  Class CLib3MFBeamLattice Implementation
 **************************************************************************************************************************/
@@ -16575,6 +17283,7 @@ void CLib3MFFunction::Init()
 
 }
 
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SampleGrid", SampleGrid);
 void CLib3MFFunction::New(const FunctionCallbackInfo<Value>& args)
 {
 		Isolate* isolate = args.GetIsolate();
@@ -16887,6 +17596,57 @@ void CLib3MFFunction::FindOutput(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+void CLib3MFFunction::SampleGrid(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (OutputIdentifier)");
+        }
+        if (!args[1]->IsObject()) {
+            throw std::runtime_error("Expected struct parameter 1 (Origin)");
+        }
+        if (!args[2]->IsObject()) {
+            throw std::runtime_error("Expected struct parameter 2 (Spacing)");
+        }
+        if (!args[3]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 3 (CountX)");
+        }
+        if (!args[4]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 4 (CountY)");
+        }
+        if (!args[5]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 5 (CountZ)");
+        }
+        if (!args[7]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 7 (UserData)");
+        }
+        v8::String::Utf8Value sutf8OutputIdentifier(isolate, args[0]);
+        std::string sOutputIdentifier = *sutf8OutputIdentifier;
+        sLib3MFVector sOrigin = convertObjectToLib3MFVector(isolate, args[1]);
+        sLib3MFVector sSpacing = convertObjectToLib3MFVector(isolate, args[2]);
+        unsigned int nCountX = (unsigned int) args[3]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nCountY = (unsigned int) args[4]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nCountZ = (unsigned int) args[5]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        v8::String::Utf8Value sutf8UserData(isolate, args[7]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SampleGrid.");
+        if (wrapperTable->m_Function_SampleGrid == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Function::SampleGrid.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Function_SampleGrid(instanceHandle, sOutputIdentifier.c_str(), &sOrigin, &sSpacing, nCountX, nCountY, nCountZ, nullptr, (void*) nUserData, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 /*************************************************************************************************************************
  Class CLib3MFImplicitFunction Implementation
 **************************************************************************************************************************/
@@ -16970,9 +17730,10 @@ void CLib3MFImplicitFunction::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SortNodesTopologically", SortNodesTopologically);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
+		NODE_SET_PROTOTYPE_METHOD(tpl, "EvaluateBatch", EvaluateBatch);
 }
 
-void CLib3MFImplicitFunction::New(const FunctionCallbackInfo<Value>& args)
+	void CLib3MFImplicitFunction::New(const FunctionCallbackInfo<Value>& args)
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
@@ -19241,6 +20002,26 @@ void CLib3MFImplicitFunction::SortNodesTopologically(const FunctionCallbackInfo<
 		}
 }
 
+void CLib3MFImplicitFunction::EvaluateBatch(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method EvaluateBatch.");
+        if (wrapperTable->m_ImplicitFunction_EvaluateBatch == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::EvaluateBatch.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_EvaluateBatch(instanceHandle, 0, nullptr, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 /*************************************************************************************************************************
  Class CLib3MFFunctionFromImage3D Implementation
 **************************************************************************************************************************/
@@ -22112,6 +22893,7 @@ void CLib3MFModel::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetBuildUUID", SetBuildUUID);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetBuildItems", GetBuildItems);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetOutbox", GetOutbox);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetBuildItemOutboxes", GetBuildItemOutboxes);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetResources", GetResources);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetObjects", GetObjects);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMeshObjects", GetMeshObjects);
@@ -22822,6 +23604,26 @@ void CLib3MFModel::GetOutbox(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFModel::GetBuildItemOutboxes(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetBuildItemOutboxes.");
+        if (wrapperTable->m_Model_GetBuildItemOutboxes == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Model::GetBuildItemOutboxes.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Model_GetBuildItemOutboxes(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFModel::GetResources(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -24167,6 +24969,7 @@ void CLib3MFWrapper::New(const FunctionCallbackInfo<Value>& args)
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eProgressIdentifier_WRITETRIANGLES"), Integer::New(isolate, 21));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eProgressIdentifier_WRITESLICES"), Integer::New(isolate, 22));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eProgressIdentifier_WRITEKEYSTORE"), Integer::New(isolate, 23));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eProgressIdentifier_SAMPLEGRID"), Integer::New(isolate, 24));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eBlendMethod_NoBlendMethod"), Integer::New(isolate, 0));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eBlendMethod_Mix"), Integer::New(isolate, 1));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eBlendMethod_Multiply"), Integer::New(isolate, 2));
@@ -97,12 +97,26 @@ private:
 	static void WriteToFile(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStreamSize(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void WriteToBuffer(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void WriteToInternalBuffer(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetInternalBufferAddress(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void WriteToCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetProgressCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetDecimalPrecision(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetDecimalPrecision(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetObjectThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetObjectThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetSubModelThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetSubModelThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetCompressionThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetCompressionThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetModelCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetModelCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetTextureCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTextureCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetAttachmentCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetAttachmentCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarning(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarningCount(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddKeyWrappingCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -128,10 +142,23 @@ private:
 	static void ReadFromBuffer(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void ReadFromCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetProgressCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetVertexStreamCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetTriangleStreamCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetBeamStreamCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetComponentStreamCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetBuildItemStreamCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddRelationToRead(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void RemoveRelationToRead(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetSubModelThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetSubModelThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetLazyMeshLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetLazyMeshLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetBackgroundDecompressionActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetBackgroundDecompressionActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetLazyAttachmentLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetLazyAttachmentLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarning(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarningCount(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddKeyWrappingCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -636,6 +663,7 @@ public:
 	CLib3MFLevelSet();
 	~CLib3MFLevelSet();
 	
+	static void SampleGrid(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void Init();
 	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
 	
@@ -2201,6 +2229,7 @@ public:
 	CLib3MFFunction();
 	~CLib3MFFunction();
 	
+	static void SampleGrid(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void Init();
 	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
 	
@@ -2272,6 +2301,7 @@ private:
 	static void Clear(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SortNodesTopologically(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+	static void EvaluateBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
 public:
 	CLib3MFImplicitFunction();
 	~CLib3MFImplicitFunction();
@@ -2584,6 +2614,7 @@ private:
 	static void SetBuildUUID(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetBuildItems(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetOutbox(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetBuildItemOutboxes(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetResources(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetObjects(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetMeshObjects(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -225,7 +225,8 @@ type
 		eProgressIdentifierWRITENODES,
 		eProgressIdentifierWRITETRIANGLES,
 		eProgressIdentifierWRITESLICES,
-		eProgressIdentifierWRITEKEYSTORE
+		eProgressIdentifierWRITEKEYSTORE,
+		eProgressIdentifierSAMPLEGRID
 	);
 
 	TLib3MFBlendMethod = (
@@ -466,6 +467,11 @@ type
 	PLib3MF_ReadCallback = function(const nByteData: QWord; const nNumBytes: QWord; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_SeekCallback = function(const nPosition: QWord; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_RandomNumberCallback = function(const nByteData: QWord; const nNumBytes: QWord; const pUserData: Pointer; out pBytesWritten: QWord): Integer; cdecl;
+	PLib3MF_VertexStreamCallback = function(const nObjectUniqueID: Cardinal; const nVertexCount: Cardinal; const nVertexData: QWord; const pUserData: Pointer): Integer; cdecl;
+	PLib3MF_TriangleStreamCallback = function(const nObjectUniqueID: Cardinal; const nTriangleCount: Cardinal; const nTriangleData: QWord; const pUserData: Pointer): Integer; cdecl;
+	PLib3MF_BeamStreamCallback = function(const nObjectUniqueID: Cardinal; const nBeamCount: Cardinal; const nBeamData: QWord; const pUserData: Pointer): Integer; cdecl;
+	PLib3MF_ComponentStreamCallback = function(const nObjectUniqueID: Cardinal; const nComponentObjectUniqueID: Cardinal; const nTransformData: QWord; const pUserData: Pointer): Integer; cdecl;
+	PLib3MF_BuildItemStreamCallback = function(const nObjectUniqueID: Cardinal; const nTransformData: QWord; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_KeyWrappingCallback = function(const pKEKParams: TLib3MFHandle; const nInBufferCount: QWord; const nOutBufferCount: QWord; const pUserData: Pointer; out pStatus: QWord): Integer; cdecl;
 	PLib3MF_ContentEncryptionCallback = function(const pCEKParams: TLib3MFHandle; const nInputCount: QWord; const nOutputCount: QWord; const pUserData: Pointer; out pStatus: QWord): Integer; cdecl;
 
@@ -621,7 +627,7 @@ type
 	TLib3MFWriter_WriteToFileFunc = function(pWriter: TLib3MFHandle; const pFilename: PAnsiChar): TLib3MFResult; cdecl;
 	
 	(**
-	* Retrieves the size of the full 3MF file stream.
+	* Retrieves the size of the full 3MF file stream..
 	*
 	* @param[in] pWriter - Writer instance.
 	* @param[out] pStreamSize - the stream size
@@ -640,6 +646,24 @@ type
 	*)
 	TLib3MFWriter_WriteToBufferFunc = function(pWriter: TLib3MFHandle; const nBufferCount: QWord; out pBufferNeededCount: QWord; pBufferBuffer: PByte): TLib3MFResult; cdecl;
 	
+	(**
+	* Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pBufferSize - size of the written buffer in bytes
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_WriteToInternalBufferFunc = function(pWriter: TLib3MFHandle; out pBufferSize: QWord): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pBufferAddress - address of the first byte of the buffer
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetInternalBufferAddressFunc = function(pWriter: TLib3MFHandle; out pBufferAddress: QWord): TLib3MFResult; cdecl;
+	
 	(**
 	* Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 	*
@@ -697,6 +721,114 @@ type
 	*)
 	TLib3MFWriter_GetStrictModeActiveFunc = function(pWriter: TLib3MFHandle; out pStrictModeActive: Byte): TLib3MFResult; cdecl;
 	
+	(**
+	* Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetObjectThreadCountFunc = function(pWriter: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used to format the XML of the objects of a model part.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pThreadCount - number of formatting threads. 0 means all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetObjectThreadCountFunc = function(pWriter: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetSubModelThreadCountFunc = function(pWriter: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used to write the non-root model parts of the production extension.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pThreadCount - number of writer threads. 0 means all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetSubModelThreadCountFunc = function(pWriter: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetCompressionThreadCountFunc = function(pWriter: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used to deflate large parts of the package.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pThreadCount - number of compression threads. 0 means all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetCompressionThreadCountFunc = function(pWriter: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the compression level of the model parts (root model and non-root models of the production extension).
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetModelCompressionLevelFunc = function(pWriter: TLib3MFHandle; const nCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the compression level of the model parts.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetModelCompressionLevelFunc = function(pWriter: TLib3MFHandle; out pCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the compression level of textures and thumbnails.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetTextureCompressionLevelFunc = function(pWriter: TLib3MFHandle; const nCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the compression level of the texture and thumbnail parts.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetTextureCompressionLevelFunc = function(pWriter: TLib3MFHandle; out pCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the compression level of all other attachments.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetAttachmentCompressionLevelFunc = function(pWriter: TLib3MFHandle; const nCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the compression level of the attachment parts.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pCompressionLevel - compression level. 0 means the parts are stored uncompressed.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetAttachmentCompressionLevelFunc = function(pWriter: TLib3MFHandle; out pCompressionLevel: Cardinal): TLib3MFResult; cdecl;
+	
 	(**
 	* Returns Warning and Error Information of the read process
 	*
@@ -786,6 +918,56 @@ type
 	*)
 	TLib3MFReader_SetProgressCallbackFunc = function(pReader: TLib3MFHandle; const pProgressCallback: PLib3MF_ProgressCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
 	
+	(**
+	* Streams the vertices of the next read to a callback
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pVertexStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetVertexStreamCallbackFunc = function(pReader: TLib3MFHandle; const pVertexStreamCallback: PLib3MF_VertexStreamCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
+	(**
+	* Streams the triangles of the next read to a callback
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pTriangleStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetTriangleStreamCallbackFunc = function(pReader: TLib3MFHandle; const pTriangleStreamCallback: PLib3MF_TriangleStreamCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
+	(**
+	* Streams the beams of the next read to a callback
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pBeamStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetBeamStreamCallbackFunc = function(pReader: TLib3MFHandle; const pBeamStreamCallback: PLib3MF_BeamStreamCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
+	(**
+	* Streams the components of the next read to a callback
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pComponentStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetComponentStreamCallbackFunc = function(pReader: TLib3MFHandle; const pComponentStreamCallback: PLib3MF_ComponentStreamCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
+	(**
+	* Streams the build items of the next read to a callback
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pBuildItemStreamCallback - pointer to the callback function.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetBuildItemStreamCallbackFunc = function(pReader: TLib3MFHandle; const pBuildItemStreamCallback: PLib3MF_BuildItemStreamCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
 	(**
 	* Adds a relationship type which shall be read as attachment in memory while loading
 	*
@@ -822,6 +1004,78 @@ type
 	*)
 	TLib3MFReader_GetStrictModeActiveFunc = function(pReader: TLib3MFHandle; out pStrictModeActive: Byte): TLib3MFResult; cdecl;
 	
+	(**
+	* Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetSubModelThreadCountFunc = function(pReader: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used to parse the non-root model parts of the production extension.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pThreadCount - number of parser threads. 0 means all available hardware threads.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetSubModelThreadCountFunc = function(pReader: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetLazyMeshLoadingActiveFunc = function(pReader: TLib3MFHandle; const bLazyMeshLoadingActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether mesh content is parsed on first access
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pLazyMeshLoadingActive - returns flag whether mesh content is parsed on first access.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetLazyMeshLoadingActiveFunc = function(pReader: TLib3MFHandle; out pLazyMeshLoadingActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetBackgroundDecompressionActiveFunc = function(pReader: TLib3MFHandle; const bBackgroundDecompressionActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether the root model part is decompressed on a background thread
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pBackgroundDecompressionActive - returns flag whether the root model part is decompressed on a background thread.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetBackgroundDecompressionActiveFunc = function(pReader: TLib3MFHandle; out pBackgroundDecompressionActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetLazyAttachmentLoadingActiveFunc = function(pReader: TLib3MFHandle; const bLazyAttachmentLoadingActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether attachments are decompressed on first access
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pLazyAttachmentLoadingActive - returns flag whether attachments are decompressed on first access.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetLazyAttachmentLoadingActiveFunc = function(pReader: TLib3MFHandle; out pLazyAttachmentLoadingActive: Byte): TLib3MFResult; cdecl;
+	
 	(**
 	* Returns Warning and Error Information of the read process
 	*
@@ -2126,6 +2380,24 @@ type
 	TLib3MFLevelSet_SetVolumeDataFunc = function(pLevelSet: TLib3MFHandle; const pTheVolumeData: TLib3MFHandle): TLib3MFResult; cdecl;
 	
 
+	(**
+	* Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+	*
+	* @param[in] pLevelSet - LevelSet instance.
+	* @param[in] pOrigin - position of the first grid point
+	* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[in] nValuesCount - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pValuesBuffer - single buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	* @return error code or 0 (success)
+	*)
+	TLib3MFLevelSet_SampleGridFunc = function(pLevelSet: TLib3MFHandle; const pOrigin: PLib3MFVector; const pSpacing: PLib3MFVector; const nCountX: Cardinal; const nCountY: Cardinal; const nCountZ: Cardinal; const pProgressCallback: PLib3MF_ProgressCallback; const pUserData: Pointer; const nValuesCount: QWord; out pValuesNeededCount: QWord; pValuesBuffer: PSingle): TLib3MFResult; cdecl;
+	
 (*************************************************************************************************************************
  Function type definitions for BeamLattice
 **************************************************************************************************************************)
@@ -4799,6 +5071,25 @@ type
 	TLib3MFFunction_FindOutputFunc = function(pFunction: TLib3MFHandle; const pIdentifier: PAnsiChar; out pOutput: TLib3MFHandle): TLib3MFResult; cdecl;
 	
 
+	(**
+	* Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+	*
+	* @param[in] pFunction - Function instance.
+	* @param[in] pOutputIdentifier - the identifier of the scalar output to sample
+	* @param[in] pOrigin - position of the first grid point
+	* @param[in] pSpacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[in] nValuesCount - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pValuesBuffer - single buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	* @return error code or 0 (success)
+	*)
+	TLib3MFFunction_SampleGridFunc = function(pFunction: TLib3MFHandle; const pOutputIdentifier: PAnsiChar; const pOrigin: PLib3MFVector; const pSpacing: PLib3MFVector; const nCountX: Cardinal; const nCountY: Cardinal; const nCountZ: Cardinal; const pProgressCallback: PLib3MF_ProgressCallback; const pUserData: Pointer; const nValuesCount: QWord; out pValuesNeededCount: QWord; pValuesBuffer: PSingle): TLib3MFResult; cdecl;
+	
 (*************************************************************************************************************************
  Function type definitions for ImplicitFunction
 **************************************************************************************************************************)
@@ -5511,6 +5802,19 @@ type
 	TLib3MFImplicitFunction_SortNodesTopologicallyFunc = function(pImplicitFunction: TLib3MFHandle): TLib3MFResult; cdecl;
 	
 
+	(**
+	* Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+	*
+	* @param[in] pImplicitFunction - ImplicitFunction instance.
+	* @param[in] nInputsCount - Number of elements in buffer
+	* @param[in] pInputsBuffer - double buffer of Input values of all points. The count MUST be a multiple of the component count of all inputs.
+	* @param[in] nOutputsCount - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutputsBuffer - double buffer of Output values of all points.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitFunction_EvaluateBatchFunc = function(pImplicitFunction: TLib3MFHandle; const nInputsCount: QWord; const pInputsBuffer: PDouble; const nOutputsCount: QWord; out pOutputsNeededCount: QWord; pOutputsBuffer: PDouble): TLib3MFResult; cdecl;
+	
 (*************************************************************************************************************************
  Function type definitions for FunctionFromImage3D
 **************************************************************************************************************************)
@@ -6639,6 +6943,17 @@ type
 	*)
 	TLib3MFModel_GetOutboxFunc = function(pModel: TLib3MFHandle; pOutbox: PLib3MFBox): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+	*
+	* @param[in] pModel - Model instance.
+	* @param[in] nOutboxesCount - Number of elements in buffer
+	* @param[out] pOutboxesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutboxesBuffer - Box buffer of contains the outbox of each build item.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFModel_GetBuildItemOutboxesFunc = function(pModel: TLib3MFHandle; const nOutboxesCount: QWord; out pOutboxesNeededCount: QWord; pOutboxesBuffer: PLib3MFBox): TLib3MFResult; cdecl;
+	
 	(**
 	* creates a resource iterator instance with all resources.
 	*
@@ -7334,12 +7649,26 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure WriteToFile(const AFilename: String);
 		function GetStreamSize(): QWord;
 		procedure WriteToBuffer(out ABuffer: TByteDynArray);
+		function WriteToInternalBuffer(): QWord;
+		function GetInternalBufferAddress(): QWord;
 		procedure WriteToCallback(const ATheWriteCallback: PLib3MF_WriteCallback; const ATheSeekCallback: PLib3MF_SeekCallback; const AUserData: Pointer);
 		procedure SetProgressCallback(const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer);
 		function GetDecimalPrecision(): Cardinal;
 		procedure SetDecimalPrecision(const ADecimalPrecision: Cardinal);
 		procedure SetStrictModeActive(const AStrictModeActive: Boolean);
 		function GetStrictModeActive(): Boolean;
+		procedure SetObjectThreadCount(const AThreadCount: Cardinal);
+		function GetObjectThreadCount(): Cardinal;
+		procedure SetSubModelThreadCount(const AThreadCount: Cardinal);
+		function GetSubModelThreadCount(): Cardinal;
+		procedure SetCompressionThreadCount(const AThreadCount: Cardinal);
+		function GetCompressionThreadCount(): Cardinal;
+		procedure SetModelCompressionLevel(const ACompressionLevel: Cardinal);
+		function GetModelCompressionLevel(): Cardinal;
+		procedure SetTextureCompressionLevel(const ACompressionLevel: Cardinal);
+		function GetTextureCompressionLevel(): Cardinal;
+		procedure SetAttachmentCompressionLevel(const ACompressionLevel: Cardinal);
+		function GetAttachmentCompressionLevel(): Cardinal;
 		function GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 		function GetWarningCount(): Cardinal;
 		procedure AddKeyWrappingCallback(const AConsumerID: String; const ATheCallback: PLib3MF_KeyWrappingCallback; const AUserData: Pointer);
@@ -7359,10 +7688,23 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure ReadFromBuffer(const ABuffer: TByteDynArray);
 		procedure ReadFromCallback(const ATheReadCallback: PLib3MF_ReadCallback; const AStreamSize: QWord; const ATheSeekCallback: PLib3MF_SeekCallback; const AUserData: Pointer);
 		procedure SetProgressCallback(const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer);
+		procedure SetVertexStreamCallback(const AVertexStreamCallback: PLib3MF_VertexStreamCallback; const AUserData: Pointer);
+		procedure SetTriangleStreamCallback(const ATriangleStreamCallback: PLib3MF_TriangleStreamCallback; const AUserData: Pointer);
+		procedure SetBeamStreamCallback(const ABeamStreamCallback: PLib3MF_BeamStreamCallback; const AUserData: Pointer);
+		procedure SetComponentStreamCallback(const AComponentStreamCallback: PLib3MF_ComponentStreamCallback; const AUserData: Pointer);
+		procedure SetBuildItemStreamCallback(const ABuildItemStreamCallback: PLib3MF_BuildItemStreamCallback; const AUserData: Pointer);
 		procedure AddRelationToRead(const ARelationShipType: String);
 		procedure RemoveRelationToRead(const ARelationShipType: String);
 		procedure SetStrictModeActive(const AStrictModeActive: Boolean);
 		function GetStrictModeActive(): Boolean;
+		procedure SetSubModelThreadCount(const AThreadCount: Cardinal);
+		function GetSubModelThreadCount(): Cardinal;
+		procedure SetLazyMeshLoadingActive(const ALazyMeshLoadingActive: Boolean);
+		function GetLazyMeshLoadingActive(): Boolean;
+		procedure SetBackgroundDecompressionActive(const ABackgroundDecompressionActive: Boolean);
+		function GetBackgroundDecompressionActive(): Boolean;
+		procedure SetLazyAttachmentLoadingActive(const ALazyAttachmentLoadingActive: Boolean);
+		function GetLazyAttachmentLoadingActive(): Boolean;
 		function GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 		function GetWarningCount(): Cardinal;
 		procedure AddKeyWrappingCallback(const AConsumerID: String; const ATheCallback: PLib3MF_KeyWrappingCallback; const AUserData: Pointer);
@@ -7730,6 +8072,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		function GetMesh(): TLib3MFMeshObject;
 		function GetVolumeData(): TLib3MFVolumeData;
 		procedure SetVolumeData(const ATheVolumeData: TLib3MFVolumeData);
+		procedure SampleGrid(const AOrigin: TLib3MFVector; const ASpacing: TLib3MFVector; const ACountX: Cardinal; const ACountY: Cardinal; const ACountZ: Cardinal; const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer; out AValues: TSingleDynArray);
 	end;
 
 
@@ -8827,6 +9170,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure RemoveOutput(const AOutput: TLib3MFImplicitPort);
 		function FindInput(const AIdentifier: String): TLib3MFImplicitPort;
 		function FindOutput(const AIdentifier: String): TLib3MFImplicitPort;
+		procedure SampleGrid(const AOutputIdentifier: String; const AOrigin: TLib3MFVector; const ASpacing: TLib3MFVector; const ACountX: Cardinal; const ACountY: Cardinal; const ACountZ: Cardinal; const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer; out AValues: TSingleDynArray);
 	end;
 
 
@@ -8896,6 +9240,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure AddLinkByNames(const ASource: String; const ATarget: String);
 		procedure Clear();
 		procedure SortNodesTopologically();
+		procedure EvaluateBatch(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
 	end;
 
 
@@ -9137,6 +9482,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetBuildUUID(const AUUID: String);
 		function GetBuildItems(): TLib3MFBuildItemIterator;
 		function GetOutbox(): TLib3MFBox;
+		procedure GetBuildItemOutboxes(out AOutboxes: ArrayOfLib3MFBox);
 		function GetResources(): TLib3MFResourceIterator;
 		function GetObjects(): TLib3MFObjectIterator;
 		function GetMeshObjects(): TLib3MFMeshObjectIterator;
@@ -9198,12 +9544,26 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFWriter_WriteToFileFunc: TLib3MFWriter_WriteToFileFunc;
 		FLib3MFWriter_GetStreamSizeFunc: TLib3MFWriter_GetStreamSizeFunc;
 		FLib3MFWriter_WriteToBufferFunc: TLib3MFWriter_WriteToBufferFunc;
+		FLib3MFWriter_WriteToInternalBufferFunc: TLib3MFWriter_WriteToInternalBufferFunc;
+		FLib3MFWriter_GetInternalBufferAddressFunc: TLib3MFWriter_GetInternalBufferAddressFunc;
 		FLib3MFWriter_WriteToCallbackFunc: TLib3MFWriter_WriteToCallbackFunc;
 		FLib3MFWriter_SetProgressCallbackFunc: TLib3MFWriter_SetProgressCallbackFunc;
 		FLib3MFWriter_GetDecimalPrecisionFunc: TLib3MFWriter_GetDecimalPrecisionFunc;
 		FLib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc;
 		FLib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc;
 		FLib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc;
+		FLib3MFWriter_SetObjectThreadCountFunc: TLib3MFWriter_SetObjectThreadCountFunc;
+		FLib3MFWriter_GetObjectThreadCountFunc: TLib3MFWriter_GetObjectThreadCountFunc;
+		FLib3MFWriter_SetSubModelThreadCountFunc: TLib3MFWriter_SetSubModelThreadCountFunc;
+		FLib3MFWriter_GetSubModelThreadCountFunc: TLib3MFWriter_GetSubModelThreadCountFunc;
+		FLib3MFWriter_SetCompressionThreadCountFunc: TLib3MFWriter_SetCompressionThreadCountFunc;
+		FLib3MFWriter_GetCompressionThreadCountFunc: TLib3MFWriter_GetCompressionThreadCountFunc;
+		FLib3MFWriter_SetModelCompressionLevelFunc: TLib3MFWriter_SetModelCompressionLevelFunc;
+		FLib3MFWriter_GetModelCompressionLevelFunc: TLib3MFWriter_GetModelCompressionLevelFunc;
+		FLib3MFWriter_SetTextureCompressionLevelFunc: TLib3MFWriter_SetTextureCompressionLevelFunc;
+		FLib3MFWriter_GetTextureCompressionLevelFunc: TLib3MFWriter_GetTextureCompressionLevelFunc;
+		FLib3MFWriter_SetAttachmentCompressionLevelFunc: TLib3MFWriter_SetAttachmentCompressionLevelFunc;
+		FLib3MFWriter_GetAttachmentCompressionLevelFunc: TLib3MFWriter_GetAttachmentCompressionLevelFunc;
 		FLib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc;
 		FLib3MFWriter_GetWarningCountFunc: TLib3MFWriter_GetWarningCountFunc;
 		FLib3MFWriter_AddKeyWrappingCallbackFunc: TLib3MFWriter_AddKeyWrappingCallbackFunc;
@@ -9212,10 +9572,23 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFReader_ReadFromBufferFunc: TLib3MFReader_ReadFromBufferFunc;
 		FLib3MFReader_ReadFromCallbackFunc: TLib3MFReader_ReadFromCallbackFunc;
 		FLib3MFReader_SetProgressCallbackFunc: TLib3MFReader_SetProgressCallbackFunc;
+		FLib3MFReader_SetVertexStreamCallbackFunc: TLib3MFReader_SetVertexStreamCallbackFunc;
+		FLib3MFReader_SetTriangleStreamCallbackFunc: TLib3MFReader_SetTriangleStreamCallbackFunc;
+		FLib3MFReader_SetBeamStreamCallbackFunc: TLib3MFReader_SetBeamStreamCallbackFunc;
+		FLib3MFReader_SetComponentStreamCallbackFunc: TLib3MFReader_SetComponentStreamCallbackFunc;
+		FLib3MFReader_SetBuildItemStreamCallbackFunc: TLib3MFReader_SetBuildItemStreamCallbackFunc;
 		FLib3MFReader_AddRelationToReadFunc: TLib3MFReader_AddRelationToReadFunc;
 		FLib3MFReader_RemoveRelationToReadFunc: TLib3MFReader_RemoveRelationToReadFunc;
 		FLib3MFReader_SetStrictModeActiveFunc: TLib3MFReader_SetStrictModeActiveFunc;
 		FLib3MFReader_GetStrictModeActiveFunc: TLib3MFReader_GetStrictModeActiveFunc;
+		FLib3MFReader_SetSubModelThreadCountFunc: TLib3MFReader_SetSubModelThreadCountFunc;
+		FLib3MFReader_GetSubModelThreadCountFunc: TLib3MFReader_GetSubModelThreadCountFunc;
+		FLib3MFReader_SetLazyMeshLoadingActiveFunc: TLib3MFReader_SetLazyMeshLoadingActiveFunc;
+		FLib3MFReader_GetLazyMeshLoadingActiveFunc: TLib3MFReader_GetLazyMeshLoadingActiveFunc;
+		FLib3MFReader_SetBackgroundDecompressionActiveFunc: TLib3MFReader_SetBackgroundDecompressionActiveFunc;
+		FLib3MFReader_GetBackgroundDecompressionActiveFunc: TLib3MFReader_GetBackgroundDecompressionActiveFunc;
+		FLib3MFReader_SetLazyAttachmentLoadingActiveFunc: TLib3MFReader_SetLazyAttachmentLoadingActiveFunc;
+		FLib3MFReader_GetLazyAttachmentLoadingActiveFunc: TLib3MFReader_GetLazyAttachmentLoadingActiveFunc;
 		FLib3MFReader_GetWarningFunc: TLib3MFReader_GetWarningFunc;
 		FLib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc;
 		FLib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc;
@@ -9341,6 +9714,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFLevelSet_GetMeshFunc: TLib3MFLevelSet_GetMeshFunc;
 		FLib3MFLevelSet_GetVolumeDataFunc: TLib3MFLevelSet_GetVolumeDataFunc;
 		FLib3MFLevelSet_SetVolumeDataFunc: TLib3MFLevelSet_SetVolumeDataFunc;
+		FLib3MFLevelSet_SampleGridFunc: TLib3MFLevelSet_SampleGridFunc;
 		FLib3MFBeamLattice_GetMinLengthFunc: TLib3MFBeamLattice_GetMinLengthFunc;
 		FLib3MFBeamLattice_SetMinLengthFunc: TLib3MFBeamLattice_SetMinLengthFunc;
 		FLib3MFBeamLattice_GetClippingFunc: TLib3MFBeamLattice_GetClippingFunc;
@@ -9580,6 +9954,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFFunction_RemoveOutputFunc: TLib3MFFunction_RemoveOutputFunc;
 		FLib3MFFunction_FindInputFunc: TLib3MFFunction_FindInputFunc;
 		FLib3MFFunction_FindOutputFunc: TLib3MFFunction_FindOutputFunc;
+		FLib3MFFunction_SampleGridFunc: TLib3MFFunction_SampleGridFunc;
 		FLib3MFImplicitFunction_GetIdentifierFunc: TLib3MFImplicitFunction_GetIdentifierFunc;
 		FLib3MFImplicitFunction_SetIdentifierFunc: TLib3MFImplicitFunction_SetIdentifierFunc;
 		FLib3MFImplicitFunction_AddNodeFunc: TLib3MFImplicitFunction_AddNodeFunc;
@@ -9638,6 +10013,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFImplicitFunction_AddLinkByNamesFunc: TLib3MFImplicitFunction_AddLinkByNamesFunc;
 		FLib3MFImplicitFunction_ClearFunc: TLib3MFImplicitFunction_ClearFunc;
 		FLib3MFImplicitFunction_SortNodesTopologicallyFunc: TLib3MFImplicitFunction_SortNodesTopologicallyFunc;
+		FLib3MFImplicitFunction_EvaluateBatchFunc: TLib3MFImplicitFunction_EvaluateBatchFunc;
 		FLib3MFFunctionFromImage3D_GetImage3DFunc: TLib3MFFunctionFromImage3D_GetImage3DFunc;
 		FLib3MFFunctionFromImage3D_SetImage3DFunc: TLib3MFFunctionFromImage3D_SetImage3DFunc;
 		FLib3MFFunctionFromImage3D_SetFilterFunc: TLib3MFFunctionFromImage3D_SetFilterFunc;
@@ -9747,6 +10123,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFModel_SetBuildUUIDFunc: TLib3MFModel_SetBuildUUIDFunc;
 		FLib3MFModel_GetBuildItemsFunc: TLib3MFModel_GetBuildItemsFunc;
 		FLib3MFModel_GetOutboxFunc: TLib3MFModel_GetOutboxFunc;
+		FLib3MFModel_GetBuildItemOutboxesFunc: TLib3MFModel_GetBuildItemOutboxesFunc;
 		FLib3MFModel_GetResourcesFunc: TLib3MFModel_GetResourcesFunc;
 		FLib3MFModel_GetObjectsFunc: TLib3MFModel_GetObjectsFunc;
 		FLib3MFModel_GetMeshObjectsFunc: TLib3MFModel_GetMeshObjectsFunc;
@@ -9828,12 +10205,26 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFWriter_WriteToFileFunc: TLib3MFWriter_WriteToFileFunc read FLib3MFWriter_WriteToFileFunc;
 		property Lib3MFWriter_GetStreamSizeFunc: TLib3MFWriter_GetStreamSizeFunc read FLib3MFWriter_GetStreamSizeFunc;
 		property Lib3MFWriter_WriteToBufferFunc: TLib3MFWriter_WriteToBufferFunc read FLib3MFWriter_WriteToBufferFunc;
+		property Lib3MFWriter_WriteToInternalBufferFunc: TLib3MFWriter_WriteToInternalBufferFunc read FLib3MFWriter_WriteToInternalBufferFunc;
+		property Lib3MFWriter_GetInternalBufferAddressFunc: TLib3MFWriter_GetInternalBufferAddressFunc read FLib3MFWriter_GetInternalBufferAddressFunc;
 		property Lib3MFWriter_WriteToCallbackFunc: TLib3MFWriter_WriteToCallbackFunc read FLib3MFWriter_WriteToCallbackFunc;
 		property Lib3MFWriter_SetProgressCallbackFunc: TLib3MFWriter_SetProgressCallbackFunc read FLib3MFWriter_SetProgressCallbackFunc;
 		property Lib3MFWriter_GetDecimalPrecisionFunc: TLib3MFWriter_GetDecimalPrecisionFunc read FLib3MFWriter_GetDecimalPrecisionFunc;
 		property Lib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc read FLib3MFWriter_SetDecimalPrecisionFunc;
 		property Lib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc read FLib3MFWriter_SetStrictModeActiveFunc;
 		property Lib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc read FLib3MFWriter_GetStrictModeActiveFunc;
+		property Lib3MFWriter_SetObjectThreadCountFunc: TLib3MFWriter_SetObjectThreadCountFunc read FLib3MFWriter_SetObjectThreadCountFunc;
+		property Lib3MFWriter_GetObjectThreadCountFunc: TLib3MFWriter_GetObjectThreadCountFunc read FLib3MFWriter_GetObjectThreadCountFunc;
+		property Lib3MFWriter_SetSubModelThreadCountFunc: TLib3MFWriter_SetSubModelThreadCountFunc read FLib3MFWriter_SetSubModelThreadCountFunc;
+		property Lib3MFWriter_GetSubModelThreadCountFunc: TLib3MFWriter_GetSubModelThreadCountFunc read FLib3MFWriter_GetSubModelThreadCountFunc;
+		property Lib3MFWriter_SetCompressionThreadCountFunc: TLib3MFWriter_SetCompressionThreadCountFunc read FLib3MFWriter_SetCompressionThreadCountFunc;
+		property Lib3MFWriter_GetCompressionThreadCountFunc: TLib3MFWriter_GetCompressionThreadCountFunc read FLib3MFWriter_GetCompressionThreadCountFunc;
+		property Lib3MFWriter_SetModelCompressionLevelFunc: TLib3MFWriter_SetModelCompressionLevelFunc read FLib3MFWriter_SetModelCompressionLevelFunc;
+		property Lib3MFWriter_GetModelCompressionLevelFunc: TLib3MFWriter_GetModelCompressionLevelFunc read FLib3MFWriter_GetModelCompressionLevelFunc;
+		property Lib3MFWriter_SetTextureCompressionLevelFunc: TLib3MFWriter_SetTextureCompressionLevelFunc read FLib3MFWriter_SetTextureCompressionLevelFunc;
+		property Lib3MFWriter_GetTextureCompressionLevelFunc: TLib3MFWriter_GetTextureCompressionLevelFunc read FLib3MFWriter_GetTextureCompressionLevelFunc;
+		property Lib3MFWriter_SetAttachmentCompressionLevelFunc: TLib3MFWriter_SetAttachmentCompressionLevelFunc read FLib3MFWriter_SetAttachmentCompressionLevelFunc;
+		property Lib3MFWriter_GetAttachmentCompressionLevelFunc: TLib3MFWriter_GetAttachmentCompressionLevelFunc read FLib3MFWriter_GetAttachmentCompressionLevelFunc;
 		property Lib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc read FLib3MFWriter_GetWarningFunc;
 		property Lib3MFWriter_GetWarningCountFunc: TLib3MFWriter_GetWarningCountFunc read FLib3MFWriter_GetWarningCountFunc;
 		property Lib3MFWriter_AddKeyWrappingCallbackFunc: TLib3MFWriter_AddKeyWrappingCallbackFunc read FLib3MFWriter_AddKeyWrappingCallbackFunc;
@@ -9842,10 +10233,23 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFReader_ReadFromBufferFunc: TLib3MFReader_ReadFromBufferFunc read FLib3MFReader_ReadFromBufferFunc;
 		property Lib3MFReader_ReadFromCallbackFunc: TLib3MFReader_ReadFromCallbackFunc read FLib3MFReader_ReadFromCallbackFunc;
 		property Lib3MFReader_SetProgressCallbackFunc: TLib3MFReader_SetProgressCallbackFunc read FLib3MFReader_SetProgressCallbackFunc;
+		property Lib3MFReader_SetVertexStreamCallbackFunc: TLib3MFReader_SetVertexStreamCallbackFunc read FLib3MFReader_SetVertexStreamCallbackFunc;
+		property Lib3MFReader_SetTriangleStreamCallbackFunc: TLib3MFReader_SetTriangleStreamCallbackFunc read FLib3MFReader_SetTriangleStreamCallbackFunc;
+		property Lib3MFReader_SetBeamStreamCallbackFunc: TLib3MFReader_SetBeamStreamCallbackFunc read FLib3MFReader_SetBeamStreamCallbackFunc;
+		property Lib3MFReader_SetComponentStreamCallbackFunc: TLib3MFReader_SetComponentStreamCallbackFunc read FLib3MFReader_SetComponentStreamCallbackFunc;
+		property Lib3MFReader_SetBuildItemStreamCallbackFunc: TLib3MFReader_SetBuildItemStreamCallbackFunc read FLib3MFReader_SetBuildItemStreamCallbackFunc;
 		property Lib3MFReader_AddRelationToReadFunc: TLib3MFReader_AddRelationToReadFunc read FLib3MFReader_AddRelationToReadFunc;
 		property Lib3MFReader_RemoveRelationToReadFunc: TLib3MFReader_RemoveRelationToReadFunc read FLib3MFReader_RemoveRelationToReadFunc;
 		property Lib3MFReader_SetStrictModeActiveFunc: TLib3MFReader_SetStrictModeActiveFunc read FLib3MFReader_SetStrictModeActiveFunc;
 		property Lib3MFReader_GetStrictModeActiveFunc: TLib3MFReader_GetStrictModeActiveFunc read FLib3MFReader_GetStrictModeActiveFunc;
+		property Lib3MFReader_SetSubModelThreadCountFunc: TLib3MFReader_SetSubModelThreadCountFunc read FLib3MFReader_SetSubModelThreadCountFunc;
+		property Lib3MFReader_GetSubModelThreadCountFunc: TLib3MFReader_GetSubModelThreadCountFunc read FLib3MFReader_GetSubModelThreadCountFunc;
+		property Lib3MFReader_SetLazyMeshLoadingActiveFunc: TLib3MFReader_SetLazyMeshLoadingActiveFunc read FLib3MFReader_SetLazyMeshLoadingActiveFunc;
+		property Lib3MFReader_GetLazyMeshLoadingActiveFunc: TLib3MFReader_GetLazyMeshLoadingActiveFunc read FLib3MFReader_GetLazyMeshLoadingActiveFunc;
+		property Lib3MFReader_SetBackgroundDecompressionActiveFunc: TLib3MFReader_SetBackgroundDecompressionActiveFunc read FLib3MFReader_SetBackgroundDecompressionActiveFunc;
+		property Lib3MFReader_GetBackgroundDecompressionActiveFunc: TLib3MFReader_GetBackgroundDecompressionActiveFunc read FLib3MFReader_GetBackgroundDecompressionActiveFunc;
+		property Lib3MFReader_SetLazyAttachmentLoadingActiveFunc: TLib3MFReader_SetLazyAttachmentLoadingActiveFunc read FLib3MFReader_SetLazyAttachmentLoadingActiveFunc;
+		property Lib3MFReader_GetLazyAttachmentLoadingActiveFunc: TLib3MFReader_GetLazyAttachmentLoadingActiveFunc read FLib3MFReader_GetLazyAttachmentLoadingActiveFunc;
 		property Lib3MFReader_GetWarningFunc: TLib3MFReader_GetWarningFunc read FLib3MFReader_GetWarningFunc;
 		property Lib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc read FLib3MFReader_GetWarningCountFunc;
 		property Lib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc read FLib3MFReader_AddKeyWrappingCallbackFunc;
@@ -9971,6 +10375,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFLevelSet_GetMeshFunc: TLib3MFLevelSet_GetMeshFunc read FLib3MFLevelSet_GetMeshFunc;
 		property Lib3MFLevelSet_GetVolumeDataFunc: TLib3MFLevelSet_GetVolumeDataFunc read FLib3MFLevelSet_GetVolumeDataFunc;
 		property Lib3MFLevelSet_SetVolumeDataFunc: TLib3MFLevelSet_SetVolumeDataFunc read FLib3MFLevelSet_SetVolumeDataFunc;
+		property Lib3MFLevelSet_SampleGridFunc: TLib3MFLevelSet_SampleGridFunc read FLib3MFLevelSet_SampleGridFunc;
 		property Lib3MFBeamLattice_GetMinLengthFunc: TLib3MFBeamLattice_GetMinLengthFunc read FLib3MFBeamLattice_GetMinLengthFunc;
 		property Lib3MFBeamLattice_SetMinLengthFunc: TLib3MFBeamLattice_SetMinLengthFunc read FLib3MFBeamLattice_SetMinLengthFunc;
 		property Lib3MFBeamLattice_GetClippingFunc: TLib3MFBeamLattice_GetClippingFunc read FLib3MFBeamLattice_GetClippingFunc;
@@ -10210,6 +10615,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFFunction_RemoveOutputFunc: TLib3MFFunction_RemoveOutputFunc read FLib3MFFunction_RemoveOutputFunc;
 		property Lib3MFFunction_FindInputFunc: TLib3MFFunction_FindInputFunc read FLib3MFFunction_FindInputFunc;
 		property Lib3MFFunction_FindOutputFunc: TLib3MFFunction_FindOutputFunc read FLib3MFFunction_FindOutputFunc;
+		property Lib3MFFunction_SampleGridFunc: TLib3MFFunction_SampleGridFunc read FLib3MFFunction_SampleGridFunc;
 		property Lib3MFImplicitFunction_GetIdentifierFunc: TLib3MFImplicitFunction_GetIdentifierFunc read FLib3MFImplicitFunction_GetIdentifierFunc;
 		property Lib3MFImplicitFunction_SetIdentifierFunc: TLib3MFImplicitFunction_SetIdentifierFunc read FLib3MFImplicitFunction_SetIdentifierFunc;
 		property Lib3MFImplicitFunction_AddNodeFunc: TLib3MFImplicitFunction_AddNodeFunc read FLib3MFImplicitFunction_AddNodeFunc;
@@ -10268,6 +10674,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFImplicitFunction_AddLinkByNamesFunc: TLib3MFImplicitFunction_AddLinkByNamesFunc read FLib3MFImplicitFunction_AddLinkByNamesFunc;
 		property Lib3MFImplicitFunction_ClearFunc: TLib3MFImplicitFunction_ClearFunc read FLib3MFImplicitFunction_ClearFunc;
 		property Lib3MFImplicitFunction_SortNodesTopologicallyFunc: TLib3MFImplicitFunction_SortNodesTopologicallyFunc read FLib3MFImplicitFunction_SortNodesTopologicallyFunc;
+		property Lib3MFImplicitFunction_EvaluateBatchFunc: TLib3MFImplicitFunction_EvaluateBatchFunc read FLib3MFImplicitFunction_EvaluateBatchFunc;
 		property Lib3MFFunctionFromImage3D_GetImage3DFunc: TLib3MFFunctionFromImage3D_GetImage3DFunc read FLib3MFFunctionFromImage3D_GetImage3DFunc;
 		property Lib3MFFunctionFromImage3D_SetImage3DFunc: TLib3MFFunctionFromImage3D_SetImage3DFunc read FLib3MFFunctionFromImage3D_SetImage3DFunc;
 		property Lib3MFFunctionFromImage3D_SetFilterFunc: TLib3MFFunctionFromImage3D_SetFilterFunc read FLib3MFFunctionFromImage3D_SetFilterFunc;
@@ -10377,6 +10784,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFModel_SetBuildUUIDFunc: TLib3MFModel_SetBuildUUIDFunc read FLib3MFModel_SetBuildUUIDFunc;
 		property Lib3MFModel_GetBuildItemsFunc: TLib3MFModel_GetBuildItemsFunc read FLib3MFModel_GetBuildItemsFunc;
 		property Lib3MFModel_GetOutboxFunc: TLib3MFModel_GetOutboxFunc read FLib3MFModel_GetOutboxFunc;
+		property Lib3MFModel_GetBuildItemOutboxesFunc: TLib3MFModel_GetBuildItemOutboxesFunc read FLib3MFModel_GetBuildItemOutboxesFunc;
 		property Lib3MFModel_GetResourcesFunc: TLib3MFModel_GetResourcesFunc read FLib3MFModel_GetResourcesFunc;
 		property Lib3MFModel_GetObjectsFunc: TLib3MFModel_GetObjectsFunc read FLib3MFModel_GetObjectsFunc;
 		property Lib3MFModel_GetMeshObjectsFunc: TLib3MFModel_GetMeshObjectsFunc read FLib3MFModel_GetMeshObjectsFunc;
@@ -10918,6 +11326,7 @@ implementation
 			eProgressIdentifierWRITETRIANGLES: Result := 21;
 			eProgressIdentifierWRITESLICES: Result := 22;
 			eProgressIdentifierWRITEKEYSTORE: Result := 23;
+			eProgressIdentifierSAMPLEGRID: Result := 24;
 			else 
 				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum value');
 		end;
@@ -10950,6 +11359,7 @@ implementation
 			21: Result := eProgressIdentifierWRITETRIANGLES;
 			22: Result := eProgressIdentifierWRITESLICES;
 			23: Result := eProgressIdentifierWRITEKEYSTORE;
+			24: Result := eProgressIdentifierSAMPLEGRID;
 			else 
 				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum constant');
 		end;
@@ -12070,6 +12480,16 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_WriteToBufferFunc(FHandle, countNeededBuffer, countWrittenBuffer, @ABuffer[0]));
 	end;
 
+	function TLib3MFWriter.WriteToInternalBuffer(): QWord;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_WriteToInternalBufferFunc(FHandle, Result));
+	end;
+
+	function TLib3MFWriter.GetInternalBufferAddress(): QWord;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetInternalBufferAddressFunc(FHandle, Result));
+	end;
+
 	procedure TLib3MFWriter.WriteToCallback(const ATheWriteCallback: PLib3MF_WriteCallback; const ATheSeekCallback: PLib3MF_SeekCallback; const AUserData: Pointer);
 	begin
 		if not Assigned(ATheWriteCallback) then
@@ -12110,6 +12530,66 @@ implementation
 		Result := (ResultStrictModeActive <> 0);
 	end;
 
+	procedure TLib3MFWriter.SetObjectThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetObjectThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFWriter.GetObjectThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetObjectThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetSubModelThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetSubModelThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFWriter.GetSubModelThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetSubModelThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetCompressionThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetCompressionThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFWriter.GetCompressionThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetCompressionThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetModelCompressionLevel(const ACompressionLevel: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetModelCompressionLevelFunc(FHandle, ACompressionLevel));
+	end;
+
+	function TLib3MFWriter.GetModelCompressionLevel(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetModelCompressionLevelFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetTextureCompressionLevel(const ACompressionLevel: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetTextureCompressionLevelFunc(FHandle, ACompressionLevel));
+	end;
+
+	function TLib3MFWriter.GetTextureCompressionLevel(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetTextureCompressionLevelFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetAttachmentCompressionLevel(const ACompressionLevel: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetAttachmentCompressionLevelFunc(FHandle, ACompressionLevel));
+	end;
+
+	function TLib3MFWriter.GetAttachmentCompressionLevel(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetAttachmentCompressionLevelFunc(FHandle, Result));
+	end;
+
 	function TLib3MFWriter.GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 	var
 		bytesNeededWarning: Cardinal;
@@ -12194,6 +12674,41 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetProgressCallbackFunc(FHandle, AProgressCallback, AUserData));
 	end;
 
+	procedure TLib3MFReader.SetVertexStreamCallback(const AVertexStreamCallback: PLib3MF_VertexStreamCallback; const AUserData: Pointer);
+	begin
+		if not Assigned(AVertexStreamCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'AVertexStreamCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetVertexStreamCallbackFunc(FHandle, AVertexStreamCallback, AUserData));
+	end;
+
+	procedure TLib3MFReader.SetTriangleStreamCallback(const ATriangleStreamCallback: PLib3MF_TriangleStreamCallback; const AUserData: Pointer);
+	begin
+		if not Assigned(ATriangleStreamCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'ATriangleStreamCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetTriangleStreamCallbackFunc(FHandle, ATriangleStreamCallback, AUserData));
+	end;
+
+	procedure TLib3MFReader.SetBeamStreamCallback(const ABeamStreamCallback: PLib3MF_BeamStreamCallback; const AUserData: Pointer);
+	begin
+		if not Assigned(ABeamStreamCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'ABeamStreamCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetBeamStreamCallbackFunc(FHandle, ABeamStreamCallback, AUserData));
+	end;
+
+	procedure TLib3MFReader.SetComponentStreamCallback(const AComponentStreamCallback: PLib3MF_ComponentStreamCallback; const AUserData: Pointer);
+	begin
+		if not Assigned(AComponentStreamCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'AComponentStreamCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetComponentStreamCallbackFunc(FHandle, AComponentStreamCallback, AUserData));
+	end;
+
+	procedure TLib3MFReader.SetBuildItemStreamCallback(const ABuildItemStreamCallback: PLib3MF_BuildItemStreamCallback; const AUserData: Pointer);
+	begin
+		if not Assigned(ABuildItemStreamCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'ABuildItemStreamCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetBuildItemStreamCallbackFunc(FHandle, ABuildItemStreamCallback, AUserData));
+	end;
+
 	procedure TLib3MFReader.AddRelationToRead(const ARelationShipType: String);
 	begin
 		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_AddRelationToReadFunc(FHandle, PAnsiChar(ARelationShipType)));
@@ -12218,6 +12733,58 @@ implementation
 		Result := (ResultStrictModeActive <> 0);
 	end;
 
+	procedure TLib3MFReader.SetSubModelThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetSubModelThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFReader.GetSubModelThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetSubModelThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFReader.SetLazyMeshLoadingActive(const ALazyMeshLoadingActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetLazyMeshLoadingActiveFunc(FHandle, Ord(ALazyMeshLoadingActive)));
+	end;
+
+	function TLib3MFReader.GetLazyMeshLoadingActive(): Boolean;
+	var
+		ResultLazyMeshLoadingActive: Byte;
+	begin
+		ResultLazyMeshLoadingActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetLazyMeshLoadingActiveFunc(FHandle, ResultLazyMeshLoadingActive));
+		Result := (ResultLazyMeshLoadingActive <> 0);
+	end;
+
+	procedure TLib3MFReader.SetBackgroundDecompressionActive(const ABackgroundDecompressionActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetBackgroundDecompressionActiveFunc(FHandle, Ord(ABackgroundDecompressionActive)));
+	end;
+
+	function TLib3MFReader.GetBackgroundDecompressionActive(): Boolean;
+	var
+		ResultBackgroundDecompressionActive: Byte;
+	begin
+		ResultBackgroundDecompressionActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetBackgroundDecompressionActiveFunc(FHandle, ResultBackgroundDecompressionActive));
+		Result := (ResultBackgroundDecompressionActive <> 0);
+	end;
+
+	procedure TLib3MFReader.SetLazyAttachmentLoadingActive(const ALazyAttachmentLoadingActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetLazyAttachmentLoadingActiveFunc(FHandle, Ord(ALazyAttachmentLoadingActive)));
+	end;
+
+	function TLib3MFReader.GetLazyAttachmentLoadingActive(): Boolean;
+	var
+		ResultLazyAttachmentLoadingActive: Byte;
+	begin
+		ResultLazyAttachmentLoadingActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetLazyAttachmentLoadingActiveFunc(FHandle, ResultLazyAttachmentLoadingActive));
+		Result := (ResultLazyAttachmentLoadingActive <> 0);
+	end;
+
 	function TLib3MFReader.GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 	var
 		bytesNeededWarning: Cardinal;
@@ -13653,6 +14220,18 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFLevelSet_SetVolumeDataFunc(FHandle, ATheVolumeDataHandle));
 	end;
 
+	procedure TLib3MFLevelSet.SampleGrid(const AOrigin: TLib3MFVector; const ASpacing: TLib3MFVector; const ACountX: Cardinal; const ACountY: Cardinal; const ACountZ: Cardinal; const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer; out AValues: TSingleDynArray);
+	var
+		countNeededValues: QWord;
+		countWrittenValues: QWord;
+	begin
+		countNeededValues:= 0;
+		countWrittenValues:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFLevelSet_SampleGridFunc(FHandle, @AOrigin, @ASpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, 0, countNeededValues, nil));
+		SetLength(AValues, countNeededValues);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFLevelSet_SampleGridFunc(FHandle, @AOrigin, @ASpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, countNeededValues, countWrittenValues, @AValues[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for BeamLattice
 **************************************************************************************************************************)
@@ -16929,6 +17508,18 @@ implementation
 			Result := TLib3MFPolymorphicFactory<TLib3MFImplicitPort, TLib3MFImplicitPort>.Make(FWrapper, HOutput);
 	end;
 
+	procedure TLib3MFFunction.SampleGrid(const AOutputIdentifier: String; const AOrigin: TLib3MFVector; const ASpacing: TLib3MFVector; const ACountX: Cardinal; const ACountY: Cardinal; const ACountZ: Cardinal; const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer; out AValues: TSingleDynArray);
+	var
+		countNeededValues: QWord;
+		countWrittenValues: QWord;
+	begin
+		countNeededValues:= 0;
+		countWrittenValues:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFFunction_SampleGridFunc(FHandle, PAnsiChar(AOutputIdentifier), @AOrigin, @ASpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, 0, countNeededValues, nil));
+		SetLength(AValues, countNeededValues);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFFunction_SampleGridFunc(FHandle, PAnsiChar(AOutputIdentifier), @AOrigin, @ASpacing, ACountX, ACountY, ACountZ, AProgressCallback, AUserData, countNeededValues, countWrittenValues, @AValues[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for ImplicitFunction
 **************************************************************************************************************************)
@@ -17565,6 +18156,28 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitFunction_SortNodesTopologicallyFunc(FHandle));
 	end;
 
+	procedure TLib3MFImplicitFunction.EvaluateBatch(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
+	var
+		PtrInputs: PDouble;
+		LenInputs: QWord;
+		countNeededOutputs: QWord;
+		countWrittenOutputs: QWord;
+	begin
+		LenInputs := Length(AInputs);
+		if LenInputs > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenInputs > 0 then
+			PtrInputs := @AInputs[0]
+		else
+			PtrInputs := nil;
+		
+		countNeededOutputs:= 0;
+		countWrittenOutputs:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitFunction_EvaluateBatchFunc(FHandle, QWord(LenInputs), PtrInputs, 0, countNeededOutputs, nil));
+		SetLength(AOutputs, countNeededOutputs);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitFunction_EvaluateBatchFunc(FHandle, QWord(LenInputs), PtrInputs, countNeededOutputs, countWrittenOutputs, @AOutputs[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for FunctionFromImage3D
 **************************************************************************************************************************)
@@ -18835,6 +19448,18 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_GetOutboxFunc(FHandle, @Result));
 	end;
 
+	procedure TLib3MFModel.GetBuildItemOutboxes(out AOutboxes: ArrayOfLib3MFBox);
+	var
+		countNeededOutboxes: QWord;
+		countWrittenOutboxes: QWord;
+	begin
+		countNeededOutboxes:= 0;
+		countWrittenOutboxes:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_GetBuildItemOutboxesFunc(FHandle, 0, countNeededOutboxes, nil));
+		SetLength(AOutboxes, countNeededOutboxes);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_GetBuildItemOutboxesFunc(FHandle, countNeededOutboxes, countWrittenOutboxes, @AOutboxes[0]));
+	end;
+
 	function TLib3MFModel.GetResources(): TLib3MFResourceIterator;
 	var
 		HResourceIterator: TLib3MFHandle;
@@ -19384,12 +20009,26 @@ implementation
 		FLib3MFWriter_WriteToFileFunc := LoadFunction('lib3mf_writer_writetofile');
 		FLib3MFWriter_GetStreamSizeFunc := LoadFunction('lib3mf_writer_getstreamsize');
 		FLib3MFWriter_WriteToBufferFunc := LoadFunction('lib3mf_writer_writetobuffer');
+		FLib3MFWriter_WriteToInternalBufferFunc := LoadFunction('lib3mf_writer_writetointernalbuffer');
+		FLib3MFWriter_GetInternalBufferAddressFunc := LoadFunction('lib3mf_writer_getinternalbufferaddress');
 		FLib3MFWriter_WriteToCallbackFunc := LoadFunction('lib3mf_writer_writetocallback');
 		FLib3MFWriter_SetProgressCallbackFunc := LoadFunction('lib3mf_writer_setprogresscallback');
 		FLib3MFWriter_GetDecimalPrecisionFunc := LoadFunction('lib3mf_writer_getdecimalprecision');
 		FLib3MFWriter_SetDecimalPrecisionFunc := LoadFunction('lib3mf_writer_setdecimalprecision');
 		FLib3MFWriter_SetStrictModeActiveFunc := LoadFunction('lib3mf_writer_setstrictmodeactive');
 		FLib3MFWriter_GetStrictModeActiveFunc := LoadFunction('lib3mf_writer_getstrictmodeactive');
+		FLib3MFWriter_SetObjectThreadCountFunc := LoadFunction('lib3mf_writer_setobjectthreadcount');
+		FLib3MFWriter_GetObjectThreadCountFunc := LoadFunction('lib3mf_writer_getobjectthreadcount');
+		FLib3MFWriter_SetSubModelThreadCountFunc := LoadFunction('lib3mf_writer_setsubmodelthreadcount');
+		FLib3MFWriter_GetSubModelThreadCountFunc := LoadFunction('lib3mf_writer_getsubmodelthreadcount');
+		FLib3MFWriter_SetCompressionThreadCountFunc := LoadFunction('lib3mf_writer_setcompressionthreadcount');
+		FLib3MFWriter_GetCompressionThreadCountFunc := LoadFunction('lib3mf_writer_getcompressionthreadcount');
+		FLib3MFWriter_SetModelCompressionLevelFunc := LoadFunction('lib3mf_writer_setmodelcompressionlevel');
+		FLib3MFWriter_GetModelCompressionLevelFunc := LoadFunction('lib3mf_writer_getmodelcompressionlevel');
+		FLib3MFWriter_SetTextureCompressionLevelFunc := LoadFunction('lib3mf_writer_settexturecompressionlevel');
+		FLib3MFWriter_GetTextureCompressionLevelFunc := LoadFunction('lib3mf_writer_gettexturecompressionlevel');
+		FLib3MFWriter_SetAttachmentCompressionLevelFunc := LoadFunction('lib3mf_writer_setattachmentcompressionlevel');
+		FLib3MFWriter_GetAttachmentCompressionLevelFunc := LoadFunction('lib3mf_writer_getattachmentcompressionlevel');
 		FLib3MFWriter_GetWarningFunc := LoadFunction('lib3mf_writer_getwarning');
 		FLib3MFWriter_GetWarningCountFunc := LoadFunction('lib3mf_writer_getwarningcount');
 		FLib3MFWriter_AddKeyWrappingCallbackFunc := LoadFunction('lib3mf_writer_addkeywrappingcallback');
@@ -19398,10 +20037,23 @@ implementation
 		FLib3MFReader_ReadFromBufferFunc := LoadFunction('lib3mf_reader_readfrombuffer');
 		FLib3MFReader_ReadFromCallbackFunc := LoadFunction('lib3mf_reader_readfromcallback');
 		FLib3MFReader_SetProgressCallbackFunc := LoadFunction('lib3mf_reader_setprogresscallback');
+		FLib3MFReader_SetVertexStreamCallbackFunc := LoadFunction('lib3mf_reader_setvertexstreamcallback');
+		FLib3MFReader_SetTriangleStreamCallbackFunc := LoadFunction('lib3mf_reader_settrianglestreamcallback');
+		FLib3MFReader_SetBeamStreamCallbackFunc := LoadFunction('lib3mf_reader_setbeamstreamcallback');
+		FLib3MFReader_SetComponentStreamCallbackFunc := LoadFunction('lib3mf_reader_setcomponentstreamcallback');
+		FLib3MFReader_SetBuildItemStreamCallbackFunc := LoadFunction('lib3mf_reader_setbuilditemstreamcallback');
 		FLib3MFReader_AddRelationToReadFunc := LoadFunction('lib3mf_reader_addrelationtoread');
 		FLib3MFReader_RemoveRelationToReadFunc := LoadFunction('lib3mf_reader_removerelationtoread');
 		FLib3MFReader_SetStrictModeActiveFunc := LoadFunction('lib3mf_reader_setstrictmodeactive');
 		FLib3MFReader_GetStrictModeActiveFunc := LoadFunction('lib3mf_reader_getstrictmodeactive');
+		FLib3MFReader_SetSubModelThreadCountFunc := LoadFunction('lib3mf_reader_setsubmodelthreadcount');
+		FLib3MFReader_GetSubModelThreadCountFunc := LoadFunction('lib3mf_reader_getsubmodelthreadcount');
+		FLib3MFReader_SetLazyMeshLoadingActiveFunc := LoadFunction('lib3mf_reader_setlazymeshloadingactive');
+		FLib3MFReader_GetLazyMeshLoadingActiveFunc := LoadFunction('lib3mf_reader_getlazymeshloadingactive');
+		FLib3MFReader_SetBackgroundDecompressionActiveFunc := LoadFunction('lib3mf_reader_setbackgrounddecompressionactive');
+		FLib3MFReader_GetBackgroundDecompressionActiveFunc := LoadFunction('lib3mf_reader_getbackgrounddecompressionactive');
+		FLib3MFReader_SetLazyAttachmentLoadingActiveFunc := LoadFunction('lib3mf_reader_setlazyattachmentloadingactive');
+		FLib3MFReader_GetLazyAttachmentLoadingActiveFunc := LoadFunction('lib3mf_reader_getlazyattachmentloadingactive');
 		FLib3MFReader_GetWarningFunc := LoadFunction('lib3mf_reader_getwarning');
 		FLib3MFReader_GetWarningCountFunc := LoadFunction('lib3mf_reader_getwarningcount');
 		FLib3MFReader_AddKeyWrappingCallbackFunc := LoadFunction('lib3mf_reader_addkeywrappingcallback');
@@ -19527,6 +20179,7 @@ implementation
 		FLib3MFLevelSet_GetMeshFunc := LoadFunction('lib3mf_levelset_getmesh');
 		FLib3MFLevelSet_GetVolumeDataFunc := LoadFunction('lib3mf_levelset_getvolumedata');
 		FLib3MFLevelSet_SetVolumeDataFunc := LoadFunction('lib3mf_levelset_setvolumedata');
+		FLib3MFLevelSet_SampleGridFunc := LoadFunction('lib3mf_levelset_samplegrid');
 		FLib3MFBeamLattice_GetMinLengthFunc := LoadFunction('lib3mf_beamlattice_getminlength');
 		FLib3MFBeamLattice_SetMinLengthFunc := LoadFunction('lib3mf_beamlattice_setminlength');
 		FLib3MFBeamLattice_GetClippingFunc := LoadFunction('lib3mf_beamlattice_getclipping');
@@ -19766,6 +20419,7 @@ implementation
 		FLib3MFFunction_RemoveOutputFunc := LoadFunction('lib3mf_function_removeoutput');
 		FLib3MFFunction_FindInputFunc := LoadFunction('lib3mf_function_findinput');
 		FLib3MFFunction_FindOutputFunc := LoadFunction('lib3mf_function_findoutput');
+		FLib3MFFunction_SampleGridFunc := LoadFunction('lib3mf_function_samplegrid');
 		FLib3MFImplicitFunction_GetIdentifierFunc := LoadFunction('lib3mf_implicitfunction_getidentifier');
 		FLib3MFImplicitFunction_SetIdentifierFunc := LoadFunction('lib3mf_implicitfunction_setidentifier');
 		FLib3MFImplicitFunction_AddNodeFunc := LoadFunction('lib3mf_implicitfunction_addnode');
@@ -19824,6 +20478,7 @@ implementation
 		FLib3MFImplicitFunction_AddLinkByNamesFunc := LoadFunction('lib3mf_implicitfunction_addlinkbynames');
 		FLib3MFImplicitFunction_ClearFunc := LoadFunction('lib3mf_implicitfunction_clear');
 		FLib3MFImplicitFunction_SortNodesTopologicallyFunc := LoadFunction('lib3mf_implicitfunction_sortnodestopologically');
+		FLib3MFImplicitFunction_EvaluateBatchFunc := LoadFunction('lib3mf_implicitfunction_evaluatebatch');
 		FLib3MFFunctionFromImage3D_GetImage3DFunc := LoadFunction('lib3mf_functionfromimage3d_getimage3d');
 		FLib3MFFunctionFromImage3D_SetImage3DFunc := LoadFunction('lib3mf_functionfromimage3d_setimage3d');
 		FLib3MFFunctionFromImage3D_SetFilterFunc := LoadFunction('lib3mf_functionfromimage3d_setfilter');
@@ -19933,6 +20588,7 @@ implementation
 		FLib3MFModel_SetBuildUUIDFunc := LoadFunction('lib3mf_model_setbuilduuid');
 		FLib3MFModel_GetBuildItemsFunc := LoadFunction('lib3mf_model_getbuilditems');
 		FLib3MFModel_GetOutboxFunc := LoadFunction('lib3mf_model_getoutbox');
+		FLib3MFModel_GetBuildItemOutboxesFunc := LoadFunction('lib3mf_model_getbuilditemoutboxes');
 		FLib3MFModel_GetResourcesFunc := LoadFunction('lib3mf_model_getresources');
 		FLib3MFModel_GetObjectsFunc := LoadFunction('lib3mf_model_getobjects');
 		FLib3MFModel_GetMeshObjectsFunc := LoadFunction('lib3mf_model_getmeshobjects');
@@ -20021,6 +20677,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_writetobuffer'), @FLib3MFWriter_WriteToBufferFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_writetointernalbuffer'), @FLib3MFWriter_WriteToInternalBufferFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getinternalbufferaddress'), @FLib3MFWriter_GetInternalBufferAddressFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_writetocallback'), @FLib3MFWriter_WriteToCallbackFunc);
@@ -20039,6 +20701,42 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getstrictmodeactive'), @FLib3MFWriter_GetStrictModeActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setobjectthreadcount'), @FLib3MFWriter_SetObjectThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getobjectthreadcount'), @FLib3MFWriter_GetObjectThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setsubmodelthreadcount'), @FLib3MFWriter_SetSubModelThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getsubmodelthreadcount'), @FLib3MFWriter_GetSubModelThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setcompressionthreadcount'), @FLib3MFWriter_SetCompressionThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getcompressionthreadcount'), @FLib3MFWriter_GetCompressionThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setmodelcompressionlevel'), @FLib3MFWriter_SetModelCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getmodelcompressionlevel'), @FLib3MFWriter_GetModelCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_settexturecompressionlevel'), @FLib3MFWriter_SetTextureCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_gettexturecompressionlevel'), @FLib3MFWriter_GetTextureCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setattachmentcompressionlevel'), @FLib3MFWriter_SetAttachmentCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getattachmentcompressionlevel'), @FLib3MFWriter_GetAttachmentCompressionLevelFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getwarning'), @FLib3MFWriter_GetWarningFunc);
@@ -20063,6 +20761,21 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setprogresscallback'), @FLib3MFReader_SetProgressCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setvertexstreamcallback'), @FLib3MFReader_SetVertexStreamCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_settrianglestreamcallback'), @FLib3MFReader_SetTriangleStreamCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setbeamstreamcallback'), @FLib3MFReader_SetBeamStreamCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setcomponentstreamcallback'), @FLib3MFReader_SetComponentStreamCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setbuilditemstreamcallback'), @FLib3MFReader_SetBuildItemStreamCallbackFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_addrelationtoread'), @FLib3MFReader_AddRelationToReadFunc);
@@ -20075,6 +20788,30 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getstrictmodeactive'), @FLib3MFReader_GetStrictModeActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setsubmodelthreadcount'), @FLib3MFReader_SetSubModelThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getsubmodelthreadcount'), @FLib3MFReader_GetSubModelThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setlazymeshloadingactive'), @FLib3MFReader_SetLazyMeshLoadingActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getlazymeshloadingactive'), @FLib3MFReader_GetLazyMeshLoadingActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setbackgrounddecompressionactive'), @FLib3MFReader_SetBackgroundDecompressionActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getbackgrounddecompressionactive'), @FLib3MFReader_GetBackgroundDecompressionActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setlazyattachmentloadingactive'), @FLib3MFReader_SetLazyAttachmentLoadingActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getlazyattachmentloadingactive'), @FLib3MFReader_GetLazyAttachmentLoadingActiveFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getwarning'), @FLib3MFReader_GetWarningFunc);
@@ -20450,6 +21187,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_levelset_setvolumedata'), @FLib3MFLevelSet_SetVolumeDataFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_levelset_samplegrid'), @FLib3MFLevelSet_SampleGridFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_beamlattice_getminlength'), @FLib3MFBeamLattice_GetMinLengthFunc);
@@ -21167,6 +21907,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_function_findoutput'), @FLib3MFFunction_FindOutputFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_function_samplegrid'), @FLib3MFFunction_SampleGridFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitfunction_getidentifier'), @FLib3MFImplicitFunction_GetIdentifierFunc);
@@ -21341,6 +22084,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitfunction_sortnodestopologically'), @FLib3MFImplicitFunction_SortNodesTopologicallyFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitfunction_evaluatebatch'), @FLib3MFImplicitFunction_EvaluateBatchFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_functionfromimage3d_getimage3d'), @FLib3MFFunctionFromImage3D_GetImage3DFunc);
@@ -21668,6 +22414,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getoutbox'), @FLib3MFModel_GetOutboxFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getbuilditemoutboxes'), @FLib3MFModel_GetBuildItemOutboxesFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getresources'), @FLib3MFModel_GetResourcesFunc);
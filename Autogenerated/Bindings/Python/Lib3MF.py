@@ -141,12 +141,26 @@ class FunctionTable:
 	lib3mf_writer_writetofile = None
 	lib3mf_writer_getstreamsize = None
 	lib3mf_writer_writetobuffer = None
+	lib3mf_writer_writetointernalbuffer = None
+	lib3mf_writer_getinternalbufferaddress = None
 	lib3mf_writer_writetocallback = None
 	lib3mf_writer_setprogresscallback = None
 	lib3mf_writer_getdecimalprecision = None
 	lib3mf_writer_setdecimalprecision = None
 	lib3mf_writer_setstrictmodeactive = None
 	lib3mf_writer_getstrictmodeactive = None
+	lib3mf_writer_setobjectthreadcount = None
+	lib3mf_writer_getobjectthreadcount = None
+	lib3mf_writer_setsubmodelthreadcount = None
+	lib3mf_writer_getsubmodelthreadcount = None
+	lib3mf_writer_setcompressionthreadcount = None
+	lib3mf_writer_getcompressionthreadcount = None
+	lib3mf_writer_setmodelcompressionlevel = None
+	lib3mf_writer_getmodelcompressionlevel = None
+	lib3mf_writer_settexturecompressionlevel = None
+	lib3mf_writer_gettexturecompressionlevel = None
+	lib3mf_writer_setattachmentcompressionlevel = None
+	lib3mf_writer_getattachmentcompressionlevel = None
 	lib3mf_writer_getwarning = None
 	lib3mf_writer_getwarningcount = None
 	lib3mf_writer_addkeywrappingcallback = None
@@ -155,10 +169,23 @@ class FunctionTable:
 	lib3mf_reader_readfrombuffer = None
 	lib3mf_reader_readfromcallback = None
 	lib3mf_reader_setprogresscallback = None
+	lib3mf_reader_setvertexstreamcallback = None
+	lib3mf_reader_settrianglestreamcallback = None
+	lib3mf_reader_setbeamstreamcallback = None
+	lib3mf_reader_setcomponentstreamcallback = None
+	lib3mf_reader_setbuilditemstreamcallback = None
 	lib3mf_reader_addrelationtoread = None
 	lib3mf_reader_removerelationtoread = None
 	lib3mf_reader_setstrictmodeactive = None
 	lib3mf_reader_getstrictmodeactive = None
+	lib3mf_reader_setsubmodelthreadcount = None
+	lib3mf_reader_getsubmodelthreadcount = None
+	lib3mf_reader_setlazymeshloadingactive = None
+	lib3mf_reader_getlazymeshloadingactive = None
+	lib3mf_reader_setbackgrounddecompressionactive = None
+	lib3mf_reader_getbackgrounddecompressionactive = None
+	lib3mf_reader_setlazyattachmentloadingactive = None
+	lib3mf_reader_getlazyattachmentloadingactive = None
 	lib3mf_reader_getwarning = None
 	lib3mf_reader_getwarningcount = None
 	lib3mf_reader_addkeywrappingcallback = None
@@ -284,6 +311,7 @@ class FunctionTable:
 	lib3mf_levelset_getmesh = None
 	lib3mf_levelset_getvolumedata = None
 	lib3mf_levelset_setvolumedata = None
+	lib3mf_levelset_samplegrid = None
 	lib3mf_beamlattice_getminlength = None
 	lib3mf_beamlattice_setminlength = None
 	lib3mf_beamlattice_getclipping = None
@@ -523,6 +551,7 @@ class FunctionTable:
 	lib3mf_function_removeoutput = None
 	lib3mf_function_findinput = None
 	lib3mf_function_findoutput = None
+	lib3mf_function_samplegrid = None
 	lib3mf_implicitfunction_getidentifier = None
 	lib3mf_implicitfunction_setidentifier = None
 	lib3mf_implicitfunction_addnode = None
@@ -581,6 +610,7 @@ class FunctionTable:
 	lib3mf_implicitfunction_addlinkbynames = None
 	lib3mf_implicitfunction_clear = None
 	lib3mf_implicitfunction_sortnodestopologically = None
+	lib3mf_implicitfunction_evaluatebatch = None
 	lib3mf_functionfromimage3d_getimage3d = None
 	lib3mf_functionfromimage3d_setimage3d = None
 	lib3mf_functionfromimage3d_setfilter = None
@@ -690,6 +720,7 @@ class FunctionTable:
 	lib3mf_model_setbuilduuid = None
 	lib3mf_model_getbuilditems = None
 	lib3mf_model_getoutbox = None
+	lib3mf_model_getbuilditemoutboxes = None
 	lib3mf_model_getresources = None
 	lib3mf_model_getobjects = None
 	lib3mf_model_getmeshobjects = None
@@ -842,6 +873,7 @@ class ProgressIdentifier(CTypesEnum):
 	WRITETRIANGLES = 21
 	WRITESLICES = 22
 	WRITEKEYSTORE = 23
+	SAMPLEGRID = 24
 '''Definition of BlendMethod
 '''
 class BlendMethod(CTypesEnum):
@@ -1097,6 +1129,26 @@ SeekCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint64, ctypes.c_void_
 		Callback to generate random numbers
 '''
 RandomNumberCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint64, ctypes.c_uint64, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+'''Definition of VertexStreamCallback
+		Callback to receive a batch of vertices while streaming a mesh object
+'''
+VertexStreamCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_void_p)
+'''Definition of TriangleStreamCallback
+		Callback to receive a batch of triangles while streaming a mesh object
+'''
+TriangleStreamCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_void_p)
+'''Definition of BeamStreamCallback
+		Callback to receive a batch of beams while streaming a mesh object
+'''
+BeamStreamCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_void_p)
+'''Definition of ComponentStreamCallback
+		Callback to receive a component while streaming a components object
+'''
+ComponentStreamCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_void_p)
+'''Definition of BuildItemStreamCallback
+		Callback to receive a build item while streaming a model
+'''
+BuildItemStreamCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_void_p)
 '''Definition of KeyWrappingCallback
 		A callback used to wrap (encrypt) the content key available in keystore resource group
 '''
@@ -1286,6 +1338,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint8))
 			self.lib.lib3mf_writer_writetobuffer = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_writetointernalbuffer")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+			self.lib.lib3mf_writer_writetointernalbuffer = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getinternalbufferaddress")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+			self.lib.lib3mf_writer_getinternalbufferaddress = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_writetocallback")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1322,6 +1386,78 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
 			self.lib.lib3mf_writer_getstrictmodeactive = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setobjectthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setobjectthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getobjectthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getobjectthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setsubmodelthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setsubmodelthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getsubmodelthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getsubmodelthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setcompressionthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setcompressionthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getcompressionthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getcompressionthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setmodelcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setmodelcompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getmodelcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getmodelcompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_settexturecompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_settexturecompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_gettexturecompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_gettexturecompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setattachmentcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setattachmentcompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getattachmentcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getattachmentcompressionlevel = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getwarning")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1370,6 +1506,36 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ProgressCallback, ctypes.c_void_p)
 			self.lib.lib3mf_reader_setprogresscallback = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setvertexstreamcallback")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, VertexStreamCallback, ctypes.c_void_p)
+			self.lib.lib3mf_reader_setvertexstreamcallback = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_settrianglestreamcallback")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, TriangleStreamCallback, ctypes.c_void_p)
+			self.lib.lib3mf_reader_settrianglestreamcallback = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setbeamstreamcallback")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, BeamStreamCallback, ctypes.c_void_p)
+			self.lib.lib3mf_reader_setbeamstreamcallback = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setcomponentstreamcallback")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ComponentStreamCallback, ctypes.c_void_p)
+			self.lib.lib3mf_reader_setcomponentstreamcallback = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setbuilditemstreamcallback")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, BuildItemStreamCallback, ctypes.c_void_p)
+			self.lib.lib3mf_reader_setbuilditemstreamcallback = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_addrelationtoread")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1394,6 +1560,54 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
 			self.lib.lib3mf_reader_getstrictmodeactive = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setsubmodelthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_reader_setsubmodelthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getsubmodelthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_reader_getsubmodelthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setlazymeshloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_reader_setlazymeshloadingactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getlazymeshloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_reader_getlazymeshloadingactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setbackgrounddecompressionactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_reader_setbackgrounddecompressionactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getbackgrounddecompressionactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_reader_getbackgrounddecompressionactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setlazyattachmentloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_reader_setlazyattachmentloadingactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getlazyattachmentloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_reader_getlazyattachmentloadingactive = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getwarning")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -2144,6 +2358,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_void_p)
 			self.lib.lib3mf_levelset_setvolumedata = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_levelset_samplegrid")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(Vector), ctypes.POINTER(Vector), ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ProgressCallback, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_float))
+			self.lib.lib3mf_levelset_samplegrid = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_beamlattice_getminlength")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -3578,6 +3798,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_void_p))
 			self.lib.lib3mf_function_findoutput = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_function_samplegrid")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(Vector), ctypes.POINTER(Vector), ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ProgressCallback, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_float))
+			self.lib.lib3mf_function_samplegrid = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitfunction_getidentifier")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -3926,6 +4152,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p)
 			self.lib.lib3mf_implicitfunction_sortnodestopologically = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitfunction_evaluatebatch")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double))
+			self.lib.lib3mf_implicitfunction_evaluatebatch = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_functionfromimage3d_getimage3d")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4580,6 +4812,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(Box))
 			self.lib.lib3mf_model_getoutbox = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_model_getbuilditemoutboxes")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Box))
+			self.lib.lib3mf_model_getbuilditemoutboxes = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_model_getresources")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4942,6 +5180,12 @@ class Wrapper:
 			self.lib.lib3mf_writer_writetobuffer.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_writetobuffer.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint8)]
 			
+			self.lib.lib3mf_writer_writetointernalbuffer.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_writetointernalbuffer.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
+			
+			self.lib.lib3mf_writer_getinternalbufferaddress.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getinternalbufferaddress.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
+			
 			self.lib.lib3mf_writer_writetocallback.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_writetocallback.argtypes = [ctypes.c_void_p, WriteCallback, SeekCallback, ctypes.c_void_p]
 			
@@ -4960,6 +5204,42 @@ class Wrapper:
 			self.lib.lib3mf_writer_getstrictmodeactive.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_getstrictmodeactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
 			
+			self.lib.lib3mf_writer_setobjectthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setobjectthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getobjectthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getobjectthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_setsubmodelthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setsubmodelthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getsubmodelthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getsubmodelthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_setcompressionthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setcompressionthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getcompressionthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getcompressionthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_setmodelcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setmodelcompressionlevel.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getmodelcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getmodelcompressionlevel.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_settexturecompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_settexturecompressionlevel.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_gettexturecompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_gettexturecompressionlevel.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_setattachmentcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setattachmentcompressionlevel.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getattachmentcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getattachmentcompressionlevel.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
 			self.lib.lib3mf_writer_getwarning.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_getwarning.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -4984,6 +5264,21 @@ class Wrapper:
 			self.lib.lib3mf_reader_setprogresscallback.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_setprogresscallback.argtypes = [ctypes.c_void_p, ProgressCallback, ctypes.c_void_p]
 			
+			self.lib.lib3mf_reader_setvertexstreamcallback.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setvertexstreamcallback.argtypes = [ctypes.c_void_p, VertexStreamCallback, ctypes.c_void_p]
+			
+			self.lib.lib3mf_reader_settrianglestreamcallback.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_settrianglestreamcallback.argtypes = [ctypes.c_void_p, TriangleStreamCallback, ctypes.c_void_p]
+			
+			self.lib.lib3mf_reader_setbeamstreamcallback.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setbeamstreamcallback.argtypes = [ctypes.c_void_p, BeamStreamCallback, ctypes.c_void_p]
+			
+			self.lib.lib3mf_reader_setcomponentstreamcallback.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setcomponentstreamcallback.argtypes = [ctypes.c_void_p, ComponentStreamCallback, ctypes.c_void_p]
+			
+			self.lib.lib3mf_reader_setbuilditemstreamcallback.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setbuilditemstreamcallback.argtypes = [ctypes.c_void_p, BuildItemStreamCallback, ctypes.c_void_p]
+			
 			self.lib.lib3mf_reader_addrelationtoread.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_addrelationtoread.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
 			
@@ -4996,6 +5291,30 @@ class Wrapper:
 			self.lib.lib3mf_reader_getstrictmodeactive.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_getstrictmodeactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
 			
+			self.lib.lib3mf_reader_setsubmodelthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setsubmodelthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_reader_getsubmodelthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getsubmodelthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_reader_setlazymeshloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setlazymeshloadingactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_reader_getlazymeshloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getlazymeshloadingactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
+			self.lib.lib3mf_reader_setbackgrounddecompressionactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setbackgrounddecompressionactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_reader_getbackgrounddecompressionactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getbackgrounddecompressionactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
+			self.lib.lib3mf_reader_setlazyattachmentloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setlazyattachmentloadingactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_reader_getlazyattachmentloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getlazyattachmentloadingactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
 			self.lib.lib3mf_reader_getwarning.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_getwarning.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -5371,6 +5690,9 @@ class Wrapper:
 			self.lib.lib3mf_levelset_setvolumedata.restype = ctypes.c_int32
 			self.lib.lib3mf_levelset_setvolumedata.argtypes = [ctypes.c_void_p, ctypes.c_void_p]
 			
+			self.lib.lib3mf_levelset_samplegrid.restype = ctypes.c_int32
+			self.lib.lib3mf_levelset_samplegrid.argtypes = [ctypes.c_void_p, ctypes.POINTER(Vector), ctypes.POINTER(Vector), ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ProgressCallback, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_float)]
+			
 			self.lib.lib3mf_beamlattice_getminlength.restype = ctypes.c_int32
 			self.lib.lib3mf_beamlattice_getminlength.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_double)]
 			
@@ -6088,6 +6410,9 @@ class Wrapper:
 			self.lib.lib3mf_function_findoutput.restype = ctypes.c_int32
 			self.lib.lib3mf_function_findoutput.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_void_p)]
 			
+			self.lib.lib3mf_function_samplegrid.restype = ctypes.c_int32
+			self.lib.lib3mf_function_samplegrid.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(Vector), ctypes.POINTER(Vector), ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ProgressCallback, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_float)]
+			
 			self.lib.lib3mf_implicitfunction_getidentifier.restype = ctypes.c_int32
 			self.lib.lib3mf_implicitfunction_getidentifier.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -6262,6 +6587,9 @@ class Wrapper:
 			self.lib.lib3mf_implicitfunction_sortnodestopologically.restype = ctypes.c_int32
 			self.lib.lib3mf_implicitfunction_sortnodestopologically.argtypes = [ctypes.c_void_p]
 			
+			self.lib.lib3mf_implicitfunction_evaluatebatch.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitfunction_evaluatebatch.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double)]
+			
 			self.lib.lib3mf_functionfromimage3d_getimage3d.restype = ctypes.c_int32
 			self.lib.lib3mf_functionfromimage3d_getimage3d.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -6589,6 +6917,9 @@ class Wrapper:
 			self.lib.lib3mf_model_getoutbox.restype = ctypes.c_int32
 			self.lib.lib3mf_model_getoutbox.argtypes = [ctypes.c_void_p, ctypes.POINTER(Box)]
 			
+			self.lib.lib3mf_model_getbuilditemoutboxes.restype = ctypes.c_int32
+			self.lib.lib3mf_model_getbuilditemoutboxes.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Box)]
+			
 			self.lib.lib3mf_model_getresources.restype = ctypes.c_int32
 			self.lib.lib3mf_model_getresources.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -7227,6 +7558,18 @@ class Writer(Base):
 		
 		return [pBufferBuffer[i] for i in range(nBufferNeededCount.value)]
 	
+	def WriteToInternalBuffer(self):
+		pBufferSize = ctypes.c_uint64()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_writetointernalbuffer(self._handle, pBufferSize))
+		
+		return pBufferSize.value
+	
+	def GetInternalBufferAddress(self):
+		pBufferAddress = ctypes.c_uint64()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getinternalbufferaddress(self._handle, pBufferAddress))
+		
+		return pBufferAddress.value
+	
 	def WriteToCallback(self, TheWriteCallbackFunc, TheSeekCallbackFunc, UserData):
 		pUserData = ctypes.c_void_p(UserData)
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_writetocallback(self._handle, TheWriteCallbackFunc, TheSeekCallbackFunc, pUserData))
@@ -7259,6 +7602,72 @@ class Writer(Base):
 		
 		return pStrictModeActive.value
 	
+	def SetObjectThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setobjectthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetObjectThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getobjectthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetSubModelThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setsubmodelthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetSubModelThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getsubmodelthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetCompressionThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setcompressionthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetCompressionThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getcompressionthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetModelCompressionLevel(self, CompressionLevel):
+		nCompressionLevel = ctypes.c_uint32(CompressionLevel)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setmodelcompressionlevel(self._handle, nCompressionLevel))
+		
+	
+	def GetModelCompressionLevel(self):
+		pCompressionLevel = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getmodelcompressionlevel(self._handle, pCompressionLevel))
+		
+		return pCompressionLevel.value
+	
+	def SetTextureCompressionLevel(self, CompressionLevel):
+		nCompressionLevel = ctypes.c_uint32(CompressionLevel)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_settexturecompressionlevel(self._handle, nCompressionLevel))
+		
+	
+	def GetTextureCompressionLevel(self):
+		pCompressionLevel = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_gettexturecompressionlevel(self._handle, pCompressionLevel))
+		
+		return pCompressionLevel.value
+	
+	def SetAttachmentCompressionLevel(self, CompressionLevel):
+		nCompressionLevel = ctypes.c_uint32(CompressionLevel)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setattachmentcompressionlevel(self._handle, nCompressionLevel))
+		
+	
+	def GetAttachmentCompressionLevel(self):
+		pCompressionLevel = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getattachmentcompressionlevel(self._handle, pCompressionLevel))
+		
+		return pCompressionLevel.value
+	
 	def GetWarning(self, Index):
 		nIndex = ctypes.c_uint32(Index)
 		pErrorCode = ctypes.c_uint32()
@@ -7318,6 +7727,31 @@ class Reader(Base):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setprogresscallback(self._handle, ProgressCallbackFunc, pUserData))
 		
 	
+	def SetVertexStreamCallback(self, VertexStreamCallbackFunc, UserData):
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setvertexstreamcallback(self._handle, VertexStreamCallbackFunc, pUserData))
+		
+	
+	def SetTriangleStreamCallback(self, TriangleStreamCallbackFunc, UserData):
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_settrianglestreamcallback(self._handle, TriangleStreamCallbackFunc, pUserData))
+		
+	
+	def SetBeamStreamCallback(self, BeamStreamCallbackFunc, UserData):
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setbeamstreamcallback(self._handle, BeamStreamCallbackFunc, pUserData))
+		
+	
+	def SetComponentStreamCallback(self, ComponentStreamCallbackFunc, UserData):
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setcomponentstreamcallback(self._handle, ComponentStreamCallbackFunc, pUserData))
+		
+	
+	def SetBuildItemStreamCallback(self, BuildItemStreamCallbackFunc, UserData):
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setbuilditemstreamcallback(self._handle, BuildItemStreamCallbackFunc, pUserData))
+		
+	
 	def AddRelationToRead(self, RelationShipType):
 		pRelationShipType = ctypes.c_char_p(str.encode(RelationShipType))
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_addrelationtoread(self._handle, pRelationShipType))
@@ -7339,6 +7773,50 @@ class Reader(Base):
 		
 		return pStrictModeActive.value
 	
+	def SetSubModelThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setsubmodelthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetSubModelThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getsubmodelthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetLazyMeshLoadingActive(self, LazyMeshLoadingActive):
+		bLazyMeshLoadingActive = ctypes.c_bool(LazyMeshLoadingActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setlazymeshloadingactive(self._handle, bLazyMeshLoadingActive))
+		
+	
+	def GetLazyMeshLoadingActive(self):
+		pLazyMeshLoadingActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getlazymeshloadingactive(self._handle, pLazyMeshLoadingActive))
+		
+		return pLazyMeshLoadingActive.value
+	
+	def SetBackgroundDecompressionActive(self, BackgroundDecompressionActive):
+		bBackgroundDecompressionActive = ctypes.c_bool(BackgroundDecompressionActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setbackgrounddecompressionactive(self._handle, bBackgroundDecompressionActive))
+		
+	
+	def GetBackgroundDecompressionActive(self):
+		pBackgroundDecompressionActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getbackgrounddecompressionactive(self._handle, pBackgroundDecompressionActive))
+		
+		return pBackgroundDecompressionActive.value
+	
+	def SetLazyAttachmentLoadingActive(self, LazyAttachmentLoadingActive):
+		bLazyAttachmentLoadingActive = ctypes.c_bool(LazyAttachmentLoadingActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setlazyattachmentloadingactive(self._handle, bLazyAttachmentLoadingActive))
+		
+	
+	def GetLazyAttachmentLoadingActive(self):
+		pLazyAttachmentLoadingActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getlazyattachmentloadingactive(self._handle, pLazyAttachmentLoadingActive))
+		
+		return pLazyAttachmentLoadingActive.value
+	
 	def GetWarning(self, Index):
 		nIndex = ctypes.c_uint32(Index)
 		pErrorCode = ctypes.c_uint32()
@@ -8469,6 +8947,21 @@ class LevelSet(Object):
 	
 
 
+	def SampleGrid(self, Origin, Spacing, CountX, CountY, CountZ, ProgressCallbackFunc, UserData):
+		nCountX = ctypes.c_uint32(CountX)
+		nCountY = ctypes.c_uint32(CountY)
+		nCountZ = ctypes.c_uint32(CountZ)
+		pUserData = ctypes.c_void_p(UserData)
+		nValuesCount = ctypes.c_uint64(0)
+		nValuesNeededCount = ctypes.c_uint64(0)
+		pValuesBuffer = (ctypes.c_float*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_levelset_samplegrid(self._handle, Origin, Spacing, nCountX, nCountY, nCountZ, ProgressCallbackFunc, pUserData, nValuesCount, nValuesNeededCount, pValuesBuffer))
+		nValuesCount = ctypes.c_uint64(nValuesNeededCount.value)
+		pValuesBuffer = (ctypes.c_float * nValuesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_levelset_samplegrid(self._handle, Origin, Spacing, nCountX, nCountY, nCountZ, ProgressCallbackFunc, pUserData, nValuesCount, nValuesNeededCount, pValuesBuffer))
+		
+		return [pValuesBuffer[i] for i in range(nValuesNeededCount.value)]
+	
 ''' Class Implementation for BeamLattice
 '''
 class BeamLattice(Base):
@@ -10975,6 +11468,22 @@ class Function(Resource):
 	
 
 
+	def SampleGrid(self, OutputIdentifier, Origin, Spacing, CountX, CountY, CountZ, ProgressCallbackFunc, UserData):
+		pOutputIdentifier = ctypes.c_char_p(str.encode(OutputIdentifier))
+		nCountX = ctypes.c_uint32(CountX)
+		nCountY = ctypes.c_uint32(CountY)
+		nCountZ = ctypes.c_uint32(CountZ)
+		pUserData = ctypes.c_void_p(UserData)
+		nValuesCount = ctypes.c_uint64(0)
+		nValuesNeededCount = ctypes.c_uint64(0)
+		pValuesBuffer = (ctypes.c_float*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_function_samplegrid(self._handle, pOutputIdentifier, Origin, Spacing, nCountX, nCountY, nCountZ, ProgressCallbackFunc, pUserData, nValuesCount, nValuesNeededCount, pValuesBuffer))
+		nValuesCount = ctypes.c_uint64(nValuesNeededCount.value)
+		pValuesBuffer = (ctypes.c_float * nValuesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_function_samplegrid(self._handle, pOutputIdentifier, Origin, Spacing, nCountX, nCountY, nCountZ, ProgressCallbackFunc, pUserData, nValuesCount, nValuesNeededCount, pValuesBuffer))
+		
+		return [pValuesBuffer[i] for i in range(nValuesNeededCount.value)]
+	
 ''' Class Implementation for ImplicitFunction
 '''
 class ImplicitFunction(Function):
@@ -11695,6 +12204,19 @@ class ImplicitFunction(Function):
 	
 
 
+	def EvaluateBatch(self, Inputs):
+		nInputsCount = ctypes.c_uint64(len(Inputs))
+		pInputsBuffer = (ctypes.c_double*len(Inputs))(*Inputs)
+		nOutputsCount = ctypes.c_uint64(0)
+		nOutputsNeededCount = ctypes.c_uint64(0)
+		pOutputsBuffer = (ctypes.c_double*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitfunction_evaluatebatch(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		nOutputsCount = ctypes.c_uint64(nOutputsNeededCount.value)
+		pOutputsBuffer = (ctypes.c_double * nOutputsNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitfunction_evaluatebatch(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		
+		return [pOutputsBuffer[i] for i in range(nOutputsNeededCount.value)]
+	
 ''' Class Implementation for FunctionFromImage3D
 '''
 class FunctionFromImage3D(Function):
@@ -12736,6 +13258,17 @@ class Model(Base):
 		
 		return pOutbox
 	
+	def GetBuildItemOutboxes(self):
+		nOutboxesCount = ctypes.c_uint64(0)
+		nOutboxesNeededCount = ctypes.c_uint64(0)
+		pOutboxesBuffer = (Box*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_getbuilditemoutboxes(self._handle, nOutboxesCount, nOutboxesNeededCount, pOutboxesBuffer))
+		nOutboxesCount = ctypes.c_uint64(nOutboxesNeededCount.value)
+		pOutboxesBuffer = (Box * nOutboxesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_getbuilditemoutboxes(self._handle, nOutboxesCount, nOutboxesNeededCount, pOutboxesBuffer))
+		
+		return [pOutboxesBuffer[i] for i in range(nOutboxesNeededCount.value)]
+	
 	def GetResources(self):
 		ResourceIteratorHandle = ctypes.c_void_p()
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_getresources(self._handle, ResourceIteratorHandle))
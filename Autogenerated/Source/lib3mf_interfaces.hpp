@@ -395,7 +395,7 @@ public:
 	virtual void WriteToFile(const std::string & sFilename) = 0;
 
 	/**
-	* IWriter::GetStreamSize - Retrieves the size of the full 3MF file stream.
+	* IWriter::GetStreamSize - Retrieves the size of the full 3MF file stream..
 	* @return the stream size
 	*/
 	virtual Lib3MF_uint64 GetStreamSize() = 0;
@@ -408,6 +408,18 @@ public:
 	*/
 	virtual void WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer) = 0;
 
+	/**
+	* IWriter::WriteToInternalBuffer - Writes out the 3MF file once into a memory buffer that is owned by the writer. The buffer stays valid until the next call of WriteToInternalBuffer or until the writer is released.
+	* @return size of the written buffer in bytes
+	*/
+	virtual Lib3MF_uint64 WriteToInternalBuffer() = 0;
+
+	/**
+	* IWriter::GetInternalBufferAddress - Returns the address of the buffer written by the last call of WriteToInternalBuffer.
+	* @return address of the first byte of the buffer
+	*/
+	virtual Lib3MF_uint64 GetInternalBufferAddress() = 0;
+
 	/**
 	* IWriter::WriteToCallback - Writes out the model and passes the data to a provided callback function. The file type is specified by the Model Writer class.
 	* @param[in] pTheWriteCallback - callback function
@@ -447,6 +459,78 @@ public:
 	*/
 	virtual bool GetStrictModeActive() = 0;
 
+	/**
+	* IWriter::SetObjectThreadCount - Sets the number of threads used to format the XML of the objects of a model part. The written stream is identical to serial writing.
+	* @param[in] nThreadCount - number of formatting threads. 1 (default) writes all objects serially, 0 uses all available hardware threads.
+	*/
+	virtual void SetObjectThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IWriter::GetObjectThreadCount - Returns the number of threads used to format the XML of the objects of a model part.
+	* @return number of formatting threads. 0 means all available hardware threads.
+	*/
+	virtual Lib3MF_uint32 GetObjectThreadCount() = 0;
+
+	/**
+	* IWriter::SetSubModelThreadCount - Sets the number of threads used to write the non-root model parts of the production extension. Each part is deflated while it is written. The written parts are identical to serial writing.
+	* @param[in] nThreadCount - number of writer threads. 1 (default) writes all parts serially, 0 uses all available hardware threads.
+	*/
+	virtual void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IWriter::GetSubModelThreadCount - Returns the number of threads used to write the non-root model parts of the production extension.
+	* @return number of writer threads. 0 means all available hardware threads.
+	*/
+	virtual Lib3MF_uint32 GetSubModelThreadCount() = 0;
+
+	/**
+	* IWriter::SetCompressionThreadCount - Sets the number of threads used to deflate large parts of the package. Parts are split into blocks of 1 MB, which are compressed independently and joined into one valid deflate stream.
+	* @param[in] nThreadCount - number of compression threads. 1 (default) compresses all parts on the calling thread, 0 uses all available hardware threads.
+	*/
+	virtual void SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IWriter::GetCompressionThreadCount - Returns the number of threads used to deflate large parts of the package.
+	* @return number of compression threads. 0 means all available hardware threads.
+	*/
+	virtual Lib3MF_uint32 GetCompressionThreadCount() = 0;
+
+	/**
+	* IWriter::SetModelCompressionLevel - Sets the compression level of the model parts (root model and non-root models of the production extension).
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	virtual void SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel) = 0;
+
+	/**
+	* IWriter::GetModelCompressionLevel - Returns the compression level of the model parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	virtual Lib3MF_uint32 GetModelCompressionLevel() = 0;
+
+	/**
+	* IWriter::SetTextureCompressionLevel - Sets the compression level of textures and thumbnails.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	virtual void SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel) = 0;
+
+	/**
+	* IWriter::GetTextureCompressionLevel - Returns the compression level of the texture and thumbnail parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	virtual Lib3MF_uint32 GetTextureCompressionLevel() = 0;
+
+	/**
+	* IWriter::SetAttachmentCompressionLevel - Sets the compression level of all other attachments.
+	* @param[in] nCompressionLevel - 0 stores the parts uncompressed, 1 (default) to 9 deflate them with increasing compression and decreasing speed.
+	*/
+	virtual void SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel) = 0;
+
+	/**
+	* IWriter::GetAttachmentCompressionLevel - Returns the compression level of the attachment parts.
+	* @return compression level. 0 means the parts are stored uncompressed.
+	*/
+	virtual Lib3MF_uint32 GetAttachmentCompressionLevel() = 0;
+
 	/**
 	* IWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -525,6 +609,41 @@ public:
 	*/
 	virtual void SetProgressCallback(const Lib3MF::ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData) = 0;
 
+	/**
+	* IReader::SetVertexStreamCallback - Streams the vertices of the next read to a callback
+	* @param[in] pVertexStreamCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	virtual void SetVertexStreamCallback(const Lib3MF::VertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData) = 0;
+
+	/**
+	* IReader::SetTriangleStreamCallback - Streams the triangles of the next read to a callback
+	* @param[in] pTriangleStreamCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	virtual void SetTriangleStreamCallback(const Lib3MF::TriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData) = 0;
+
+	/**
+	* IReader::SetBeamStreamCallback - Streams the beams of the next read to a callback
+	* @param[in] pBeamStreamCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	virtual void SetBeamStreamCallback(const Lib3MF::BeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData) = 0;
+
+	/**
+	* IReader::SetComponentStreamCallback - Streams the components of the next read to a callback
+	* @param[in] pComponentStreamCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	virtual void SetComponentStreamCallback(const Lib3MF::ComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData) = 0;
+
+	/**
+	* IReader::SetBuildItemStreamCallback - Streams the build items of the next read to a callback
+	* @param[in] pBuildItemStreamCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	*/
+	virtual void SetBuildItemStreamCallback(const Lib3MF::BuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData) = 0;
+
 	/**
 	* IReader::AddRelationToRead - Adds a relationship type which shall be read as attachment in memory while loading
 	* @param[in] sRelationShipType - String of the relationship type
@@ -549,6 +668,54 @@ public:
 	*/
 	virtual bool GetStrictModeActive() = 0;
 
+	/**
+	* IReader::SetSubModelThreadCount - Sets the number of threads used to parse the non-root model parts of the production extension. Resources, IDs and warnings are identical to serial parsing.
+	* @param[in] nThreadCount - number of parser threads. 1 (default) parses all parts serially, 0 uses all available hardware threads.
+	*/
+	virtual void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IReader::GetSubModelThreadCount - Returns the number of threads used to parse the non-root model parts of the production extension.
+	* @return number of parser threads. 0 means all available hardware threads.
+	*/
+	virtual Lib3MF_uint32 GetSubModelThreadCount() = 0;
+
+	/**
+	* IReader::SetLazyMeshLoadingActive - Defers parsing of mesh content until a mesh is accessed for the first time. The package data (file, buffer or callbacks) must stay valid until all meshes are loaded, and deferred meshes must not be loaded from several threads at once.
+	* @param[in] bLazyMeshLoadingActive - flag whether mesh content is parsed on first access. Ignored if a stream callback is set.
+	*/
+	virtual void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive) = 0;
+
+	/**
+	* IReader::GetLazyMeshLoadingActive - Queries whether mesh content is parsed on first access
+	* @return returns flag whether mesh content is parsed on first access.
+	*/
+	virtual bool GetLazyMeshLoadingActive() = 0;
+
+	/**
+	* IReader::SetBackgroundDecompressionActive - Decompresses the root model part on a background thread while it is parsed. Read callbacks are then called from that thread.
+	* @param[in] bBackgroundDecompressionActive - flag whether the root model part is decompressed on a background thread. Ignored if lazy mesh loading is active.
+	*/
+	virtual void SetBackgroundDecompressionActive(const bool bBackgroundDecompressionActive) = 0;
+
+	/**
+	* IReader::GetBackgroundDecompressionActive - Queries whether the root model part is decompressed on a background thread
+	* @return returns flag whether the root model part is decompressed on a background thread.
+	*/
+	virtual bool GetBackgroundDecompressionActive() = 0;
+
+	/**
+	* IReader::SetLazyAttachmentLoadingActive - Keeps attachments, textures and thumbnails compressed in the package until their content is accessed. Attachments that are not accessed or replaced are copied without recompression when the model is written. The package data (file, buffer or callbacks) must stay valid as long as the model uses such attachments.
+	* @param[in] bLazyAttachmentLoadingActive - flag whether attachments are decompressed on first access. Encrypted attachments are always read immediately.
+	*/
+	virtual void SetLazyAttachmentLoadingActive(const bool bLazyAttachmentLoadingActive) = 0;
+
+	/**
+	* IReader::GetLazyAttachmentLoadingActive - Queries whether attachments are decompressed on first access
+	* @return returns flag whether attachments are decompressed on first access.
+	*/
+	virtual bool GetLazyAttachmentLoadingActive() = 0;
+
 	/**
 	* IReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -1781,6 +1948,21 @@ public:
 	*/
 	virtual void SetVolumeData(IVolumeData* pTheVolumeData) = 0;
 
+	/**
+	* ILevelSet::SampleGrid - Evaluates the field of the level set in the coordinate system of the level set object on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The field is the channel of the function, where NaN is replaced by the fall back value, clipped to the bounding mesh. It is negative inside the shape. A grid with CountZ = 1 samples a single layer.
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pValuesBuffer - single buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	virtual void SampleGrid(const Lib3MF::sVector Origin, const Lib3MF::sVector Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const Lib3MF::ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<ILevelSet> PILevelSet;
@@ -4875,6 +5057,22 @@ public:
 	*/
 	virtual IImplicitPort * FindOutput(const std::string & sIdentifier) = 0;
 
+	/**
+	* IFunction::SampleGrid - Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ. The function MUST have inputs with 3 components in total, which receive the grid position. A grid with CountZ = 1 samples a single layer.
+	* @param[in] sOutputIdentifier - the identifier of the scalar output to sample
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - callback function
+	* @param[in] nUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pValuesBuffer - single buffer of value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	virtual void SampleGrid(const std::string & sOutputIdentifier, const Lib3MF::sVector Origin, const Lib3MF::sVector Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const Lib3MF::ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IFunction> PIFunction;
@@ -5426,6 +5624,16 @@ public:
 	*/
 	virtual void SortNodesTopologically() = 0;
 
+	/**
+	* IImplicitFunction::EvaluateBatch - Evaluates the function for a batch of points. The input values are given in structure-of-arrays order: for every input of the function in their order, for every component (1 for scalars, 3 for vectors, 16 for matrices in row-major order), the values of all points. The output values are returned in the same order: for every output of the function in their order, for every component, the values of all points.
+	* @param[in] nInputsBufferSize - Number of elements in buffer
+	* @param[in] pInputsBuffer - Input values of all points. The count MUST be a multiple of the component count of all inputs.
+	* @param[in] nOutputsBufferSize - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutputsBuffer - double buffer of Output values of all points.
+	*/
+	virtual void EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IImplicitFunction> PIImplicitFunction;
@@ -6386,6 +6594,14 @@ public:
 	*/
 	virtual Lib3MF::sBox GetOutbox() = 0;
 
+	/**
+	* IModel::GetBuildItemOutboxes - Returns the outboxes of all build items in the order of the build items. Large builds are processed on several threads
+	* @param[in] nOutboxesBufferSize - Number of elements in buffer
+	* @param[out] pOutboxesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutboxesBuffer - Box buffer of contains the outbox of each build item.
+	*/
+	virtual void GetBuildItemOutboxes(Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, Lib3MF::sBox * pOutboxesBuffer) = 0;
+
 	/**
 	* IModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
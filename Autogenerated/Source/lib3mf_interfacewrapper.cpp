@@ -228,6 +228,74 @@ Lib3MFResult lib3mf_writer_writetobuffer(Lib3MF_Writer pWriter, const Lib3MF_uin
 	}
 }
 
+Lib3MFResult lib3mf_writer_writetointernalbuffer(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferSize)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "WriteToInternalBuffer");
+		}
+		if (pBufferSize == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pBufferSize = pIWriter->WriteToInternalBuffer();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("BufferSize", *pBufferSize);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getinternalbufferaddress(Lib3MF_Writer pWriter, Lib3MF_uint64 * pBufferAddress)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetInternalBufferAddress");
+		}
+		if (pBufferAddress == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pBufferAddress = pIWriter->GetInternalBufferAddress();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("BufferAddress", *pBufferAddress);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_writer_writetocallback(Lib3MF_Writer pWriter, Lib3MFWriteCallback pTheWriteCallback, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
 {
 	IBase* pIBaseClass = (IBase *)pWriter;
@@ -424,51 +492,881 @@ Lib3MFResult lib3mf_writer_getstrictmodeactive(Lib3MF_Writer pWriter, bool * pSt
 	}
 }
 
-Lib3MFResult lib3mf_writer_getwarning(Lib3MF_Writer pWriter, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
+Lib3MFResult lib3mf_writer_setobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetWarning");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetObjectThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetObjectThreadCount(nThreadCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getobjectthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetObjectThreadCount");
+		}
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIWriter->GetObjectThreadCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetSubModelThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetSubModelThreadCount(nThreadCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getsubmodelthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetSubModelThreadCount");
+		}
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIWriter->GetSubModelThreadCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetCompressionThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetCompressionThreadCount(nThreadCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getcompressionthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetCompressionThreadCount");
+		}
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIWriter->GetCompressionThreadCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetModelCompressionLevel");
+			pJournalEntry->addUInt32Parameter("CompressionLevel", nCompressionLevel);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetModelCompressionLevel(nCompressionLevel);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getmodelcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetModelCompressionLevel");
+		}
+		if (pCompressionLevel == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCompressionLevel = pIWriter->GetModelCompressionLevel();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("CompressionLevel", *pCompressionLevel);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_settexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetTextureCompressionLevel");
+			pJournalEntry->addUInt32Parameter("CompressionLevel", nCompressionLevel);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetTextureCompressionLevel(nCompressionLevel);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_gettexturecompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetTextureCompressionLevel");
+		}
+		if (pCompressionLevel == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCompressionLevel = pIWriter->GetTextureCompressionLevel();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("CompressionLevel", *pCompressionLevel);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetAttachmentCompressionLevel");
+			pJournalEntry->addUInt32Parameter("CompressionLevel", nCompressionLevel);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetAttachmentCompressionLevel(nCompressionLevel);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getattachmentcompressionlevel(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetAttachmentCompressionLevel");
+		}
+		if (pCompressionLevel == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCompressionLevel = pIWriter->GetAttachmentCompressionLevel();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("CompressionLevel", *pCompressionLevel);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getwarning(Lib3MF_Writer pWriter, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetWarning");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
+		}
+		if (!pErrorCode)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ( (!pWarningBuffer) && !(pWarningNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sWarning("");
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pWarningBuffer == nullptr);
+		if (isCacheCall) {
+			sWarning = pIWriter->GetWarning(nIndex, *pErrorCode);
+
+			pIWriter->_setCache (new ParameterCache_2<Lib3MF_uint32, std::string> (*pErrorCode, sWarning));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_2<Lib3MF_uint32, std::string>*> (pIWriter->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (*pErrorCode, sWarning);
+			pIWriter->_setCache (nullptr);
+		}
+		
+		if (pWarningNeededChars)
+			*pWarningNeededChars = (Lib3MF_uint32) (sWarning.size()+1);
+		if (pWarningBuffer) {
+			if (sWarning.size() >= nWarningBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iWarning = 0; iWarning < sWarning.size(); iWarning++)
+				pWarningBuffer[iWarning] = sWarning[iWarning];
+			pWarningBuffer[sWarning.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ErrorCode", *pErrorCode);
+			pJournalEntry->addStringResult("Warning", sWarning.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getwarningcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetWarningCount");
+		}
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCount = pIWriter->GetWarningCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_addkeywrappingcallback(Lib3MF_Writer pWriter, const char * pConsumerID, Lib3MFKeyWrappingCallback pTheCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "AddKeyWrappingCallback");
+			pJournalEntry->addStringParameter("ConsumerID", pConsumerID);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		if (pConsumerID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sConsumerID(pConsumerID);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->AddKeyWrappingCallback(sConsumerID, pTheCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setcontentencryptioncallback(Lib3MF_Writer pWriter, Lib3MFContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetContentEncryptionCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetContentEncryptionCallback(pTheCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for Reader
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_reader_readfromfile(Lib3MF_Reader pReader, const char * pFilename)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromFile");
+			pJournalEntry->addStringParameter("Filename", pFilename);
+		}
+		if (pFilename == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sFilename(pFilename);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->ReadFromFile(sFilename);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_readfrombuffer(Lib3MF_Reader pReader, Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromBuffer");
+		}
+		if ( (!pBufferBuffer) && (nBufferBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->ReadFromBuffer(nBufferBufferSize, pBufferBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_readfromcallback(Lib3MF_Reader pReader, Lib3MFReadCallback pTheReadCallback, Lib3MF_uint64 nStreamSize, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromCallback");
+			pJournalEntry->addUInt64Parameter("StreamSize", nStreamSize);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->ReadFromCallback(pTheReadCallback, nStreamSize, pTheSeekCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_setprogresscallback(Lib3MF_Reader pReader, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetProgressCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetProgressCallback(pProgressCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_setvertexstreamcallback(Lib3MF_Reader pReader, Lib3MFVertexStreamCallback pVertexStreamCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetVertexStreamCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetVertexStreamCallback(pVertexStreamCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_settrianglestreamcallback(Lib3MF_Reader pReader, Lib3MFTriangleStreamCallback pTriangleStreamCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetTriangleStreamCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetTriangleStreamCallback(pTriangleStreamCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_setbeamstreamcallback(Lib3MF_Reader pReader, Lib3MFBeamStreamCallback pBeamStreamCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetBeamStreamCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetBeamStreamCallback(pBeamStreamCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_setcomponentstreamcallback(Lib3MF_Reader pReader, Lib3MFComponentStreamCallback pComponentStreamCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetComponentStreamCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetComponentStreamCallback(pComponentStreamCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_setbuilditemstreamcallback(Lib3MF_Reader pReader, Lib3MFBuildItemStreamCallback pBuildItemStreamCallback, Lib3MF_pvoid pUserData)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetBuildItemStreamCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetBuildItemStreamCallback(pBuildItemStreamCallback, pUserData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_addrelationtoread(Lib3MF_Reader pReader, const char * pRelationShipType)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "AddRelationToRead");
+			pJournalEntry->addStringParameter("RelationShipType", pRelationShipType);
 		}
-		if (!pErrorCode)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pWarningBuffer) && !(pWarningNeededChars) )
+		if (pRelationShipType == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sWarning("");
-		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
-		if (!pIWriter)
+		std::string sRelationShipType(pRelationShipType);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pWarningBuffer == nullptr);
-		if (isCacheCall) {
-			sWarning = pIWriter->GetWarning(nIndex, *pErrorCode);
+		pIReader->AddRelationToRead(sRelationShipType);
 
-			pIWriter->_setCache (new ParameterCache_2<Lib3MF_uint32, std::string> (*pErrorCode, sWarning));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_2<Lib3MF_uint32, std::string>*> (pIWriter->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (*pErrorCode, sWarning);
-			pIWriter->_setCache (nullptr);
-		}
-		
-		if (pWarningNeededChars)
-			*pWarningNeededChars = (Lib3MF_uint32) (sWarning.size()+1);
-		if (pWarningBuffer) {
-			if (sWarning.size() >= nWarningBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iWarning = 0; iWarning < sWarning.size(); iWarning++)
-				pWarningBuffer[iWarning] = sWarning[iWarning];
-			pWarningBuffer[sWarning.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("ErrorCode", *pErrorCode);
-			pJournalEntry->addStringResult("Warning", sWarning.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -484,25 +1382,26 @@ Lib3MFResult lib3mf_writer_getwarning(Lib3MF_Writer pWriter, Lib3MF_uint32 nInde
 	}
 }
 
-Lib3MFResult lib3mf_writer_getwarningcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_reader_removerelationtoread(Lib3MF_Reader pReader, const char * pRelationShipType)
 {
-	IBase* pIBaseClass = (IBase *)pWriter;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetWarningCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "RemoveRelationToRead");
+			pJournalEntry->addStringParameter("RelationShipType", pRelationShipType);
 		}
-		if (pCount == nullptr)
+		if (pRelationShipType == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
-		if (!pIWriter)
+		std::string sRelationShipType(pRelationShipType);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIWriter->GetWarningCount();
+		pIReader->RemoveRelationToRead(sRelationShipType);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -518,25 +1417,21 @@ Lib3MFResult lib3mf_writer_getwarningcount(Lib3MF_Writer pWriter, Lib3MF_uint32
 	}
 }
 
-Lib3MFResult lib3mf_writer_addkeywrappingcallback(Lib3MF_Writer pWriter, const char * pConsumerID, Lib3MFKeyWrappingCallback pTheCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pReader, bool bStrictModeActive)
 {
-	IBase* pIBaseClass = (IBase *)pWriter;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "AddKeyWrappingCallback");
-			pJournalEntry->addStringParameter("ConsumerID", pConsumerID);
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetStrictModeActive");
+			pJournalEntry->addBooleanParameter("StrictModeActive", bStrictModeActive);
 		}
-		if (pConsumerID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sConsumerID(pConsumerID);
-		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
-		if (!pIWriter)
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIWriter->AddKeyWrappingCallback(sConsumerID, pTheCallback, pUserData);
+		pIReader->SetStrictModeActive(bStrictModeActive);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -554,23 +1449,25 @@ Lib3MFResult lib3mf_writer_addkeywrappingcallback(Lib3MF_Writer pWriter, const c
 	}
 }
 
-Lib3MFResult lib3mf_writer_setcontentencryptioncallback(Lib3MF_Writer pWriter, Lib3MFContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pStrictModeActive)
 {
-	IBase* pIBaseClass = (IBase *)pWriter;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetContentEncryptionCallback");
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetStrictModeActive");
 		}
-		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
-		if (!pIWriter)
+		if (pStrictModeActive == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIWriter->SetContentEncryptionCallback(pTheCallback, pUserData);
+		*pStrictModeActive = pIReader->GetStrictModeActive();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("StrictModeActive", *pStrictModeActive);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -586,28 +1483,21 @@ Lib3MFResult lib3mf_writer_setcontentencryptioncallback(Lib3MF_Writer pWriter, L
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Reader
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_reader_readfromfile(Lib3MF_Reader pReader, const char * pFilename)
+Lib3MFResult lib3mf_reader_setsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromFile");
-			pJournalEntry->addStringParameter("Filename", pFilename);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetSubModelThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
 		}
-		if (pFilename == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sFilename(pFilename);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->ReadFromFile(sFilename);
+		pIReader->SetSubModelThreadCount(nThreadCount);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -625,24 +1515,25 @@ Lib3MFResult lib3mf_reader_readfromfile(Lib3MF_Reader pReader, const char * pFil
 	}
 }
 
-Lib3MFResult lib3mf_reader_readfrombuffer(Lib3MF_Reader pReader, Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
+Lib3MFResult lib3mf_reader_getsubmodelthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromBuffer");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetSubModelThreadCount");
 		}
-		if ( (!pBufferBuffer) && (nBufferBufferSize>0))
+		if (pThreadCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->ReadFromBuffer(nBufferBufferSize, pBufferBuffer);
+		*pThreadCount = pIReader->GetSubModelThreadCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -658,22 +1549,21 @@ Lib3MFResult lib3mf_reader_readfrombuffer(Lib3MF_Reader pReader, Lib3MF_uint64 n
 	}
 }
 
-Lib3MFResult lib3mf_reader_readfromcallback(Lib3MF_Reader pReader, Lib3MFReadCallback pTheReadCallback, Lib3MF_uint64 nStreamSize, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_setlazymeshloadingactive(Lib3MF_Reader pReader, bool bLazyMeshLoadingActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "ReadFromCallback");
-			pJournalEntry->addUInt64Parameter("StreamSize", nStreamSize);
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetLazyMeshLoadingActive");
+			pJournalEntry->addBooleanParameter("LazyMeshLoadingActive", bLazyMeshLoadingActive);
 		}
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->ReadFromCallback(pTheReadCallback, nStreamSize, pTheSeekCallback, pUserData);
+		pIReader->SetLazyMeshLoadingActive(bLazyMeshLoadingActive);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -691,23 +1581,25 @@ Lib3MFResult lib3mf_reader_readfromcallback(Lib3MF_Reader pReader, Lib3MFReadCal
 	}
 }
 
-Lib3MFResult lib3mf_reader_setprogresscallback(Lib3MF_Reader pReader, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_getlazymeshloadingactive(Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetProgressCallback");
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetLazyMeshLoadingActive");
 		}
+		if (pLazyMeshLoadingActive == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->SetProgressCallback(pProgressCallback, pUserData);
+		*pLazyMeshLoadingActive = pIReader->GetLazyMeshLoadingActive();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("LazyMeshLoadingActive", *pLazyMeshLoadingActive);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -723,24 +1615,21 @@ Lib3MFResult lib3mf_reader_setprogresscallback(Lib3MF_Reader pReader, Lib3MFProg
 	}
 }
 
-Lib3MFResult lib3mf_reader_addrelationtoread(Lib3MF_Reader pReader, const char * pRelationShipType)
+Lib3MFResult lib3mf_reader_setbackgrounddecompressionactive(Lib3MF_Reader pReader, bool bBackgroundDecompressionActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "AddRelationToRead");
-			pJournalEntry->addStringParameter("RelationShipType", pRelationShipType);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetBackgroundDecompressionActive");
+			pJournalEntry->addBooleanParameter("BackgroundDecompressionActive", bBackgroundDecompressionActive);
 		}
-		if (pRelationShipType == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sRelationShipType(pRelationShipType);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->AddRelationToRead(sRelationShipType);
+		pIReader->SetBackgroundDecompressionActive(bBackgroundDecompressionActive);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -758,26 +1647,25 @@ Lib3MFResult lib3mf_reader_addrelationtoread(Lib3MF_Reader pReader, const char *
 	}
 }
 
-Lib3MFResult lib3mf_reader_removerelationtoread(Lib3MF_Reader pReader, const char * pRelationShipType)
+Lib3MFResult lib3mf_reader_getbackgrounddecompressionactive(Lib3MF_Reader pReader, bool * pBackgroundDecompressionActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "RemoveRelationToRead");
-			pJournalEntry->addStringParameter("RelationShipType", pRelationShipType);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetBackgroundDecompressionActive");
 		}
-		if (pRelationShipType == nullptr)
+		if (pBackgroundDecompressionActive == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sRelationShipType(pRelationShipType);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->RemoveRelationToRead(sRelationShipType);
+		*pBackgroundDecompressionActive = pIReader->GetBackgroundDecompressionActive();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("BackgroundDecompressionActive", *pBackgroundDecompressionActive);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -793,21 +1681,21 @@ Lib3MFResult lib3mf_reader_removerelationtoread(Lib3MF_Reader pReader, const cha
 	}
 }
 
-Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pReader, bool bStrictModeActive)
+Lib3MFResult lib3mf_reader_setlazyattachmentloadingactive(Lib3MF_Reader pReader, bool bLazyAttachmentLoadingActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetStrictModeActive");
-			pJournalEntry->addBooleanParameter("StrictModeActive", bStrictModeActive);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetLazyAttachmentLoadingActive");
+			pJournalEntry->addBooleanParameter("LazyAttachmentLoadingActive", bLazyAttachmentLoadingActive);
 		}
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->SetStrictModeActive(bStrictModeActive);
+		pIReader->SetLazyAttachmentLoadingActive(bLazyAttachmentLoadingActive);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -825,25 +1713,25 @@ Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pReader, bool bStri
 	}
 }
 
-Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pStrictModeActive)
+Lib3MFResult lib3mf_reader_getlazyattachmentloadingactive(Lib3MF_Reader pReader, bool * pLazyAttachmentLoadingActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetStrictModeActive");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetLazyAttachmentLoadingActive");
 		}
-		if (pStrictModeActive == nullptr)
+		if (pLazyAttachmentLoadingActive == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pStrictModeActive = pIReader->GetStrictModeActive();
+		*pLazyAttachmentLoadingActive = pIReader->GetLazyAttachmentLoadingActive();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("StrictModeActive", *pStrictModeActive);
+			pJournalEntry->addBooleanResult("LazyAttachmentLoadingActive", *pLazyAttachmentLoadingActive);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5595,6 +6483,43 @@ Lib3MFResult lib3mf_levelset_setvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_Vol
 }
 
 
+Lib3MFResult lib3mf_levelset_samplegrid(Lib3MF_LevelSet pLevelSet, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pLevelSet;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SampleGrid");
+			pJournalEntry->addUInt32Parameter("CountX", nCountX);
+			pJournalEntry->addUInt32Parameter("CountY", nCountY);
+			pJournalEntry->addUInt32Parameter("CountZ", nCountZ);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pILevelSet->SampleGrid(*pOrigin, *pSpacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 /*************************************************************************************************************************
  Class implementation for BeamLattice
 **************************************************************************************************************************/
@@ -14637,6 +15562,47 @@ Lib3MFResult lib3mf_function_findoutput(Lib3MF_Function pFunction, const char *
 }
 
 
+Lib3MFResult lib3mf_function_samplegrid(Lib3MF_Function pFunction, const char * pOutputIdentifier, const sLib3MFVector * pOrigin, const sLib3MFVector * pSpacing, Lib3MF_uint32 nCountX, Lib3MF_uint32 nCountY, Lib3MF_uint32 nCountZ, Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData, const Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pFunction;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "SampleGrid");
+			pJournalEntry->addStringParameter("OutputIdentifier", pOutputIdentifier);
+			pJournalEntry->addUInt32Parameter("CountX", nCountX);
+			pJournalEntry->addUInt32Parameter("CountY", nCountY);
+			pJournalEntry->addUInt32Parameter("CountZ", nCountZ);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
+		}
+		if (pOutputIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sOutputIdentifier(pOutputIdentifier);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIFunction->SampleGrid(sOutputIdentifier, *pOrigin, *pSpacing, nCountX, nCountY, nCountZ, pProgressCallback, pUserData, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 /*************************************************************************************************************************
  Class implementation for ImplicitFunction
 **************************************************************************************************************************/
@@ -17382,6 +18348,41 @@ Lib3MFResult lib3mf_implicitfunction_sortnodestopologically(Lib3MF_ImplicitFunct
 }
 
 
+Lib3MFResult lib3mf_implicitfunction_evaluatebatch(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "EvaluateBatch");
+		}
+		if ( (!pInputsBuffer) && (nInputsBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pOutputsBuffer) && !(pOutputsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImplicitFunction->EvaluateBatch(nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 /*************************************************************************************************************************
  Class implementation for FunctionFromImage3D
 **************************************************************************************************************************/
@@ -21557,6 +22558,39 @@ Lib3MFResult lib3mf_model_getoutbox(Lib3MF_Model pModel, sLib3MFBox * pOutbox)
 	}
 }
 
+Lib3MFResult lib3mf_model_getbuilditemoutboxes(Lib3MF_Model pModel, const Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, sLib3MFBox * pOutboxesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pModel;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pModel, "Model", "GetBuildItemOutboxes");
+		}
+		if ((!pOutboxesBuffer) && !(pOutboxesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IModel* pIModel = dynamic_cast<IModel*>(pIBaseClass);
+		if (!pIModel)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIModel->GetBuildItemOutboxes(nOutboxesBufferSize, pOutboxesNeededCount, pOutboxesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_model_getresources(Lib3MF_Model pModel, Lib3MF_ResourceIterator * pResourceIterator)
 {
 	IBase* pIBaseClass = (IBase *)pModel;
@@ -23349,6 +24383,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_writer_getstreamsize;
 	if (sProcName == "lib3mf_writer_writetobuffer") 
 		*ppProcAddress = (void*) &lib3mf_writer_writetobuffer;
+	if (sProcName == "lib3mf_writer_writetointernalbuffer") 
+		*ppProcAddress = (void*) &lib3mf_writer_writetointernalbuffer;
+	if (sProcName == "lib3mf_writer_getinternalbufferaddress") 
+		*ppProcAddress = (void*) &lib3mf_writer_getinternalbufferaddress;
 	if (sProcName == "lib3mf_writer_writetocallback") 
 		*ppProcAddress = (void*) &lib3mf_writer_writetocallback;
 	if (sProcName == "lib3mf_writer_setprogresscallback") 
@@ -23361,6 +24399,30 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_writer_setstrictmodeactive;
 	if (sProcName == "lib3mf_writer_getstrictmodeactive") 
 		*ppProcAddress = (void*) &lib3mf_writer_getstrictmodeactive;
+	if (sProcName == "lib3mf_writer_setobjectthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_setobjectthreadcount;
+	if (sProcName == "lib3mf_writer_getobjectthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_getobjectthreadcount;
+	if (sProcName == "lib3mf_writer_setsubmodelthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_setsubmodelthreadcount;
+	if (sProcName == "lib3mf_writer_getsubmodelthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_getsubmodelthreadcount;
+	if (sProcName == "lib3mf_writer_setcompressionthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_setcompressionthreadcount;
+	if (sProcName == "lib3mf_writer_getcompressionthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_getcompressionthreadcount;
+	if (sProcName == "lib3mf_writer_setmodelcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_setmodelcompressionlevel;
+	if (sProcName == "lib3mf_writer_getmodelcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_getmodelcompressionlevel;
+	if (sProcName == "lib3mf_writer_settexturecompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_settexturecompressionlevel;
+	if (sProcName == "lib3mf_writer_gettexturecompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_gettexturecompressionlevel;
+	if (sProcName == "lib3mf_writer_setattachmentcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_setattachmentcompressionlevel;
+	if (sProcName == "lib3mf_writer_getattachmentcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_getattachmentcompressionlevel;
 	if (sProcName == "lib3mf_writer_getwarning") 
 		*ppProcAddress = (void*) &lib3mf_writer_getwarning;
 	if (sProcName == "lib3mf_writer_getwarningcount") 
@@ -23377,6 +24439,16 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_reader_readfromcallback;
 	if (sProcName == "lib3mf_reader_setprogresscallback") 
 		*ppProcAddress = (void*) &lib3mf_reader_setprogresscallback;
+	if (sProcName == "lib3mf_reader_setvertexstreamcallback") 
+		*ppProcAddress = (void*) &lib3mf_reader_setvertexstreamcallback;
+	if (sProcName == "lib3mf_reader_settrianglestreamcallback") 
+		*ppProcAddress = (void*) &lib3mf_reader_settrianglestreamcallback;
+	if (sProcName == "lib3mf_reader_setbeamstreamcallback") 
+		*ppProcAddress = (void*) &lib3mf_reader_setbeamstreamcallback;
+	if (sProcName == "lib3mf_reader_setcomponentstreamcallback") 
+		*ppProcAddress = (void*) &lib3mf_reader_setcomponentstreamcallback;
+	if (sProcName == "lib3mf_reader_setbuilditemstreamcallback") 
+		*ppProcAddress = (void*) &lib3mf_reader_setbuilditemstreamcallback;
 	if (sProcName == "lib3mf_reader_addrelationtoread") 
 		*ppProcAddress = (void*) &lib3mf_reader_addrelationtoread;
 	if (sProcName == "lib3mf_reader_removerelationtoread") 
@@ -23385,6 +24457,22 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_reader_setstrictmodeactive;
 	if (sProcName == "lib3mf_reader_getstrictmodeactive") 
 		*ppProcAddress = (void*) &lib3mf_reader_getstrictmodeactive;
+	if (sProcName == "lib3mf_reader_setsubmodelthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_reader_setsubmodelthreadcount;
+	if (sProcName == "lib3mf_reader_getsubmodelthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_reader_getsubmodelthreadcount;
+	if (sProcName == "lib3mf_reader_setlazymeshloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_setlazymeshloadingactive;
+	if (sProcName == "lib3mf_reader_getlazymeshloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_getlazymeshloadingactive;
+	if (sProcName == "lib3mf_reader_setbackgrounddecompressionactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_setbackgrounddecompressionactive;
+	if (sProcName == "lib3mf_reader_getbackgrounddecompressionactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_getbackgrounddecompressionactive;
+	if (sProcName == "lib3mf_reader_setlazyattachmentloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_setlazyattachmentloadingactive;
+	if (sProcName == "lib3mf_reader_getlazyattachmentloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_getlazyattachmentloadingactive;
 	if (sProcName == "lib3mf_reader_getwarning") 
 		*ppProcAddress = (void*) &lib3mf_reader_getwarning;
 	if (sProcName == "lib3mf_reader_getwarningcount") 
@@ -23635,6 +24723,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_levelset_getvolumedata;
 	if (sProcName == "lib3mf_levelset_setvolumedata") 
 		*ppProcAddress = (void*) &lib3mf_levelset_setvolumedata;
+	if (sProcName == "lib3mf_levelset_samplegrid") 
+		*ppProcAddress = (void*) &lib3mf_levelset_samplegrid;
 	if (sProcName == "lib3mf_beamlattice_getminlength") 
 		*ppProcAddress = (void*) &lib3mf_beamlattice_getminlength;
 	if (sProcName == "lib3mf_beamlattice_setminlength") 
@@ -24113,6 +25203,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_function_findinput;
 	if (sProcName == "lib3mf_function_findoutput") 
 		*ppProcAddress = (void*) &lib3mf_function_findoutput;
+	if (sProcName == "lib3mf_function_samplegrid") 
+		*ppProcAddress = (void*) &lib3mf_function_samplegrid;
 	if (sProcName == "lib3mf_implicitfunction_getidentifier") 
 		*ppProcAddress = (void*) &lib3mf_implicitfunction_getidentifier;
 	if (sProcName == "lib3mf_implicitfunction_setidentifier") 
@@ -24229,6 +25321,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_implicitfunction_clear;
 	if (sProcName == "lib3mf_implicitfunction_sortnodestopologically") 
 		*ppProcAddress = (void*) &lib3mf_implicitfunction_sortnodestopologically;
+	if (sProcName == "lib3mf_implicitfunction_evaluatebatch") 
+		*ppProcAddress = (void*) &lib3mf_implicitfunction_evaluatebatch;
 	if (sProcName == "lib3mf_functionfromimage3d_getimage3d") 
 		*ppProcAddress = (void*) &lib3mf_functionfromimage3d_getimage3d;
 	if (sProcName == "lib3mf_functionfromimage3d_setimage3d") 
@@ -24447,6 +25541,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_model_getbuilditems;
 	if (sProcName == "lib3mf_model_getoutbox") 
 		*ppProcAddress = (void*) &lib3mf_model_getoutbox;
+	if (sProcName == "lib3mf_model_getbuilditemoutboxes") 
+		*ppProcAddress = (void*) &lib3mf_model_getbuilditemoutboxes;
 	if (sProcName == "lib3mf_model_getresources") 
 		*ppProcAddress = (void*) &lib3mf_model_getresources;
 	if (sProcName == "lib3mf_model_getobjects") 
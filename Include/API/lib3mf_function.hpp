@@ -145,6 +145,22 @@ public:
 	*/
 	IImplicitPort * FindOutput(const std::string & sIdentifier) override;
 
+	/**
+	* IFunction::SampleGrid - Evaluates a scalar output of the function on the regular grid Origin + (i, j, k) * Spacing with i < CountX, j < CountY and k < CountZ.
+	* @param[in] sOutputIdentifier - the identifier of the scalar output to sample
+	* @param[in] Origin - position of the first grid point
+	* @param[in] Spacing - distance between neighbouring grid points along x, y and z
+	* @param[in] nCountX - number of grid points along x
+	* @param[in] nCountY - number of grid points along y
+	* @param[in] nCountZ - number of grid points along z
+	* @param[in] pProgressCallback - pointer to the callback function, may be NULL. It is called on the thread that calls SampleGrid.
+	* @param[in] pUserData - pointer to arbitrary user data that is passed without modification to the callback.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pValuesBuffer - value of grid point (i, j, k) at index (k * CountY + j) * CountX + i
+	*/
+	void SampleGrid(const std::string & sOutputIdentifier, const Lib3MF::sVector Origin, const Lib3MF::sVector Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const Lib3MFProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer) override;
+
 };
 
 } // namespace Impl
@@ -784,6 +784,24 @@ namespace Lib3MF
              * topologically
              */
             void SortNodesTopologically() override;
+
+            /**
+             * IImplicitFunction::EvaluateBatch - Evaluates the function for a
+             * batch of points
+             * @param[in] nInputsBufferSize - Number of elements in buffer
+             * @param[in] pInputsBuffer - Input values of all points in
+             * structure-of-arrays order
+             * @param[in] nOutputsBufferSize - Number of elements in buffer
+             * @param[out] pOutputsNeededCount - will be filled with the count
+             * of the written elements, or needed buffer size.
+             * @param[out] pOutputsBuffer - Output values of all points in
+             * structure-of-arrays order
+             */
+            void EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize,
+                               const Lib3MF_double* pInputsBuffer,
+                               Lib3MF_uint64 nOutputsBufferSize,
+                               Lib3MF_uint64* pOutputsNeededCount,
+                               Lib3MF_double* pOutputsBuffer) override;
         };
 
     }  // namespace Impl
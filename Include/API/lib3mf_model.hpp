@@ -201,11 +201,13 @@ public:
 
 	Lib3MF::sBox GetOutbox() override;
 
+	void GetBuildItemOutboxes(Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, Lib3MF::sBox * pOutboxesBuffer) override;
+
 	IKeyStore * GetKeyStore() override;
 
 	void SetRandomNumberCallback(const Lib3MF::RandomNumberCallback pTheCallback, const Lib3MF_pvoid pUserData) override;
 
-	IImageStack * AddImageStack(const Lib3MF_uint32 nSizeX, const Lib3MF_uint32 nSizeY, const Lib3MF_uint32 nSheetCount) override;
+	IImageStack * AddImageStack(const Lib3MF_uint32 nColumnCount, const Lib3MF_uint32 nRowCount, const Lib3MF_uint32 nSheetCount) override;
 
 	IImageStack* GetImageStackByID(const Lib3MF_uint32 nUniqueResourceID) override;
 
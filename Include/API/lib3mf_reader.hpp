@@ -90,12 +90,38 @@ public:
 
 	void SetProgressCallback(const Lib3MFProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
 
+	void SetVertexStreamCallback(const Lib3MFVertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData);
+
+	void SetTriangleStreamCallback(const Lib3MFTriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData);
+
+	void SetBeamStreamCallback(const Lib3MFBeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData);
+
+	void SetComponentStreamCallback(const Lib3MFComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData);
+
+	void SetBuildItemStreamCallback(const Lib3MFBuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData);
+
 	void RemoveRelationToRead (const std::string & sRelationShipType);
 
 	void SetStrictModeActive (const bool bStrictModeActive);
 
 	bool GetStrictModeActive ();
 
+	void SetSubModelThreadCount (const Lib3MF_uint32 nThreadCount);
+
+	Lib3MF_uint32 GetSubModelThreadCount ();
+
+	void SetLazyMeshLoadingActive (const bool bLazyMeshLoadingActive);
+
+	bool GetLazyMeshLoadingActive ();
+
+	void SetBackgroundDecompressionActive (const bool bBackgroundDecompressionActive);
+
+	bool GetBackgroundDecompressionActive ();
+
+	void SetLazyAttachmentLoadingActive (const bool bLazyAttachmentLoadingActive);
+
+	bool GetLazyAttachmentLoadingActive ();
+
 	std::string GetWarning (const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 
 	Lib3MF_uint32 GetWarningCount ();
@@ -38,6 +38,9 @@ Abstract: This file contains utilties used in the API of lib3mf
 #include "Common/Math/NMR_Matrix.h" 
 #include "Model/Classes/NMR_ModelTypes.h" 
 #include "Common/NMR_SecureContentTypes.h"
+#include "Common/3MF_ProgressMonitor.h"
+
+#include <functional>
 
 namespace Lib3MF {
 
@@ -56,6 +59,11 @@ NMR::eKeyStoreWrapAlgorithm translateWrappingAlgorithm(const eLib3MFWrappingAlgo
 eLib3MFCompression translateCompression(bool compression);
 bool translateCompression(const eLib3MFCompression compression);
 
+// Calls fnRun with a progress monitor that forwards to pProgressCallback, or with nullptr if no
+// callback is set. A cancellation by the callback is reported as LIB3MF_ERROR_CALCULATIONABORTED.
+void runWithProgressCallback(Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData,
+	const std::function<void(NMR::CProgressMonitor*)> & fnRun);
+
 }
 
 #endif // __LIB3MF_UTILS
@@ -68,6 +68,9 @@ private:
 	NMR::PModelWriter m_pWriter;
 
 	NMR::PExportStreamMemory momentBuffer;
+	NMR::PExportStreamMemory m_pInternalBuffer;
+
+	NMR::PExportStreamMemory exportToMemory();
 protected:
 
 	/**
@@ -92,6 +95,10 @@ public:
 
 	void WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer) override;
 
+	Lib3MF_uint64 WriteToInternalBuffer() override;
+
+	Lib3MF_uint64 GetInternalBufferAddress() override;
+
 	void WriteToCallback(const Lib3MFWriteCallback pTheWriteCallback, const Lib3MFSeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData) override;
 
 	void SetProgressCallback(const Lib3MFProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData) override;
@@ -108,6 +115,30 @@ public:
 
 	bool GetStrictModeActive() override;
 
+	void SetObjectThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+	Lib3MF_uint32 GetObjectThreadCount() override;
+
+	void SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+	Lib3MF_uint32 GetSubModelThreadCount() override;
+
+	void SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+	Lib3MF_uint32 GetCompressionThreadCount() override;
+
+	void SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel) override;
+
+	Lib3MF_uint32 GetModelCompressionLevel() override;
+
+	void SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel) override;
+
+	Lib3MF_uint32 GetTextureCompressionLevel() override;
+
+	void SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel) override;
+
+	Lib3MF_uint32 GetAttachmentCompressionLevel() override;
+
 	std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode) override;
 
 	Lib3MF_uint32 GetWarningCount() override;
@@ -57,7 +57,9 @@ namespace NMR
 		PROGRESS_WRITEOBJECTS,
 		PROGRESS_WRITENODES,
 		PROGRESS_WRITETRIANGLES,
-		PROGRESS_WRITESLICES
+		PROGRESS_WRITESLICES,
+		PROGRESS_WRITEKEYSTORE,
+		PROGRESS_SAMPLEGRID
 	};
 	
 	// Matches dll interface type, always modify both!
@@ -48,6 +48,7 @@ You can only add nodes and faces to mesh. You cannot remove the existing structu
 #include "Common/Mesh/NMR_BeamLattice.h"
 
 #include <map>
+#include <vector>
 
 namespace NMR {
 
@@ -57,9 +58,23 @@ namespace NMR {
 		MESHFACES m_Faces;
 		CBeamLattice m_BeamLattice;
 
+		// Increased by every change of nodes, faces, beams or balls
+		nfUint64 m_nGeneration;
 
+		// Result of checkSanity and the generation it was computed for
+		nfBool m_bSanityCached;
+		nfBool m_bSanity;
+		nfUint64 m_nSanityGeneration;
+
+		// Local outbox of the nodes and the nodes that can be extreme under a transformation (a superset of the convex hull vertices)
+		nfBool m_bOutboxCached;
+		nfUint64 m_nOutboxGeneration;
+		NOUTBOX3 m_LocalOutbox;
+		std::vector<NVEC3> m_OutboxVertices;
 
 		PMeshInformationHandler m_pMeshInformationHandler;
+
+		nfBool computeSanity();
 	public:
 		CMesh();
 		CMesh(_In_opt_ CMesh * pMesh);
@@ -77,6 +92,16 @@ namespace NMR {
 			_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2);
 		_Ret_notnull_ MESHBALL * addBall(_In_ MESHNODE * pNode, _In_ nfDouble dRadius);
 		_Ret_notnull_ PBEAMSET addBeamSet();
+
+		// Bulk variants of addNode and addFace, the input consists of nCount consecutive triples.
+		// The input is validated before the mesh is changed.
+		void addNodes(_In_ const nfFloat * pCoordinates, _In_ nfUint32 nCount);
+		void addFaces(_In_ const nfUint32 * pNodeIndices, _In_ nfUint32 nCount);
+
+		// Copy the node coordinates and face node indices of the whole mesh (or of a face range) into consecutive triples
+		void getNodeCoordinates(_Out_ nfFloat * pCoordinates);
+		void getFaceNodeIndices(_Out_ nfUint32 * pNodeIndices);
+		void getFaceNodeIndices(_Out_ nfUint32 * pNodeIndices, _In_ nfUint32 nFirstFace, _In_ nfUint32 nFaceCount);
 		
 		nfUint32 getNodeCount();
 		nfUint32 getFaceCount();
@@ -110,8 +135,17 @@ namespace NMR {
 
 		nfBool checkSanity();
 
+		// The generation changes with every modification of the geometry, derived results are cached per generation.
+		// Code that changes nodes, faces, beams or balls through the pointers of getNode, getFace, getBeam or getBall must call markModified.
+		void markModified() { m_nGeneration++; }
+		nfUint64 getGeneration() { return m_nGeneration; }
+
 		void clear();
 		void clearBeamLattice();
+
+		// Allocates the memory for the given node and face counts in advance
+		void reserveCapacity(_In_ nfUint32 nNodeCount, _In_ nfUint32 nFaceCount);
+
 		void clearBeamLatticeBeams();
 		void clearBeamLatticeBalls();
 		void scanOccupiedNodes();
@@ -121,7 +155,12 @@ namespace NMR {
 		_Ret_notnull_ CMeshInformationHandler * createMeshInformationHandler();
 		void clearMeshInformationHandler();
 		void patchMeshInformationResources(_In_ std::map<UniqueResourceID, UniqueResourceID> &oldToNewMapping);
+
+		// Extends the outbox by the transformed nodes. The local outbox and the hull vertices are cached per generation,
+		// calling updateOutboxCache first makes extendOutbox read-only, so that it can be called from several threads.
+		void updateOutboxCache();
 		void extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix);
+		nfUint32 getOutboxVertexCount();
 	};
 
 	typedef std::shared_ptr <CMesh> PMesh;
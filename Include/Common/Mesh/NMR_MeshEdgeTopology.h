@@ -0,0 +1,67 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_MeshEdgeTopology.h defines the class CMeshEdgeTopology.
+
+CMeshEdgeTopology checks the edge topology of a mesh. Every directed edge of
+the faces is packed into a 64 bit key of its two nodes and its orientation.
+The keys are radix sorted, so that the two faces of a manifold edge end up
+next to each other. Key extraction and sorting run on several threads for
+large meshes.
+
+--*/
+
+#ifndef __NMR_MESHEDGETOPOLOGY
+#define __NMR_MESHEDGETOPOLOGY
+
+#include "Common/Mesh/NMR_Mesh.h"
+
+#include <vector>
+
+namespace NMR {
+
+	class CMeshEdgeTopology {
+	private:
+		CMesh * m_pMesh;
+		nfUint32 m_nThreadCount;
+
+		void createEdgeKeys(_Out_ std::vector<nfUint64> & Keys, _In_ nfUint32 nThreadCount);
+		void sortEdgeKeys(_Inout_ std::vector<nfUint64> & Keys, _In_ nfUint64 nMaxKey, _In_ nfUint32 nThreadCount);
+
+	public:
+		// nThreadCount = 0 selects the thread count from the mesh size and the hardware
+		CMeshEdgeTopology(_In_ CMesh * pMesh, _In_ nfUint32 nThreadCount);
+
+		// Returns true if every edge is shared by exactly two faces, which use it in opposite directions.
+		// The faces must reference existing and distinct nodes (see CMesh::checkSanity).
+		nfBool isManifoldAndOriented();
+	};
+
+}
+
+#endif // __NMR_MESHEDGETOPOLOGY
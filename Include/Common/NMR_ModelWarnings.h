@@ -81,6 +81,9 @@ namespace NMR {
 		void addWarning(_In_ nfError nErrorCode, _In_ eModelWarningLevel WarningLevel);
 		void addException(const _In_ CNMRException & Exception, _In_ eModelWarningLevel WarningLevel);
 
+		// Appends already recorded warnings (e.g. of a staged parse) without re-evaluating the critical level
+		void appendWarnings(_In_ CModelWarnings & Warnings);
+
 		nfUint32 getWarningCount();
 		PModelReaderWarning getWarning(_In_ nfUint32 nIndex);
 	};
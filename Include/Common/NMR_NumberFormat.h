@@ -0,0 +1,67 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_NumberFormat.h defines the number formatting of the model writers. Integers
+are written with a table of two-digit pairs, fixed point numbers with exactly
+the given count of decimals, and floating point attributes with std::to_chars.
+The functions write into a caller-provided buffer and do not append a
+terminating zero.
+
+--*/
+
+#ifndef __NMR_NUMBERFORMAT
+#define __NMR_NUMBERFORMAT
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+// Buffer size that is sufficient for every function below
+#define NMR_NUMBERFORMAT_BUFFERSIZE 32
+
+namespace NMR {
+
+	// Writes the decimal representation of nValue, returns the number of characters written
+	nfUint32 fnFormatUInt32(_Out_ nfChar * pBuffer, _In_ nfUint32 nValue);
+	nfUint32 fnFormatUInt64(_Out_ nfChar * pBuffer, _In_ nfUint64 nValue);
+	nfUint32 fnFormatInt32(_Out_ nfChar * pBuffer, _In_ nfInt32 nValue);
+
+	// Writes nAbsScaledValue / 10^nDecimals with exactly nDecimals decimals ("%.Nf" of a truncated value),
+	// a zero value is written as "0". nDecimals must be between 1 and 18.
+	nfUint32 fnFormatFixedPoint(_Out_ nfChar * pBuffer, _In_ nfUint64 nAbsScaledValue, _In_ nfBool bIsNegative, _In_ nfUint32 nDecimals);
+
+	// Writes fValue * nFactor truncated to an integer as fixed point number, where nFactor = 10^nDecimals
+	nfUint32 fnFormatFloatFixed(_Out_ nfChar * pBuffer, _In_ nfFloat fValue, _In_ nfInt64 nFactor, _In_ nfUint32 nDecimals);
+	nfUint32 fnFormatDoubleFixed(_Out_ nfChar * pBuffer, _In_ nfDouble dValue, _In_ nfInt64 nFactor, _In_ nfUint32 nDecimals);
+
+	// Writes the value with six significant digits, identical to the default formatting of std::ostream ("%g")
+	nfUint32 fnFormatFloat(_Out_ nfChar * pBuffer, _In_ nfFloat fValue);
+	nfUint32 fnFormatDouble(_Out_ nfChar * pBuffer, _In_ nfDouble dValue);
+
+}
+
+#endif // __NMR_NUMBERFORMAT
@@ -0,0 +1,57 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_PNGDecoder.h defines a decoder for PNG images that expands all color types
+and bit depths into 16 bit RGBA samples.
+
+--*/
+
+#ifndef __NMR_PNGDECODER
+#define __NMR_PNGDECODER
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <vector>
+
+namespace NMR {
+
+	// Decoded PNG image, row by row, four 16 bit samples (red, green, blue, alpha) per pixel. Gray
+	// images are copied into red, green and blue, images without alpha channel are opaque.
+	typedef struct {
+		nfUint32 m_nWidth;
+		nfUint32 m_nHeight;
+		std::vector<nfUint16> m_RGBA;
+	} sPNGImage;
+
+	// Decodes a PNG image. Throws NMR_ERROR_INVALIDPNGIMAGE if the data is not a valid PNG image.
+	void fnDecodePNG(_In_ const nfByte * pData, _In_ nfUint64 cbSize, _Out_ sPNGImage & Image);
+
+}
+
+#endif // __NMR_PNGDECODER
@@ -28,6 +28,8 @@ Abstract:
 
 NMR_PagedVector.h defines a vector class which allocates its memory block-wise, leading to 
 significant performance improvements against a standard template library vector.
+Blocks are carved out of chunks which grow geometrically, so that large vectors
+end up in few contiguous allocations while element addresses stay stable.
 
 --*/
 
@@ -41,6 +43,9 @@ significant performance improvements against a standard template library vector.
 
 #include <array>
 
+// Upper bound of the number of elements which are allocated at once
+#define NMR_PAGEDVECTOR_MAXCHUNKSIZE (1 << 18)
+
 namespace NMR {
 
 	template <class T, unsigned int DEFAULTBLOCKSIZE = 1024>
@@ -49,6 +54,38 @@ namespace NMR {
 		nfUint32 m_nCount;
 		T * m_pHeadBlock;
 		std::vector<T *> m_pBlocks;
+
+		// Allocations, the blocks of a chunk are consecutive in m_pBlocks
+		std::vector<T *> m_pChunks;
+
+		void allocChunk(_In_ nfUint32 nBlockCount) {
+			T * pChunk = new T[(size_t)nBlockCount * m_nBlockSize];
+			m_pChunks.push_back(pChunk);
+
+			m_pBlocks.reserve(m_pBlocks.size() + nBlockCount);
+			for (nfUint32 nBlock = 0; nBlock < nBlockCount; nBlock++)
+				m_pBlocks.push_back(pChunk + (size_t)nBlock * m_nBlockSize);
+		}
+
+		nfUint32 getMaxChunkBlockCount() {
+			nfUint32 nMaxBlockCount = NMR_PAGEDVECTOR_MAXCHUNKSIZE / m_nBlockSize;
+			return (nMaxBlockCount > 0) ? nMaxBlockCount : 1;
+		}
+
+		// Makes the block of the next element the head block, growing the capacity geometrically
+		void nextBlock() {
+			size_t nBlockIndex = m_nCount / m_nBlockSize;
+			if (nBlockIndex >= m_pBlocks.size()) {
+				nfUint32 nBlockCount = (nfUint32)m_pBlocks.size();
+				nfUint32 nMaxBlockCount = getMaxChunkBlockCount();
+				if (nBlockCount > nMaxBlockCount)
+					nBlockCount = nMaxBlockCount;
+				allocChunk((nBlockCount > 0) ? nBlockCount : 1);
+			}
+
+			m_pHeadBlock = m_pBlocks[nBlockIndex];
+		}
+
 	public:
 
 		CPagedVector() {
@@ -75,14 +112,22 @@ namespace NMR {
 			return m_nCount;
 		}
 
+		// Allocates the memory for nCount elements in advance, in chunks of at most NMR_PAGEDVECTOR_MAXCHUNKSIZE elements
+		void reserve(_In_ nfUint32 nCount) {
+			nfUint64 nBlocksNeeded = ((nfUint64)nCount + m_nBlockSize - 1) / m_nBlockSize;
+			nfUint32 nMaxBlockCount = getMaxChunkBlockCount();
+			while (m_pBlocks.size() < nBlocksNeeded) {
+				nfUint64 nBlockCount = nBlocksNeeded - m_pBlocks.size();
+				allocChunk((nBlockCount > nMaxBlockCount) ? nMaxBlockCount : (nfUint32)nBlockCount);
+			}
+		}
+
 		_Ret_notnull_ T * allocData() {
 			nfUint32 nIdx = (m_nCount % m_nBlockSize);
 
-			// Allocate new node block if necessary
-			if (nIdx == 0) {
-				m_pHeadBlock = new T[m_nBlockSize];
-				m_pBlocks.push_back(m_pHeadBlock);
-			}
+			// Move to the next block if necessary
+			if (nIdx == 0)
+				nextBlock();
 
 			T * pResult = &m_pHeadBlock[nIdx];
 			m_nCount++;
@@ -98,11 +143,9 @@ namespace NMR {
 		T& allocDataRef(_Out_ nfUint32& nNewIndex) {
 			nfUint32 nIdx = (m_nCount % m_nBlockSize);
 
-			// Allocate new node block if necessary
-			if (nIdx == 0) {
-				m_pHeadBlock = new T[m_nBlockSize];
-				m_pBlocks.push_back(m_pHeadBlock);
-			}
+			// Move to the next block if necessary
+			if (nIdx == 0)
+				nextBlock();
 
 			nNewIndex = m_nCount;
 			m_nCount++;
@@ -110,6 +153,45 @@ namespace NMR {
 			return m_pHeadBlock[nIdx];
 		}
 
+		// Appends nCount elements block-wise, fnFill(pElements, nFirstIndex, nElementCount) initializes each contiguous run.
+		// If fnFill throws, the elements of the previous runs stay appended.
+		template <typename F> void appendRuns(_In_ nfUint32 nCount, _In_ F fnFill) {
+			while (nCount > 0) {
+				nfUint32 nIdx = (m_nCount % m_nBlockSize);
+				if (nIdx == 0)
+					nextBlock();
+
+				nfUint32 nRunCount = m_nBlockSize - nIdx;
+				if (nRunCount > nCount)
+					nRunCount = nCount;
+
+				fnFill(&m_pHeadBlock[nIdx], m_nCount, nRunCount);
+				m_nCount += nRunCount;
+				nCount -= nRunCount;
+			}
+		}
+
+		// Calls fnVisit(pElements, nFirstIndex, nElementCount) for the contiguous runs of the elements nStart to nStart + nCount - 1, in index order
+		template <typename F> void visitRuns(_In_ nfUint32 nStart, _In_ nfUint32 nCount, _In_ F fnVisit) {
+			if ((nfUint64)nStart + nCount > m_nCount)
+				throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+			while (nCount > 0) {
+				nfUint32 nIdx = (nStart % m_nBlockSize);
+				nfUint32 nRunCount = m_nBlockSize - nIdx;
+				if (nRunCount > nCount)
+					nRunCount = nCount;
+
+				fnVisit(&m_pBlocks[nStart / m_nBlockSize][nIdx], nStart, nRunCount);
+				nStart += nRunCount;
+				nCount -= nRunCount;
+			}
+		}
+
+		template <typename F> void visitRuns(_In_ F fnVisit) {
+			visitRuns(0, m_nCount, fnVisit);
+		}
+
 		_Ret_notnull_ T * getData(_In_ nfUint32 nIdx) {
 			if (nIdx >= m_nCount)
 				throw CNMRException(NMR_ERROR_INVALIDINDEX);
@@ -127,12 +209,13 @@ namespace NMR {
 		}
 
 		void clearAllData() {
-			for (auto iIterator = m_pBlocks.begin(); iIterator != m_pBlocks.end(); iIterator++)
+			for (auto iIterator = m_pChunks.begin(); iIterator != m_pChunks.end(); iIterator++)
 			{
-				T * pBlock = *iIterator;
-				delete[] pBlock;
+				T * pChunk = *iIterator;
+				delete[] pChunk;
 			}
 
+			m_pChunks.clear();
 			m_pBlocks.clear();
 			m_nCount = 0;
 			m_pHeadBlock = NULL;
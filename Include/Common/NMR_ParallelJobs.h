@@ -0,0 +1,59 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ParallelJobs.h defines helpers that run a fixed number of jobs on
+separate threads. If threads cannot be created, the remaining jobs run on the
+calling thread. The first exception of a job is rethrown after all jobs have
+finished.
+
+--*/
+
+#ifndef __NMR_PARALLELJOBS
+#define __NMR_PARALLELJOBS
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <functional>
+
+namespace NMR {
+
+	// Calls fnJob(nJobIndex) for every index below nJobCount, job 0 always runs on the calling thread
+	void fnRunParallelJobs(_In_ nfUint32 nJobCount, _In_ const std::function<void(nfUint32)> & fnJob);
+
+	// Calls fnItem(nJobIndex, nItemIndex) for every index below nItemCount on nJobCount jobs. Every job
+	// starts with a contiguous share of the items and steals the upper half of the largest remaining
+	// share of another job when its own share is done. After an exception no further items are started.
+	void fnRunStealingJobs(_In_ nfUint32 nJobCount, _In_ nfUint32 nItemCount, _In_ const std::function<void(nfUint32, nfUint32)> & fnItem);
+
+	// Thread count for nItemCount items of which each thread should process at least nMinItemsPerThread
+	nfUint32 fnGetParallelJobCount(_In_ nfUint64 nItemCount, _In_ nfUint64 nMinItemsPerThread);
+
+}
+
+#endif // __NMR_PARALLELJOBS
@@ -5,17 +5,24 @@
 #include <string>
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 namespace NMR {
 	class COpcPackageRelationship;
 	class COpcPackagePart;
 	using POpcPackagePart = std::shared_ptr<COpcPackagePart>;
+	class CImportStream;
+	using PImportStream = std::shared_ptr<CImportStream>;
 
 	class IOpcPackageReader {
 	public:
 		virtual _Ret_maybenull_ COpcPackageRelationship * findRootRelation(_In_ std::string sRelationType, _In_ nfBool bMustBeUnique) = 0;
 		virtual POpcPackagePart createPart(_In_ std::string sPath) = 0;
 		virtual nfUint64 getPartSize(_In_ std::string sPath) = 0;
+		// Opens the content of a part again from the start. Returns null if the part cannot be reopened.
+		virtual PImportStream openPartStream(_In_ std::string sPath) = 0;
+		// Opens the stored bytes of a part without decompressing them. Returns null if the part cannot be copied unchanged.
+		virtual PImportStream openRawPartStream(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & Info) = 0;
 		virtual void close() {}
 	};
 
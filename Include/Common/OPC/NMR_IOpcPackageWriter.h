@@ -6,16 +6,20 @@
 #include <list>
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 namespace NMR {
 	class COpcPackageRelationship;
 	using POpcPackageRelationship = std::shared_ptr<COpcPackageRelationship>;
 	class COpcPackagePart;
 	using POpcPackagePart = std::shared_ptr<COpcPackagePart>;
+	class CImportStream;
 
 	class IOpcPackageWriter {
 	public:
-		virtual POpcPackagePart addPart(_In_ std::string sPath) = 0;
+		virtual POpcPackagePart addPart(_In_ std::string sPath, _In_ nfUint32 nCompressionLevel) = 0;
+		// Adds a part whose stored bytes are copied without recompression. Returns null if the content has to be written through addPart.
+		virtual POpcPackagePart addRawPart(_In_ std::string sPath, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info) = 0;
 		virtual void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) = 0;
 		virtual void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) = 0;
 		virtual POpcPackageRelationship addRootRelationship(_In_ std::string sType, _In_ COpcPackagePart * pTargetPart) = 0;
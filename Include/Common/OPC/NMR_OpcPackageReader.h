@@ -54,7 +54,7 @@ namespace NMR {
 		PProgressMonitor m_pProgressMonitor;
 
 		// ZIP Handling Variables
-		std::vector<nfByte> m_Buffer;
+		PImportStream m_pImportStream;
 		zip_error_t m_ZIPError;
 		zip_t * m_ZIParchive;
 		std::map <std::string, nfUint64> m_ZIPEntries;
@@ -80,6 +80,8 @@ namespace NMR {
 		_Ret_maybenull_ COpcPackageRelationship * findRootRelation(_In_ std::string sRelationType, _In_ nfBool bMustBeUnique) override;
 		POpcPackagePart createPart(_In_ std::string sPath) override;
 		nfUint64 getPartSize(_In_ std::string sPath) override;
+		PImportStream openPartStream(_In_ std::string sPath) override;
+		PImportStream openRawPartStream(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & Info) override;
 	};
 
 	typedef std::shared_ptr<COpcPackageReader> POpcPackageReader;
@@ -63,10 +63,11 @@ namespace NMR {
 		void writeRootRelationships();
 		std::string generateRelationShipID();
 	public:
-		COpcPackageWriter(_In_ PExportStream pExportStream);
+		COpcPackageWriter(_In_ PExportStream pExportStream, _In_ nfUint32 nCompressionThreadCount);
 		~COpcPackageWriter();
 
-		POpcPackagePart addPart(_In_ std::string sPath) override;
+		POpcPackagePart addPart(_In_ std::string sPath, _In_ nfUint32 nCompressionLevel) override;
+		POpcPackagePart addRawPart(_In_ std::string sPath, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info) override;
 
 		void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) override;
 		void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) override;
@@ -49,6 +49,7 @@ namespace NMR {
 	private:
 		CPortableZIPWriter * m_pZIPWriter;
 		nfUint32 m_nEntryKey;
+		nfUint32 m_nCompressionLevel;
 		z_stream m_pStream;
 		std::array<nfByte, ZIPEXPORTBUFFERSIZE> m_nOutBuffer;
 
@@ -58,7 +59,7 @@ namespace NMR {
 		void finishDeflate();
 	public:
 		CExportStream_ZIP() = delete;
-		CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey);
+		CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey, nfUint32 nCompressionLevel);
 		~CExportStream_ZIP();
 
 		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
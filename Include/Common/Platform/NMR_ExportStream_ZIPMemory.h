@@ -0,0 +1,84 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_ZIPMemory.h defines an export stream that compresses a ZIP entry into memory.
+The entry can be copied into a package later without being compressed again.
+
+--*/
+
+#ifndef __NMR_EXPORTSTREAM_ZIPMEMORY
+#define __NMR_EXPORTSTREAM_ZIPMEMORY
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
+#include "zlib.h"
+
+#include <vector>
+
+namespace NMR {
+
+	class CExportStream_ZIPMemory : public CExportStream {
+	private:
+		nfUint32 m_nCompressionLevel;
+		z_stream m_Stream;
+		std::vector<nfByte> m_Buffer;
+		nfUint32 m_nCRC32;
+		nfUint64 m_nUncompressedSize;
+
+		nfBool m_bIsInitialized;
+		nfBool m_bIsFinished;
+
+		void deflateChunk(_In_ const nfByte * pData, _In_ nfUint32 cbCount, _In_ nfInt32 nFlush);
+	public:
+		CExportStream_ZIPMemory() = delete;
+		CExportStream_ZIPMemory(_In_ nfUint32 nCompressionLevel);
+		~CExportStream_ZIPMemory();
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 getPosition();
+		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite);
+
+		// Completes the entry. No data can be written afterwards.
+		void finishEntry();
+
+		// Opens the stored bytes of the finished entry. The stream is only valid as long as this object lives.
+		PImportStream openRawStream(_Out_ ZIPRAWENTRYINFO & Info);
+
+		// Decompresses the finished entry into a stream of its own.
+		PImportStream openUncompressedStream();
+	};
+
+	typedef std::shared_ptr <CExportStream_ZIPMemory> PExportStream_ZIPMemory;
+
+}
+
+#endif // __NMR_EXPORTSTREAM_ZIPMEMORY
@@ -0,0 +1,116 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_ZIPParallel.h defines an export stream that deflates a ZIP entry on several threads.
+The data is split into blocks, which are deflated independently with the end of the previous block as
+dictionary and concatenated into a single raw deflate stream.
+
+--*/
+
+#ifndef __NMR_EXPORTSTREAM_ZIPPARALLEL
+#define __NMR_EXPORTSTREAM_ZIPPARALLEL
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriter.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define ZIPPARALLELBLOCKSIZE (1024 * 1024)
+#define ZIPPARALLELDICTIONARYSIZE 32768
+#define ZIPPARALLELBLOCKSPERTHREAD 2
+
+namespace NMR {
+
+	typedef struct {
+		std::vector<nfByte> m_Dictionary;
+		std::vector<nfByte> m_Input;
+		std::vector<nfByte> m_Output;
+		nfUint32 m_nCRC32;
+		nfBool m_bIsLast;
+		nfBool m_bIsDone;
+		std::exception_ptr m_pException;
+	} ZIPPARALLELBLOCK;
+
+	typedef std::shared_ptr<ZIPPARALLELBLOCK> PZIPPARALLELBLOCK;
+
+	class CExportStream_ZIPParallel : public CExportStream {
+	private:
+		CPortableZIPWriter * m_pZIPWriter;
+		nfUint32 m_nEntryKey;
+		nfUint32 m_nThreadCount;
+		nfUint32 m_nCompressionLevel;
+		nfUint64 m_nPosition;
+
+		PZIPPARALLELBLOCK m_pCurrentBlock;
+		std::vector<nfByte> m_Dictionary;
+
+		// Blocks in stream order, which have not been written yet
+		std::deque<PZIPPARALLELBLOCK> m_PendingBlocks;
+		// Blocks which have not been picked up by a worker yet
+		std::deque<PZIPPARALLELBLOCK> m_QueuedBlocks;
+
+		std::vector<std::thread> m_Workers;
+		std::mutex m_Mutex;
+		std::condition_variable m_QueuedCondition;
+		std::condition_variable m_DoneCondition;
+		nfBool m_bStopWorkers;
+		nfBool m_bIsInitialized;
+
+		void submitBlock(_In_ nfBool bIsLast);
+		void writeFirstPendingBlock();
+		void startWorkers();
+		void stopWorkers();
+		void runWorker();
+
+		static void deflateBlock(_In_ ZIPPARALLELBLOCK & Block, _In_ nfUint32 nCompressionLevel);
+	public:
+		CExportStream_ZIPParallel() = delete;
+		CExportStream_ZIPParallel(_In_ CPortableZIPWriter * pZIPWriter, _In_ nfUint32 nEntryKey, _In_ nfUint32 nCompressionLevel, _In_ nfUint32 nThreadCount);
+		~CExportStream_ZIPParallel();
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 getPosition();
+		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite);
+
+		void flushZIPStream();
+	};
+
+	typedef std::shared_ptr <CExportStream_ZIPParallel> PExportStream_ZIPParallel;
+
+}
+
+#endif // __NMR_EXPORTSTREAM_ZIPPARALLEL
@@ -0,0 +1,81 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_Deferred.h defines a stream class which opens its source on the
+first access, e.g. to keep an attachment compressed in the package until its
+content is needed.
+
+--*/
+
+#ifndef __NMR_IMPORTSTREAM_DEFERRED
+#define __NMR_IMPORTSTREAM_DEFERRED
+
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
+
+#include <functional>
+
+namespace NMR {
+
+	typedef std::function<PImportStream()> ImportStream_OpenerType;
+	typedef std::function<PImportStream(ZIPRAWENTRYINFO & Info)> ImportStream_RawOpenerType;
+
+	class CImportStream_Deferred : public CImportStream {
+	private:
+		ImportStream_OpenerType m_fnOpener;
+		ImportStream_RawOpenerType m_fnRawOpener;
+		nfUint64 m_nSize;
+		PImportStream m_pStream;
+
+		// Decompresses the source into memory on the first call
+		CImportStream * materialize();
+
+	public:
+		CImportStream_Deferred() = delete;
+		CImportStream_Deferred(_In_ ImportStream_OpenerType fnOpener, _In_ ImportStream_RawOpenerType fnRawOpener, _In_ nfUint64 nSize);
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll);
+		virtual nfUint64 retrieveSize();
+		virtual void writeToFile(_In_ const nfWChar * pwszFileName);
+		virtual PImportStream copyToMemory();
+		virtual nfUint64 getPosition();
+
+		nfBool isMaterialized();
+
+		// Opens the stored bytes of the source, returns null if they cannot be copied without recompression
+		PImportStream openRawStream(_Out_ ZIPRAWENTRYINFO & Info);
+	};
+
+	typedef std::shared_ptr <CImportStream_Deferred> PImportStream_Deferred;
+
+}
+
+#endif // __NMR_IMPORTSTREAM_DEFERRED
@@ -61,6 +61,12 @@ namespace NMR {
 		virtual nfUint64 retrieveSize();
 		virtual void writeToFile(_In_ const nfWChar * pwszFileName);
 		virtual PImportStream copyToMemory() = 0;
+
+		// Returns the start of the wrapped memory, or nullptr if the stream is empty. Valid as long as this stream lives.
+		const nfByte * getData();
+
+		// Returns an independent read position on the same memory. The view must not outlive this stream.
+		PImportStream createSharedView();
 	};
 
 }
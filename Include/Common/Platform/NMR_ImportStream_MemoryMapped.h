@@ -1,6 +1,6 @@
 /*++
 
-Copyright (C) 2019 3MF Consortium
+Copyright (C) 2024 3MF Consortium
 
 All rights reserved.
 
@@ -25,42 +25,40 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Abstract:
-
-NMR_ModelReaderNode_Vertex.h defines the Model Reader Vertex Node Class.
-A vertex reader model node is a parser for the vertex node of an XML Model Stream.
+NMR_ImportStream_MemoryMapped.h defines the CImportStream_MemoryMapped Class.
+This is a platform specific class for reading a file through a read-only memory mapping.
 
 --*/
 
-#ifndef __NMR_MODELREADERNODE100_VERTEX
-#define __NMR_MODELREADERNODE100_VERTEX
+#ifndef __NMR_IMPORTSTREAM_MEMORYMAPPED
+#define __NMR_IMPORTSTREAM_MEMORYMAPPED
 
-#include "Model/Reader/NMR_ModelReaderNode.h"
-#include "Model/Classes/NMR_ModelComponent.h"
-#include "Model/Classes/NMR_ModelObject.h"
+#include "Common/Platform/NMR_ImportStream_Memory.h"
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
 
 namespace NMR {
 
-	class CModelReaderNode100_Vertex : public CModelReaderNode {
+	class CImportStream_MemoryMapped : public CImportStream_Memory {
 	private:
-		nfFloat m_fX;
-		nfFloat m_fY;
-		nfFloat m_fZ;
-		nfBool m_bHasX;
-		nfBool m_bHasY;
-		nfBool m_bHasZ;
+		const nfByte * m_pMapping;
+#ifdef _WIN32
+		void * m_hFile;
+		void * m_hMapping;
+#endif // _WIN32
+
+		void unmap();
+	protected:
+		virtual const nfByte * getAt(nfUint64 nPosition);
 	public:
-		CModelReaderNode100_Vertex() = delete;
-		CModelReaderNode100_Vertex(_In_ PModelWarnings pWarnings);
-
-		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
+		// Maps the whole file. Throws if the file is empty or cannot be mapped.
+		// The file must not be truncated while it is mapped.
+		CImportStream_MemoryMapped(_In_ const nfWChar * pwszFileName);
+		~CImportStream_MemoryMapped();
 
-		virtual void parseXML(_In_ CXmlReader * pXMLReader);
-
-		void retrievePosition(_Out_ nfFloat & fX, _Out_ nfFloat & fY, _Out_ nfFloat & fZ);
+		virtual PImportStream copyToMemory();
 	};
 
-	typedef std::shared_ptr <CModelReaderNode100_Vertex> PModelReaderNode100_Vertex;
-
 }
 
-#endif // __NMR_MODELREADERNODE100_VERTEX
+#endif // __NMR_IMPORTSTREAM_MEMORYMAPPED
@@ -0,0 +1,98 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+This is a stream class which reads another import stream ahead on a background thread,
+e.g. to inflate a ZIP entry while the XML parser works on the previously inflated data.
+
+--*/
+
+#ifndef __NMR_IMPORTSTREAM_PIPELINED
+#define __NMR_IMPORTSTREAM_PIPELINED
+
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/3MF_ProgressMonitor.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define IMPORTSTREAM_PIPELINED_BUFFERSIZE (1024 * 1024)
+#define IMPORTSTREAM_PIPELINED_BUFFERCOUNT 4
+// Interval in milliseconds in which a waiting reader queries the progress monitor
+#define IMPORTSTREAM_PIPELINED_CANCELINTERVAL 50
+
+namespace NMR {
+
+	class CImportStream_Pipelined : public CImportStream {
+	private:
+		PImportStream m_pSourceStream;
+		PProgressMonitor m_pProgressMonitor;
+		nfUint64 m_nSize;
+		nfUint64 m_nPosition;
+
+		// Ring of buffers, filled by the producer thread and consumed in order
+		std::vector<std::vector<nfByte>> m_Buffers;
+		std::vector<nfUint64> m_BufferSizes;
+		nfUint64 m_nProducedBuffers;
+		nfUint64 m_nConsumedBuffers;
+		nfUint64 m_nReadOffset;
+
+		nfBool m_bFinished;
+		nfBool m_bCancelled;
+		std::exception_ptr m_pProducerException;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_BufferProduced;
+		std::condition_variable m_BufferConsumed;
+		std::thread m_Producer;
+		// The source is read directly if no thread could be started
+		nfBool m_bSynchronous;
+
+		void produceBuffers();
+		nfBool waitForBuffer();
+		void stopProducer();
+
+	public:
+		CImportStream_Pipelined() = delete;
+		CImportStream_Pipelined(_In_ PImportStream pSourceStream, _In_opt_ PProgressMonitor pProgressMonitor);
+		~CImportStream_Pipelined();
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll);
+		virtual nfUint64 retrieveSize();
+		virtual void writeToFile(_In_ const nfWChar * pwszFileName);
+		virtual PImportStream copyToMemory();
+		virtual nfUint64 getPosition();
+	};
+
+}
+
+#endif // __NMR_IMPORTSTREAM_PIPELINED
@@ -34,6 +34,7 @@ NMR_PortableZIPWriter.h defines a portable and fast writer of ZIP files
 #define __NMR_PORTABLEZIPWRITER
 
 #include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_ImportStream.h"
 #include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 #include "Common/Platform/NMR_PortableZIPWriterEntry.h"
 #include "Common/NMR_Types.h"
@@ -50,6 +51,7 @@ namespace NMR {
 		nfUint32 m_nCurrentEntryKey;
 		nfUint32 m_nNextEntryKey;
 		nfBool m_bIsFinished;
+		nfUint32 m_nCompressionThreadCount;
 
 		nfBool m_bWriteZIP64;
 		nfUint16 m_nVersionMade;
@@ -57,18 +59,27 @@ namespace NMR {
 
 		std::list<PPortableZIPWriterEntry> m_Entries;
 		PExportStream m_pCurrentStream;
+
+		void startEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfUint16 nCompressionMethod);
 	public:
 		CPortableZIPWriter() = delete;
 		CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64);
 		~CPortableZIPWriter();
 
-		PExportStream createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp);
+		// nCompressionLevel 0 stores the entry, 1 to 9 deflate it
+		PExportStream createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfUint32 nCompressionLevel);
 		void closeEntry();
+		// Writes an entry whose stored bytes are read from pRawStream, e.g. the compressed data of an entry of another ZIP file
+		void writeRawEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info);
 
 		void writeDeflatedBuffer(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbCompressedBytes);
 		void calculateChecksum(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbUncompressedBytes);
+		void combineChecksum(_In_ nfUint32 nEntryKey, _In_ nfUint32 nCRC32, _In_ nfUint64 cbUncompressedBytes);
 		nfUint64 getCurrentSize(_In_ nfUint32 nEntryKey);
 
+		// 1 deflates every entry on the calling thread, 0 uses all available hardware threads
+		void setCompressionThreadCount(_In_ nfUint32 nThreadCount);
+
 		void writeDirectory();
 	};
 
@@ -51,8 +51,9 @@ namespace NMR {
 		nfUint64 m_nFilePosition;
 		nfUint64 m_nExtInfoPosition;
 		nfUint64 m_nDataPosition;
+		nfUint16 m_nCompressionMethod;
 	public:
-		CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition);
+		CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition, _In_ nfUint16 nCompressionMethod);
 		std::string getUTF8Name();
 		nfUint32 getCRC32();
 		nfUint64 getCompressedSize();
@@ -62,9 +63,14 @@ namespace NMR {
 		nfUint64 getFilePosition();
 		nfUint64 getExtInfoPosition();
 		nfUint64 getDataPosition();
+		nfUint16 getCompressionMethod();
 		void increaseCompressedSize(_In_ nfUint32 nCompressedSize);
 		void increaseUncompressedSize(_In_ nfUint32 nUncompressedSize);
 		void calculateChecksum(_In_ const void * pBuffer, _In_ nfUint32 cbCount);
+		// Appends data whose checksum has been calculated separately
+		void combineChecksum(_In_ nfUint32 nCRC32, _In_ nfUint64 cbCount);
+		// For entries whose data is copied unchanged from another ZIP file
+		void setChecksumAndUncompressedSize(_In_ nfUint32 nCRC32, _In_ nfUint64 nUncompressedSize);
 
 	};
 
@@ -53,9 +53,15 @@ NMR_PortableZIPWriterTypes.h defines a portable and fast writer of ZIP files
 
 #define ZIPFILECOMPRESSION_UNCOMPRESSED 0
 #define ZIPFILECOMPRESSION_DEFLATED 8
+
+// Compression level 0 stores entries without compression, 1 to 9 are the deflate levels of zlib
+#define ZIPFILECOMPRESSIONLEVEL_STORED 0
+#define ZIPFILECOMPRESSIONLEVEL_DEFAULT 1
+#define ZIPFILECOMPRESSIONLEVEL_MAX 9
 #define ZIPFILEMAXFILENAMELENGTH 32000
 
 #define ZIPFILEMAXIMUMSIZENON64 0xFFFFFFFF
+#define ZIPFILERAWCOPYBUFFERSIZE (1024 * 1024)
 
 namespace NMR {
 
@@ -212,6 +218,14 @@ namespace NMR {
 
 #pragma pack()
 
+	// Describes the stored data of a ZIP entry, which can be copied into another package without recompression
+	typedef struct {
+		nfUint16 m_nCompressionMethod;
+		nfUint32 m_nCRC32;
+		nfUint64 m_nCompressedSize;
+		nfUint64 m_nUncompressedSize;
+	} ZIPRAWENTRYINFO;
+
 }
 
 #endif //__NMR_PORTABLEZIPWRITERTYPES
@@ -35,6 +35,7 @@ NMR_XMLReader.h defines a XML reader class in a portable way.
 
 #include "Common/Platform/NMR_ImportStream.h"
 #include <string>
+#include <map>
 
 namespace NMR {
 
@@ -65,6 +66,12 @@ namespace NMR {
 		virtual nfBool MoveToNextAttribute() = 0;
 		virtual nfBool IsDefault() = 0;
 		virtual void CloseElement();
+
+		// Position in the import stream of the markup of the last read element: the "<" of a start or end tag, or the end of a self-closing tag
+		virtual nfUint64 GetElementStreamPosition();
+		// Namespace prefixes and URIs that are in scope, the default namespace has an empty prefix
+		virtual void GetNameSpaces(_Out_ std::map<std::string, std::string> & NameSpaces);
+		virtual void SetNameSpaces(_In_ const std::map<std::string, std::string> & NameSpaces);
 	};
 
 	typedef std::shared_ptr<CXmlReader> PXmlReader;
@@ -34,6 +34,7 @@ NMR_XMLReader_Native.h defines a XML reader class with a native XML parsing impl
 #define __NMR_XMLREADER_NATIVE
 
 #include "Common/Platform/NMR_XmlReader.h"
+#include "Common/Platform/NMR_XmlReader_NativeScanner.h"
 #include "Common/3MF_ProgressMonitor.h"
 
 #include <memory>
@@ -114,6 +115,14 @@ namespace NMR {
 
 		// How many characters have to be transferred into the next buffer?
 		nfUint32 m_cbCurrentOverflowSize;
+
+		// Stream positions of the read data and of the first character of the current buffer
+		nfUint64 m_nStreamBytesRead;
+		nfUint64 m_nCurrentBufferStreamPosition;
+
+		// Delimiter scanners, selected by the CPU features at construction
+		const XMLREADERNATIVESCANNER * m_pScanner;
+
 		nfChar * m_pCurrentName;
 		nfChar * m_pCurrentPrefix;
 		nfChar * m_pCurrentElementName;
@@ -170,6 +179,9 @@ namespace NMR {
 		virtual nfBool IsDefault();
 		virtual void CloseElement();
 
+		virtual nfUint64 GetElementStreamPosition();
+		virtual void GetNameSpaces(_Out_ std::map<std::string, std::string> & NameSpaces);
+		virtual void SetNameSpaces(_In_ const std::map<std::string, std::string> & NameSpaces);
 	};
 
 	typedef std::shared_ptr<CXmlReader_Native> PXmlReader_Native;
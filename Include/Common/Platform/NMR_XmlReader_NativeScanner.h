@@ -0,0 +1,78 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_XmlReader_NativeScanner.h defines the delimiter scanners of the native XML reader.
+Each scanner skips the characters of a token until one of the characters that can end
+it. Depending on the CPU, 16 or 32 characters are compared at once.
+
+--*/
+
+#ifndef __NMR_XMLREADER_NATIVESCANNER
+#define __NMR_XMLREADER_NATIVESCANNER
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+// Overrides the detected scan level, values are "scalar", "sse2" and "avx2"
+#define NMR_XMLREADER_SCANLEVEL_ENVIRONMENTVARIABLE "LIB3MF_XML_SCANNER"
+
+namespace NMR {
+
+	enum eXmlReaderNativeScanLevel {
+		XMLREADERSCANLEVEL_SCALAR = 0,
+		XMLREADERSCANLEVEL_SSE2 = 1,
+		XMLREADERSCANLEVEL_AVX2 = 2
+	};
+
+	// Returns the first character in [pszStart, pszEnd) that is in the delimiter set of the function, or pszEnd
+	typedef nfChar * (*XmlReaderNative_ScanFunction)(_In_ nfChar * pszStart, _In_ nfChar * pszEnd);
+
+	typedef struct {
+		eXmlReaderNativeScanLevel m_eLevel;
+		// <
+		XmlReaderNative_ScanFunction m_fnScanText;
+		// whitespace, /, ? and >
+		XmlReaderNative_ScanFunction m_fnScanElementName;
+		// /, ? and >
+		XmlReaderNative_ScanFunction m_fnScanEndElementName;
+		// whitespace, quotes and =
+		XmlReaderNative_ScanFunction m_fnScanAttributeName;
+		// "
+		XmlReaderNative_ScanFunction m_fnScanDoubleQuote;
+		// '
+		XmlReaderNative_ScanFunction m_fnScanSingleQuote;
+	} XMLREADERNATIVESCANNER;
+
+	// Best scan level of this CPU, limited by NMR_XMLREADER_SCANLEVEL_ENVIRONMENTVARIABLE
+	eXmlReaderNativeScanLevel fnGetXmlReaderNativeScanLevel();
+
+	// Returns the scanner of the given level, or of the best supported level below
+	const XMLREADERNATIVESCANNER * fnGetXmlReaderNativeScanner(_In_ eXmlReaderNativeScanLevel eLevel);
+
+}
+
+#endif // __NMR_XMLREADER_NATIVESCANNER
@@ -38,6 +38,9 @@ NMR_XMLWriter.h defines the XML Writer Class in a portable way.
 
 namespace NMR {
 
+	class CXmlWriter;
+	typedef std::shared_ptr<CXmlWriter> PXmlWriter;
+
 	class CXmlWriter {
 	protected:
 		PExportStream m_pExportStream;
@@ -62,9 +65,12 @@ namespace NMR {
 		virtual nfUint32 GetNamespaceCount() = 0;
 		virtual std::string GetNamespacePrefix(nfUint32 nIndex) = 0;
 		virtual std::string GetNamespace(nfUint32 nIndex) = 0;
-	};
 
-	typedef std::shared_ptr<CXmlWriter> PXmlWriter;
+		// Creates a writer for a detached fragment at the current nesting level, which knows the same namespaces
+		virtual PXmlWriter CreateFragmentWriter(_In_ PExportStream pExportStream) = 0;
+		// Inserts the output of a fragment writer as content of the current element
+		virtual void WriteFragment(_In_ const nfByte * pData, _In_ nfUint64 cbLength) = 0;
+	};
 
 }
 
@@ -99,6 +99,9 @@ namespace NMR {
 		virtual nfUint32 GetNamespaceCount();
 		virtual std::string GetNamespacePrefix(nfUint32 nIndex);
 		virtual std::string GetNamespace(nfUint32 nIndex);
+
+		virtual PXmlWriter CreateFragmentWriter(_In_ PExportStream pExportStream);
+		virtual void WriteFragment(_In_ const nfByte * pData, _In_ nfUint64 cbLength);
 	};
 
 	typedef std::shared_ptr<CXmlWriter_Native> PXmlWriter_Native;
@@ -0,0 +1,105 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace NMR
+{
+    class CModelImplicitFunction;
+    class CProgressMonitor;
+
+    namespace implicit
+    {
+        class Image3DSampler;
+        class LevelSetSampler;
+
+        /**
+         * @brief Samples scalar fields on a regular grid into a float buffer.
+         *
+         * The value of grid point (i, j, k) at pOrigin + (i, j, k) * pSpacing
+         * is written to pValues[(k * pCounts[1] + j) * pCounts[0] + i]. The
+         * grid is split into tiles of TileSize^3 points, or of
+         * LayerTileSize^2 points if it has a single layer, which are
+         * distributed over threads by work stealing. Progress is reported and
+         * cancellation is queried after every tile that is finished on the
+         * calling thread, so the progress callback is never called from
+         * another thread.
+         */
+        class GridSampler
+        {
+           public:
+            static size_t constexpr TileSize = 16;
+            static size_t constexpr LayerTileSize = 64;
+
+            GridSampler(double const* pOrigin, double const* pSpacing, size_t const* pCounts);
+
+            size_t getPointCount() const;
+
+            // Samples the scalar output of a function with 3 input components
+            void sampleFunction(CModelImplicitFunction& function,
+                                std::string const& outputIdentifier,
+                                float* pValues,
+                                CProgressMonitor* pProgressMonitor) const;
+
+            // Samples the field of a level set in the coordinate system of the object
+            void sampleLevelSet(LevelSetSampler const& sampler,
+                                float* pValues,
+                                CProgressMonitor* pProgressMonitor) const;
+
+            // Samples a channel of a function from an image stack at the grid points as uvw
+            void sampleImage3D(Image3DSampler const& sampler,
+                               size_t nChannel,
+                               float* pValues,
+                               CProgressMonitor* pProgressMonitor) const;
+
+           private:
+            double m_origin[3];
+            double m_spacing[3];
+            size_t m_counts[3];
+            size_t m_tileSize[3];
+            size_t m_tileCounts[3];
+
+            // Samples the points of one tile in the layout of the grid; called with the job index
+            using TileFunction = std::function<void(size_t nJob,
+                                                    double const* pOrigin,
+                                                    size_t const* pCounts,
+                                                    double* pValues)>;
+
+            size_t getTileCount() const;
+            size_t getJobCount() const;
+            void sampleTiles(TileFunction const& sampleTile,
+                             float* pValues,
+                             CProgressMonitor* pProgressMonitor) const;
+        };
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,99 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#pragma once
+
+#include "Model/Classes/NMR_ImageStackCache.h"
+#include "Model/Classes/NMR_ModelTypes.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace NMR
+{
+    class CModelFunctionFromImage3D;
+    class CModelImageStack;
+
+    namespace implicit
+    {
+        /**
+         * @brief Samples the channels of a function from an image stack at
+         * uvw coordinates.
+         *
+         * Voxel (i, j, k) covers [i, i + 1) / columncount in u,
+         * [j, j + 1) / rowcount in v and [k, k + 1) / sheetcount in w, where
+         * j counts the rows from the first row of the sheet. Nearest
+         * filtering returns the voxel that contains the position, linear
+         * filtering interpolates between the centers of the surrounding 8
+         * voxels. Voxel indices outside of the image are mapped back by the
+         * tile style of their axis; with tile style none they are zero. The
+         * channels are mapped from [0, 1] by offset + scale * value.
+         */
+        class Image3DSampler
+        {
+           public:
+            static size_t constexpr ChannelCount = 4;
+
+            explicit Image3DSampler(CModelFunctionFromImage3D& function);
+
+            // Index of the scalar output red, green, blue or alpha, or ChannelCount
+            static size_t findChannel(std::string const& outputIdentifier);
+
+            /**
+             * @brief Samples a channel at nCount positions.
+             *
+             * Thread safe, the brick layers of the image stack are decoded on
+             * first access.
+             */
+            void sample(size_t nChannel,
+                        double const* pU,
+                        double const* pV,
+                        double const* pW,
+                        double* pValues,
+                        size_t nCount) const;
+
+            // Range of all values of the channels
+            void getRange(double& dMin, double& dMax) const;
+
+            // Returns whether the image stack still has the sheets and the size of the cache
+            bool isUpToDate() const;
+
+           private:
+            std::weak_ptr<CModelImageStack> m_pImageStack;
+            PImageStackCache m_pCache;
+            size_t m_counts[3];
+            eModelTextureTileStyle m_tileStyles[3];
+            bool m_bNearest;
+            double m_offset;
+            double m_scale;
+        };
+
+        using PImage3DSampler = std::shared_ptr<Image3DSampler const>;
+    }  // namespace implicit
+}  // namespace NMR
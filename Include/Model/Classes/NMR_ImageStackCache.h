@@ -0,0 +1,136 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImageStackCache.h defines a cache of the decoded voxels of an image stack.
+The voxels are stored in bricks of 8x8x8 voxels, 8 consecutive sheets form a
+brick layer. Brick layers are decoded on first access and evicted in least
+recently used order once the decoded data exceeds the memory budget.
+
+--*/
+
+#ifndef __NMR_IMAGESTACKCACHE
+#define __NMR_IMAGESTACKCACHE
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NMR {
+
+	class CModelImageStack;
+	class CModelAttachment;
+	typedef std::shared_ptr<CModelAttachment> PModelAttachment;
+
+	// Edge length of a brick, in voxels
+	constexpr nfUint32 IMAGESTACKCACHE_BRICKSIZE = 8;
+
+	// Default budget of the decoded voxels of one image stack, in bytes
+	constexpr nfUint64 IMAGESTACKCACHE_DEFAULTMEMORYBUDGET = 512ULL * 1024 * 1024;
+
+	// Decoded voxels of the sheets [8 * nLayer, 8 * nLayer + 8), as four 16 bit samples
+	// (red, green, blue, alpha) per voxel
+	class CImageStackBrickLayer {
+	private:
+		nfUint32 m_nBrickCountX;
+		std::vector<nfUint16> m_Voxels;
+
+	public:
+		CImageStackBrickLayer(_In_ nfUint32 nBrickCountX, _In_ nfUint32 nBrickCountY);
+
+		// Samples of voxel (nX, nY) of sheet 8 * nLayer + nZ
+		inline const nfUint16 * getVoxel(_In_ nfUint32 nX, _In_ nfUint32 nY, _In_ nfUint32 nZ) const
+		{
+			nfUint64 nBrick = (nfUint64)(nY / IMAGESTACKCACHE_BRICKSIZE) * m_nBrickCountX + nX / IMAGESTACKCACHE_BRICKSIZE;
+			nfUint32 nVoxel = ((nZ * IMAGESTACKCACHE_BRICKSIZE) + (nY % IMAGESTACKCACHE_BRICKSIZE)) * IMAGESTACKCACHE_BRICKSIZE + (nX % IMAGESTACKCACHE_BRICKSIZE);
+			return &m_Voxels[(nBrick * IMAGESTACKCACHE_BRICKSIZE * IMAGESTACKCACHE_BRICKSIZE * IMAGESTACKCACHE_BRICKSIZE + nVoxel) * 4];
+		}
+
+		inline nfUint16 * getVoxel(_In_ nfUint32 nX, _In_ nfUint32 nY, _In_ nfUint32 nZ)
+		{
+			return const_cast<nfUint16 *>(static_cast<const CImageStackBrickLayer *>(this)->getVoxel(nX, nY, nZ));
+		}
+
+		nfUint64 getMemoryUsage() const;
+	};
+
+	typedef std::shared_ptr<const CImageStackBrickLayer> PImageStackBrickLayer;
+
+	// The cache captures the size and the sheets of the image stack when it is created. Layers that
+	// are in use stay valid after they have been evicted. All methods are thread safe.
+	class CImageStackCache {
+	private:
+		nfUint32 m_nColumnCount;
+		nfUint32 m_nRowCount;
+		nfUint32 m_nSheetCount;
+		std::vector<PModelAttachment> m_Sheets;
+		nfUint64 m_nMemoryBudget;
+
+		// Guards the layers and the usage list
+		std::mutex m_Mutex;
+		// Serializes decoding, so that a layer is only decoded once
+		std::mutex m_DecodeMutex;
+
+		std::vector<PImageStackBrickLayer> m_Layers;
+		std::vector<std::list<nfUint32>::iterator> m_UsagePositions;
+		// Decoded layers, most recently used first
+		std::list<nfUint32> m_Usage;
+		nfUint64 m_nMemoryUsage;
+
+		PImageStackBrickLayer findLayer(_In_ nfUint32 nLayer);
+		PImageStackBrickLayer decodeLayer(_In_ nfUint32 nLayer);
+		// Evicts least recently used layers until the budget is met, the caller holds m_Mutex
+		void evictLayers();
+
+	public:
+		CImageStackCache(_In_ CModelImageStack & ImageStack, _In_ nfUint64 nMemoryBudget);
+
+		nfUint32 getColumnCount() const;
+		nfUint32 getRowCount() const;
+		nfUint32 getSheetCount() const;
+		nfUint32 getLayerCount() const;
+
+		// Returns whether the cache still reflects the sheets and the size of the image stack
+		nfBool isValidFor(_In_ CModelImageStack & ImageStack) const;
+
+		// Returns the voxels of the sheets [8 * nLayer, 8 * nLayer + 8), decodes them if necessary
+		PImageStackBrickLayer getLayer(_In_ nfUint32 nLayer);
+
+		nfUint64 getMemoryBudget();
+		void setMemoryBudget(_In_ nfUint64 nMemoryBudget);
+		nfUint64 getMemoryUsage();
+	};
+
+	typedef std::shared_ptr<CImageStackCache> PImageStackCache;
+
+}
+
+#endif // __NMR_IMAGESTACKCACHE
@@ -0,0 +1,204 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NMR
+{
+    class CModelImplicitFunction;
+
+    namespace implicit
+    {
+        class Image3DSampler;
+
+        enum class OpCode : uint8_t
+        {
+            Constant,
+            Input,
+            Add,
+            Sub,
+            Mul,
+            Div,
+            Min,
+            Max,
+            Pow,
+            Fmod,
+            Mod,
+            ArcTan2,
+            Sin,
+            Cos,
+            Tan,
+            ArcSin,
+            ArcCos,
+            ArcTan,
+            Sinh,
+            Cosh,
+            Tanh,
+            Abs,
+            Sqrt,
+            Exp,
+            Log,
+            Log2,
+            Log10,
+            Round,
+            Ceil,
+            Floor,
+            Sign,
+            Fract,
+            Select,  // A < B ? C : D
+            MeshDistance,
+            UnsignedMeshDistance,
+            ImageSample  // channel of an image stack at uvw
+        };
+
+        using RegisterIndex = uint32_t;
+
+        struct Instruction
+        {
+            OpCode op;
+            RegisterIndex result;
+            RegisterIndex args[4];
+            // input component for OpCode::Input, mesh index for the mesh
+            // distances, image index * 4 + channel for OpCode::ImageSample
+            uint32_t aux;
+        };
+
+        // Triangles of a referenced mesh, 9 coordinates per triangle
+        struct MeshData
+        {
+            std::vector<double> m_triangles;
+        };
+
+        // Register file of one thread, filled by Program::initRegisters
+        using Registers = std::vector<double>;
+
+        // Closed range of values, used by Program::evaluateBounds
+        struct Interval
+        {
+            double lo;
+            double hi;
+        };
+
+        /**
+         * @brief Flat register program compiled from an implicit function.
+         *
+         * All scalars, vectors and matrices of the node graph are expanded into
+         * scalar values. Constant subexpressions are folded, common
+         * subexpressions are merged and values that do not contribute to an
+         * output are removed. The remaining instructions are evaluated on
+         * chunks of points in structure-of-arrays layout.
+         *
+         * Inputs and outputs are counted in components: 1 per scalar, 3 per
+         * vector and 16 per matrix (row-major). Resource ID ports have no
+         * components.
+         */
+        class Program
+        {
+           public:
+            static size_t constexpr ChunkSize = 256;
+
+            explicit Program(CModelImplicitFunction& function);
+
+            // Compiles only the output with the given identifier
+            Program(CModelImplicitFunction& function, std::string const& outputIdentifier);
+
+            size_t getInputComponentCount() const;
+            size_t getOutputComponentCount() const;
+            std::vector<Instruction> const& getInstructions() const;
+            size_t getRegisterCount() const;
+
+            void initRegisters(Registers& registers) const;
+
+            /**
+             * @brief Evaluates the points [nFirst, nFirst + nCount) on the
+             * calling thread.
+             *
+             * Component k of point i is read from pInputs[k * nInputStride + i]
+             * and written to pOutputs[k * nOutputStride + i].
+             */
+            void evaluateRange(Registers& registers,
+                               double const* pInputs,
+                               size_t nInputStride,
+                               double* pOutputs,
+                               size_t nOutputStride,
+                               size_t nFirst,
+                               size_t nCount) const;
+
+            // Evaluates nPointCount points, distributing the chunks over threads
+            void evaluate(double const* pInputs,
+                          double* pOutputs,
+                          size_t nPointCount) const;
+
+            /**
+             * @brief Computes bounds of the outputs for inputs that vary
+             * within the given intervals.
+             *
+             * The bounds are conservative, but not necessarily tight. Outputs
+             * that may be NaN somewhere in the input box are unbounded.
+             */
+            void evaluateBounds(Interval const* pInputs, Interval* pOutputs) const;
+
+            /**
+             * @brief Returns whether the referenced meshes, called functions
+             * and image stacks are unchanged since the program was compiled.
+             *
+             * Changes of the compiled function itself are not tracked.
+             */
+            bool isUpToDate() const;
+
+           private:
+            size_t m_inputComponentCount = 0;
+            std::vector<Instruction> m_instructions;
+            std::vector<std::pair<RegisterIndex, double>> m_constants;
+            std::vector<RegisterIndex> m_outputs;
+            std::vector<MeshData> m_meshes;
+            std::vector<std::shared_ptr<Image3DSampler const>> m_images;
+            size_t m_registerCount = 0;
+            // Return whether a resource captured at compile time is unchanged
+            std::vector<std::function<bool()>> m_dependencies;
+
+            void execute(Instruction const& instruction,
+                         double* registers,
+                         double const* pInputs,
+                         size_t nInputStride,
+                         size_t nFirst,
+                         size_t nCount) const;
+
+            friend class Compiler;
+        };
+
+        using PProgram = std::shared_ptr<Program>;
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,87 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+#pragma once
+
+#include "Common/Math/NMR_Geometry.h"
+#include "Model/Classes/NMR_LevelSetSampler.h"
+
+#include <cstddef>
+
+namespace NMR
+{
+    class CMesh;
+    class CModelLevelSetObject;
+
+    namespace implicit
+    {
+        /**
+         * @brief Triangulates the zero level set of a level set object with
+         * marching cubes.
+         *
+         * The grid spans the bounding box of the bounding mesh with one cell
+         * of margin. The cell size is half the minimal feature size, limited
+         * to MaxCellsPerAxis cells along the longest side, or the longest
+         * side divided by DefaultCellsPerAxis if no minimal feature size is
+         * set. The grid is processed in tiles of TileSize^3 cells on several
+         * threads, so that the memory for the samples is bounded by the
+         * tile size. Tiles in which the sign cannot change are skipped by
+         * their clip values and by interval bounds of the function.
+         *
+         * The result is a closed, consistently oriented mesh, negative values
+         * are inside.
+         */
+        class LevelSetMesher
+        {
+           public:
+            static size_t constexpr TileSize = 32;
+            static size_t constexpr DefaultCellsPerAxis = 128;
+            static size_t constexpr MaxCellsPerAxis = 1024;
+
+            explicit LevelSetMesher(CModelLevelSetObject& levelSet);
+
+            // Adds the triangulated level set, transformed by mMatrix, to pMesh
+            void mesh(CMesh* pMesh, NMATRIX3 const& mMatrix) const;
+
+           private:
+            struct TileMesh;
+            struct TileBuffers;
+
+            LevelSetSampler m_sampler;
+            double m_cellSize = 0.;
+            double m_origin[3] = {0., 0., 0.};
+            size_t m_cellCounts[3] = {0, 0, 0};
+
+            void meshTile(size_t const* pTile,
+                          TileBuffers& buffers,
+                          LevelSetSampler::Workspace& workspace,
+                          TileMesh& result) const;
+        };
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,134 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+#pragma once
+
+#include "Model/Classes/NMR_ImplicitProgram.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NMR
+{
+    class CModelLevelSetObject;
+
+    namespace implicit
+    {
+        /**
+         * @brief Evaluates the field of a level set object on grids in the
+         * coordinate system of the object.
+         *
+         * The field is the channel of the level set function at the
+         * transformed positions, where NaN is replaced by the fall back
+         * value. It is clipped to the bounding mesh by taking the maximum
+         * with a clip value that is negative inside the mesh and positive
+         * outside. With meshbboxonly the clip value is the signed distance
+         * to the bounding box of the mesh. Otherwise the sign is given by
+         * the crossings of the mesh along z, and the magnitude is the
+         * distance to the nearest crossing along the grid lines in x, y and
+         * z. Positive values are capped at the grid spacing.
+         */
+        class LevelSetSampler
+        {
+           public:
+            // Buffers of one thread
+            struct Workspace
+            {
+                Registers registers;
+                std::vector<double> inputs;
+                std::vector<double> clip;
+                std::vector<double> crossings;
+            };
+
+            explicit LevelSetSampler(CModelLevelSetObject& levelSet);
+
+            // Bounding box of the bounding mesh, empty if the mesh has no nodes
+            bool getBoundingBox(double* pMin, double* pMax) const;
+
+            /**
+             * @brief Samples the grid pOrigin + (i, j, k) * pSpacing with
+             * i < pCounts[0], j < pCounts[1] and k < pCounts[2].
+             *
+             * The value of (i, j, k) is written to
+             * pValues[(k * pCounts[1] + j) * pCounts[0] + i].
+             */
+            void sampleGrid(double const* pOrigin,
+                            double const* pSpacing,
+                            size_t const* pCounts,
+                            double* pValues,
+                            Workspace& workspace) const;
+
+            // Samples only the clip value of the bounding mesh
+            void sampleClip(double const* pOrigin,
+                            double const* pSpacing,
+                            size_t const* pCounts,
+                            double* pValues,
+                            Workspace& workspace) const;
+
+            // Samples only the function, without clipping
+            void sampleFunction(double const* pOrigin,
+                                double const* pSpacing,
+                                size_t const* pCounts,
+                                double* pValues,
+                                Workspace& workspace) const;
+
+            // Conservative bounds of the function, without clipping, on a box
+            Interval boundFunction(double const* pMin, double const* pMax) const;
+
+           private:
+            PProgram m_program;
+            double m_transform[3][4];
+            double m_fallBackValue = 0.;
+            bool m_bBoxOnly = false;
+            bool m_bHasBox = false;
+            double m_boxMin[3] = {0., 0., 0.};
+            double m_boxMax[3] = {0., 0., 0.};
+
+            // Triangles of the bounding mesh bucketed by their projection
+            // along one axis
+            struct Projection
+            {
+                size_t axes[3];
+                size_t bucketCounts[2];
+                double bucketSize[2];
+                std::vector<uint32_t> bucketStarts;
+                std::vector<uint32_t> bucketTriangles;
+            };
+
+            // 9 coordinates per triangle
+            std::vector<double> m_triangles;
+            Projection m_projections[3];
+
+            void buildProjection(size_t axis);
+            // Sorted crossings of the line through (u, v) along axis
+            void findCrossings(size_t axis, double u, double v, std::vector<double>& crossings) const;
+        };
+    }  // namespace implicit
+}  // namespace NMR
@@ -235,6 +235,8 @@ namespace NMR {
 		void addBuildItem(_In_ PModelBuildItem pBuildItem);
 		nfUint32 getBuildItemCount();
 		PModelBuildItem getBuildItem(_In_ nfUint32 nIdx);
+		// Computes the outbox of every build item, large builds are processed on several threads
+		void getBuildItemOutboxes(_Out_ std::vector<NOUTBOX3> & Outboxes);
 		// Removes a build item identified by its handle
 		void removeBuildItem(_In_ nfUint32 nHandle, _In_ nfBool bThrowExceptionIfNotFound);
 
@@ -380,6 +382,12 @@ namespace NMR {
 
 		void removeResource(PModelResource pResource);
 
+		// Staged parsing of non-root models: a part is read into a separate model that shares
+		// the attachments of this model, and its resources are moved over afterwards.
+		void shareModelAttachments(_In_ CModel * pSourceModel);
+		nfBool canAdoptStagedResources(_In_ CModel * pStagedModel);
+		void adoptStagedResources(_In_ CModel * pStagedModel);
+
 	};
 
 	typedef std::shared_ptr <CModel> PModel;
@@ -46,9 +46,20 @@ namespace NMR
         PPorts m_inputs;
         PPorts m_outputs;
 
+        // Counts the calls of onGraphChanged
+        nfUint64 m_nGraphVersion = 0;
+
+        void copyPorts(const CModelFunction& other);
+
     public:
         CModelFunction(_In_ const ModelResourceID sID, _In_ CModel* pModel);
 
+        // Copy constructor, the copy gets its own inputs and outputs
+        CModelFunction(const CModelFunction& other);
+
+        // Copy assignment operator, replaces the inputs and outputs by copies
+        CModelFunction& operator=(const CModelFunction& other);
+
         std::string const& getDisplayName() const;
         void setDisplayName(std::string const& displayname);
 
@@ -67,6 +78,13 @@ namespace NMR
         PModelImplicitPort findOutput(const std::string& sIdentifier) const;
 
         virtual void clear();
+
+        // Called whenever a change of the function affects its evaluation
+        virtual void onGraphChanged();
+
+        // Changes whenever onGraphChanged is called. Programs that inline
+        // this function compare it to detect changes of their callee.
+        nfUint64 getGraphVersion() const;
     };
 
     using PModelFunction = std::shared_ptr<CModelFunction>;
@@ -39,6 +39,7 @@ NMR_ModelImageStack.h defines an image stack for the volumetric extension
 #include <vector>
 #include "Common/NMR_Types.h" 
 #include "Model/Classes/NMR_ModelImage3D.h"
+#include "Model/Classes/NMR_ImageStackCache.h"
 #include "Common/Platform/NMR_ImportStream.h"
 
 constexpr auto MAX_IMAGESTACK_SIZE = (1024 * 1024 * 1024);
@@ -52,6 +53,8 @@ namespace NMR {
 		nfUint32 m_nSheetCount;
 		
 		std::vector <PModelAttachment> m_Sheets;
+
+		PImageStackCache m_pCache;
 	protected:
 		CModelImageStack(_In_ const ModelResourceID sID, _In_ CModel* pModel, _In_ nfUint32 nRowCount, _In_ nfUint32 nColumCount, nfUint32 nSheetCount);
 
@@ -70,6 +73,9 @@ namespace NMR {
 		void setSheet(nfUint32 nSheetIndex, PModelAttachment pAttachment);
 		PModelAttachment getSheet(nfUint32 nSheetIndex);
 		PModelAttachment createSheet(nfUint32 nSheetIndex, const std::string & sPath, PImportStream pCopiedStream);
+
+		// Decoded voxels of the sheets. A new cache is created if the size or the sheets have changed.
+		PImageStackCache getCache();
 	};
 
 	typedef std::shared_ptr<CModelImageStack> PModelImageStack;
@@ -32,7 +32,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Model/Classes/NMR_ModelImplicitNode.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Model/Classes/NMR_ModelFunction.h"
@@ -45,6 +47,7 @@ namespace NMR
     namespace implicit
     {
         class NodeTypes;
+        class Program;
     }
 
     // Extract node name (before the first dot) from a node identifier
@@ -65,19 +68,39 @@ namespace NMR
         PImplicitNodes m_nodes;
         static const implicit::NodeTypes m_nodeTypes;
 
+        // Program of all outputs, compiled on demand by getProgram and reset
+        // by onGraphChanged
+        std::shared_ptr<implicit::Program const> m_pProgram;
+        std::mutex m_programMutex;
+
+        // Nodes by identifier. Nodes with an empty identifier are not
+        // indexed. If identifiers are not unique, the index holds the first
+        // node in m_nodes and is rebuilt whenever that could change. Every
+        // change of m_nodes updates or invalidates the index.
+        mutable std::unordered_map<ImplicitIdentifier, PModelImplicitNode> m_nodeIndex;
+        mutable bool m_bNodeIndexValid = true;
+        mutable bool m_bNodeIndexHasDuplicates = false;
+
         CModelImplicitNode* findNode(
             const ImplicitIdentifier& sIdentifier) const;
 
+        void rebuildNodeIndex() const;
+        void indexNode(PModelImplicitNode const& node);
+        void unindexNode(CModelImplicitNode& node,
+                         const ImplicitIdentifier& sIdentifier);
+
+        void copyNodes(const CModelImplicitFunction& other);
+
        public:
         CModelImplicitFunction(_In_ const ModelResourceID sID,
                                _In_ CModel* pModel);
 
-        // Copy constructor
-        CModelImplicitFunction(const CModelImplicitFunction& other) = default;
+        // Copy constructor, copies the nodes and ports and compiles its own
+        // program
+        CModelImplicitFunction(const CModelImplicitFunction& other);
 
-        // Copy assignment operator
-        CModelImplicitFunction& operator=(const CModelImplicitFunction& other) =
-            default;
+        // Copy assignment operator, replaces the nodes and ports by copies
+        CModelImplicitFunction& operator=(const CModelImplicitFunction& other);
 
         ImplicitIdentifier const& getIdentifier() const;
         void setIdentifier(ImplicitIdentifier const& identifier);
@@ -101,8 +124,14 @@ namespace NMR
 
         void removeNode(const ImplicitIdentifier& sIdentifier);
 
+        // Updates the node index, called by CModelImplicitNode::setIdentifier
+        void onNodeIdentifierChanged(CModelImplicitNode& node,
+                                     const ImplicitIdentifier& sOldIdentifier);
+
         void clear() override;
 
+        void onGraphChanged() override;
+
         /**
          * @brief Replaces a resource ID with a new one.
          *
@@ -127,6 +156,38 @@ namespace NMR
 
         PModelImplicitPort findPort(const ImplicitIdentifier& sIdentifier) const;
 
+        /**
+         * @brief Returns the program of all outputs of the function.
+         *
+         * The program is compiled on the first call and kept until the nodes,
+         * links or ports of the function change. Referenced meshes, image
+         * stacks and called functions are captured at compile time, the
+         * program is compiled again once one of them has changed.
+         */
+        std::shared_ptr<implicit::Program const> getProgram();
+
+        /**
+         * @brief Evaluates the function for a batch of points.
+         *
+         * The inputs are given in structure-of-arrays order: for every
+         * component of every function input, the values of all points. The
+         * number of points is nValueCount divided by the component count of
+         * all inputs. The outputs are written in the same layout. If pOutputs
+         * is nullptr, only the needed output count is returned.
+         *
+         * @param pInputs The input values.
+         * @param nValueCount The number of input values.
+         * @param nOutputBufferSize The size of the output buffer.
+         * @param pOutputNeededCount Receives the number of output values, may
+         * be nullptr.
+         * @param pOutputs The output buffer, may be nullptr.
+         */
+        void evaluateBatch(double const* pInputs,
+                           size_t nValueCount,
+                           size_t nOutputBufferSize,
+                           size_t* pOutputNeededCount,
+                           double* pOutputs);
+
         ResourceDependencies getDependencies() override;
     };
 
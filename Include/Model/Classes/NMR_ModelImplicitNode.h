@@ -45,7 +45,7 @@ namespace NMR
 
     using GraphID = unsigned int;
     using TopologicalOrderIndex = unsigned int;
-    class CModelImplicitNode
+    class CModelImplicitNode : public std::enable_shared_from_this<CModelImplicitNode>
     {
       private:
         Lib3MF::eImplicitNodeType m_type;
@@ -62,7 +62,7 @@ namespace NMR
         std::unique_ptr<Lib3MF::sMatrix4x4> m_matrix;
 
         // resource ID that is unique in the scope of a model to reference mesh objects, functions etc.
-        ModelResourceID m_modelResourceID;
+        ModelResourceID m_modelResourceID = 0;
         
         CModelImplicitFunction * m_parent = nullptr;
 
@@ -70,6 +70,8 @@ namespace NMR
         GraphID m_graphId = 0;
         TopologicalOrderIndex m_topologicalOrderIndex = 0;
 
+        void onChanged();
+
       public:
         CModelImplicitNode(Lib3MF::eImplicitNodeType type,
                            ImplicitIdentifier const & identifier,
@@ -78,6 +80,9 @@ namespace NMR
                            CModelImplicitFunction * parent);
         CModelImplicitNode(Lib3MF::eImplicitNodeType type, CModelImplicitFunction * parent);
 
+        // Copies the node and its ports into the function parent
+        std::shared_ptr<CModelImplicitNode> clone(CModelImplicitFunction * parent) const;
+
         ImplicitIdentifier const & getIdentifier() const;
         std::string const & getDisplayName() const;
         std::string const& getTag() const;
@@ -43,11 +43,14 @@ namespace NMR
     class CModelImplicitNode;
     class CModelImplicitPort;
     class CModelImplicitFunction;
+    class CModelFunction;
 
     class CModelImplicitPort
     {
       private:
         CModelImplicitNode * m_parent = nullptr;
+        // Function of a function input or output, nullptr for ports of nodes
+        CModelFunction * m_function = nullptr;
         ImplicitIdentifier m_identifier;
         std::string m_displayname;
         Lib3MF::eImplicitPortType m_type = Lib3MF::eImplicitPortType::Scalar;
@@ -56,16 +59,24 @@ namespace NMR
         ImplicitIdentifier m_reference; // m_reference might seem redundant, but it can be set if the dependency does not exist yet
 
         void updateReference() const;
+        void onChanged() const;
 
       public:
         CModelImplicitPort(CModelImplicitNode * parent,
                            ImplicitIdentifier const & identifier,
                            std::string const & displayname);
 
-        CModelImplicitPort(ImplicitIdentifier const & identifier,
+        CModelImplicitPort(CModelFunction * function,
+                           ImplicitIdentifier const & identifier,
                            std::string const & displayname,
                            Lib3MF::eImplicitPortType type);
 
+        // Copies a port for a copied node or function. The reference is
+        // copied by its identifier and resolved in the new function.
+        CModelImplicitPort(CModelImplicitNode * parent,
+                           CModelFunction * function,
+                           CModelImplicitPort const & other);
+
         ImplicitIdentifier const & getIdentifier() const;
         std::string const & getDisplayName() const;
         void setIdentifier(ImplicitIdentifier const & identifier);
@@ -65,6 +65,7 @@ namespace NMR
         static auto constexpr min = "min";
         static auto constexpr max = "max";
         static auto constexpr functionID = "functionID";
+        static auto constexpr uvw = "uvw";
     };
 
     struct OutputNames
@@ -75,5 +76,9 @@ namespace NMR
         static auto constexpr matrix = "matrix";
         static auto constexpr color = "color";
         static auto constexpr distance = "distance";
+        static auto constexpr red = "red";
+        static auto constexpr green = "green";
+        static auto constexpr blue = "blue";
+        static auto constexpr alpha = "alpha";
     };
 }
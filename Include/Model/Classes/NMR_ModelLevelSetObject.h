@@ -80,6 +80,7 @@ namespace NMR {
 		void extendOutbox(_Out_ NOUTBOX3& vOutBox,
 							_In_ const NMATRIX3
 								mAccumulatedMatrix) override;
+		void prepareOutbox() override;
 
 		PModelMeshObject getMesh();
 		void setMesh(PModelMeshObject pMesh);
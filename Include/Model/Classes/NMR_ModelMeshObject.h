@@ -49,9 +49,21 @@ namespace NMR {
 	class CModelObject;
 	typedef std::shared_ptr <CModelObject> PModelObject;
 
+	class CModelMeshObject;
+
+	// Fills the mesh of a mesh object on first access, used for deferred reading
+	class IModelMeshLoader {
+	public:
+		virtual ~IModelMeshLoader() = default;
+		virtual void loadMesh(_In_ CModelMeshObject * pMeshObject) = 0;
+	};
+
+	typedef std::shared_ptr <IModelMeshLoader> PModelMeshLoader;
+
 	class CModelMeshObject : public CModelObject {
 	private:
 		PMesh m_pMesh; 
+		PModelMeshLoader m_pMeshLoader;
 
 		PModelVolumeData m_pVolumeData;
 		PModelMeshBeamLatticeAttributes m_pBeamLatticeAttributes;
@@ -59,6 +71,14 @@ namespace NMR {
 		std::map<std::string, PModelTriangleSet> m_TriangleSetMap;
 		std::vector<PModelTriangleSet> m_TriangleSets;
 
+		// Result of isManifoldAndOriented, valid as long as the mesh and its generation are unchanged
+		CMesh * m_pTopologyMesh;
+		nfUint64 m_nTopologyGeneration;
+		nfBool m_bManifoldAndOriented;
+
+		void ensureMeshLoaded();
+		void resetTopologyCache();
+
 	public:
 		CModelMeshObject() = delete;
 		CModelMeshObject(_In_ const ModelResourceID sID, _In_ CModel * pModel);
@@ -68,6 +88,9 @@ namespace NMR {
 		_Ret_notnull_ CMesh * getMesh ();
 		void setMesh (_In_ PMesh pMesh);
 
+		// The loader is called once, before the mesh content is accessed the first time
+		void setMeshLoader(_In_ PModelMeshLoader pMeshLoader);
+
 		void mergeToMesh(_In_ CMesh * pMesh, _In_ const NMATRIX3 mMatrix) override;
 
 		void setObjectType(_In_ eModelObjectType ObjectType) override;
@@ -87,6 +110,7 @@ namespace NMR {
 		void setBeamLatticeAttributes(_In_ PModelMeshBeamLatticeAttributes pBeamLatticeAttributes);
 
 		void extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix) override;
+		void prepareOutbox() override;
 
 		_Ret_notnull_ PModelVolumeData getVolumeData();
 		void setVolumeData(_In_ PModelVolumeData pVolumeData);
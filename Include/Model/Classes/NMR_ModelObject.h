@@ -118,6 +118,9 @@ namespace NMR {
 		virtual void calculateComponentDepthLevel (nfUint32 nLevel);
 
 		virtual void extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix) = 0;
+		// Loads and caches everything extendOutbox needs, so that extendOutbox can be called from several threads afterwards.
+		// Does not include referenced objects.
+		virtual void prepareOutbox();
 	};
 
 	typedef std::shared_ptr <CModelObject> PModelObject;
@@ -33,6 +33,7 @@ NMR_PackageResourceID.h defines the UniqueResourceID Class.
 #ifndef __NMR_PACKAGERESOURCEID
 #define __NMR_PACKAGERESOURCEID
 
+#include "Common/NMR_Types.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 #include <string>
 
@@ -116,6 +117,12 @@ namespace NMR {
 
 		void removePackageResourceID(PPackageResourceID pPackageResourceID);
 
+		UniqueResourceID getMaxUniqueID();
+		nfUint32 getResourceIDCount();
+
+		// moves all IDs of pSourceHandler into this handler and shifts their unique IDs by nUniqueIDOffset
+		void adoptPackageResourceIDs(CResourceHandler* pSourceHandler, UniqueResourceID nUniqueIDOffset);
+
 		void clear();
 	};
 
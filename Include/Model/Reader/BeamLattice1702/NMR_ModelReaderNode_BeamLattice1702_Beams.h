@@ -36,6 +36,7 @@ NMR_ModelReaderNode_BeamLattice1702_Beams.h covers the official 3MF beamlattice
 #define __NMR_MODELREADERNODE_BEAMLATTICE1702_BEAMS
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 
@@ -49,11 +50,13 @@ namespace NMR {
 		nfDouble m_dDefaultRadius;
 		eModelBeamLatticeCapMode m_eDefaultCapMode;
 
+		CModelReader_StreamingMesh * m_pStreamingMesh;
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode_BeamLattice1702_Beams() = delete;
-		CModelReaderNode_BeamLattice1702_Beams(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ nfDouble defaultRadius, _In_ eModelBeamLatticeCapMode defaultCapMode, _In_ PModelWarnings pWarnings);
+		CModelReaderNode_BeamLattice1702_Beams(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ nfDouble defaultRadius, _In_ eModelBeamLatticeCapMode defaultCapMode, _In_ PModelWarnings pWarnings, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
@@ -65,6 +65,8 @@ namespace NMR {
 		virtual COpcPackageRelationship * findRootRelation(std::string sRelationType, nfBool bMustBeUnique) override;
 		virtual POpcPackagePart createPart(std::string sPath) override;
 		virtual nfUint64 getPartSize(std::string sPath) override;
+		virtual PImportStream openPartStream(std::string sPath) override;
+		virtual PImportStream openRawPartStream(std::string sPath, ZIPRAWENTRYINFO & Info) override;
 
 		void close() override;
 	};
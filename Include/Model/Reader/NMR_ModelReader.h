@@ -37,6 +37,7 @@ A model reader reads in a model file and generates an in-memory representation o
 #include "Model/Classes/NMR_ModelContext.h"
 #include "Common/NMR_ModelWarnings.h" 
 #include "Common/MeshImport/NMR_MeshImporter.h" 
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 
 #include <list>
 #include <set>
@@ -48,7 +49,11 @@ namespace NMR {
 		PImportStream m_pPrintTicketStream;
 		std::string m_sPrintTicketContentType;
 		std::set<std::string> m_RelationsToRead;
-
+		nfUint32 m_nSubModelThreadCount;
+		PModelReader_Streaming m_pStreaming;
+		nfBool m_bLazyMeshLoading;
+		nfBool m_bBackgroundDecompression;
+		nfBool m_bLazyAttachmentLoading;
 
 		void readFromMeshImporter(_In_ CMeshImporter * pImporter);
 	public:
@@ -61,6 +66,27 @@ namespace NMR {
 
 		void addRelationToRead(_In_ std::string sRelationShipType);
 		void removeRelationToRead(_In_ std::string sRelationShipType);
+
+		// Number of threads to parse non-root model parts with (1 = serial, 0 = hardware concurrency)
+		void setSubModelThreadCount(_In_ nfUint32 nThreadCount);
+		nfUint32 getSubModelThreadCount();
+
+		// Callbacks for streaming reads, only supported by the 3MF reader
+		CModelReader_Streaming * streaming();
+		// Returns null if no streaming callback is set
+		PModelReader_Streaming getActiveStreaming();
+
+		// Defer parsing of mesh content until the mesh is accessed, only supported by the 3MF reader
+		void setLazyMeshLoading(_In_ nfBool bLazyMeshLoading);
+		nfBool getLazyMeshLoading();
+
+		// Inflate the root model part on a background thread while it is parsed, only supported by the 3MF reader
+		void setBackgroundDecompression(_In_ nfBool bBackgroundDecompression);
+		nfBool getBackgroundDecompression();
+
+		// Keep attachments, textures and thumbnails in the package until they are accessed, only supported by the 3MF reader
+		void setLazyAttachmentLoading(_In_ nfBool bLazyAttachmentLoading);
+		nfBool getLazyAttachmentLoading();
 	};
 
 	typedef std::shared_ptr <CModelReader> PModelReader;
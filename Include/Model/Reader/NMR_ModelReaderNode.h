@@ -56,6 +56,10 @@ namespace NMR {
 		void parseAttributes(_In_ CXmlReader * pXMLReader);
 		void parseContent(_In_ CXmlReader * pXMLReader);
 
+		// Lightweight helpers for leaf elements that are parsed without a reader node of their own
+		static nfBool readAttribute(_In_ CXmlReader * pXMLReader, _Out_ const nfChar * & pszAttributeName, _Out_ const nfChar * & pszAttributeValue);
+		static void skipContent(_In_ CXmlReader * pXMLReader, _In_z_ const nfChar * pszElementName);
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnText(_In_z_ const nfChar * pText, _In_ CXmlReader * pXMLReader);
 		virtual void OnEndElement(_In_ CXmlReader * pXMLReader);
@@ -35,6 +35,8 @@ A model reader model node is a parser for the root node of an XML Model Stream.
 #define __NMR_MODELREADERNODE_MODELBASE
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
 
 namespace NMR {
 
@@ -47,6 +49,7 @@ namespace NMR {
 		std::string m_sPath;
 		nfBool m_bHasResources;
 		nfBool m_bHasBuild;
+		nfBool m_bHasUnit;
 
 		nfBool m_bWithinIgnoredElement;
 		nfBool m_bIgnoreBuild;
@@ -54,6 +57,9 @@ namespace NMR {
 
 		nfBool m_bHaveWarnedAboutV093;
 
+		PModelReader_Streaming m_pStreaming;
+		PModelReader_LazyMeshSource m_pLazyMeshSource;
+
 		void ReadMetaDataNode(_In_ CXmlReader * pXMLReader);
 
 		virtual void CheckRequiredExtensions();
@@ -63,12 +69,14 @@ namespace NMR {
 		virtual void OnNSAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_z_ const nfChar * pNameSpace);
 	public:
 		CModelReaderNode_ModelBase() = delete;
-		CModelReaderNode_ModelBase(_In_ CModel *pModel, _In_ PModelWarnings pWarnings, const std::string sPath, _In_ PProgressMonitor pProgressMonitor);
+		CModelReaderNode_ModelBase(_In_ CModel *pModel, _In_ PModelWarnings pWarnings, const std::string sPath, _In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming = nullptr, _In_ PModelReader_LazyMeshSource pLazyMeshSource = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 
 		nfBool getHasResources();
 		nfBool getHasBuild();
+		nfBool getHasUnit();
+		nfBool getHasV093Content();
 
 		nfBool ignoreBuild();
 		void setIgnoreBuild(bool bIgnoreBuild);
@@ -35,6 +35,7 @@ NMR_ModelReader_3MF.h defines the Model Reader Class for
 #define __NMR_MODELREADER_3MF
 
 #include "Model/Reader/NMR_ModelReader.h" 
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
 #include "Common/NMR_SecureContentTypes.h"
 #include <string>
 #include <map>
@@ -45,6 +46,8 @@ namespace NMR {
 	protected:
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream) = 0;
 		virtual void release3MFOPCPackage() = 0;
+		// Returns an empty opener if the part can not be opened again after reading
+		virtual ModelReader_PartStreamOpener getPartStreamOpener(_In_ std::string sPath) = 0;
 
 	public:
 		CModelReader_3MF() = delete;
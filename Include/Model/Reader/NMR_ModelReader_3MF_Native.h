@@ -54,9 +54,13 @@ namespace NMR {
 		void extractTexturesFromRelationships(_In_ std::string& sTargetPartURIDir, _In_ COpcPackagePart * pModelPart);
 		void extractModelDataFromRelationships(_In_ std::string& sTargetPartURIDir, _In_ COpcPackagePart * pModelPart);
 		void checkContentTypes();
+
+		// Returns the content of an attachment part, kept in the package if lazy attachment loading is active
+		PImportStream readAttachmentStream(_In_ const std::string & sURI);
 	
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream);
 		virtual void release3MFOPCPackage();
+		virtual ModelReader_PartStreamOpener getPartStreamOpener(_In_ std::string sPath);
 
 	public:
 		CModelReader_3MF_Native() = delete;
@@ -0,0 +1,112 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_ModelReader_LazyMesh.h defines the Model Reader Lazy Mesh Classes.
+They remember where the content of a mesh element is located in a model part,
+and parse it when the mesh is accessed for the first time.
+
+--*/
+
+#ifndef __NMR_MODELREADER_LAZYMESH
+#define __NMR_MODELREADER_LAZYMESH
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Common/NMR_ModelWarnings.h"
+#include "Model/Classes/NMR_PackageResourceID.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace NMR {
+
+	class CImportStream_Memory;
+
+	// Opens the content of a model part from the start
+	typedef std::function<PImportStream()> ModelReader_PartStreamOpener;
+
+	// Gives access to byte ranges of a model part, relative to the position where parsing started
+	class CModelReader_LazyMeshSource {
+	private:
+		std::string m_sPath;
+		PModelWarnings m_pWarnings;
+
+		// The part is kept in memory
+		PImportStream m_pMemoryStream;
+		CImportStream_Memory * m_pMemory;
+		nfUint64 m_nBasePosition;
+
+		// The part is opened again, and read forward from the last range
+		ModelReader_PartStreamOpener m_fnOpener;
+		PImportStream m_pCursorStream;
+		nfUint64 m_nCursorPosition;
+
+	public:
+		CModelReader_LazyMeshSource() = delete;
+		CModelReader_LazyMeshSource(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ PImportStream pMemoryStream);
+		CModelReader_LazyMeshSource(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ ModelReader_PartStreamOpener fnOpener);
+
+		// Returns nullptr if the stream cannot be used for deferred reading
+		static std::shared_ptr<CModelReader_LazyMeshSource> makeFromStream(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ PImportStream pStream);
+
+		std::string getPath();
+		PModelWarnings getWarnings();
+
+		PImportStream readRange(_In_ nfUint64 nStartPosition, _In_ nfUint64 nEndPosition);
+	};
+
+	typedef std::shared_ptr <CModelReader_LazyMeshSource> PModelReader_LazyMeshSource;
+
+	// Parses the recorded content of a mesh element into its mesh object
+	class CModelReader_LazyMesh : public IModelMeshLoader {
+	private:
+		PModelReader_LazyMeshSource m_pSource;
+		nfUint64 m_nStartPosition;
+		nfUint64 m_nEndPosition;
+		std::map<std::string, std::string> m_NameSpaces;
+
+		PPackageResourceID m_pObjectLevelPropertyID;
+		ModelResourceIndex m_nObjectLevelPropertyIndex;
+		nfBool m_bHasDefaultProperty;
+		ModelResourceID m_nDefaultPropertyModelID;
+
+	public:
+		CModelReader_LazyMesh() = delete;
+		CModelReader_LazyMesh(_In_ PModelReader_LazyMeshSource pSource, _In_ nfUint64 nStartPosition, _In_ nfUint64 nEndPosition, _In_ const std::map<std::string, std::string> & NameSpaces);
+
+		void setObjectLevelProperty(_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nObjectLevelPropertyIndex, _In_ nfBool bHasDefaultProperty, _In_ ModelResourceID nDefaultPropertyModelID);
+
+		void loadMesh(_In_ CModelMeshObject * pMeshObject) override;
+	};
+
+}
+
+#endif // __NMR_MODELREADER_LAZYMESH
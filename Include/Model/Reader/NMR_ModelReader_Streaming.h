@@ -0,0 +1,132 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_ModelReader_Streaming.h defines the Model Reader Streaming Classes.
+They pass the bulk content of a model stream to callbacks while it is parsed,
+instead of storing it in the meshes of the model.
+
+--*/
+
+#ifndef __NMR_MODELREADER_STREAMING
+#define __NMR_MODELREADER_STREAMING
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Math/NMR_Matrix.h"
+#include "Model/Classes/NMR_ModelTypes.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#define MODELREADER_STREAMING_BATCHSIZE 4096
+
+namespace NMR {
+
+	typedef struct {
+		nfFloat m_fPosition[3];
+	} MODELSTREAMINGVERTEX;
+
+	typedef struct {
+		nfUint32 m_nIndices[3];
+	} MODELSTREAMINGTRIANGLE;
+
+	typedef struct {
+		nfUint32 m_nIndices[2];
+		nfDouble m_dRadii[2];
+		nfInt32 m_nCapModes[2];
+	} MODELSTREAMINGBEAM;
+
+	typedef std::function<void(UniqueResourceID nObjectID, const MODELSTREAMINGVERTEX * pVertices, nfUint32 nCount)> ModelStreaming_VertexCallback;
+	typedef std::function<void(UniqueResourceID nObjectID, const MODELSTREAMINGTRIANGLE * pTriangles, nfUint32 nCount)> ModelStreaming_TriangleCallback;
+	typedef std::function<void(UniqueResourceID nObjectID, const MODELSTREAMINGBEAM * pBeams, nfUint32 nCount)> ModelStreaming_BeamCallback;
+	typedef std::function<void(UniqueResourceID nObjectID, UniqueResourceID nComponentObjectID, const NMATRIX3 & mTransform)> ModelStreaming_ComponentCallback;
+	typedef std::function<void(UniqueResourceID nObjectID, const NMATRIX3 & mTransform)> ModelStreaming_BuildItemCallback;
+
+	// The callbacks of a streaming read. Mesh content is only streamed (and not stored) if one of the mesh callbacks is set.
+	class CModelReader_Streaming {
+	private:
+		ModelStreaming_VertexCallback m_VertexCallback;
+		ModelStreaming_TriangleCallback m_TriangleCallback;
+		ModelStreaming_BeamCallback m_BeamCallback;
+		ModelStreaming_ComponentCallback m_ComponentCallback;
+		ModelStreaming_BuildItemCallback m_BuildItemCallback;
+	public:
+		CModelReader_Streaming();
+
+		void setVertexCallback(_In_ ModelStreaming_VertexCallback callback);
+		void setTriangleCallback(_In_ ModelStreaming_TriangleCallback callback);
+		void setBeamCallback(_In_ ModelStreaming_BeamCallback callback);
+		void setComponentCallback(_In_ ModelStreaming_ComponentCallback callback);
+		void setBuildItemCallback(_In_ ModelStreaming_BuildItemCallback callback);
+
+		nfBool streamsMeshes() const;
+		nfBool isActive() const;
+
+		void onVertices(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGVERTEX * pVertices, _In_ nfUint32 nCount);
+		void onTriangles(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGTRIANGLE * pTriangles, _In_ nfUint32 nCount);
+		void onBeams(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGBEAM * pBeams, _In_ nfUint32 nCount);
+		void onComponent(_In_ UniqueResourceID nObjectID, _In_ UniqueResourceID nComponentObjectID, _In_ const NMATRIX3 & mTransform);
+		void onBuildItem(_In_ UniqueResourceID nObjectID, _In_ const NMATRIX3 & mTransform);
+	};
+
+	typedef std::shared_ptr <CModelReader_Streaming> PModelReader_Streaming;
+
+	// Collects the content of one mesh object in fixed size batches. Only the element counts are kept after a batch is passed on.
+	class CModelReader_StreamingMesh {
+	private:
+		CModelReader_Streaming * m_pStreaming;
+		UniqueResourceID m_nObjectID;
+
+		std::vector<MODELSTREAMINGVERTEX> m_Vertices;
+		std::vector<MODELSTREAMINGTRIANGLE> m_Triangles;
+		std::vector<MODELSTREAMINGBEAM> m_Beams;
+
+		nfUint32 m_nVertexCount;
+		nfUint32 m_nTriangleCount;
+		nfUint32 m_nBeamCount;
+	public:
+		CModelReader_StreamingMesh() = delete;
+		CModelReader_StreamingMesh(_In_ CModelReader_Streaming * pStreaming, _In_ UniqueResourceID nObjectID);
+
+		void addVertex(_In_ nfFloat fX, _In_ nfFloat fY, _In_ nfFloat fZ);
+		void addTriangle(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfUint32 nIndex3);
+		void addBeam(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfDouble dRadius1, _In_ nfDouble dRadius2, _In_ nfInt32 nCapMode1, _In_ nfInt32 nCapMode2);
+
+		// Passes on all pending elements
+		void flush();
+
+		nfUint32 getVertexCount() const;
+		nfUint32 getTriangleCount() const;
+		nfUint32 getBeamCount() const;
+	};
+
+	typedef std::shared_ptr <CModelReader_StreamingMesh> PModelReader_StreamingMesh;
+
+}
+
+#endif // __NMR_MODELREADER_STREAMING
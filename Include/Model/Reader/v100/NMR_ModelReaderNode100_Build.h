@@ -34,12 +34,14 @@ A build reader model node is a parser for the build node of an XML Model Stream.
 #define __NMR_MODELREADERNODE100_BUILD
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 
 namespace NMR {
 
 	class CModelReaderNode100_Build : public CModelReaderNode {
 	protected:
 		CModel * m_pModel;
+		PModelReader_Streaming m_pStreaming;
 		PUUID m_UUID;
 
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
@@ -47,7 +49,7 @@ namespace NMR {
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Build() = delete;
-		CModelReaderNode100_Build(_In_ CModel * pModel, _In_ PModelWarnings pWarnings);
+		CModelReaderNode100_Build(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
@@ -35,6 +35,7 @@ A builditem reader model node is a parser for the builditem node of an XML Model
 #define __NMR_MODELREADERNODE100_BUILDITEM
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 #include "Model/Classes/NMR_ModelMetaDataGroup.h"
 
 namespace NMR {
@@ -42,6 +43,7 @@ namespace NMR {
 	class CModelReaderNode100_BuildItem : public CModelReaderNode {
 	private:
 		CModel * m_pModel;
+		PModelReader_Streaming m_pStreaming;
 		nfInt32 m_ObjectID;
 		nfBool m_bHasID;
 		std::string m_sPartNumber;
@@ -60,7 +62,7 @@ namespace NMR {
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_BuildItem() = delete;
-		CModelReaderNode100_BuildItem(_In_ CModel * pModel, _In_ PModelWarnings pWarnings);
+		CModelReaderNode100_BuildItem(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
@@ -36,6 +36,7 @@ NMR_ModelReaderNode100_Components.h defines the Model Components Reader Node Cla
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Classes/NMR_ModelComponentsObject.h"
 #include "Model/Classes/NMR_ModelMetaData.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 
 namespace NMR {
 
@@ -43,12 +44,13 @@ namespace NMR {
 	private:
 	protected:
 		CModelComponentsObject * m_pComponentsObject;
+		PModelReader_Streaming m_pStreaming;
 
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Components() = delete;
-		CModelReaderNode100_Components(_In_ CModelComponentsObject * pComponentsObject, _In_ PModelWarnings pWarnings);
+		CModelReaderNode100_Components(_In_ CModelComponentsObject * pComponentsObject, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
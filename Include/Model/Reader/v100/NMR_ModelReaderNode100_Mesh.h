@@ -36,6 +36,7 @@ A mesh reader model node is a parser for the mesh node of an XML Model Stream.
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Reader/NMR_ModelReader_TexCoordMapping.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 #include "Model/Classes/NMR_ModelVolumeData.h"
@@ -62,6 +63,12 @@ namespace NMR {
 
 		nfBool m_bHasVolumeDataID = false;
 		ModelResourceID m_nVolumeDataID = 0;
+
+		CModelReader_StreamingMesh * m_pStreamingMesh;
+
+		UniqueResourceID m_nResourceIDLimit = 0;
+
+		PPackageResourceID findPackageResourceID(_In_ ModelResourceID nResourceID);
 	protected:
 		void OnNSAttribute(_In_z_ const nfChar *pAttributeName,
 							_In_z_ const nfChar *pAttributeValue,
@@ -69,13 +76,21 @@ namespace NMR {
 		void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) override;
 	public:
 		CModelReaderNode100_Mesh() = delete;
-		CModelReaderNode100_Mesh(_In_ CModel * pModel, PModelMeshObject pMesh, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID m_pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex);
+		CModelReaderNode100_Mesh(_In_ CModel * pModel, PModelMeshObject pMesh, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID m_pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 		void retrieveClippingInfo(_Out_ eModelBeamLatticeClipMode &eClipMode, _Out_ nfBool & bHasClippingMode, _Out_ ModelResourceID & nClippingMeshID);
 		void retrieveRepresentationInfo(_Out_ nfBool & bHasRepresentation, _Out_ ModelResourceID & nRepresentationMeshID);
 
 		std::vector<PModelTriangleSet> getTriangleSets ();
+
+		// Only resources with a unique ID below nResourceIDLimit are resolved, 0 resolves all resources.
+		// Deferred meshes use it to see the resources which were known when the mesh element was read.
+		void setResourceIDLimit(_In_ UniqueResourceID nResourceIDLimit);
+
+		// Resolve the beam lattice references and the object-level property, once the mesh content has been parsed
+		void handleBeamLatticeExtension();
+		void createDefaultProperties(_In_ ModelResourceID nPropertyModelID, _In_ ModelResourceIndex nPropertyIndex);
 	};
 	typedef std::shared_ptr <CModelReaderNode100_Mesh> PModelReaderNode100_Mesh;
 }
@@ -37,6 +37,8 @@ A object reader model node is a parser for the object node of an XML Model Strea
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Mesh.h"
 #include "Model/Reader/NMR_ModelReader_TexCoordMapping.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelComponentsObject.h"
 #include "Model/Classes/NMR_ModelMetaDataGroup.h"
@@ -69,15 +71,18 @@ namespace NMR {
 
 		PModelMetaDataGroup m_MetaDataGroup;
 
-		void createDefaultProperties();
-		void handleBeamLatticeExtension(CModelReaderNode100_Mesh* pXMLNode);
+		PModelReader_Streaming m_pStreaming;
+		PModelReader_LazyMeshSource m_pLazyMeshSource;
+
+		void createDefaultProperties(_In_ CModelReaderNode100_Mesh * pXMLNode);
+		void deferMeshContent(_In_ PModelMeshObject pMeshObject, _In_ CXmlReader * pXMLReader);
 	protected:
 		virtual void OnNSAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_z_ const nfChar * pNameSpace);
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Object() = delete;
-		CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor);
+		CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming = nullptr, _In_ PModelReader_LazyMeshSource pLazyMeshSource = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
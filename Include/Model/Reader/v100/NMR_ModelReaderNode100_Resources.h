@@ -35,6 +35,8 @@ A resources reader model node is a parser for the resources node of an XML Model
 #define __NMR_MODELREADERNODE100_RESOURCES
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
 #include "Model/Classes/NMR_ModelTexture2DGroup.h"
 
 namespace NMR {
@@ -46,11 +48,14 @@ namespace NMR {
 
 		int m_nProgressCount;
 
+		PModelReader_Streaming m_pStreaming;
+		PModelReader_LazyMeshSource m_pLazyMeshSource;
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar *  pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Resources() = delete;
-		CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath, _In_ PProgressMonitor pProgressMonitor);
+		CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath, _In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming = nullptr, _In_ PModelReader_LazyMeshSource pLazyMeshSource = nullptr);
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
 
@@ -37,6 +37,7 @@ A triangles reader model node is a parser for the triangles node of an XML Model
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Reader/NMR_ModelReader_TexCoordMapping.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 
@@ -51,6 +52,20 @@ namespace NMR {
 		ModelResourceIndex m_nDefaultResourceIndex;
 		ModelResourceID m_nUsedResourceID;
 
+		// Last property resource that has been looked up, as consecutive triangles mostly share it
+		nfBool m_bHasCachedResource;
+		ModelResourceID m_nCachedResourceID;
+		PPackageResourceID m_pCachedPackageResourceID;
+		PModelResource m_pCachedResource;
+		CMeshInformation_Properties * m_pPropertiesInformation;
+
+		CModelReader_StreamingMesh * m_pStreamingMesh;
+
+		UniqueResourceID m_nResourceIDLimit;
+
+		void parseTriangle(_In_ CXmlReader * pXMLReader);
+		void assignTriangleProperties(_In_ MESHFACE * pFace, _In_ ModelResourceID nModelResourceID, _In_ ModelResourceIndex nResourceIndex1, _In_ ModelResourceIndex nResourceIndex2, _In_ ModelResourceIndex nResourceIndex3);
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 
@@ -58,10 +73,13 @@ namespace NMR {
 	public:
 		CModelReaderNode100_Triangles() = delete;
 		CModelReaderNode100_Triangles(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ PModelWarnings pWarnings,
-			_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex);
+			_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 		ModelResourceID getUsedPropertyID() const;
+
+		// Only resources with a unique ID below nResourceIDLimit are resolved, 0 resolves all resources
+		void setResourceIDLimit(_In_ UniqueResourceID nResourceIDLimit);
 	};
 
 	typedef std::shared_ptr <CModelReaderNode100_Triangles> PModelReaderNode100_Triangles;
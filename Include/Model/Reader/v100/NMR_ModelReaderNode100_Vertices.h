@@ -35,6 +35,7 @@ A vertices reader model node is a parser for the vertices node of an XML Model S
 #define __NMR_MODELREADERNODE100_VERTICES
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 
@@ -43,12 +44,15 @@ namespace NMR {
 	class CModelReaderNode100_Vertices : public CModelReaderNode {
 	private:
 		CMesh * m_pMesh;
+		CModelReader_StreamingMesh * m_pStreamingMesh;
+
+		void parseVertex(_In_ CXmlReader * pXMLReader);
 	protected:
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Vertices() = delete;
-		CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings);
+		CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh = nullptr);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
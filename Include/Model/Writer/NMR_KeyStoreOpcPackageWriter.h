@@ -63,9 +63,11 @@ namespace NMR {
 	public:
 		CKeyStoreOpcPackageWriter(
 			_In_ PExportStream pImportStream, 
-			_In_ CModelContext const & context);
+			_In_ CModelContext const & context,
+			_In_ nfUint32 nCompressionThreadCount);
 
-		POpcPackagePart addPart(_In_ std::string sPath) override;
+		POpcPackagePart addPart(_In_ std::string sPath, _In_ nfUint32 nCompressionLevel) override;
+		POpcPackagePart addRawPart(_In_ std::string sPath, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info) override;
 		void close() override;
 		void addContentType(std::string sExtension, std::string sContentType) override;
 		void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) override;
@@ -45,6 +45,12 @@ namespace NMR {
 	class CModelWriter : public CModelContext{
 	private:
 		nfUint32 m_nDecimalPrecision;
+		nfUint32 m_nObjectThreadCount;
+		nfUint32 m_nCompressionThreadCount;
+		nfUint32 m_nSubModelThreadCount;
+		nfUint32 m_nModelCompressionLevel;
+		nfUint32 m_nTextureCompressionLevel;
+		nfUint32 m_nAttachmentCompressionLevel;
 	public:
 		CModelWriter() = delete;
 		CModelWriter(_In_ PModel pModel);
@@ -54,6 +60,26 @@ namespace NMR {
 
 		void SetDecimalPrecision(nfUint32);
 		nfUint32 GetDecimalPrecision();
+
+		// 1 writes all objects serially, 0 uses all available hardware threads
+		void SetObjectThreadCount(nfUint32 nThreadCount);
+		nfUint32 GetObjectThreadCount();
+
+		// 1 deflates all parts on the calling thread, 0 uses all available hardware threads
+		void SetCompressionThreadCount(nfUint32 nThreadCount);
+		nfUint32 GetCompressionThreadCount();
+
+		// 1 writes the non-root model parts serially, 0 uses all available hardware threads
+		void SetSubModelThreadCount(nfUint32 nThreadCount);
+		nfUint32 GetSubModelThreadCount();
+
+		// 0 stores the parts uncompressed, 1 (fastest) to 9 (smallest) deflate them
+		void SetModelCompressionLevel(nfUint32 nCompressionLevel);
+		nfUint32 GetModelCompressionLevel();
+		void SetTextureCompressionLevel(nfUint32 nCompressionLevel);
+		nfUint32 GetTextureCompressionLevel();
+		void SetAttachmentCompressionLevel(nfUint32 nCompressionLevel);
+		nfUint32 GetAttachmentCompressionLevel();
 	};
 
 	typedef std::shared_ptr <CModelWriter> PModelWriter;
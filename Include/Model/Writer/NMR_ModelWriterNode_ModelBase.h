@@ -45,11 +45,15 @@ namespace NMR {
 	class CModelWriterNode_ModelBase : public CModelWriterNode {
 	protected:
 		CModel * m_pModel;
+		// Path of the model part that is written. Taken from the model on construction, so that parts can be written on several threads.
+		std::string m_sModelPath;
 
 		void assertResourceIsInCurrentPath(PPackageResourceID pID);
 	public:
 		CModelWriterNode_ModelBase() = delete;
 		CModelWriterNode_ModelBase(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor);
+
+		void setModelPath(_In_ const std::string & sModelPath);
 	};
 
 }
@@ -45,8 +45,9 @@ namespace NMR {
 		// Creates a model stream
 		void writeModelStream(_In_ CXmlWriter * pXMLWriter, _In_ CModel * pModel);
 
-		// Creates a slicestack attachment stream
-		void writeNonRootModelStream(_In_ CXmlWriter *pXMLWriter);
+		// Creates a non-root model stream. pSortedObjectList may be null, the objects are then sorted by the model.
+		void writeNonRootModelStream(_In_ CXmlWriter * pXMLWriter, _In_ const std::string & sPath, _In_ PProgressMonitor pProgressMonitor,
+			_In_ nfUint32 nObjectThreadCount, _In_opt_ const std::list<CModelObject *> * pSortedObjectList);
 
 		// These are OPC dependent functions
 		virtual void createPackage(_In_ CModel * pModel) = 0;
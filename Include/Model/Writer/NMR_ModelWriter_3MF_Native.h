@@ -53,9 +53,15 @@ namespace NMR {
 		virtual void writePackageToStream(_In_ PExportStream pStream);
 		virtual void releasePackage();
 
+		POpcPackagePart addAttachmentPart(_In_ std::string sPath, _In_ PImportStream pStream, _In_ nfUint32 nCompressionLevel);
+		nfUint32 getAttachmentCompressionLevel(_In_ const std::string & sRelationShipType);
 		void addAttachments(_In_ CModel * pModel, _In_ POpcPackagePart pModelPart);
 
 		void addNonRootModels();
+		PImportStream writeNonRootModelPart(_In_ const std::string & sPath, _In_ PProgressMonitor pProgressMonitor,
+			_In_ nfUint32 nObjectThreadCount, _In_opt_ const std::list<CModelObject *> * pSortedObjectList);
+		// Writes the non-root model parts that do not depend on the current path of the model on several threads
+		void writeNonRootModelParts(_In_ const std::vector<std::string> & Paths, _In_ std::vector<PImportStream> & Streams, _In_ nfUint32 nThreadCount);
 
 	public:
 		CModelWriter_3MF_Native() = delete;
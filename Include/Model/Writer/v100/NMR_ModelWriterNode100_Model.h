@@ -42,12 +42,17 @@ This is the class for exporting the 3mf model stream root node.
 
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 
+#include <list>
+#include <vector>
+
 
 namespace NMR {
 
 	class CModelWriterNode100_Model : public CModelWriterNode_ModelBase {
 	protected:
 		nfUint32 m_nDecimalPrecision;
+		nfUint32 m_nObjectThreadCount;
+		const std::list<CModelObject *> * m_pSortedObjectList;
 		
 		PMeshInformation_PropertyIndexMapping m_pPropertyIndexMapping;
 		
@@ -71,6 +76,7 @@ namespace NMR {
 
 		void writeResources();
 		void writeResource(CModelResource * pResource);
+		void writeResourceSequence(_In_ const std::vector<CModelResource *> & Resources);
 		
 		void writeBaseMaterials();
 		void writeBaseMaterial(
@@ -100,6 +106,7 @@ namespace NMR {
 
 		void writeObjects();
 		void writeObject(CModelObject & pObject);
+		void writeObjectElement(CModelObject & pObject);
 		void writeBuild();
 
 		void writeSliceStacks();
@@ -115,6 +122,12 @@ namespace NMR {
 		CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nDecimalPrecision);
 		CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nDecimalPrecision, _In_ nfBool bWritesRootModel);
 		
+		// 1 writes all objects serially, 0 formats objects on all available hardware threads
+		void setObjectThreadCount(_In_ nfUint32 nThreadCount);
+
+		// Uses a precomputed result of CModel::getSortedObjectList, which must not be computed by several threads at once
+		void setSortedObjectList(_In_ const std::list<CModelObject *> * pSortedObjectList);
+
 		virtual void writeToXML();
 	};
 
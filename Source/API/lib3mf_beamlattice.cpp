@@ -368,6 +368,7 @@ void CBeamLattice::SetBall (const Lib3MF_uint32 nIndex, const sLib3MFBall BallIn
 	}
 
 	eBeamLatticeBallMode ballMode = (eBeamLatticeBallMode(m_mesh.getBeamLatticeBallMode()));
+	m_mesh.markModified();
 
 	if (ballMode == eBeamLatticeBallMode::Mixed) {
 		NMR::MESHBALL * meshBall = m_mesh.getBall(nIndex);
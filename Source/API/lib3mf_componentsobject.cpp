@@ -131,3 +131,8 @@ bool CComponentsObject::IsLevelSetObject()
 	return false;
 }
 
+bool CComponentsObject::IsValid()
+{
+	return getComponentsObject()->isValid();
+}
+
@@ -34,6 +34,11 @@ Abstract: This is a stub class definition of CFunction
 #include "lib3mf_implicitportiterator.hpp"
 
 // Include custom headers here.
+#include "lib3mf_utils.hpp"
+#include "Model/Classes/NMR_GridSampler.h"
+#include "Model/Classes/NMR_Image3DSampler.h"
+#include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
+#include "Model/Classes/NMR_ModelImplicitFunction.h"
 
 
 using namespace Lib3MF::Impl;
@@ -124,3 +129,40 @@ IImplicitPort* CFunction::FindOutput(const std::string& sIdentifier)
 {
 	return new CImplicitPort(function()->findOutput(sIdentifier));
 }
+
+void CFunction::SampleGrid(const std::string & sOutputIdentifier, const Lib3MF::sVector Origin, const Lib3MF::sVector Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const Lib3MFProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	double const origin[3] = {Origin.m_Coordinates[0], Origin.m_Coordinates[1], Origin.m_Coordinates[2]};
+	double const spacing[3] = {Spacing.m_Coordinates[0], Spacing.m_Coordinates[1], Spacing.m_Coordinates[2]};
+	size_t const counts[3] = {nCountX, nCountY, nCountZ};
+	NMR::implicit::GridSampler grid(origin, spacing, counts);
+
+	Lib3MF_uint64 const count = grid.getPointCount();
+	if (pValuesNeededCount)
+		*pValuesNeededCount = count;
+	if (pValuesBuffer == nullptr)
+		return;
+	if (nValuesBufferSize < count)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
+
+	NMR::CModelFunctionFromImage3D* pImageFunction = dynamic_cast<NMR::CModelFunctionFromImage3D*>(function());
+	if (pImageFunction != nullptr) {
+		size_t nChannel = NMR::implicit::Image3DSampler::findChannel(sOutputIdentifier);
+		if (nChannel >= NMR::implicit::Image3DSampler::ChannelCount)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM, "A function from an image stack can only be sampled on a grid for the outputs red, green, blue and alpha.");
+
+		NMR::implicit::Image3DSampler sampler(*pImageFunction);
+		runWithProgressCallback(pProgressCallback, pUserData, [&](NMR::CProgressMonitor* pProgressMonitor) {
+			grid.sampleImage3D(sampler, nChannel, pValuesBuffer, pProgressMonitor);
+		});
+		return;
+	}
+
+	NMR::CModelImplicitFunction* pImplicitFunction = dynamic_cast<NMR::CModelImplicitFunction*>(function());
+	if (pImplicitFunction == nullptr)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_NOTIMPLEMENTED, "Only implicit functions and functions from image stacks can be sampled on a grid.");
+
+	runWithProgressCallback(pProgressCallback, pUserData, [&](NMR::CProgressMonitor* pProgressMonitor) {
+		grid.sampleFunction(*pImplicitFunction, sOutputIdentifier, pValuesBuffer, pProgressMonitor);
+	});
+}
@@ -86,6 +86,7 @@ Abstract: This is a stub class definition of CImplicitFunction
 // Include custom headers here.
 #include "lib3mf_implicitportiterator.hpp"
 #include "lib3mf_nodeiterator.hpp"
+#include <algorithm>
 
 using namespace Lib3MF::Impl;
 
@@ -717,3 +718,18 @@ void CImplicitFunction::SortNodesTopologically()
     function()->sortNodesTopologically();
 }
 
+void CImplicitFunction::EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize,
+                                      const Lib3MF_double* pInputsBuffer,
+                                      Lib3MF_uint64 nOutputsBufferSize,
+                                      Lib3MF_uint64* pOutputsNeededCount,
+                                      Lib3MF_double* pOutputsBuffer)
+{
+    size_t neededCount = 0;
+    function()->evaluateBatch(pInputsBuffer,
+                              static_cast<size_t>(nInputsBufferSize),
+                              static_cast<size_t>(nOutputsBufferSize),
+                              &neededCount, pOutputsBuffer);
+    if (pOutputsNeededCount)
+        *pOutputsNeededCount = neededCount;
+}
+
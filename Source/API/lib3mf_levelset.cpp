@@ -39,6 +39,8 @@ Abstract: This is a stub class definition of CLevelSet
 #include "Model/Classes/NMR_ModelLevelSetObject.h"
 #include "Model/Classes/NMR_ModelFunction.h"
 #include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Model/Classes/NMR_GridSampler.h"
+#include "Model/Classes/NMR_LevelSetSampler.h"
 
 
 using namespace Lib3MF::Impl;
@@ -275,4 +277,26 @@ IVolumeData * CLevelSet::GetVolumeData()
 		return nullptr;
 	}
 	return new CVolumeData(pVolumeData);
-}
\ No newline at end of file
+}
+
+void CLevelSet::SampleGrid(const Lib3MF::sVector Origin, const Lib3MF::sVector Spacing, const Lib3MF_uint32 nCountX, const Lib3MF_uint32 nCountY, const Lib3MF_uint32 nCountZ, const Lib3MFProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData, Lib3MF_uint64 nValuesBufferSize, Lib3MF_uint64* pValuesNeededCount, Lib3MF_single * pValuesBuffer)
+{
+	double const origin[3] = {Origin.m_Coordinates[0], Origin.m_Coordinates[1], Origin.m_Coordinates[2]};
+	double const spacing[3] = {Spacing.m_Coordinates[0], Spacing.m_Coordinates[1], Spacing.m_Coordinates[2]};
+	size_t const counts[3] = {nCountX, nCountY, nCountZ};
+	NMR::implicit::GridSampler grid(origin, spacing, counts);
+
+	Lib3MF_uint64 const count = grid.getPointCount();
+	if (pValuesNeededCount)
+		*pValuesNeededCount = count;
+	if (pValuesBuffer == nullptr)
+		return;
+	if (nValuesBufferSize < count)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
+
+	NMR::PModelLevelSetObject pLevelSet = levelSetObject();
+	NMR::implicit::LevelSetSampler sampler(*pLevelSet);
+	runWithProgressCallback(pProgressCallback, pUserData, [&](NMR::CProgressMonitor* pProgressMonitor) {
+		grid.sampleLevelSet(sampler, pValuesBuffer, pProgressMonitor);
+	});
+}
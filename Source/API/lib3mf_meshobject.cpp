@@ -39,6 +39,7 @@ Abstract: This is a stub class definition of CMeshObject
 #include "Model/Classes/NMR_ModelVolumeData.h"
 #include "Model/Classes/NMR_ModelResource.h"
 #include <cmath>
+#include <algorithm>
 
 using namespace Lib3MF::Impl;
 
@@ -112,6 +113,7 @@ void CMeshObject::SetVertex (const Lib3MF_uint32 nIndex, const sLib3MFPosition C
 	node->m_position.m_fields[0] = Coordinates.m_Coordinates[0];
 	node->m_position.m_fields[1] = Coordinates.m_Coordinates[1];
 	node->m_position.m_fields[2] = Coordinates.m_Coordinates[2];
+	mesh()->markModified();
 }
 
 sLib3MFPosition CMeshObject::GetVertex(const Lib3MF_uint32 nIndex)
@@ -135,16 +137,9 @@ void CMeshObject::GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64*
 	if (pVerticesNeededCount)
 		*pVerticesNeededCount = nodeCount;
 
+	// sLib3MFPosition is a packed triple of floats
 	if (nVerticesBufferSize >= nodeCount && pVerticesBuffer)
-	{
-		for (Lib3MF_uint32 i = 0; i < nodeCount; i++)
-		{
-			const NMR::MESHNODE* node = mesh()->getNode(i);
-			pVerticesBuffer[i].m_Coordinates[0] = node->m_position.m_fields[0];
-			pVerticesBuffer[i].m_Coordinates[1] = node->m_position.m_fields[1];
-			pVerticesBuffer[i].m_Coordinates[2] = node->m_position.m_fields[2];
-		}
-	}
+		mesh()->getNodeCoordinates(&pVerticesBuffer->m_Coordinates[0]);
 }
 
 sLib3MFTriangle CMeshObject::GetTriangle (const Lib3MF_uint32 nIndex)
@@ -166,6 +161,7 @@ void CMeshObject::SetTriangle (const Lib3MF_uint32 nIndex, const sLib3MFTriangle
 	mf->m_nodeindices[0] = Indices.m_Indices[0];
 	mf->m_nodeindices[1] = Indices.m_Indices[1];
 	mf->m_nodeindices[2] = Indices.m_Indices[2];
+	mesh()->markModified();
 }
 
 Lib3MF_uint32 CMeshObject::AddTriangle(const sLib3MFTriangle Indices)
@@ -179,16 +175,9 @@ void CMeshObject::GetTriangleIndices (Lib3MF_uint64 nIndicesBufferSize, Lib3MF_u
 	if (pIndicesNeededCount)
 		*pIndicesNeededCount = faceCount;
 
+	// sLib3MFTriangle is a packed triple of node indices
 	if (nIndicesBufferSize >= faceCount && pIndicesBuffer)
-	{
-		for (Lib3MF_uint32 i = 0; i < faceCount; i++)
-		{
-			const NMR::MESHFACE* face = mesh()->getFace(i);
-			pIndicesBuffer[i].m_Indices[0] = face->m_nodeindices[0];
-			pIndicesBuffer[i].m_Indices[1] = face->m_nodeindices[1];
-			pIndicesBuffer[i].m_Indices[2] = face->m_nodeindices[2];
-		}
-	}
+		mesh()->getFaceNodeIndices(&pIndicesBuffer->m_Indices[0]);
 }
 
 void CMeshObject::SetObjectLevelProperty(const Lib3MF_uint32 nUniqueResourceID, const Lib3MF_uint32 nPropertyID)
@@ -334,37 +323,28 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 	// Clear old mesh
 	pMesh->clear();
 
-	// Rebuild Mesh Coordinates
-	const sLib3MFPosition * pVertex = pVerticesBuffer;
-	for (Lib3MF_uint64 nIndex = 0; nIndex < nVerticesBufferSize; nIndex++) {
-		for (int j = 0; j < 3; j++) {
-			if (std::fabs(pVertex->m_Coordinates[j]) > NMR_MESH_MAXCOORDINATE)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
-		}
-		pMesh->addNode(pVertex->m_Coordinates[0], pVertex->m_Coordinates[1], pVertex->m_Coordinates[2]);
+	if (nVerticesBufferSize > NMR_MESH_MAXNODECOUNT)
+		throw NMR::CNMRException(NMR_ERROR_TOOMANYNODES);
+	if (nIndicesBufferSize > NMR_MESH_MAXFACECOUNT)
+		throw NMR::CNMRException(NMR_ERROR_TOOMANYFACES);
 
-		pVertex++;
-	}
+	// The final size is known, so allocate it at once
+	pMesh->reserveCapacity((Lib3MF_uint32)nVerticesBufferSize, (Lib3MF_uint32)nIndicesBufferSize);
 
-	// Rebuild Mesh Faces
-	const sLib3MFTriangle * pTriangle = pIndicesBuffer;
-	for (Lib3MF_uint64 nIndex = 0; nIndex < nIndicesBufferSize; nIndex++) {
-		NMR::MESHNODE * pNodes[3];
-
-		for (int j = 0; j < 3; j++) {
-			if (pTriangle->m_Indices[j] >= nVerticesBufferSize)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
-			pNodes[j] = pMesh->getNode(pTriangle->m_Indices[j]);
-		}
-
-		if ((pTriangle->m_Indices[0] == pTriangle->m_Indices[1]) ||
-			(pTriangle->m_Indices[0] == pTriangle->m_Indices[2]) ||
-			(pTriangle->m_Indices[1] == pTriangle->m_Indices[2]))
+	// Copy the buffers block-wise, sLib3MFPosition and sLib3MFTriangle are packed triples
+	try {
+		pMesh->addNodes(pVerticesBuffer ? &pVerticesBuffer->m_Coordinates[0] : nullptr, (Lib3MF_uint32)nVerticesBufferSize);
+		pMesh->addFaces(pIndicesBuffer ? &pIndicesBuffer->m_Indices[0] : nullptr, (Lib3MF_uint32)nIndicesBufferSize);
+	}
+	catch (NMR::CNMRException & e) {
+		switch (e.getErrorCode()) {
+		case NMR_ERROR_INVALIDCOORDINATES:
+		case NMR_ERROR_INVALIDNODEINDEX:
+		case NMR_ERROR_DUPLICATENODE:
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
-
-		pMesh->addFace(pNodes[0], pNodes[1], pNodes[2]);
-
-		pTriangle++;
+		default:
+			throw;
+		}
 	}
 }
 
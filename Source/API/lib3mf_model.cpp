@@ -805,9 +805,12 @@ Lib3MF::sBox CModel::GetOutbox()
 	NMR::NOUTBOX3 sOutbox;
 	NMR::fnOutboxInitialize(sOutbox);
 
-	for (NMR::nfUint32 iBuildItem = 0; iBuildItem < model().getBuildItemCount(); iBuildItem++) {
-		auto pBuildItem = model().getBuildItem(iBuildItem);
-		pBuildItem->getObject()->extendOutbox(sOutbox, pBuildItem->getTransform());
+	std::vector<NMR::NOUTBOX3> BuildItemOutboxes;
+	model().getBuildItemOutboxes(BuildItemOutboxes);
+	for (NMR::NOUTBOX3 & sBuildItemOutbox : BuildItemOutboxes) {
+		// build items without any vertex keep the initial (inverted) outbox
+		if (sBuildItemOutbox.m_min.m_fields[0] <= sBuildItemOutbox.m_max.m_fields[0])
+			NMR::fnOutboxMergeOutbox(sOutbox, sBuildItemOutbox);
 	}
 
 	sBox s;
@@ -821,9 +824,27 @@ Lib3MF::sBox CModel::GetOutbox()
 	return s;
 }
 
-IImageStack * CModel::AddImageStack(const Lib3MF_uint32 nSizeX, const Lib3MF_uint32 nSizeY, const Lib3MF_uint32 nSheetCount)
+void CModel::GetBuildItemOutboxes(Lib3MF_uint64 nOutboxesBufferSize, Lib3MF_uint64* pOutboxesNeededCount, sLib3MFBox * pOutboxesBuffer)
 {
-	NMR::PModelImageStack pResource = NMR::CModelImageStack::make(model().generateResourceID(), &model(), nSizeX, nSizeY, nSheetCount);
+	NMR::nfUint32 nBuildItemCount = model().getBuildItemCount();
+	if (pOutboxesNeededCount)
+		*pOutboxesNeededCount = nBuildItemCount;
+
+	if (nOutboxesBufferSize >= nBuildItemCount && pOutboxesBuffer) {
+		std::vector<NMR::NOUTBOX3> BuildItemOutboxes;
+		model().getBuildItemOutboxes(BuildItemOutboxes);
+		for (NMR::nfUint32 iBuildItem = 0; iBuildItem < nBuildItemCount; iBuildItem++) {
+			for (int j = 0; j < 3; j++) {
+				pOutboxesBuffer[iBuildItem].m_MinCoordinate[j] = BuildItemOutboxes[iBuildItem].m_min.m_fields[j];
+				pOutboxesBuffer[iBuildItem].m_MaxCoordinate[j] = BuildItemOutboxes[iBuildItem].m_max.m_fields[j];
+			}
+		}
+	}
+}
+
+IImageStack * CModel::AddImageStack(const Lib3MF_uint32 nColumnCount, const Lib3MF_uint32 nRowCount, const Lib3MF_uint32 nSheetCount)
+{
+	NMR::PModelImageStack pResource = NMR::CModelImageStack::make(model().generateResourceID(), &model(), nRowCount, nColumnCount, nSheetCount);
 	model().addResource(pResource);
 
 	return new CImageStack(pResource);
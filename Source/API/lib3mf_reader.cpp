@@ -34,8 +34,10 @@ Abstract: This is a stub class definition of CReader
 #include "lib3mf_interfaceexception.hpp"
 #include "lib3mf_accessright.hpp"
 #include "lib3mf_contentencryptionparams.hpp"
+#include "lib3mf_utils.hpp"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/Platform/NMR_ImportStream_Shared_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
 #include "Common/Platform/NMR_ImportStream_Callback.h"
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/NMR_SecureContext.h"
@@ -72,7 +74,7 @@ NMR::CModelReader& CReader::reader()
 
 void CReader::ReadFromFile (const std::string & sFilename)
 {
-	NMR::PImportStream pImportStream = NMR::fnCreateImportStreamInstance(sFilename.c_str());
+	NMR::PImportStream pImportStream = NMR::fnCreateMappedImportStreamInstance(sFilename.c_str());
 
 	try {
 		reader().readStream(pImportStream);
@@ -87,7 +89,12 @@ void CReader::ReadFromFile (const std::string & sFilename)
 
 void CReader::ReadFromBuffer (const Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
 {
-	NMR::PImportStream pImportStream = std::make_shared<NMR::CImportStream_Shared_Memory>(pBufferBuffer, nBufferBufferSize);
+	// Lazy meshes and attachments are read after this call returns, so they must not refer to the caller's buffer
+	NMR::PImportStream pImportStream;
+	if (reader().getLazyMeshLoading() || reader().getLazyAttachmentLoading())
+		pImportStream = std::make_shared<NMR::CImportStream_Unique_Memory>(pBufferBuffer, nBufferBufferSize);
+	else
+		pImportStream = std::make_shared<NMR::CImportStream_Shared_Memory>(pBufferBuffer, nBufferBufferSize);
 
 	try {
 		reader().readStream(pImportStream);
@@ -143,6 +150,81 @@ void CReader::SetProgressCallback(const Lib3MFProgressCallback pProgressCallback
 	m_pReader->SetProgressCallback(lambdaCallback, pUserData);
 }
 
+void CReader::SetVertexStreamCallback(const Lib3MFVertexStreamCallback pVertexStreamCallback, const Lib3MF_pvoid pUserData)
+{
+	static_assert(sizeof(NMR::MODELSTREAMINGVERTEX) == sizeof(sLib3MFPosition), "invalid vertex stream layout");
+	if (pVertexStreamCallback == nullptr) {
+		reader().streaming()->setVertexCallback(nullptr);
+		return;
+	}
+
+	reader().streaming()->setVertexCallback([pVertexStreamCallback, pUserData](NMR::UniqueResourceID nObjectID, const NMR::MODELSTREAMINGVERTEX * pVertices, NMR::nfUint32 nCount) {
+		(*pVertexStreamCallback)(nObjectID, nCount, (Lib3MF_uint64)pVertices, pUserData);
+	});
+}
+
+void CReader::SetTriangleStreamCallback(const Lib3MFTriangleStreamCallback pTriangleStreamCallback, const Lib3MF_pvoid pUserData)
+{
+	static_assert(sizeof(NMR::MODELSTREAMINGTRIANGLE) == sizeof(sLib3MFTriangle), "invalid triangle stream layout");
+	if (pTriangleStreamCallback == nullptr) {
+		reader().streaming()->setTriangleCallback(nullptr);
+		return;
+	}
+
+	reader().streaming()->setTriangleCallback([pTriangleStreamCallback, pUserData](NMR::UniqueResourceID nObjectID, const NMR::MODELSTREAMINGTRIANGLE * pTriangles, NMR::nfUint32 nCount) {
+		(*pTriangleStreamCallback)(nObjectID, nCount, (Lib3MF_uint64)pTriangles, pUserData);
+	});
+}
+
+void CReader::SetBeamStreamCallback(const Lib3MFBeamStreamCallback pBeamStreamCallback, const Lib3MF_pvoid pUserData)
+{
+	if (pBeamStreamCallback == nullptr) {
+		reader().streaming()->setBeamCallback(nullptr);
+		return;
+	}
+
+	// sBeam is packed, so the batch is converted instead of passed through
+	auto pBeamBuffer = std::make_shared<std::vector<sLib3MFBeam>>();
+	reader().streaming()->setBeamCallback([pBeamStreamCallback, pUserData, pBeamBuffer](NMR::UniqueResourceID nObjectID, const NMR::MODELSTREAMINGBEAM * pBeams, NMR::nfUint32 nCount) {
+		pBeamBuffer->resize(nCount);
+		for (NMR::nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			sLib3MFBeam & beam = (*pBeamBuffer)[nIndex];
+			for (int j = 0; j < 2; j++) {
+				beam.m_Indices[j] = pBeams[nIndex].m_nIndices[j];
+				beam.m_Radii[j] = pBeams[nIndex].m_dRadii[j];
+				beam.m_CapModes[j] = eLib3MFBeamLatticeCapMode(pBeams[nIndex].m_nCapModes[j]);
+			}
+		}
+		(*pBeamStreamCallback)(nObjectID, nCount, (Lib3MF_uint64)pBeamBuffer->data(), pUserData);
+	});
+}
+
+void CReader::SetComponentStreamCallback(const Lib3MFComponentStreamCallback pComponentStreamCallback, const Lib3MF_pvoid pUserData)
+{
+	if (pComponentStreamCallback == nullptr) {
+		reader().streaming()->setComponentCallback(nullptr);
+		return;
+	}
+
+	reader().streaming()->setComponentCallback([pComponentStreamCallback, pUserData](NMR::UniqueResourceID nObjectID, NMR::UniqueResourceID nComponentObjectID, const NMR::NMATRIX3 & mTransform) {
+		sLib3MFTransform transform = MatrixToTransform(mTransform);
+		(*pComponentStreamCallback)(nObjectID, nComponentObjectID, (Lib3MF_uint64)&transform, pUserData);
+	});
+}
+
+void CReader::SetBuildItemStreamCallback(const Lib3MFBuildItemStreamCallback pBuildItemStreamCallback, const Lib3MF_pvoid pUserData)
+{
+	if (pBuildItemStreamCallback == nullptr) {
+		reader().streaming()->setBuildItemCallback(nullptr);
+		return;
+	}
+
+	reader().streaming()->setBuildItemCallback([pBuildItemStreamCallback, pUserData](NMR::UniqueResourceID nObjectID, const NMR::NMATRIX3 & mTransform) {
+		sLib3MFTransform transform = MatrixToTransform(mTransform);
+		(*pBuildItemStreamCallback)(nObjectID, (Lib3MF_uint64)&transform, pUserData);
+	});
+}
+
 void CReader::AddRelationToRead (const std::string & sRelationShipType)
 {
 	reader().addRelationToRead(sRelationShipType);
@@ -166,6 +248,46 @@ bool CReader::GetStrictModeActive ()
 	return reader().warnings()->getCriticalWarningLevel() == NMR::mrwInvalidOptionalValue;
 }
 
+void CReader::SetSubModelThreadCount (const Lib3MF_uint32 nThreadCount)
+{
+	reader().setSubModelThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CReader::GetSubModelThreadCount ()
+{
+	return reader().getSubModelThreadCount();
+}
+
+void CReader::SetLazyMeshLoadingActive (const bool bLazyMeshLoadingActive)
+{
+	reader().setLazyMeshLoading(bLazyMeshLoadingActive);
+}
+
+bool CReader::GetLazyMeshLoadingActive ()
+{
+	return reader().getLazyMeshLoading();
+}
+
+void CReader::SetBackgroundDecompressionActive (const bool bBackgroundDecompressionActive)
+{
+	reader().setBackgroundDecompression(bBackgroundDecompressionActive);
+}
+
+bool CReader::GetBackgroundDecompressionActive ()
+{
+	return reader().getBackgroundDecompression();
+}
+
+void CReader::SetLazyAttachmentLoadingActive (const bool bLazyAttachmentLoadingActive)
+{
+	reader().setLazyAttachmentLoading(bLazyAttachmentLoadingActive);
+}
+
+bool CReader::GetLazyAttachmentLoadingActive ()
+{
+	return reader().getLazyAttachmentLoading();
+}
+
 std::string CReader::GetWarning (const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode)
 {
 	auto warning = reader().warnings()->getWarning(nIndex);
@@ -32,6 +32,7 @@ Abstract: This file implements utilities for the lib3mf API
 #include "lib3mf_interfaceexception.hpp"
 
 // Include custom headers here.
+#include "Common/NMR_Exception.h"
 
 
 // using namespace Lib3MF::Impl;
@@ -88,3 +89,29 @@ eLib3MFCompression Lib3MF::translateCompression(bool compression) {
 bool Lib3MF::translateCompression(const eLib3MFCompression compression) {
 	return eLib3MFCompression::Deflate == compression;
 }
+
+void Lib3MF::runWithProgressCallback(Lib3MFProgressCallback pProgressCallback, Lib3MF_pvoid pUserData,
+	const std::function<void(NMR::CProgressMonitor*)> & fnRun)
+{
+	if (pProgressCallback == nullptr) {
+		fnRun(nullptr);
+		return;
+	}
+
+	NMR::CProgressMonitor monitor;
+	monitor.SetProgressCallback([pProgressCallback](int progressStep, NMR::ProgressIdentifier identifier, void* pUserData)
+	{
+		bool ret = false;
+		(*pProgressCallback)(&ret, progressStep / 100.0f, eLib3MFProgressIdentifier(identifier), pUserData);
+		return ret;
+	}, pUserData);
+
+	try {
+		fnRun(&monitor);
+	}
+	catch (NMR::CNMRException & e) {
+		if (e.getErrorCode() == NMR_USERABORTED)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
+		throw;
+	}
+}
@@ -75,6 +75,7 @@ NMR::CModelWriter& CWriter::writer()
 void CWriter::WriteToFile (const std::string & sFilename)
 {
 	setlocale(LC_ALL, "C");
+	momentBuffer.reset();
 	NMR::PExportStream pStream = NMR::fnCreateExportStreamInstance(sFilename.c_str());
 	try {
 		writer().exportToStream(pStream);
@@ -92,6 +93,7 @@ void CWriter::WriteToFile (const std::string & sFilename)
 Lib3MF_uint64 CWriter::GetStreamSize ()
 {
 	// Write to a special dummy stream just to calculate the size
+	momentBuffer.reset();
 	NMR::PExportStreamDummy pStream = std::make_shared<NMR::CExportStreamDummy>();
 	try {
 		writer().exportToStream(pStream);
@@ -110,24 +112,33 @@ Lib3MF_uint64 CWriter::GetStreamSize ()
 
 #include <cstring>
 
+NMR::PExportStreamMemory CWriter::exportToMemory()
+{
+	NMR::PExportStreamMemory pStream = std::make_shared<NMR::CExportStreamMemory>();
+	try {
+		writer().exportToStream(pStream);
+	} catch (NMR::CNMRException&e) {
+		if (e.getErrorCode() == NMR_USERABORTED) {
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
+		} else if (e.getErrorCode() == NMR_ERROR_DEKDESCRIPTORNOTFOUND
+			|| e.getErrorCode() == NMR_ERROR_KEKDESCRIPTORNOTFOUND) {
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_SECURECONTEXTNOTREGISTERED);
+		} else throw e;
+	}
+	return pStream;
+}
+
 void CWriter::WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer)
 {
+	// The stream of a call with a too small buffer is kept for the next call only, so that a size query
+	// followed by the actual write exports the model once. Any other write discards it.
 	NMR::PExportStreamMemory pStream;
 	if (!momentBuffer || momentBuffer->getDataSize() > nBufferBufferSize) {
-		pStream = std::make_shared<NMR::CExportStreamMemory>();
-		try {
-			writer().exportToStream(pStream);
-		} catch (NMR::CNMRException&e) {
-			if (e.getErrorCode() == NMR_USERABORTED) {
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
-			} else if (e.getErrorCode() == NMR_ERROR_DEKDESCRIPTORNOTFOUND
-				|| e.getErrorCode() == NMR_ERROR_KEKDESCRIPTORNOTFOUND) {
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_SECURECONTEXTNOTREGISTERED);
-			} else throw e;
-		}
+		pStream = exportToMemory();
 	} else {
 		pStream = momentBuffer;
 	}
+	momentBuffer.reset();
 
 	Lib3MF_uint64 cbStreamSize = pStream->getDataSize();
 	if (pBufferNeededCount)
@@ -136,12 +147,27 @@ void CWriter::WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBuf
 	if (nBufferBufferSize >= cbStreamSize) {
 		// TODO eliminate this copy, perhaps by allowing CExportStreamMemory to use existing buffers
 		memcpy(pBufferBuffer, pStream->getData(), static_cast<size_t>(cbStreamSize));
-		momentBuffer.reset();
 	} else {
 		momentBuffer = pStream;
 	}
 }
 
+Lib3MF_uint64 CWriter::WriteToInternalBuffer()
+{
+	// The model is written exactly once, the caller reads the buffer in place
+	momentBuffer.reset();
+	m_pInternalBuffer.reset();
+	m_pInternalBuffer = exportToMemory();
+	return m_pInternalBuffer->getDataSize();
+}
+
+Lib3MF_uint64 CWriter::GetInternalBufferAddress()
+{
+	if (!m_pInternalBuffer)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_SHOULDNOTBECALLED);
+	return reinterpret_cast<Lib3MF_uint64>(m_pInternalBuffer->getData());
+}
+
 void CWriter::WriteToCallback(const Lib3MFWriteCallback pTheWriteCallback, const Lib3MFSeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData)
 {
 	NMR::ExportStream_WriteCallbackType lambdaWriteCallback =
@@ -158,6 +184,7 @@ void CWriter::WriteToCallback(const Lib3MFWriteCallback pTheWriteCallback, const
 		return 0;
 	};
 
+	momentBuffer.reset();
 	NMR::PExportStream pStream = std::make_shared<NMR::CExportStream_Callback>(lambdaWriteCallback, lambdaSeekCallback, pUserData);
 	try {
 		writer().exportToStream(pStream);
@@ -260,6 +287,54 @@ bool CWriter::GetStrictModeActive() {
 	return writer().warnings()->getCriticalWarningLevel() == NMR::mrwInvalidOptionalValue;
 }
 
+void CWriter::SetObjectThreadCount(const Lib3MF_uint32 nThreadCount) {
+	writer().SetObjectThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CWriter::GetObjectThreadCount() {
+	return writer().GetObjectThreadCount();
+}
+
+void CWriter::SetSubModelThreadCount(const Lib3MF_uint32 nThreadCount) {
+	writer().SetSubModelThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CWriter::GetSubModelThreadCount() {
+	return writer().GetSubModelThreadCount();
+}
+
+void CWriter::SetCompressionThreadCount(const Lib3MF_uint32 nThreadCount) {
+	writer().SetCompressionThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CWriter::GetCompressionThreadCount() {
+	return writer().GetCompressionThreadCount();
+}
+
+void CWriter::SetModelCompressionLevel(const Lib3MF_uint32 nCompressionLevel) {
+	writer().SetModelCompressionLevel(nCompressionLevel);
+}
+
+Lib3MF_uint32 CWriter::GetModelCompressionLevel() {
+	return writer().GetModelCompressionLevel();
+}
+
+void CWriter::SetTextureCompressionLevel(const Lib3MF_uint32 nCompressionLevel) {
+	writer().SetTextureCompressionLevel(nCompressionLevel);
+}
+
+Lib3MF_uint32 CWriter::GetTextureCompressionLevel() {
+	return writer().GetTextureCompressionLevel();
+}
+
+void CWriter::SetAttachmentCompressionLevel(const Lib3MF_uint32 nCompressionLevel) {
+	writer().SetAttachmentCompressionLevel(nCompressionLevel);
+}
+
+Lib3MF_uint32 CWriter::GetAttachmentCompressionLevel() {
+	return writer().GetAttachmentCompressionLevel();
+}
+
 std::string CWriter::GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode) {
 	auto warning = writer().warnings()->getWarning(nIndex);
 	nErrorCode = warning->getErrorCode();
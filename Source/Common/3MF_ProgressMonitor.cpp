@@ -152,6 +152,8 @@ void NMR::CProgressMonitor::GetProgressMessage(NMR::ProgressIdentifier progressI
 		case PROGRESS_WRITENODES: progressString = "Writing Nodes"; break;
 		case PROGRESS_WRITETRIANGLES: progressString = "Writing triangles"; break;
 		case PROGRESS_WRITESLICES: progressString = "Writing slices"; break;
+		case PROGRESS_WRITEKEYSTORE: progressString = "Writing key store"; break;
+		case PROGRESS_SAMPLEGRID: progressString = "Sampling grid"; break;
 		default: progressString = "Unknown Progress Identifier";
 	}
 }
@@ -36,9 +36,9 @@ NMR_Matrix.cpp implements all needed matrix calculations and transforms for
 #include "Common/Math/NMR_Vector.h" 
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_StringUtils.h" 
+#include "Common/NMR_NumberFormat.h"
 #include <cmath>
 #include <string>
-#include <sstream>
 
 namespace NMR {
 
@@ -419,18 +419,19 @@ namespace NMR {
 	}
 
 	std::string fnMATRIX3_toString(_In_ const NMATRIX3 mMatrix) {
-		std::stringstream sStream;
+		nfChar szBuffer[12 * (NMR_NUMBERFORMAT_BUFFERSIZE + 1)];
+		nfChar * pTarget = szBuffer;
 		nfInt32 i, j;
 
 		for (j = 0; j < 4; j++) {
 			for (i = 0; i < 3; i++) {
-				sStream << mMatrix.m_fields[i][j];
+				pTarget += fnFormatFloat(pTarget, mMatrix.m_fields[i][j]);
 				if ((i != 2) || (j != 3))
-					sStream << " ";
+					*(pTarget++) = ' ';
 			}
 		}
 
-		return sStream.str();
+		return std::string(szBuffer, pTarget);
 	}
 
 	NMATRIX3 fnMATRIX3_fromString(_In_ const std::string sString)
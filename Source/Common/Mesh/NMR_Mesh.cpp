@@ -44,15 +44,23 @@ structure.
 #include "Common/NMR_Exception.h" 
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 #include <cmath>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+// Relative distance to the inner hull below which a node is still treated as possible hull vertex
+#define NMR_MESH_OUTBOXHULLTOLERANCE 1.0E-5
+// Relative distance of the extreme nodes to a plane below which they lie on the plane
+#define NMR_MESH_OUTBOXPLANETOLERANCE 1.0E-7
 
 namespace NMR {
 
-	CMesh::CMesh(): m_BeamLattice(this->m_Nodes)
+	CMesh::CMesh(): m_BeamLattice(this->m_Nodes), m_nGeneration(0), m_bSanityCached(false), m_bSanity(false), m_nSanityGeneration(0), m_bOutboxCached(false), m_nOutboxGeneration(0)
 	{
 		// empty on purpose
 	}
 
-	CMesh::CMesh(_In_opt_ CMesh * pMesh) : m_BeamLattice(this->m_Nodes)
+	CMesh::CMesh(_In_opt_ CMesh * pMesh) : m_BeamLattice(this->m_Nodes), m_nGeneration(0), m_bSanityCached(false), m_bSanity(false), m_nSanityGeneration(0), m_bOutboxCached(false), m_nOutboxGeneration(0)
 	{
 		if (!pMesh)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
@@ -165,6 +173,7 @@ namespace NMR {
 
 	_Ret_notnull_ MESHNODE * CMesh::addNode(_In_ const NVEC3 vPosition)
 	{
+		markModified();
 		MESHNODE * pNode;
 		nfUint32 j;
 
@@ -188,6 +197,7 @@ namespace NMR {
 	}
 	_Ret_notnull_ MESHNODE * CMesh::addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ)
 	{
+		markModified();
 		MESHNODE * pNode;
 
 		// Check Position Validity
@@ -216,6 +226,7 @@ namespace NMR {
 
 	_Ret_notnull_ MESHFACE * CMesh::addFace(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2, _In_ MESHNODE * pNode3)
 	{
+		markModified();
 		if ((!pNode1) || (!pNode2) || (!pNode3))
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -244,6 +255,7 @@ namespace NMR {
 	
 	_Ret_notnull_ MESHFACE * CMesh::addFace(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfInt32 nNodeIndex3)
 	{
+		markModified();
 		if ((nNodeIndex1 == nNodeIndex2) || (nNodeIndex1 == nNodeIndex3) || (nNodeIndex2 == nNodeIndex3))
 			throw CNMRException(NMR_ERROR_DUPLICATENODE);
 
@@ -267,10 +279,113 @@ namespace NMR {
 		return pFace;
 	}
 
+	void CMesh::addNodes(_In_ const nfFloat * pCoordinates, _In_ nfUint32 nCount)
+	{
+		markModified();
+		if ((!pCoordinates) && (nCount > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		// Check Node Quota
+		if ((nfUint64)getNodeCount() + nCount > NMR_MESH_MAXNODECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYNODES);
+
+		// Check Position Validity
+		nfUint64 nCoordinateCount = (nfUint64)nCount * 3;
+		for (nfUint64 nIndex = 0; nIndex < nCoordinateCount; nIndex++)
+			if (fabs(pCoordinates[nIndex]) > NMR_MESH_MAXCOORDINATE)
+				throw CNMRException(NMR_ERROR_INVALIDCOORDINATES);
+
+		const nfFloat * pSource = pCoordinates;
+		m_Nodes.appendRuns(nCount, [&pSource](MESHNODE * pNodes, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				pNodes[nIndex].m_index = nFirstIndex + nIndex;
+				pNodes[nIndex].m_position.m_values.x = pSource[0];
+				pNodes[nIndex].m_position.m_values.y = pSource[1];
+				pNodes[nIndex].m_position.m_values.z = pSource[2];
+				pSource += 3;
+			}
+		});
+	}
+
+	void CMesh::addFaces(_In_ const nfUint32 * pNodeIndices, _In_ nfUint32 nCount)
+	{
+		markModified();
+		if ((!pNodeIndices) && (nCount > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint32 nFaceCount = getFaceCount();
+		if ((nfUint64)nFaceCount + nCount > NMR_MESH_MAXFACECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYFACES);
+
+		nfUint32 nNodeCount = getNodeCount();
+		const nfUint32 * pFaceIndices = pNodeIndices;
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			if ((pFaceIndices[0] >= nNodeCount) || (pFaceIndices[1] >= nNodeCount) || (pFaceIndices[2] >= nNodeCount))
+				throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
+			if ((pFaceIndices[0] == pFaceIndices[1]) || (pFaceIndices[0] == pFaceIndices[2]) || (pFaceIndices[1] == pFaceIndices[2]))
+				throw CNMRException(NMR_ERROR_DUPLICATENODE);
+			pFaceIndices += 3;
+		}
+
+		const nfUint32 * pSource = pNodeIndices;
+		m_Faces.appendRuns(nCount, [&pSource](MESHFACE * pFaces, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				pFaces[nIndex].m_index = nFirstIndex + nIndex;
+				pFaces[nIndex].m_nodeindices[0] = pSource[0];
+				pFaces[nIndex].m_nodeindices[1] = pSource[1];
+				pFaces[nIndex].m_nodeindices[2] = pSource[2];
+				pSource += 3;
+			}
+		});
+
+		if (m_pMeshInformationHandler) {
+			for (nfUint32 nIndex = 1; nIndex <= nCount; nIndex++)
+				m_pMeshInformationHandler->addFace(nFaceCount + nIndex);
+		}
+	}
+
+	void CMesh::getNodeCoordinates(_Out_ nfFloat * pCoordinates)
+	{
+		if (!pCoordinates)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfFloat * pTarget = pCoordinates;
+		m_Nodes.visitRuns([&pTarget](MESHNODE * pNodes, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				pTarget[0] = pNodes[nIndex].m_position.m_values.x;
+				pTarget[1] = pNodes[nIndex].m_position.m_values.y;
+				pTarget[2] = pNodes[nIndex].m_position.m_values.z;
+				pTarget += 3;
+			}
+		});
+	}
+
+	void CMesh::getFaceNodeIndices(_Out_ nfUint32 * pNodeIndices)
+	{
+		getFaceNodeIndices(pNodeIndices, 0, getFaceCount());
+	}
+
+	void CMesh::getFaceNodeIndices(_Out_ nfUint32 * pNodeIndices, _In_ nfUint32 nFirstFace, _In_ nfUint32 nFaceCount)
+	{
+		if (!pNodeIndices)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint32 * pTarget = pNodeIndices;
+		m_Faces.visitRuns(nFirstFace, nFaceCount, [&pTarget](MESHFACE * pFaces, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				pTarget[0] = (nfUint32)pFaces[nIndex].m_nodeindices[0];
+				pTarget[1] = (nfUint32)pFaces[nIndex].m_nodeindices[1];
+				pTarget[2] = (nfUint32)pFaces[nIndex].m_nodeindices[2];
+				pTarget += 3;
+			}
+		});
+	}
+
 	_Ret_notnull_ MESHBEAM * CMesh::addBeam(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2,
 		_In_ nfDouble dRadius1, _In_ nfDouble dRadius2,
 		_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2)
 	{
+		markModified();
 		if ((!pNode1) || (!pNode2))
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -308,6 +423,7 @@ namespace NMR {
 
 	_Ret_notnull_ MESHBALL * CMesh::addBall(_In_ MESHNODE * pNode, _In_ nfDouble dRadius)
 	{
+		markModified();
 		if ((!pNode))
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -448,6 +564,17 @@ namespace NMR {
 	}
 
 	nfBool CMesh::checkSanity()
+	{
+		if (m_bSanityCached && (m_nSanityGeneration == m_nGeneration))
+			return m_bSanity;
+
+		m_bSanity = computeSanity();
+		m_nSanityGeneration = m_nGeneration;
+		m_bSanityCached = true;
+		return m_bSanity;
+	}
+
+	nfBool CMesh::computeSanity()
 	{
 		nfUint32 nIdx, j;
 
@@ -466,26 +593,36 @@ namespace NMR {
 		if (nBallCount > NMR_MESH_MAXBALLCOUNT)
 			return false;
 
-		for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
-			MESHNODE * node = getNode(nIdx);
-			if (node->m_index != (nfInt32) nIdx)
-				return false;
-			for (j = 0; j < 3; j++)
-				if (fabs(node->m_position.m_fields[j]) > NMR_MESH_MAXCOORDINATE)
-					return false;
-		}
-
-		for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
-			MESHFACE * face = getFace(nIdx);
-			for (j = 0; j < 3; j++)
-				if ((face->m_nodeindices[j] < 0) || (((nfUint32)face->m_nodeindices[j]) >= nNodeCount))
-					return false;
+		// Nodes and faces are checked block-wise
+		nfBool bSane = true;
+		m_Nodes.visitRuns([&bSane](MESHNODE * pNodes, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				MESHNODE * node = &pNodes[nIndex];
+				if (node->m_index != (nfInt32)(nFirstIndex + nIndex))
+					bSane = false;
+				for (nfUint32 j = 0; j < 3; j++)
+					if (fabs(node->m_position.m_fields[j]) > NMR_MESH_MAXCOORDINATE)
+						bSane = false;
+			}
+		});
+		if (!bSane)
+			return false;
 
-			if ((face->m_nodeindices[0] == face->m_nodeindices[1]) ||
-				(face->m_nodeindices[0] == face->m_nodeindices[2]) ||
-				(face->m_nodeindices[1] == face->m_nodeindices[2]))
-				return false;
-		}
+		m_Faces.visitRuns([&bSane, nNodeCount](MESHFACE * pFaces, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				MESHFACE * face = &pFaces[nIndex];
+				for (nfUint32 j = 0; j < 3; j++)
+					if ((face->m_nodeindices[j] < 0) || (((nfUint32)face->m_nodeindices[j]) >= nNodeCount))
+						bSane = false;
+
+				if ((face->m_nodeindices[0] == face->m_nodeindices[1]) ||
+					(face->m_nodeindices[0] == face->m_nodeindices[2]) ||
+					(face->m_nodeindices[1] == face->m_nodeindices[2]))
+					bSane = false;
+			}
+		});
+		if (!bSane)
+			return false;
 
 		for (nIdx = 0; nIdx < nBeamCount; nIdx++) {
 			MESHBEAM * beam = getBeam(nIdx);
@@ -507,25 +644,37 @@ namespace NMR {
 
 	void CMesh::clear()
 	{
+		markModified();
 		m_pMeshInformationHandler.reset();
 		m_Faces.clearAllData();
 		m_Nodes.clearAllData();
 		clearBeamLattice();
 	}
+
+	void CMesh::reserveCapacity(_In_ nfUint32 nNodeCount, _In_ nfUint32 nFaceCount)
+	{
+		m_Nodes.reserve(std::min(nNodeCount, (nfUint32)NMR_MESH_MAXNODECOUNT));
+		m_Faces.reserve(std::min(nFaceCount, (nfUint32)NMR_MESH_MAXFACECOUNT));
+	}
+
 	
 	void CMesh::clearBeamLattice() {
+		markModified();
 		m_BeamLattice.clear();
 	}
 
 	void CMesh::clearBeamLatticeBeams() {
+		markModified();
 		m_BeamLattice.clearBeams();
 	}
 
 	void CMesh::clearBeamLatticeBalls() {
+		markModified();
 		m_BeamLattice.clearBalls();
 	}
 
 	void CMesh::scanOccupiedNodes() {
+		markModified();
 		m_BeamLattice.m_OccupiedNodes.clear();
 
 		nfUint32 beamCount = m_BeamLattice.m_Beams.getCount();
@@ -536,6 +685,7 @@ namespace NMR {
 	}
 
 	void CMesh::validateBeamLatticeBalls() {
+		markModified();
 		nfUint32 ballCount = m_BeamLattice.m_Balls.getCount();
 		MESHBALL * ballData = new MESHBALL[ballCount];
 		for (nfUint32 iBall = 0; iBall < ballCount; iBall++) {
@@ -597,17 +747,180 @@ namespace NMR {
 		return m_pMeshInformationHandler.get();
 	}
 
+	void CMesh::updateOutboxCache()
+	{
+		if (m_bOutboxCached && (m_nOutboxGeneration == m_nGeneration))
+			return;
+
+		fnOutboxInitialize(m_LocalOutbox);
+		m_OutboxVertices.clear();
+
+		// The extreme nodes in the 26 directions towards the corners, edges and faces of a cube span an inner hull
+		nfDouble Directions[26][3];
+		nfDouble ExtremeValues[26];
+		NVEC3 ExtremeNodes[26];
+		nfUint32 nDirectionCount = 0;
+		for (nfInt32 x = -1; x <= 1; x++)
+			for (nfInt32 y = -1; y <= 1; y++)
+				for (nfInt32 z = -1; z <= 1; z++) {
+					if ((x == 0) && (y == 0) && (z == 0))
+						continue;
+					Directions[nDirectionCount][0] = x;
+					Directions[nDirectionCount][1] = y;
+					Directions[nDirectionCount][2] = z;
+					ExtremeValues[nDirectionCount] = -std::numeric_limits<nfDouble>::infinity();
+					nDirectionCount++;
+				}
+
+		m_Nodes.visitRuns([&](MESHNODE * pNodes, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				const NVEC3 & vPosition = pNodes[nIndex].m_position;
+				fnOutboxMergeVector(m_LocalOutbox, vPosition);
+				for (nfUint32 nDirection = 0; nDirection < nDirectionCount; nDirection++) {
+					nfDouble dValue = Directions[nDirection][0] * vPosition.m_fields[0] + Directions[nDirection][1] * vPosition.m_fields[1] + Directions[nDirection][2] * vPosition.m_fields[2];
+					if (dValue > ExtremeValues[nDirection]) {
+						ExtremeValues[nDirection] = dValue;
+						ExtremeNodes[nDirection] = vPosition;
+					}
+				}
+			}
+		});
+
+		nfDouble dScale = 0.0;
+		if (getNodeCount() > 0) {
+			for (nfUint32 j = 0; j < 3; j++)
+				dScale = std::max(dScale, std::max(std::fabs((nfDouble)m_LocalOutbox.m_min.m_fields[j]), std::fabs((nfDouble)m_LocalOutbox.m_max.m_fields[j])));
+		}
+
+		std::vector<NVEC3> Extremes;
+		for (nfUint32 nDirection = 0; nDirection < nDirectionCount; nDirection++) {
+			if (ExtremeValues[nDirection] == -std::numeric_limits<nfDouble>::infinity())
+				continue;
+			const NVEC3 & vExtreme = ExtremeNodes[nDirection];
+			auto fnIsEqual = [&vExtreme](const NVEC3 & vOther) {
+				return (vOther.m_fields[0] == vExtreme.m_fields[0]) && (vOther.m_fields[1] == vExtreme.m_fields[1]) && (vOther.m_fields[2] == vExtreme.m_fields[2]);
+			};
+			if (std::find_if(Extremes.begin(), Extremes.end(), fnIsEqual) == Extremes.end())
+				Extremes.push_back(vExtreme);
+		}
+
+		// The inner hull is covered by tetrahedra between the centroid of the extreme nodes and every triple of them
+		// that lies on a supporting plane. Facets that are missed because of rounding only make the covered region smaller.
+		size_t nExtremeCount = Extremes.size();
+		nfDouble Centroid[3] = { 0.0, 0.0, 0.0 };
+		for (const NVEC3 & vExtreme : Extremes)
+			for (nfUint32 l = 0; l < 3; l++)
+				Centroid[l] += (nfDouble)vExtreme.m_fields[l] / nExtremeCount;
+
+		auto fnPlane = [](const nfDouble * A, const nfDouble * B, const nfDouble * C, const nfDouble * Inside) {
+			// Normalized plane through A, B and C, oriented so that Inside has a negative distance
+			std::array<nfDouble, 4> Plane = { 0.0, 0.0, 0.0, 0.0 };
+			nfDouble U[3] = { B[0] - A[0], B[1] - A[1], B[2] - A[2] };
+			nfDouble V[3] = { C[0] - A[0], C[1] - A[1], C[2] - A[2] };
+			Plane[0] = U[1] * V[2] - U[2] * V[1];
+			Plane[1] = U[2] * V[0] - U[0] * V[2];
+			Plane[2] = U[0] * V[1] - U[1] * V[0];
+			nfDouble dLength = std::sqrt(Plane[0] * Plane[0] + Plane[1] * Plane[1] + Plane[2] * Plane[2]);
+			if (!(dLength > 0.0))
+				return Plane;
+			for (nfUint32 l = 0; l < 3; l++)
+				Plane[l] /= dLength;
+			Plane[3] = Plane[0] * A[0] + Plane[1] * A[1] + Plane[2] * A[2];
+			if (Plane[0] * Inside[0] + Plane[1] * Inside[1] + Plane[2] * Inside[2] - Plane[3] > 0.0) {
+				for (nfUint32 l = 0; l < 4; l++)
+					Plane[l] = -Plane[l];
+			}
+			return Plane;
+		};
+		auto fnDistance = [](const std::array<nfDouble, 4> & Plane, const nfDouble * P) {
+			return Plane[0] * P[0] + Plane[1] * P[1] + Plane[2] * P[2] - Plane[3];
+		};
+
+		std::vector<std::array<std::array<nfDouble, 4>, 4>> Tetrahedra;
+		nfDouble dPlaneTolerance = dScale * NMR_MESH_OUTBOXPLANETOLERANCE;
+		for (size_t i = 0; i < nExtremeCount; i++)
+			for (size_t j = i + 1; j < nExtremeCount; j++)
+				for (size_t k = j + 1; k < nExtremeCount; k++) {
+					nfDouble A[3], B[3], C[3];
+					for (nfUint32 l = 0; l < 3; l++) {
+						A[l] = Extremes[i].m_fields[l];
+						B[l] = Extremes[j].m_fields[l];
+						C[l] = Extremes[k].m_fields[l];
+					}
+
+					std::array<nfDouble, 4> Facet = fnPlane(A, B, C, Centroid);
+					if (!(fnDistance(Facet, Centroid) < -dPlaneTolerance))
+						continue;
+
+					nfBool bSupporting = true;
+					for (const NVEC3 & vExtreme : Extremes) {
+						nfDouble P[3] = { vExtreme.m_fields[0], vExtreme.m_fields[1], vExtreme.m_fields[2] };
+						if (fnDistance(Facet, P) > dPlaneTolerance) {
+							bSupporting = false;
+							break;
+						}
+					}
+
+					if (bSupporting)
+						Tetrahedra.push_back({ Facet, fnPlane(Centroid, A, B, C), fnPlane(Centroid, B, C, A), fnPlane(Centroid, C, A, B) });
+				}
+
+		// Nodes clearly inside the inner hull cannot be extreme under any affine transformation
+		nfDouble dHullTolerance = dScale * NMR_MESH_OUTBOXHULLTOLERANCE;
+		m_Nodes.visitRuns([&](MESHNODE * pNodes, nfUint32 nFirstIndex, nfUint32 nRunCount) {
+			for (nfUint32 nIndex = 0; nIndex < nRunCount; nIndex++) {
+				const NVEC3 & vPosition = pNodes[nIndex].m_position;
+				nfDouble P[3] = { vPosition.m_fields[0], vPosition.m_fields[1], vPosition.m_fields[2] };
+
+				nfBool bInside = false;
+				for (auto & Tetrahedron : Tetrahedra) {
+					if ((fnDistance(Tetrahedron[0], P) < -dHullTolerance) && (fnDistance(Tetrahedron[1], P) <= 0.0) &&
+						(fnDistance(Tetrahedron[2], P) <= 0.0) && (fnDistance(Tetrahedron[3], P) <= 0.0)) {
+						bInside = true;
+						break;
+					}
+				}
+				if (!bInside)
+					m_OutboxVertices.push_back(vPosition);
+			}
+		});
+		m_OutboxVertices.shrink_to_fit();
+
+		m_nOutboxGeneration = m_nGeneration;
+		m_bOutboxCached = true;
+	}
+
+	nfUint32 CMesh::getOutboxVertexCount()
+	{
+		updateOutboxCache();
+		return (nfUint32)m_OutboxVertices.size();
+	}
+
 	void CMesh::extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix)
 	{
+		updateOutboxCache();
+		if (getNodeCount() == 0)
+			return;
+
 		if (fnMATRIX3_isIdentity(mAccumulatedMatrix)) {
-			for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
-				fnOutboxMergeVector(vOutBox, getNode(iNode)->m_position);
-			}
+			fnOutboxMergeOutbox(vOutBox, m_LocalOutbox);
+			return;
+		}
+
+		// A translation keeps the order of the coordinates, so the corners of the local outbox give the exact result
+		nfBool bIsTranslation = true;
+		for (nfUint32 i = 0; i < 3; i++)
+			for (nfUint32 j = 0; j < 3; j++)
+				if (mAccumulatedMatrix.m_fields[i][j] != ((i == j) ? 1.0f : 0.0f))
+					bIsTranslation = false;
+
+		if (bIsTranslation) {
+			fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, m_LocalOutbox.m_min));
+			fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, m_LocalOutbox.m_max));
 		}
 		else {
-			for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
-				fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, getNode(iNode)->m_position));
-			}
+			for (const NVEC3 & vPosition : m_OutboxVertices)
+				fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, vPosition));
 		}
 	}
 }
@@ -0,0 +1,184 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_MeshEdgeTopology.cpp implements the class CMeshEdgeTopology.
+
+--*/
+
+#include "Common/Mesh/NMR_MeshEdgeTopology.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_ParallelJobs.h"
+
+#include <algorithm>
+
+// Faces per thread below which no further threads are used
+#define NMR_MESHEDGETOPOLOGY_MINFACESPERTHREAD (1 << 18)
+// Faces whose node indices are copied at once
+#define NMR_MESHEDGETOPOLOGY_FACEBATCHSIZE 1024
+// Key counts below this are sorted with std::sort
+#define NMR_MESHEDGETOPOLOGY_MINRADIXSORTKEYS (1 << 16)
+#define NMR_MESHEDGETOPOLOGY_RADIXBITS 16
+#define NMR_MESHEDGETOPOLOGY_RADIXSIZE (1 << NMR_MESHEDGETOPOLOGY_RADIXBITS)
+
+namespace NMR {
+
+	CMeshEdgeTopology::CMeshEdgeTopology(_In_ CMesh * pMesh, _In_ nfUint32 nThreadCount)
+	{
+		if (!pMesh)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pMesh = pMesh;
+		m_nThreadCount = nThreadCount;
+	}
+
+	void CMeshEdgeTopology::createEdgeKeys(_Out_ std::vector<nfUint64> & Keys, _In_ nfUint32 nThreadCount)
+	{
+		nfUint64 nNodeCount = m_pMesh->getNodeCount();
+		nfUint32 nFaceCount = m_pMesh->getFaceCount();
+		Keys.resize((size_t)nFaceCount * 3);
+
+		fnRunParallelJobs(nThreadCount, [&](nfUint32 nThreadIndex) {
+			nfUint32 nFirstFace = (nfUint32)((nfUint64)nFaceCount * nThreadIndex / nThreadCount);
+			nfUint32 nEndFace = (nfUint32)((nfUint64)nFaceCount * (nThreadIndex + 1) / nThreadCount);
+
+			nfUint32 NodeIndices[NMR_MESHEDGETOPOLOGY_FACEBATCHSIZE * 3];
+			nfUint64 * pKey = &Keys[(size_t)nFirstFace * 3];
+
+			for (nfUint32 nBatchStart = nFirstFace; nBatchStart < nEndFace; nBatchStart += NMR_MESHEDGETOPOLOGY_FACEBATCHSIZE) {
+				nfUint32 nBatchCount = std::min(nEndFace - nBatchStart, (nfUint32)NMR_MESHEDGETOPOLOGY_FACEBATCHSIZE);
+				m_pMesh->getFaceNodeIndices(NodeIndices, nBatchStart, nBatchCount);
+
+				for (nfUint32 nIndex = 0; nIndex < nBatchCount * 3; nIndex++) {
+					nfUint64 nNode1 = NodeIndices[nIndex];
+					nfUint64 nNode2 = NodeIndices[(nIndex % 3 == 2) ? nIndex - 2 : nIndex + 1];
+
+					// The key orders the edges by their nodes, the lowest bit is the direction of the edge
+					if (nNode1 < nNode2)
+						*(pKey++) = (nNode1 * nNodeCount + nNode2) << 1;
+					else
+						*(pKey++) = ((nNode2 * nNodeCount + nNode1) << 1) | 1;
+				}
+			}
+		});
+	}
+
+	void CMeshEdgeTopology::sortEdgeKeys(_Inout_ std::vector<nfUint64> & Keys, _In_ nfUint64 nMaxKey, _In_ nfUint32 nThreadCount)
+	{
+		size_t nKeyCount = Keys.size();
+		if (nKeyCount < NMR_MESHEDGETOPOLOGY_MINRADIXSORTKEYS) {
+			std::sort(Keys.begin(), Keys.end());
+			return;
+		}
+
+		nfUint32 nKeyBits = 0;
+		while ((nKeyBits < 64) && ((nMaxKey >> nKeyBits) != 0))
+			nKeyBits++;
+
+		std::vector<nfUint64> Buffer(nKeyCount);
+		std::vector<std::vector<size_t>> Offsets(nThreadCount, std::vector<size_t>(NMR_MESHEDGETOPOLOGY_RADIXSIZE));
+		nfUint64 * pSource = Keys.data();
+		nfUint64 * pTarget = Buffer.data();
+
+		// Least significant digit first, every pass is stable
+		for (nfUint32 nShift = 0; nShift < nKeyBits; nShift += NMR_MESHEDGETOPOLOGY_RADIXBITS) {
+			fnRunParallelJobs(nThreadCount, [&](nfUint32 nThreadIndex) {
+				size_t nFirst = nKeyCount * nThreadIndex / nThreadCount;
+				size_t nEnd = nKeyCount * (nThreadIndex + 1) / nThreadCount;
+				std::vector<size_t> & Counts = Offsets[nThreadIndex];
+				std::fill(Counts.begin(), Counts.end(), 0);
+				for (size_t nIndex = nFirst; nIndex < nEnd; nIndex++)
+					Counts[(pSource[nIndex] >> nShift) & (NMR_MESHEDGETOPOLOGY_RADIXSIZE - 1)]++;
+			});
+
+			// Turn the counts into the target positions of every thread and digit
+			size_t nOffset = 0;
+			nfBool bSingleDigit = false;
+			for (nfUint32 nDigit = 0; nDigit < NMR_MESHEDGETOPOLOGY_RADIXSIZE; nDigit++) {
+				size_t nDigitStart = nOffset;
+				for (nfUint32 nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++) {
+					size_t nCount = Offsets[nThreadIndex][nDigit];
+					Offsets[nThreadIndex][nDigit] = nOffset;
+					nOffset += nCount;
+				}
+				if (nOffset - nDigitStart == nKeyCount)
+					bSingleDigit = true;
+			}
+
+			// All keys share the digit, the order does not change
+			if (bSingleDigit)
+				continue;
+
+			fnRunParallelJobs(nThreadCount, [&](nfUint32 nThreadIndex) {
+				size_t nFirst = nKeyCount * nThreadIndex / nThreadCount;
+				size_t nEnd = nKeyCount * (nThreadIndex + 1) / nThreadCount;
+				std::vector<size_t> & Positions = Offsets[nThreadIndex];
+				for (size_t nIndex = nFirst; nIndex < nEnd; nIndex++) {
+					nfUint64 nKey = pSource[nIndex];
+					pTarget[Positions[(nKey >> nShift) & (NMR_MESHEDGETOPOLOGY_RADIXSIZE - 1)]++] = nKey;
+				}
+			});
+
+			std::swap(pSource, pTarget);
+		}
+
+		if (pSource != Keys.data())
+			Keys.swap(Buffer);
+	}
+
+	nfBool CMeshEdgeTopology::isManifoldAndOriented()
+	{
+		nfUint64 nNodeCount = m_pMesh->getNodeCount();
+		nfUint32 nFaceCount = m_pMesh->getFaceCount();
+		if ((nNodeCount < 3) || (nFaceCount < 3))
+			return false;
+
+		nfUint32 nThreadCount = m_nThreadCount;
+		if (nThreadCount == 0)
+			nThreadCount = fnGetParallelJobCount(nFaceCount, NMR_MESHEDGETOPOLOGY_MINFACESPERTHREAD);
+		nThreadCount = std::min(nThreadCount, nFaceCount);
+
+		std::vector<nfUint64> Keys;
+		createEdgeKeys(Keys, nThreadCount);
+		sortEdgeKeys(Keys, ((nNodeCount * nNodeCount) << 1) - 1, nThreadCount);
+
+		// Every edge must appear exactly twice, once in each direction
+		size_t nKeyCount = Keys.size();
+		if ((nKeyCount % 2) != 0)
+			return false;
+		for (size_t nIndex = 0; nIndex < nKeyCount; nIndex += 2) {
+			if ((Keys[nIndex] & 1) != 0)
+				return false;
+			if (Keys[nIndex + 1] != Keys[nIndex] + 1)
+				return false;
+		}
+
+		// Mesh is non-empty, oriented and manifold
+		return true;
+	}
+
+}
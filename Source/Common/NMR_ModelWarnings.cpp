@@ -92,6 +92,15 @@ namespace NMR {
 			throw Exception;
 	}
 
+	void CModelWarnings::appendWarnings(_In_ CModelWarnings & Warnings)
+	{
+		for (auto pWarning : Warnings.m_Warnings) {
+			if (m_Warnings.size() >= NMR_MAXWARNINGCOUNT)
+				break;
+			m_Warnings.push_back(pWarning);
+		}
+	}
+
 	nfUint32 CModelWarnings::getWarningCount()
 	{
 		return (nfUint32)m_Warnings.size();
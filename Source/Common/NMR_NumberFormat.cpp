@@ -0,0 +1,170 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_NumberFormat.cpp implements the number formatting of the model writers.
+
+--*/
+
+#include "Common/NMR_NumberFormat.h"
+#include "Common/NMR_Exception.h"
+
+#include <charconv>
+
+namespace NMR {
+
+	// Decimal representations of 00 to 99
+	static const nfChar NMR_DIGITPAIRS[201] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+	static __NMR_INLINE nfUint32 fnCountDigits(_In_ nfUint64 nValue)
+	{
+		nfUint32 nCount = 1;
+		while (true) {
+			if (nValue < 10)
+				return nCount;
+			if (nValue < 100)
+				return nCount + 1;
+			if (nValue < 1000)
+				return nCount + 2;
+			if (nValue < 10000)
+				return nCount + 3;
+			nValue /= 10000;
+			nCount += 4;
+		}
+	}
+
+	// Writes exactly nDigits digits of nValue backwards, ending before pEnd
+	static __NMR_INLINE void fnWriteDigitsBackwards(_In_ nfChar * pEnd, _In_ nfUint64 nValue, _In_ nfUint32 nDigits)
+	{
+		while (nDigits >= 2) {
+			const nfChar * pPair = &NMR_DIGITPAIRS[(nValue % 100) * 2];
+			nValue /= 100;
+			*(--pEnd) = pPair[1];
+			*(--pEnd) = pPair[0];
+			nDigits -= 2;
+		}
+		if (nDigits > 0)
+			*(--pEnd) = (nfChar)('0' + (nValue % 10));
+	}
+
+	nfUint32 fnFormatUInt64(_Out_ nfChar * pBuffer, _In_ nfUint64 nValue)
+	{
+		__NMRASSERT(pBuffer);
+		nfUint32 nDigits = fnCountDigits(nValue);
+		fnWriteDigitsBackwards(pBuffer + nDigits, nValue, nDigits);
+		return nDigits;
+	}
+
+	nfUint32 fnFormatUInt32(_Out_ nfChar * pBuffer, _In_ nfUint32 nValue)
+	{
+		return fnFormatUInt64(pBuffer, nValue);
+	}
+
+	nfUint32 fnFormatInt32(_Out_ nfChar * pBuffer, _In_ nfInt32 nValue)
+	{
+		__NMRASSERT(pBuffer);
+		if (nValue < 0) {
+			*pBuffer = '-';
+			return 1 + fnFormatUInt64(pBuffer + 1, (nfUint64)(-(nfInt64)nValue));
+		}
+		return fnFormatUInt64(pBuffer, (nfUint64)nValue);
+	}
+
+	nfUint32 fnFormatFixedPoint(_Out_ nfChar * pBuffer, _In_ nfUint64 nAbsScaledValue, _In_ nfBool bIsNegative, _In_ nfUint32 nDecimals)
+	{
+		__NMRASSERT(pBuffer);
+		__NMRASSERT((nDecimals >= 1) && (nDecimals <= 18));
+
+		if (nAbsScaledValue == 0) {
+			*pBuffer = '0';
+			return 1;
+		}
+
+		nfUint64 nDivisor = 1;
+		for (nfUint32 nIndex = 0; nIndex < nDecimals; nIndex++)
+			nDivisor *= 10;
+
+		nfUint64 nIntegerPart = nAbsScaledValue / nDivisor;
+		nfUint64 nFractionalPart = nAbsScaledValue % nDivisor;
+
+		nfChar * pTarget = pBuffer;
+		if (bIsNegative)
+			*(pTarget++) = '-';
+
+		pTarget += fnFormatUInt64(pTarget, nIntegerPart);
+		*(pTarget++) = '.';
+		fnWriteDigitsBackwards(pTarget + nDecimals, nFractionalPart, nDecimals);
+		pTarget += nDecimals;
+
+		return (nfUint32)(pTarget - pBuffer);
+	}
+
+	nfUint32 fnFormatFloatFixed(_Out_ nfChar * pBuffer, _In_ nfFloat fValue, _In_ nfInt64 nFactor, _In_ nfUint32 nDecimals)
+	{
+		// The product is computed in single precision, as the value is stored in single precision
+		nfInt64 nScaledValue = (nfInt64)(fValue * nFactor);
+		nfUint64 nAbsScaledValue = (nScaledValue < 0) ? (nfUint64)(-nScaledValue) : (nfUint64)nScaledValue;
+		return fnFormatFixedPoint(pBuffer, nAbsScaledValue, fValue < 0, nDecimals);
+	}
+
+	nfUint32 fnFormatDoubleFixed(_Out_ nfChar * pBuffer, _In_ nfDouble dValue, _In_ nfInt64 nFactor, _In_ nfUint32 nDecimals)
+	{
+		nfInt64 nScaledValue = (nfInt64)(dValue * nFactor);
+		nfUint64 nAbsScaledValue = (nScaledValue < 0) ? (nfUint64)(-nScaledValue) : (nfUint64)nScaledValue;
+		return fnFormatFixedPoint(pBuffer, nAbsScaledValue, dValue < 0, nDecimals);
+	}
+
+	template <typename T> static nfUint32 fnFormatGeneral(_Out_ nfChar * pBuffer, _In_ T value)
+	{
+		__NMRASSERT(pBuffer);
+		std::to_chars_result result = std::to_chars(pBuffer, pBuffer + NMR_NUMBERFORMAT_BUFFERSIZE, value, std::chars_format::general, 6);
+		if (result.ec != std::errc())
+			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
+		return (nfUint32)(result.ptr - pBuffer);
+	}
+
+	nfUint32 fnFormatFloat(_Out_ nfChar * pBuffer, _In_ nfFloat fValue)
+	{
+		return fnFormatGeneral(pBuffer, fValue);
+	}
+
+	nfUint32 fnFormatDouble(_Out_ nfChar * pBuffer, _In_ nfDouble dValue)
+	{
+		return fnFormatGeneral(pBuffer, dValue);
+	}
+
+}
@@ -0,0 +1,425 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_PNGDecoder.cpp implements a PNG decoder on top of zlib. It supports all
+color types, bit depths and the Adam7 interlacing of the PNG specification.
+Ancillary chunks other than tRNS are ignored.
+
+--*/
+
+#include "Common/NMR_PNGDecoder.h"
+#include "Common/NMR_Exception.h"
+
+#include "zlib.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NMR {
+
+	namespace {
+
+		const nfByte PNG_SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+		// Decoded images must fit into memory several times
+		const nfUint64 PNG_MAXPIXELCOUNT = 1ULL << 28;
+
+		const nfUint32 PNG_COLORTYPE_GRAY = 0;
+		const nfUint32 PNG_COLORTYPE_RGB = 2;
+		const nfUint32 PNG_COLORTYPE_PALETTE = 3;
+		const nfUint32 PNG_COLORTYPE_GRAYALPHA = 4;
+		const nfUint32 PNG_COLORTYPE_RGBA = 6;
+
+		// Start and step of the seven Adam7 passes
+		const nfUint32 ADAM7_STARTX[7] = { 0, 4, 0, 2, 0, 1, 0 };
+		const nfUint32 ADAM7_STARTY[7] = { 0, 0, 4, 0, 2, 0, 1 };
+		const nfUint32 ADAM7_STEPX[7] = { 8, 8, 4, 4, 2, 2, 1 };
+		const nfUint32 ADAM7_STEPY[7] = { 8, 8, 8, 4, 4, 2, 2 };
+
+		void fnCheckPNG(nfBool bCondition)
+		{
+			if (!bCondition)
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+		}
+
+		nfUint32 fnReadBigEndian32(const nfByte * pData)
+		{
+			return ((nfUint32)pData[0] << 24) | ((nfUint32)pData[1] << 16) | ((nfUint32)pData[2] << 8) | (nfUint32)pData[3];
+		}
+
+		nfUint32 fnChannelCount(nfUint32 nColorType)
+		{
+			switch (nColorType) {
+			case PNG_COLORTYPE_GRAY: return 1;
+			case PNG_COLORTYPE_RGB: return 3;
+			case PNG_COLORTYPE_PALETTE: return 1;
+			case PNG_COLORTYPE_GRAYALPHA: return 2;
+			case PNG_COLORTYPE_RGBA: return 4;
+			default: break;
+			}
+			throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+		}
+
+		// A sub image of the raw data, the whole image or one Adam7 pass
+		typedef struct {
+			nfUint32 m_nStartX;
+			nfUint32 m_nStartY;
+			nfUint32 m_nStepX;
+			nfUint32 m_nStepY;
+			nfUint32 m_nWidth;
+			nfUint32 m_nHeight;
+			nfUint64 m_cbRow;
+		} sPNGPass;
+
+		// Reverses the row filters of a pass in place. Every row starts with its filter type.
+		void fnUnfilterPass(nfByte * pData, const sPNGPass & Pass, nfUint32 nBytesPerPixel)
+		{
+			const nfByte * pPrevious = nullptr;
+			for (nfUint32 nRow = 0; nRow < Pass.m_nHeight; nRow++) {
+				nfByte nFilter = pData[0];
+				nfByte * pRow = pData + 1;
+				nfUint64 cbRow = Pass.m_cbRow;
+
+				switch (nFilter) {
+				case 0:
+					break;
+				case 1:
+					for (nfUint64 nIndex = nBytesPerPixel; nIndex < cbRow; nIndex++)
+						pRow[nIndex] = (nfByte)(pRow[nIndex] + pRow[nIndex - nBytesPerPixel]);
+					break;
+				case 2:
+					if (pPrevious != nullptr) {
+						for (nfUint64 nIndex = 0; nIndex < cbRow; nIndex++)
+							pRow[nIndex] = (nfByte)(pRow[nIndex] + pPrevious[nIndex]);
+					}
+					break;
+				case 3:
+					for (nfUint64 nIndex = 0; nIndex < cbRow; nIndex++) {
+						nfUint32 nLeft = (nIndex >= nBytesPerPixel) ? pRow[nIndex - nBytesPerPixel] : 0;
+						nfUint32 nUp = (pPrevious != nullptr) ? pPrevious[nIndex] : 0;
+						pRow[nIndex] = (nfByte)(pRow[nIndex] + ((nLeft + nUp) >> 1));
+					}
+					break;
+				case 4:
+					for (nfUint64 nIndex = 0; nIndex < cbRow; nIndex++) {
+						nfInt32 nLeft = (nIndex >= nBytesPerPixel) ? pRow[nIndex - nBytesPerPixel] : 0;
+						nfInt32 nUp = (pPrevious != nullptr) ? pPrevious[nIndex] : 0;
+						nfInt32 nUpLeft = ((pPrevious != nullptr) && (nIndex >= nBytesPerPixel)) ? pPrevious[nIndex - nBytesPerPixel] : 0;
+						nfInt32 nEstimate = nLeft + nUp - nUpLeft;
+						nfInt32 nDistanceLeft = std::abs(nEstimate - nLeft);
+						nfInt32 nDistanceUp = std::abs(nEstimate - nUp);
+						nfInt32 nDistanceUpLeft = std::abs(nEstimate - nUpLeft);
+						nfInt32 nPredictor;
+						if ((nDistanceLeft <= nDistanceUp) && (nDistanceLeft <= nDistanceUpLeft))
+							nPredictor = nLeft;
+						else if (nDistanceUp <= nDistanceUpLeft)
+							nPredictor = nUp;
+						else
+							nPredictor = nUpLeft;
+						pRow[nIndex] = (nfByte)(pRow[nIndex] + nPredictor);
+					}
+					break;
+				default:
+					throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				}
+
+				pPrevious = pRow;
+				pData += cbRow + 1;
+			}
+		}
+
+		// Sample nIndex of an unfiltered row
+		nfUint32 fnReadSample(const nfByte * pRow, nfUint64 nIndex, nfUint32 nBitDepth)
+		{
+			switch (nBitDepth) {
+			case 16:
+				return ((nfUint32)pRow[2 * nIndex] << 8) | pRow[2 * nIndex + 1];
+			case 8:
+				return pRow[nIndex];
+			default:
+			{
+				nfUint64 nBit = nIndex * nBitDepth;
+				nfUint32 nShift = 8 - nBitDepth - (nfUint32)(nBit & 7);
+				return (pRow[nBit >> 3] >> nShift) & ((1u << nBitDepth) - 1);
+			}
+			}
+		}
+
+		class CPNGReader {
+		private:
+			nfUint32 m_nWidth = 0;
+			nfUint32 m_nHeight = 0;
+			nfUint32 m_nBitDepth = 0;
+			nfUint32 m_nColorType = 0;
+			nfBool m_bInterlaced = false;
+
+			std::vector<nfByte> m_Compressed;
+			std::vector<nfByte> m_Palette;
+			std::vector<nfByte> m_Transparency;
+			nfBool m_bHasTransparency = false;
+
+			void readHeader(const nfByte * pData, nfUint32 cbLength)
+			{
+				fnCheckPNG(cbLength == 13);
+				m_nWidth = fnReadBigEndian32(pData);
+				m_nHeight = fnReadBigEndian32(pData + 4);
+				m_nBitDepth = pData[8];
+				m_nColorType = pData[9];
+				fnCheckPNG((pData[10] == 0) && (pData[11] == 0) && (pData[12] <= 1));
+				m_bInterlaced = (pData[12] == 1);
+
+				fnCheckPNG((m_nWidth > 0) && (m_nHeight > 0));
+				fnCheckPNG((nfUint64)m_nWidth * m_nHeight <= PNG_MAXPIXELCOUNT);
+
+				nfBool bValidDepth;
+				switch (m_nColorType) {
+				case PNG_COLORTYPE_GRAY:
+					bValidDepth = (m_nBitDepth == 1) || (m_nBitDepth == 2) || (m_nBitDepth == 4) || (m_nBitDepth == 8) || (m_nBitDepth == 16);
+					break;
+				case PNG_COLORTYPE_PALETTE:
+					bValidDepth = (m_nBitDepth == 1) || (m_nBitDepth == 2) || (m_nBitDepth == 4) || (m_nBitDepth == 8);
+					break;
+				case PNG_COLORTYPE_RGB:
+				case PNG_COLORTYPE_GRAYALPHA:
+				case PNG_COLORTYPE_RGBA:
+					bValidDepth = (m_nBitDepth == 8) || (m_nBitDepth == 16);
+					break;
+				default:
+					bValidDepth = false;
+				}
+				fnCheckPNG(bValidDepth);
+			}
+
+			sPNGPass getPass(nfUint32 nPass) const
+			{
+				sPNGPass Pass;
+				if (m_bInterlaced) {
+					Pass.m_nStartX = ADAM7_STARTX[nPass];
+					Pass.m_nStartY = ADAM7_STARTY[nPass];
+					Pass.m_nStepX = ADAM7_STEPX[nPass];
+					Pass.m_nStepY = ADAM7_STEPY[nPass];
+				}
+				else {
+					Pass.m_nStartX = 0;
+					Pass.m_nStartY = 0;
+					Pass.m_nStepX = 1;
+					Pass.m_nStepY = 1;
+				}
+				Pass.m_nWidth = (m_nWidth > Pass.m_nStartX) ? (m_nWidth - Pass.m_nStartX + Pass.m_nStepX - 1) / Pass.m_nStepX : 0;
+				Pass.m_nHeight = (m_nHeight > Pass.m_nStartY) ? (m_nHeight - Pass.m_nStartY + Pass.m_nStepY - 1) / Pass.m_nStepY : 0;
+				if (Pass.m_nWidth == 0)
+					Pass.m_nHeight = 0;
+				Pass.m_cbRow = ((nfUint64)Pass.m_nWidth * fnChannelCount(m_nColorType) * m_nBitDepth + 7) / 8;
+				return Pass;
+			}
+
+			void inflateData(nfByte * pBuffer, nfUint64 cbSize)
+			{
+				z_stream Stream;
+				memset(&Stream, 0, sizeof(Stream));
+				if (inflateInit(&Stream) != Z_OK)
+					throw CNMRException(NMR_ERROR_COULDNOTINITINFLATE);
+
+				// zlib counts in 32 bit, so large images are inflated in several steps
+				const nfUint64 cbMaxStep = 1ULL << 30;
+				nfUint64 cbConsumed = 0;
+				nfUint64 cbProduced = 0;
+				nfInt32 nResult = Z_OK;
+				while ((nResult == Z_OK) && (cbProduced < cbSize)) {
+					nfUint64 cbIn = std::min(cbMaxStep, (nfUint64)m_Compressed.size() - cbConsumed);
+					nfUint64 cbOut = std::min(cbMaxStep, cbSize - cbProduced);
+					Stream.next_in = m_Compressed.data() + cbConsumed;
+					Stream.avail_in = (uInt)cbIn;
+					Stream.next_out = pBuffer + cbProduced;
+					Stream.avail_out = (uInt)cbOut;
+					nResult = inflate(&Stream, Z_NO_FLUSH);
+					cbConsumed += cbIn - Stream.avail_in;
+					cbProduced += cbOut - Stream.avail_out;
+					if ((nResult == Z_BUF_ERROR) && (cbIn == 0))
+						break;
+					if (nResult == Z_BUF_ERROR)
+						nResult = Z_OK;
+				}
+				(void)inflateEnd(&Stream);
+
+				if (((nResult != Z_OK) && (nResult != Z_STREAM_END)) || (cbProduced != cbSize))
+					throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+			}
+
+			void convertPass(const nfByte * pData, const sPNGPass & Pass, sPNGImage & Image) const
+			{
+				nfUint32 nChannels = fnChannelCount(m_nColorType);
+				nfUint32 nMaxSample = (1u << m_nBitDepth) - 1;
+				nfUint32 nPaletteSize = (nfUint32)(m_Palette.size() / 3);
+
+				// Color key of tRNS for gray and RGB images, in raw sample values
+				nfUint32 nKey[3] = { 0xffffffff, 0xffffffff, 0xffffffff };
+				if (m_bHasTransparency && (m_nColorType == PNG_COLORTYPE_GRAY)) {
+					fnCheckPNG(m_Transparency.size() >= 2);
+					nKey[0] = ((nfUint32)m_Transparency[0] << 8) | m_Transparency[1];
+				}
+				if (m_bHasTransparency && (m_nColorType == PNG_COLORTYPE_RGB)) {
+					fnCheckPNG(m_Transparency.size() >= 6);
+					for (nfUint32 nChannel = 0; nChannel < 3; nChannel++)
+						nKey[nChannel] = ((nfUint32)m_Transparency[2 * nChannel] << 8) | m_Transparency[2 * nChannel + 1];
+				}
+
+				for (nfUint32 nRow = 0; nRow < Pass.m_nHeight; nRow++) {
+					const nfByte * pRow = pData + nRow * (Pass.m_cbRow + 1) + 1;
+					nfUint64 nY = Pass.m_nStartY + (nfUint64)nRow * Pass.m_nStepY;
+					for (nfUint32 nColumn = 0; nColumn < Pass.m_nWidth; nColumn++) {
+						nfUint64 nX = Pass.m_nStartX + (nfUint64)nColumn * Pass.m_nStepX;
+						nfUint16 * pPixel = &Image.m_RGBA[(nY * m_nWidth + nX) * 4];
+
+						nfUint32 nSamples[4];
+						for (nfUint32 nChannel = 0; nChannel < nChannels; nChannel++)
+							nSamples[nChannel] = fnReadSample(pRow, (nfUint64)nColumn * nChannels + nChannel, m_nBitDepth);
+
+						switch (m_nColorType) {
+						case PNG_COLORTYPE_GRAY:
+						{
+							nfUint16 nGray = (nfUint16)(nSamples[0] * 65535 / nMaxSample);
+							pPixel[0] = pPixel[1] = pPixel[2] = nGray;
+							pPixel[3] = (nSamples[0] == nKey[0]) ? 0 : 65535;
+							break;
+						}
+						case PNG_COLORTYPE_RGB:
+							for (nfUint32 nChannel = 0; nChannel < 3; nChannel++)
+								pPixel[nChannel] = (nfUint16)(nSamples[nChannel] * 65535 / nMaxSample);
+							pPixel[3] = ((nSamples[0] == nKey[0]) && (nSamples[1] == nKey[1]) && (nSamples[2] == nKey[2])) ? 0 : 65535;
+							break;
+						case PNG_COLORTYPE_PALETTE:
+							fnCheckPNG(nSamples[0] < nPaletteSize);
+							for (nfUint32 nChannel = 0; nChannel < 3; nChannel++)
+								pPixel[nChannel] = (nfUint16)(m_Palette[3 * nSamples[0] + nChannel] * 257);
+							pPixel[3] = (nSamples[0] < m_Transparency.size()) ? (nfUint16)(m_Transparency[nSamples[0]] * 257) : 65535;
+							break;
+						case PNG_COLORTYPE_GRAYALPHA:
+						{
+							nfUint16 nGray = (nfUint16)(nSamples[0] * 65535 / nMaxSample);
+							pPixel[0] = pPixel[1] = pPixel[2] = nGray;
+							pPixel[3] = (nfUint16)(nSamples[1] * 65535 / nMaxSample);
+							break;
+						}
+						default:
+							for (nfUint32 nChannel = 0; nChannel < 4; nChannel++)
+								pPixel[nChannel] = (nfUint16)(nSamples[nChannel] * 65535 / nMaxSample);
+							break;
+						}
+					}
+				}
+			}
+
+		public:
+			void read(const nfByte * pData, nfUint64 cbSize)
+			{
+				fnCheckPNG((pData != nullptr) && (cbSize >= 8) && (memcmp(pData, PNG_SIGNATURE, 8) == 0));
+
+				nfUint64 nPosition = 8;
+				nfBool bHasHeader = false;
+				nfBool bHasEnd = false;
+				while (!bHasEnd) {
+					fnCheckPNG(cbSize - nPosition >= 12);
+					nfUint32 cbLength = fnReadBigEndian32(pData + nPosition);
+					fnCheckPNG(cbLength <= cbSize - nPosition - 12);
+					const nfByte * pType = pData + nPosition + 4;
+					const nfByte * pChunk = pType + 4;
+					nfUint32 nCRC = fnReadBigEndian32(pChunk + cbLength);
+					fnCheckPNG(crc32(crc32(0L, Z_NULL, 0), pType, cbLength + 4) == nCRC);
+
+					if (memcmp(pType, "IHDR", 4) == 0) {
+						fnCheckPNG(!bHasHeader);
+						readHeader(pChunk, cbLength);
+						bHasHeader = true;
+					}
+					else {
+						fnCheckPNG(bHasHeader);
+						if (memcmp(pType, "PLTE", 4) == 0) {
+							fnCheckPNG((cbLength % 3 == 0) && (cbLength <= 3 * 256));
+							m_Palette.assign(pChunk, pChunk + cbLength);
+						}
+						else if (memcmp(pType, "tRNS", 4) == 0) {
+							m_Transparency.assign(pChunk, pChunk + cbLength);
+							m_bHasTransparency = true;
+						}
+						else if (memcmp(pType, "IDAT", 4) == 0) {
+							m_Compressed.insert(m_Compressed.end(), pChunk, pChunk + cbLength);
+						}
+						else if (memcmp(pType, "IEND", 4) == 0) {
+							bHasEnd = true;
+						}
+						else {
+							// Unknown critical chunks change the meaning of the image
+							fnCheckPNG((pType[0] & 0x20) != 0);
+						}
+					}
+
+					nPosition += (nfUint64)cbLength + 12;
+				}
+				fnCheckPNG(!m_Compressed.empty());
+				fnCheckPNG((m_nColorType != PNG_COLORTYPE_PALETTE) || !m_Palette.empty());
+			}
+
+			void decode(sPNGImage & Image)
+			{
+				nfUint32 nPassCount = m_bInterlaced ? 7 : 1;
+				nfUint64 cbRaw = 0;
+				for (nfUint32 nPass = 0; nPass < nPassCount; nPass++) {
+					sPNGPass Pass = getPass(nPass);
+					cbRaw += (Pass.m_cbRow + 1) * Pass.m_nHeight;
+				}
+
+				std::vector<nfByte> Raw((size_t)cbRaw);
+				inflateData(Raw.data(), cbRaw);
+				m_Compressed.clear();
+
+				Image.m_nWidth = m_nWidth;
+				Image.m_nHeight = m_nHeight;
+				Image.m_RGBA.resize((size_t)m_nWidth * m_nHeight * 4);
+
+				nfUint32 nBytesPerPixel = std::max(1u, fnChannelCount(m_nColorType) * m_nBitDepth / 8);
+				nfByte * pPassData = Raw.data();
+				for (nfUint32 nPass = 0; nPass < nPassCount; nPass++) {
+					sPNGPass Pass = getPass(nPass);
+					fnUnfilterPass(pPassData, Pass, nBytesPerPixel);
+					convertPass(pPassData, Pass, Image);
+					pPassData += (Pass.m_cbRow + 1) * Pass.m_nHeight;
+				}
+			}
+		};
+
+	}
+
+	void fnDecodePNG(_In_ const nfByte * pData, _In_ nfUint64 cbSize, _Out_ sPNGImage & Image)
+	{
+		CPNGReader Reader;
+		Reader.read(pData, cbSize);
+		Reader.decode(Image);
+	}
+
+}
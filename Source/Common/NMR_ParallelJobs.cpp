@@ -0,0 +1,186 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ParallelJobs.cpp implements the parallel job helper.
+
+--*/
+
+#include "Common/NMR_ParallelJobs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace NMR {
+
+	void fnRunParallelJobs(_In_ nfUint32 nJobCount, _In_ const std::function<void(nfUint32)> & fnJob)
+	{
+		std::vector<std::exception_ptr> Exceptions(nJobCount);
+		auto fnRunJob = [&fnJob, &Exceptions](nfUint32 nJobIndex) {
+			try {
+				fnJob(nJobIndex);
+			}
+			catch (...) {
+				Exceptions[nJobIndex] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> Threads;
+		Threads.reserve(nJobCount);
+		nfUint32 nJobIndex = 1;
+		try {
+			for (; nJobIndex < nJobCount; nJobIndex++)
+				Threads.push_back(std::thread(fnRunJob, nJobIndex));
+		}
+		catch (std::system_error &) {
+			// The jobs of the threads that could not be created run below
+		}
+
+		for (nfUint32 nIndex = nJobIndex; nIndex < nJobCount; nIndex++)
+			fnRunJob(nIndex);
+		if (nJobCount > 0)
+			fnRunJob(0);
+
+		for (std::thread & Thread : Threads)
+			Thread.join();
+
+		for (std::exception_ptr & pException : Exceptions)
+			if (pException)
+				std::rethrow_exception(pException);
+	}
+
+	namespace {
+
+		// Items [begin, end) that a job has not started yet, packed into one word so that the
+		// owner and thieves can update both bounds with a single compare and swap
+		struct alignas(64) CItemRange {
+			std::atomic<nfUint64> m_nRange;
+		};
+
+		nfUint64 fnPackRange(nfUint32 nBegin, nfUint32 nEnd)
+		{
+			return ((nfUint64)nEnd << 32) | nBegin;
+		}
+
+		nfUint32 fnRangeBegin(nfUint64 nRange)
+		{
+			return (nfUint32)(nRange & 0xffffffff);
+		}
+
+		nfUint32 fnRangeEnd(nfUint64 nRange)
+		{
+			return (nfUint32)(nRange >> 32);
+		}
+
+		// Takes the first item of the own range
+		bool fnTakeItem(CItemRange & Range, nfUint32 & nItem)
+		{
+			nfUint64 nRange = Range.m_nRange.load();
+			while (fnRangeBegin(nRange) < fnRangeEnd(nRange)) {
+				if (Range.m_nRange.compare_exchange_weak(nRange, fnPackRange(fnRangeBegin(nRange) + 1, fnRangeEnd(nRange)))) {
+					nItem = fnRangeBegin(nRange);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Moves the upper half of the largest other range into the own range and takes its first item
+		bool fnStealItem(CItemRange * pRanges, nfUint32 nJobCount, nfUint32 nJobIndex, nfUint32 & nItem)
+		{
+			while (true) {
+				nfUint32 nVictim = nJobIndex;
+				nfUint64 nVictimRange = 0;
+				nfUint32 nVictimCount = 0;
+				for (nfUint32 nIndex = 0; nIndex < nJobCount; nIndex++) {
+					if (nIndex == nJobIndex)
+						continue;
+					nfUint64 nRange = pRanges[nIndex].m_nRange.load();
+					nfUint32 nCount = fnRangeEnd(nRange) - std::min(fnRangeBegin(nRange), fnRangeEnd(nRange));
+					if (nCount > nVictimCount) {
+						nVictim = nIndex;
+						nVictimRange = nRange;
+						nVictimCount = nCount;
+					}
+				}
+				if (nVictimCount == 0)
+					return false;
+
+				nfUint32 nEnd = fnRangeEnd(nVictimRange);
+				nfUint32 nSplit = nEnd - (nVictimCount + 1) / 2;
+				if (pRanges[nVictim].m_nRange.compare_exchange_strong(nVictimRange, fnPackRange(fnRangeBegin(nVictimRange), nSplit))) {
+					// Nobody else writes to an empty range, so a plain store suffices
+					pRanges[nJobIndex].m_nRange.store(fnPackRange(nSplit + 1, nEnd));
+					nItem = nSplit;
+					return true;
+				}
+			}
+		}
+
+	}
+
+	void fnRunStealingJobs(_In_ nfUint32 nJobCount, _In_ nfUint32 nItemCount, _In_ const std::function<void(nfUint32, nfUint32)> & fnItem)
+	{
+		if ((nJobCount == 0) || (nItemCount == 0))
+			return;
+
+		std::unique_ptr<CItemRange[]> pRanges(new CItemRange[nJobCount]);
+		for (nfUint32 nJobIndex = 0; nJobIndex < nJobCount; nJobIndex++) {
+			nfUint32 nBegin = (nfUint32)((nfUint64)nItemCount * nJobIndex / nJobCount);
+			nfUint32 nEnd = (nfUint32)((nfUint64)nItemCount * (nJobIndex + 1) / nJobCount);
+			pRanges[nJobIndex].m_nRange.store(fnPackRange(nBegin, nEnd));
+		}
+
+		std::atomic<bool> bFailed(false);
+		fnRunParallelJobs(nJobCount, [&](nfUint32 nJobIndex) {
+			try {
+				nfUint32 nItem = 0;
+				while (!bFailed.load(std::memory_order_relaxed) &&
+					(fnTakeItem(pRanges[nJobIndex], nItem) || fnStealItem(pRanges.get(), nJobCount, nJobIndex, nItem)))
+					fnItem(nJobIndex, nItem);
+			}
+			catch (...) {
+				bFailed.store(true);
+				throw;
+			}
+		});
+	}
+
+	nfUint32 fnGetParallelJobCount(_In_ nfUint64 nItemCount, _In_ nfUint64 nMinItemsPerThread)
+	{
+		nfUint64 nJobCount = std::max(std::thread::hardware_concurrency(), 1u);
+		if (nMinItemsPerThread > 0)
+			nJobCount = std::min(nJobCount, std::max(nItemCount / nMinItemsPerThread, (nfUint64)1));
+		return (nfUint32)nJobCount;
+	}
+
+}
@@ -34,6 +34,7 @@ NMR_OpcPackageReader.cpp defines an OPC Package reader in a portable way.
 #include "Common/OPC/NMR_OpcPackageRelationshipReader.h" 
 #include "Common/OPC/NMR_OpcPackageContentTypesReader.h" 
 #include "Common/Platform/NMR_ImportStream_ZIP.h" 
+#include "Common/Platform/NMR_ImportStream_Memory.h"
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_StringUtils.h" 
 
@@ -104,7 +105,7 @@ namespace NMR {
 	}
 
 	COpcPackageReader::COpcPackageReader(_In_ PImportStream pImportStream, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
-		: m_pWarnings(pWarnings), m_pProgressMonitor(pProgressMonitor)
+		: m_pWarnings(pWarnings), m_pProgressMonitor(pProgressMonitor), m_pImportStream(pImportStream)
 	{
 		if (!pImportStream)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
@@ -129,16 +130,14 @@ namespace NMR {
 			// create ZIP objects
 			zip_error_init(&m_ZIPError);
 
-			bool bUseCallback = true;
-			if (bUseCallback) {
-				// read ZIP from callback: faster and requires less memory
-				pZIPsource = zip_source_function_create(custom_zip_source_callback, pImportStream.get(), &m_ZIPError);
+			CImportStream_Memory * pMemoryStream = dynamic_cast<CImportStream_Memory *> (pImportStream.get());
+			if (pMemoryStream != nullptr) {
+				// read ZIP directly from memory (buffers and memory mapped files): no copy and no callbacks
+				pZIPsource = zip_source_buffer_create(pMemoryStream->getData(), (size_t)nStreamSize, 0, &m_ZIPError);
 			}
 			else {
-				// read ZIP into memory
-				m_Buffer.resize((size_t)nStreamSize);
-				pImportStream->readIntoBuffer(&m_Buffer[0], nStreamSize, true);
-				pZIPsource = zip_source_buffer_create(&m_Buffer[0], (size_t)nStreamSize, 0, &m_ZIPError);
+				// read ZIP from callback: requires less memory than copying the stream
+				pZIPsource = zip_source_function_create(custom_zip_source_callback, pImportStream.get(), &m_ZIPError);
 			}
 			if (pZIPsource == nullptr)
 				throw CNMRException(NMR_ERROR_COULDNOTREADZIPFILE);
@@ -219,7 +218,6 @@ namespace NMR {
 			zip_close(m_ZIParchive);
 
 		zip_error_fini(&m_ZIPError);
-		m_Buffer.resize(0);
 
 		m_ZIParchive = nullptr;
 	}
@@ -317,6 +315,42 @@ namespace NMR {
 		return Stat.size;
 	}
 
+	PImportStream COpcPackageReader::openPartStream(_In_ std::string sPath)
+	{
+		return openZIPEntry(fnRemoveLeadingPathDelimiter(sPath));
+	}
+
+	PImportStream COpcPackageReader::openRawPartStream(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & Info)
+	{
+		auto iIterator = m_ZIPEntries.find(fnRemoveLeadingPathDelimiter(sPath));
+		if (iIterator == m_ZIPEntries.end())
+			return nullptr;
+
+		zip_stat_t Stat;
+		nfInt32 nResult = zip_stat_index(m_ZIParchive, iIterator->second, ZIP_FL_UNCHANGED, &Stat);
+		if (nResult != 0)
+			throw CNMRException(NMR_ERROR_COULDNOTSTATZIPENTRY);
+
+		const zip_uint64_t nRequiredFields = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC | ZIP_STAT_ENCRYPTION_METHOD;
+		if ((Stat.valid & nRequiredFields) != nRequiredFields)
+			return nullptr;
+		if (Stat.encryption_method != ZIP_EM_NONE)
+			return nullptr;
+		if ((Stat.comp_method != ZIP_CM_STORE) && (Stat.comp_method != ZIP_CM_DEFLATE))
+			return nullptr;
+
+		zip_file_t * pFile = zip_fopen_index(m_ZIParchive, iIterator->second, ZIP_FL_UNCHANGED | ZIP_FL_COMPRESSED);
+		if (pFile == nullptr)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
+
+		Info.m_nCompressionMethod = (Stat.comp_method == ZIP_CM_STORE) ? ZIPFILECOMPRESSION_UNCOMPRESSED : ZIPFILECOMPRESSION_DEFLATED;
+		Info.m_nCRC32 = Stat.crc;
+		Info.m_nCompressedSize = Stat.comp_size;
+		Info.m_nUncompressedSize = Stat.size;
+
+		return std::make_shared<CImportStream_ZIP>(pFile, Stat.comp_size);
+	}
+
 	POpcPackagePart COpcPackageReader::createPart(_In_ std::string sPath)
 	{
 		std::string sRealPath = fnRemoveLeadingPathDelimiter (sPath);
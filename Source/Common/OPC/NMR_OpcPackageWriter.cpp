@@ -32,6 +32,7 @@ NMR_OpcPackageWriter.cpp defines an OPC Package writer in a portable way.
 
 #include "Common/OPC/NMR_OpcPackageWriter.h" 
 #include "Common/Platform/NMR_Time.h" 
+#include "Common/Platform/NMR_ExportStream_Dummy.h" 
 #include "Common/Platform/NMR_XmlWriter_Native.h" 
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_StringUtils.h" 
@@ -43,13 +44,14 @@ NMR_OpcPackageWriter.cpp defines an OPC Package writer in a portable way.
 namespace NMR {
 
 
-	COpcPackageWriter::COpcPackageWriter(_In_ PExportStream pExportStream)
+	COpcPackageWriter::COpcPackageWriter(_In_ PExportStream pExportStream, _In_ nfUint32 nCompressionThreadCount)
 	{
 		if (pExportStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		m_pExportStream = pExportStream;
 		m_pZIPWriter = std::make_shared<CPortableZIPWriter>(m_pExportStream, true);
+		m_pZIPWriter->setCompressionThreadCount(nCompressionThreadCount);
 
 		m_nRelationIDCounter = 0;
 	}
@@ -59,17 +61,29 @@ namespace NMR {
 		finishPackage();
 	}
 
-	POpcPackagePart COpcPackageWriter::addPart(_In_ std::string sPath)
+	POpcPackagePart COpcPackageWriter::addPart(_In_ std::string sPath, _In_ nfUint32 nCompressionLevel)
 	{
 		sPath = fnRemoveLeadingPathDelimiter(sPath);
 		
-		PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime());
+		PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime(), nCompressionLevel);
 		POpcPackagePart pPart = std::make_shared<COpcPackagePart>(sPath, pStream);
 		m_Parts.push_back(pPart);
 
 		return pPart;
 	}
 
+	POpcPackagePart COpcPackageWriter::addRawPart(_In_ std::string sPath, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info)
+	{
+		sPath = fnRemoveLeadingPathDelimiter(sPath);
+
+		m_pZIPWriter->writeRawEntry(sPath, fnGetUnixTime(), pRawStream, Info);
+		// the content is already written, the part only carries the relationships
+		POpcPackagePart pPart = std::make_shared<COpcPackagePart>(sPath, std::make_shared<CExportStreamDummy>());
+		m_Parts.push_back(pPart);
+
+		return pPart;
+	}
+
 	void COpcPackageWriter::addContentType(_In_ std::string sExtension, _In_ std::string sContentType)
 	{
 		m_DefaultContentTypes.insert(std::make_pair(sExtension, sContentType));
@@ -141,7 +155,7 @@ namespace NMR {
 				sPath += sName;
 				sPath += std::string(".")+PACKAGE_3D_RELS_EXTENSION;
 
-				PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime());
+				PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime(), ZIPFILECOMPRESSIONLEVEL_DEFAULT);
 				pPart->writeRelationships(pStream);
 			}
 			iIterator++;
@@ -151,7 +165,7 @@ namespace NMR {
 
 	void COpcPackageWriter::writeContentTypes()
 	{
-		PExportStream pStream = m_pZIPWriter->createEntry(OPCPACKAGE_PATH_CONTENTTYPES, fnGetUnixTime());
+		PExportStream pStream = m_pZIPWriter->createEntry(OPCPACKAGE_PATH_CONTENTTYPES, fnGetUnixTime(), ZIPFILECOMPRESSIONLEVEL_DEFAULT);
 		PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pStream);
 
 		pXMLWriter->WriteStartDocument();
@@ -190,7 +204,7 @@ namespace NMR {
 		if (m_RootRelationships.size() == 0)
 			return;
 
-		PExportStream pStream = m_pZIPWriter->createEntry(OPCPACKAGE_PATH_ROOTRELATIONSHIPS, fnGetUnixTime());
+		PExportStream pStream = m_pZIPWriter->createEntry(OPCPACKAGE_PATH_ROOTRELATIONSHIPS, fnGetUnixTime(), ZIPFILECOMPRESSIONLEVEL_DEFAULT);
 		PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pStream);
 
 		pXMLWriter->WriteStartDocument();
@@ -33,6 +33,8 @@ NMR_ExportStream_Memory.cpp implements the ExportStream to Memory Class.
 #include "Common/Platform/NMR_ExportStream_Memory.h"
 #include "Common/NMR_Exception.h"
 
+#include <string.h>
+
 namespace NMR {
 
 	CExportStreamMemory::CExportStreamMemory() {
@@ -72,9 +74,8 @@ namespace NMR {
 		if ((m_Position + cbTotalBytesToWrite) > m_Buffer.size()) {
 			m_Buffer.resize(static_cast<size_t>(m_Position + cbTotalBytesToWrite));
 		}
-		for (nfUint64 i = 0; i < cbTotalBytesToWrite; i++) {
-			m_Buffer[static_cast<size_t>(m_Position + i)] = pByteBuffer[i];
-		}
+		if (cbTotalBytesToWrite > 0)
+			memcpy(&m_Buffer[static_cast<size_t>(m_Position)], pByteBuffer, static_cast<size_t>(cbTotalBytesToWrite));
 		m_Position += cbTotalBytesToWrite;
 		return cbTotalBytesToWrite;
 	}
@@ -35,7 +35,7 @@ NMR_PortableZIPWriter.cpp implements a portable stream to write into ZIP files
  
 namespace NMR {
 
-	CExportStream_ZIP::CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey)
+	CExportStream_ZIP::CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey, nfUint32 nCompressionLevel)
 	{
 		m_bIsInitialized = false;
 
@@ -43,9 +43,12 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		if (nEntryKey == 0)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		m_pZIPWriter = pZIPWriter;
 		m_nEntryKey = nEntryKey;
+		m_nCompressionLevel = nCompressionLevel;
 
 		m_pStream.next_in = nullptr;
 		m_pStream.avail_in = 0;
@@ -66,9 +69,12 @@ namespace NMR {
 		m_pStream.avail_out = ZIPEXPORTBUFFERSIZE;
 		m_pStream.total_out = 0;
 
-		nfInt32 nResult = deflateInit2(&m_pStream, Z_BEST_SPEED, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
-		if (nResult < 0)
-			throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
+		// stored entries pass the data through
+		if (m_nCompressionLevel != ZIPFILECOMPRESSIONLEVEL_STORED) {
+			nfInt32 nResult = deflateInit2(&m_pStream, (nfInt32)m_nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+			if (nResult < 0)
+				throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
+		}
 
 		m_bIsInitialized = true;
 	}
@@ -124,6 +130,7 @@ namespace NMR {
 			if (cbBytesWritten == 0)
 				throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
 
+			pByte += cbBytesWritten;
 			cbCount -= cbBytesWritten;
 		}
 
@@ -140,6 +147,11 @@ namespace NMR {
 
 		m_pZIPWriter->calculateChecksum(m_nEntryKey, pData, cbCount);
 
+		if (m_nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED) {
+			m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, pData, cbCount);
+			return cbCount;
+		}
+
 		while (m_pStream.avail_in > 0) {
 			nfInt32 nResult = deflate(&m_pStream, 0);
 			if (nResult < 0)
@@ -163,6 +175,11 @@ namespace NMR {
 		if (!m_bIsInitialized)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
+		if (m_nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED) {
+			m_bIsInitialized = false;
+			return;
+		}
+
 		m_pStream.next_in = nullptr;
 		m_pStream.avail_in = 0;
 
@@ -0,0 +1,207 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_ZIPMemory.cpp implements an export stream that compresses a ZIP entry into memory.
+
+--*/
+
+#include "Common/Platform/NMR_ExportStream_ZIPMemory.h"
+#include "Common/Platform/NMR_ExportStream_ZIP.h"
+#include "Common/Platform/NMR_ImportStream_Shared_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/NMR_Exception.h"
+
+#include <algorithm>
+
+namespace NMR {
+
+	CExportStream_ZIPMemory::CExportStream_ZIPMemory(_In_ nfUint32 nCompressionLevel)
+	{
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_nCompressionLevel = nCompressionLevel;
+		m_nCRC32 = crc32(0L, Z_NULL, 0);
+		m_nUncompressedSize = 0;
+		m_bIsInitialized = false;
+		m_bIsFinished = false;
+
+		m_Stream.zalloc = Z_NULL;
+		m_Stream.zfree = Z_NULL;
+		m_Stream.opaque = Z_NULL;
+		m_Stream.next_in = Z_NULL;
+		m_Stream.avail_in = 0;
+
+		// stored entries pass the data through
+		if (m_nCompressionLevel != ZIPFILECOMPRESSIONLEVEL_STORED) {
+			if (deflateInit2(&m_Stream, (nfInt32)m_nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+				throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
+			m_bIsInitialized = true;
+		}
+	}
+
+	CExportStream_ZIPMemory::~CExportStream_ZIPMemory()
+	{
+		if (m_bIsInitialized)
+			(void)deflateEnd(&m_Stream);
+	}
+
+	nfBool CExportStream_ZIPMemory::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfBool CExportStream_ZIPMemory::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfBool CExportStream_ZIPMemory::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfUint64 CExportStream_ZIPMemory::getPosition()
+	{
+		return m_nUncompressedSize;
+	}
+
+	void CExportStream_ZIPMemory::deflateChunk(_In_ const nfByte * pData, _In_ nfUint32 cbCount, _In_ nfInt32 nFlush)
+	{
+		m_Stream.next_in = (Bytef *)pData;
+		m_Stream.avail_in = cbCount;
+
+		do {
+			// deflate directly behind the data compressed so far
+			size_t nPosition = m_Buffer.size();
+			m_Buffer.resize(nPosition + ZIPEXPORTBUFFERSIZE);
+			m_Stream.next_out = &m_Buffer[nPosition];
+			m_Stream.avail_out = ZIPEXPORTBUFFERSIZE;
+
+			nfInt32 nResult = deflate(&m_Stream, nFlush);
+			if ((nResult < 0) && (nResult != Z_BUF_ERROR))
+				throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
+
+			m_Buffer.resize(nPosition + ZIPEXPORTBUFFERSIZE - m_Stream.avail_out);
+		} while ((m_Stream.avail_in > 0) || (m_Stream.avail_out == 0));
+	}
+
+	nfUint64 CExportStream_ZIPMemory::writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite)
+	{
+		if (m_bIsFinished)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		const nfByte * pByte = (const nfByte *)pBuffer;
+		nfUint64 cbCount = cbTotalBytesToWrite;
+		while (cbCount > 0) {
+			nfUint32 cbChunk = (nfUint32)std::min(cbCount, (nfUint64)ZIPEXPORTWRITECHUNKSIZE);
+
+			m_nCRC32 = crc32(m_nCRC32, pByte, cbChunk);
+			if (m_nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED)
+				m_Buffer.insert(m_Buffer.end(), pByte, pByte + cbChunk);
+			else
+				deflateChunk(pByte, cbChunk, Z_NO_FLUSH);
+
+			m_nUncompressedSize += cbChunk;
+			pByte += cbChunk;
+			cbCount -= cbChunk;
+		}
+
+		return cbTotalBytesToWrite;
+	}
+
+	void CExportStream_ZIPMemory::finishEntry()
+	{
+		if (m_bIsFinished)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+
+		if (m_bIsInitialized) {
+			deflateChunk(nullptr, 0, Z_FINISH);
+			(void)deflateEnd(&m_Stream);
+			m_bIsInitialized = false;
+		}
+
+		m_Buffer.shrink_to_fit();
+		m_bIsFinished = true;
+	}
+
+	PImportStream CExportStream_ZIPMemory::openRawStream(_Out_ ZIPRAWENTRYINFO & Info)
+	{
+		if (!m_bIsFinished)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED)
+			Info.m_nCompressionMethod = ZIPFILECOMPRESSION_UNCOMPRESSED;
+		else
+			Info.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+		Info.m_nCRC32 = m_nCRC32;
+		Info.m_nCompressedSize = m_Buffer.size();
+		Info.m_nUncompressedSize = m_nUncompressedSize;
+
+		return std::make_shared<CImportStream_Shared_Memory>(m_Buffer.data(), m_Buffer.size());
+	}
+
+	PImportStream CExportStream_ZIPMemory::openUncompressedStream()
+	{
+		if (!m_bIsFinished)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_nUncompressedSize == 0)
+			return std::make_shared<CImportStream_Unique_Memory>();
+		if (m_nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED)
+			return std::make_shared<CImportStream_Unique_Memory>(m_Buffer.data(), m_Buffer.size());
+
+		std::vector<nfByte> Uncompressed((size_t)m_nUncompressedSize);
+		z_stream Stream;
+		Stream.zalloc = Z_NULL;
+		Stream.zfree = Z_NULL;
+		Stream.opaque = Z_NULL;
+		Stream.next_in = (Bytef *)m_Buffer.data();
+		Stream.avail_in = (uInt)m_Buffer.size();
+		if (inflateInit2(&Stream, -15) != Z_OK)
+			throw CNMRException(NMR_ERROR_COULDNOTINITINFLATE);
+
+		Stream.next_out = Uncompressed.data();
+		Stream.avail_out = (uInt)Uncompressed.size();
+		nfInt32 nResult = inflate(&Stream, Z_FINISH);
+		(void)inflateEnd(&Stream);
+		if ((nResult != Z_STREAM_END) || (Stream.avail_out != 0))
+			throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+
+		return std::make_shared<CImportStream_Unique_Memory>(Uncompressed.data(), Uncompressed.size());
+	}
+
+}
@@ -0,0 +1,322 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_ZIPParallel.cpp implements an export stream that deflates a ZIP entry on several threads.
+
+--*/
+
+#include "Common/Platform/NMR_ExportStream_ZIPParallel.h"
+#include "Common/NMR_Exception.h"
+#include "zlib.h"
+
+#include <algorithm>
+#include <string.h>
+#include <system_error>
+
+namespace NMR {
+
+	CExportStream_ZIPParallel::CExportStream_ZIPParallel(_In_ CPortableZIPWriter * pZIPWriter, _In_ nfUint32 nEntryKey, _In_ nfUint32 nCompressionLevel, _In_ nfUint32 nThreadCount)
+	{
+		m_bIsInitialized = false;
+		m_bStopWorkers = false;
+
+		if (pZIPWriter == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (nEntryKey == 0)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if ((nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED) || (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (nThreadCount == 0)
+			nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+		m_pZIPWriter = pZIPWriter;
+		m_nEntryKey = nEntryKey;
+		m_nThreadCount = nThreadCount;
+		m_nCompressionLevel = nCompressionLevel;
+		m_nPosition = 0;
+
+		m_pCurrentBlock = std::make_shared<ZIPPARALLELBLOCK>();
+		m_pCurrentBlock->m_Input.reserve(ZIPPARALLELBLOCKSIZE);
+
+		m_bIsInitialized = true;
+	}
+
+	CExportStream_ZIPParallel::~CExportStream_ZIPParallel()
+	{
+		stopWorkers();
+	}
+
+	nfBool CExportStream_ZIPParallel::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfBool CExportStream_ZIPParallel::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfBool CExportStream_ZIPParallel::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bHasToSucceed)
+			throw CNMRException(NMR_ERROR_ZIPSTREAMCANNOTSEEK);
+		return false;
+	}
+
+	nfUint64 CExportStream_ZIPParallel::getPosition()
+	{
+		return m_nPosition;
+	}
+
+	nfUint64 CExportStream_ZIPParallel::writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite)
+	{
+		if (!m_bIsInitialized)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		if ((pBuffer == nullptr) && (cbTotalBytesToWrite > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		const nfByte * pByte = (const nfByte *)pBuffer;
+		nfUint64 cbCount = cbTotalBytesToWrite;
+
+		while (cbCount > 0) {
+			std::vector<nfByte> & Input = m_pCurrentBlock->m_Input;
+			size_t cbBytesToCopy = (size_t)std::min(cbCount, (nfUint64)(ZIPPARALLELBLOCKSIZE - Input.size()));
+			Input.insert(Input.end(), pByte, pByte + cbBytesToCopy);
+			pByte += cbBytesToCopy;
+			cbCount -= cbBytesToCopy;
+
+			if (Input.size() >= ZIPPARALLELBLOCKSIZE)
+				submitBlock(false);
+		}
+
+		m_nPosition += cbTotalBytesToWrite;
+		return cbTotalBytesToWrite;
+	}
+
+	void CExportStream_ZIPParallel::submitBlock(_In_ nfBool bIsLast)
+	{
+		PZIPPARALLELBLOCK pBlock = m_pCurrentBlock;
+		pBlock->m_Dictionary = m_Dictionary;
+		pBlock->m_bIsLast = bIsLast;
+		pBlock->m_bIsDone = false;
+
+		if (bIsLast) {
+			m_pCurrentBlock = nullptr;
+		}
+		else {
+			// the end of this block primes the next one
+			size_t cbDictionary = std::min(pBlock->m_Input.size(), (size_t)ZIPPARALLELDICTIONARYSIZE);
+			m_Dictionary.assign(pBlock->m_Input.end() - cbDictionary, pBlock->m_Input.end());
+
+			m_pCurrentBlock = std::make_shared<ZIPPARALLELBLOCK>();
+			m_pCurrentBlock->m_Input.reserve(ZIPPARALLELBLOCKSIZE);
+		}
+
+		// entries that fit into a single block do not need any worker
+		if (!(bIsLast && m_PendingBlocks.empty()) && m_Workers.empty())
+			startWorkers();
+
+		if (m_Workers.empty()) {
+			deflateBlock(*pBlock, m_nCompressionLevel);
+			pBlock->m_bIsDone = true;
+			m_PendingBlocks.push_back(pBlock);
+		}
+		else {
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				m_PendingBlocks.push_back(pBlock);
+				m_QueuedBlocks.push_back(pBlock);
+			}
+			m_QueuedCondition.notify_one();
+		}
+
+		// write finished blocks in order, and bound the number of blocks in memory
+		while (!m_PendingBlocks.empty()) {
+			nfBool bFirstIsDone;
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				bFirstIsDone = m_PendingBlocks.front()->m_bIsDone;
+			}
+			if (!bFirstIsDone && !bIsLast && (m_PendingBlocks.size() < (size_t)m_nThreadCount * ZIPPARALLELBLOCKSPERTHREAD))
+				break;
+
+			writeFirstPendingBlock();
+		}
+	}
+
+	void CExportStream_ZIPParallel::writeFirstPendingBlock()
+	{
+		PZIPPARALLELBLOCK pBlock = m_PendingBlocks.front();
+		{
+			std::unique_lock<std::mutex> Lock(m_Mutex);
+			m_DoneCondition.wait(Lock, [&pBlock]() { return pBlock->m_bIsDone; });
+			m_PendingBlocks.pop_front();
+		}
+
+		if (pBlock->m_pException)
+			std::rethrow_exception(pBlock->m_pException);
+
+		m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, pBlock->m_Output.data(), (nfUint32)pBlock->m_Output.size());
+		m_pZIPWriter->combineChecksum(m_nEntryKey, pBlock->m_nCRC32, pBlock->m_Input.size());
+	}
+
+	void CExportStream_ZIPParallel::startWorkers()
+	{
+		m_bStopWorkers = false;
+		for (nfUint32 nWorker = 0; nWorker < m_nThreadCount; nWorker++) {
+			try {
+				m_Workers.push_back(std::thread(&CExportStream_ZIPParallel::runWorker, this));
+			}
+			catch (std::system_error &) {
+				// continue with the threads we have, or deflate on this thread
+				break;
+			}
+		}
+	}
+
+	void CExportStream_ZIPParallel::stopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_bStopWorkers = true;
+		}
+		m_QueuedCondition.notify_all();
+
+		for (auto & Worker : m_Workers)
+			Worker.join();
+		m_Workers.clear();
+	}
+
+	void CExportStream_ZIPParallel::runWorker()
+	{
+		while (true) {
+			PZIPPARALLELBLOCK pBlock;
+			{
+				std::unique_lock<std::mutex> Lock(m_Mutex);
+				m_QueuedCondition.wait(Lock, [this]() { return m_bStopWorkers || !m_QueuedBlocks.empty(); });
+				if (m_bStopWorkers)
+					return;
+				pBlock = m_QueuedBlocks.front();
+				m_QueuedBlocks.pop_front();
+			}
+
+			try {
+				deflateBlock(*pBlock, m_nCompressionLevel);
+			}
+			catch (...) {
+				pBlock->m_pException = std::current_exception();
+			}
+
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				pBlock->m_bIsDone = true;
+			}
+			m_DoneCondition.notify_all();
+		}
+	}
+
+	void CExportStream_ZIPParallel::deflateBlock(_In_ ZIPPARALLELBLOCK & Block, _In_ nfUint32 nCompressionLevel)
+	{
+		std::vector<nfByte> & Input = Block.m_Input;
+
+		Block.m_nCRC32 = crc32(0L, Z_NULL, 0);
+		if (Input.size() > 0)
+			Block.m_nCRC32 = crc32(Block.m_nCRC32, Input.data(), (uInt)Input.size());
+
+		z_stream Stream;
+		memset(&Stream, 0, sizeof(Stream));
+		if (deflateInit2(&Stream, (nfInt32)nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
+
+		try {
+			if (Block.m_Dictionary.size() > 0) {
+				if (deflateSetDictionary(&Stream, Block.m_Dictionary.data(), (uInt)Block.m_Dictionary.size()) != Z_OK)
+					throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
+			}
+
+			// Blocks but the last end with a sync flush, which leaves the stream open and byte aligned
+			nfInt32 nFlush = Block.m_bIsLast ? Z_FINISH : Z_SYNC_FLUSH;
+			Block.m_Output.resize(deflateBound(&Stream, (uLong)Input.size()) + 16);
+
+			Stream.next_in = Input.data();
+			Stream.avail_in = (uInt)Input.size();
+			Stream.next_out = Block.m_Output.data();
+			Stream.avail_out = (uInt)Block.m_Output.size();
+
+			while (true) {
+				nfInt32 nResult = deflate(&Stream, nFlush);
+				if ((nResult < 0) && (nResult != Z_BUF_ERROR))
+					throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
+
+				if (Block.m_bIsLast ? (nResult == Z_STREAM_END) : ((Stream.avail_in == 0) && (Stream.avail_out > 0)))
+					break;
+
+				if (Stream.avail_out == 0) {
+					size_t cbUsed = Block.m_Output.size();
+					Block.m_Output.resize(cbUsed * 2);
+					Stream.next_out = Block.m_Output.data() + cbUsed;
+					Stream.avail_out = (uInt)(Block.m_Output.size() - cbUsed);
+				}
+				else if (nResult == Z_BUF_ERROR)
+					throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
+			}
+
+			Block.m_Output.resize(Block.m_Output.size() - Stream.avail_out);
+		}
+		catch (...) {
+			deflateEnd(&Stream);
+			throw;
+		}
+
+		deflateEnd(&Stream);
+		Block.m_Dictionary.clear();
+	}
+
+	void CExportStream_ZIPParallel::flushZIPStream()
+	{
+		if (!m_bIsInitialized)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		m_bIsInitialized = false;
+
+		try {
+			submitBlock(true);
+		}
+		catch (...) {
+			stopWorkers();
+			throw;
+		}
+
+		stopWorkers();
+	}
+
+}
@@ -0,0 +1,121 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_Deferred.cpp implements a stream class which opens its source
+on the first access.
+
+--*/
+
+#include "Common/Platform/NMR_ImportStream_Deferred.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR {
+
+	CImportStream_Deferred::CImportStream_Deferred(_In_ ImportStream_OpenerType fnOpener, _In_ ImportStream_RawOpenerType fnRawOpener, _In_ nfUint64 nSize)
+		: m_fnOpener(fnOpener), m_fnRawOpener(fnRawOpener), m_nSize(nSize)
+	{
+		if (!m_fnOpener)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	CImportStream * CImportStream_Deferred::materialize()
+	{
+		if (m_pStream.get() == nullptr) {
+			PImportStream pSourceStream = m_fnOpener();
+			if (pSourceStream.get() == nullptr)
+				throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
+
+			// ZIP entries cannot seek, consumers of attachments expect a random access stream
+			PImportStream pMemoryStream = pSourceStream->copyToMemory();
+			if (pMemoryStream->retrieveSize() != m_nSize)
+				throw CNMRException(NMR_ERROR_COULDNOTREADFULLDATA);
+			m_pStream = pMemoryStream;
+		}
+
+		return m_pStream.get();
+	}
+
+	nfBool CImportStream_Deferred::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		return materialize()->seekPosition(position, bHasToSucceed);
+	}
+
+	nfBool CImportStream_Deferred::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		return materialize()->seekForward(bytes, bHasToSucceed);
+	}
+
+	nfBool CImportStream_Deferred::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		return materialize()->seekFromEnd(bytes, bHasToSucceed);
+	}
+
+	nfUint64 CImportStream_Deferred::readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
+	{
+		return materialize()->readIntoBuffer(pBuffer, cbTotalBytesToRead, bNeedsToReadAll);
+	}
+
+	nfUint64 CImportStream_Deferred::retrieveSize()
+	{
+		return m_nSize;
+	}
+
+	void CImportStream_Deferred::writeToFile(_In_ const nfWChar * pwszFileName)
+	{
+		materialize()->writeToFile(pwszFileName);
+	}
+
+	PImportStream CImportStream_Deferred::copyToMemory()
+	{
+		return materialize()->copyToMemory();
+	}
+
+	nfUint64 CImportStream_Deferred::getPosition()
+	{
+		if (m_pStream.get() == nullptr)
+			return 0;
+		return m_pStream->getPosition();
+	}
+
+	nfBool CImportStream_Deferred::isMaterialized()
+	{
+		return (m_pStream.get() != nullptr);
+	}
+
+	PImportStream CImportStream_Deferred::openRawStream(_Out_ ZIPRAWENTRYINFO & Info)
+	{
+		if (!m_fnRawOpener)
+			return nullptr;
+
+		PImportStream pRawStream = m_fnRawOpener(Info);
+		if ((pRawStream.get() != nullptr) && (Info.m_nUncompressedSize != m_nSize))
+			return nullptr;
+		return pRawStream;
+	}
+
+}
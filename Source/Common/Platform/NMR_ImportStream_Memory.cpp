@@ -32,6 +32,7 @@ This is an abstract platform independent class for keeping data in a memory stre
 --*/
 
 #include "Common/Platform/NMR_ImportStream_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Shared_Memory.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
@@ -125,6 +126,22 @@ namespace NMR {
 		return m_cbSize;
 	}
 
+	const nfByte * CImportStream_Memory::getData()
+	{
+		if (m_cbSize == 0)
+			return nullptr;
+
+		return getAt(0);
+	}
+
+	PImportStream CImportStream_Memory::createSharedView()
+	{
+		if (m_cbSize == 0)
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+
+		return std::make_shared<CImportStream_Shared_Memory>(getAt(0), m_cbSize);
+	}
+
 	void CImportStream_Memory::writeToFile(_In_ const nfWChar * pwszFileName)
 	{
 		if (pwszFileName == nullptr)
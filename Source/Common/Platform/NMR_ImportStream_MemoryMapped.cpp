@@ -0,0 +1,150 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_ImportStream_MemoryMapped.cpp implements the CImportStream_MemoryMapped Class.
+This is a platform specific class for reading a file through a read-only memory mapping.
+
+--*/
+
+#include "Common/Platform/NMR_ImportStream_MemoryMapped.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_Exception_Windows.h"
+#include "Common/NMR_StringUtils.h"
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace NMR {
+
+	CImportStream_MemoryMapped::CImportStream_MemoryMapped(_In_ const nfWChar * pwszFileName)
+	{
+		if (pwszFileName == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pMapping = nullptr;
+		m_cbSize = 0;
+		m_nPosition = 0;
+
+#ifdef _WIN32
+		m_hFile = INVALID_HANDLE_VALUE;
+		m_hMapping = nullptr;
+
+		m_hFile = CreateFileW(pwszFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_hFile == INVALID_HANDLE_VALUE)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENFILE);
+
+		LARGE_INTEGER nFileSize;
+		if (!GetFileSizeEx(m_hFile, &nFileSize) || (nFileSize.QuadPart <= 0) || ((nfUint64)nFileSize.QuadPart > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)) {
+			unmap();
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+		}
+
+		m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_hMapping == nullptr) {
+			unmap();
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+		}
+
+		m_pMapping = (const nfByte *)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+		if (m_pMapping == nullptr) {
+			unmap();
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+		}
+
+		m_cbSize = (nfUint64)nFileSize.QuadPart;
+#else
+		std::string sUTF8Name = fnUTF16toUTF8(pwszFileName);
+		int nFileDescriptor = open(sUTF8Name.c_str(), O_RDONLY);
+		if (nFileDescriptor < 0)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENFILE);
+
+		struct stat FileStat;
+		if ((fstat(nFileDescriptor, &FileStat) != 0) || (FileStat.st_size <= 0) || ((nfUint64)FileStat.st_size > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)) {
+			close(nFileDescriptor);
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+		}
+
+		void * pMapping = mmap(nullptr, (size_t)FileStat.st_size, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+		// the mapping keeps its own reference to the file
+		close(nFileDescriptor);
+		if (pMapping == MAP_FAILED)
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+
+		m_pMapping = (const nfByte *)pMapping;
+		m_cbSize = (nfUint64)FileStat.st_size;
+#endif // _WIN32
+	}
+
+	CImportStream_MemoryMapped::~CImportStream_MemoryMapped()
+	{
+		unmap();
+	}
+
+	void CImportStream_MemoryMapped::unmap()
+	{
+#ifdef _WIN32
+		if (m_pMapping != nullptr)
+			UnmapViewOfFile(m_pMapping);
+		if (m_hMapping != nullptr)
+			CloseHandle(m_hMapping);
+		if (m_hFile != INVALID_HANDLE_VALUE)
+			CloseHandle(m_hFile);
+
+		m_hMapping = nullptr;
+		m_hFile = INVALID_HANDLE_VALUE;
+#else
+		if (m_pMapping != nullptr)
+			munmap((void *)m_pMapping, (size_t)m_cbSize);
+#endif // _WIN32
+
+		m_pMapping = nullptr;
+		m_cbSize = 0;
+		m_nPosition = 0;
+	}
+
+	PImportStream CImportStream_MemoryMapped::copyToMemory()
+	{
+		__NMRASSERT(m_nPosition <= m_cbSize);
+
+		return std::make_shared<CImportStream_Unique_Memory>(this, m_cbSize - m_nPosition, true);
+	}
+
+	const nfByte * CImportStream_MemoryMapped::getAt(nfUint64 nPosition)
+	{
+		return &m_pMapping[nPosition];
+	}
+
+}
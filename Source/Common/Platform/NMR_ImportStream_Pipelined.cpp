@@ -0,0 +1,254 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+This is a stream class which reads another import stream ahead on a background thread.
+The producer thread fills a ring of buffers from the source stream, the reading thread
+copies the data out of them. Only the reading thread queries the progress monitor; if it
+cancels, the stream is released and the destructor stops and joins the producer.
+
+--*/
+
+#include "Common/Platform/NMR_ImportStream_Pipelined.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/NMR_Exception.h"
+
+#include <chrono>
+#include <cstring>
+#include <system_error>
+
+namespace NMR {
+
+	CImportStream_Pipelined::CImportStream_Pipelined(_In_ PImportStream pSourceStream, _In_opt_ PProgressMonitor pProgressMonitor)
+	{
+		if (pSourceStream.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pSourceStream = pSourceStream;
+		m_pProgressMonitor = pProgressMonitor;
+		m_nSize = pSourceStream->retrieveSize();
+		m_nPosition = 0;
+
+		m_Buffers.resize(IMPORTSTREAM_PIPELINED_BUFFERCOUNT);
+		for (auto & Buffer : m_Buffers)
+			Buffer.resize(IMPORTSTREAM_PIPELINED_BUFFERSIZE);
+		m_BufferSizes.resize(IMPORTSTREAM_PIPELINED_BUFFERCOUNT, 0);
+		m_nProducedBuffers = 0;
+		m_nConsumedBuffers = 0;
+		m_nReadOffset = 0;
+
+		m_bFinished = false;
+		m_bCancelled = false;
+		m_bSynchronous = false;
+
+		try {
+			m_Producer = std::thread(&CImportStream_Pipelined::produceBuffers, this);
+		}
+		catch (std::system_error &) {
+			m_bSynchronous = true;
+		}
+	}
+
+	CImportStream_Pipelined::~CImportStream_Pipelined()
+	{
+		stopProducer();
+	}
+
+	void CImportStream_Pipelined::stopProducer()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_bCancelled = true;
+		}
+		m_BufferConsumed.notify_all();
+
+		if (m_Producer.joinable())
+			m_Producer.join();
+	}
+
+	void CImportStream_Pipelined::produceBuffers()
+	{
+		try {
+			while (true) {
+				nfUint64 nBufferIndex;
+				{
+					std::unique_lock<std::mutex> Lock(m_Mutex);
+					m_BufferConsumed.wait(Lock, [this] {
+						return m_bCancelled || (m_nProducedBuffers - m_nConsumedBuffers < IMPORTSTREAM_PIPELINED_BUFFERCOUNT);
+					});
+					if (m_bCancelled)
+						return;
+					nBufferIndex = m_nProducedBuffers % IMPORTSTREAM_PIPELINED_BUFFERCOUNT;
+				}
+
+				// The reading thread does not touch buffers which are not produced yet
+				nfUint64 cbRead = m_pSourceStream->readIntoBuffer(m_Buffers[nBufferIndex].data(), IMPORTSTREAM_PIPELINED_BUFFERSIZE, false);
+
+				{
+					std::lock_guard<std::mutex> Lock(m_Mutex);
+					if (cbRead > 0) {
+						m_BufferSizes[nBufferIndex] = cbRead;
+						m_nProducedBuffers++;
+					}
+					if (cbRead < IMPORTSTREAM_PIPELINED_BUFFERSIZE)
+						m_bFinished = true;
+				}
+				m_BufferProduced.notify_one();
+
+				if (cbRead < IMPORTSTREAM_PIPELINED_BUFFERSIZE)
+					return;
+			}
+		}
+		catch (...) {
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				m_pProducerException = std::current_exception();
+				m_bFinished = true;
+			}
+			m_BufferProduced.notify_one();
+		}
+	}
+
+	nfBool CImportStream_Pipelined::waitForBuffer()
+	{
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+		while ((m_nConsumedBuffers == m_nProducedBuffers) && !m_bFinished) {
+			if (!m_BufferProduced.wait_for(Lock, std::chrono::milliseconds(IMPORTSTREAM_PIPELINED_CANCELINTERVAL), [this] {
+				return (m_nConsumedBuffers != m_nProducedBuffers) || m_bFinished;
+			})) {
+				if (m_pProgressMonitor) {
+					Lock.unlock();
+					m_pProgressMonitor->QueryCancelled(true);
+					Lock.lock();
+				}
+			}
+		}
+
+		if (m_nConsumedBuffers != m_nProducedBuffers)
+			return true;
+
+		// Data read before a failure is returned first
+		if (m_pProducerException)
+			std::rethrow_exception(m_pProducerException);
+		return false;
+	}
+
+	nfUint64 CImportStream_Pipelined::readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
+	{
+		if (m_bSynchronous) {
+			nfUint64 cbRead = m_pSourceStream->readIntoBuffer(pBuffer, cbTotalBytesToRead, bNeedsToReadAll);
+			m_nPosition += cbRead;
+			return cbRead;
+		}
+
+		nfByte * pData = pBuffer;
+		nfUint64 cbBytesRead = 0;
+		while (cbBytesRead < cbTotalBytesToRead) {
+			if (!waitForBuffer())
+				break;
+
+			nfUint64 nBufferIndex = m_nConsumedBuffers % IMPORTSTREAM_PIPELINED_BUFFERCOUNT;
+			nfUint64 cbAvailable = m_BufferSizes[nBufferIndex] - m_nReadOffset;
+			nfUint64 cbToCopy = cbTotalBytesToRead - cbBytesRead;
+			if (cbToCopy > cbAvailable)
+				cbToCopy = cbAvailable;
+
+			memcpy(pData, &m_Buffers[nBufferIndex][(size_t)m_nReadOffset], (size_t)cbToCopy);
+			pData += cbToCopy;
+			cbBytesRead += cbToCopy;
+			m_nReadOffset += cbToCopy;
+
+			if (m_nReadOffset == m_BufferSizes[nBufferIndex]) {
+				{
+					std::lock_guard<std::mutex> Lock(m_Mutex);
+					m_nConsumedBuffers++;
+				}
+				m_nReadOffset = 0;
+				m_BufferConsumed.notify_one();
+			}
+		}
+
+		m_nPosition += cbBytesRead;
+		if ((cbBytesRead != cbTotalBytesToRead) && bNeedsToReadAll)
+			throw CNMRException(NMR_ERROR_COULDNOTREADFULLDATA);
+
+		return cbBytesRead;
+	}
+
+	nfBool CImportStream_Pipelined::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		if (position < m_nPosition)
+			throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+		return seekForward(position - m_nPosition, bHasToSucceed);
+	}
+
+	nfBool CImportStream_Pipelined::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		// The data is read and dropped, as the source is read ahead
+		std::vector<nfByte> Buffer((size_t)std::min(bytes, (nfUint64)IMPORTSTREAM_PIPELINED_BUFFERSIZE));
+		nfUint64 cbBytesLeft = bytes;
+		while (cbBytesLeft > 0) {
+			nfUint64 cbToRead = std::min(cbBytesLeft, (nfUint64)Buffer.size());
+			nfUint64 cbRead = readIntoBuffer(Buffer.data(), cbToRead, false);
+			cbBytesLeft -= cbRead;
+			if (cbRead != cbToRead) {
+				if (bHasToSucceed)
+					throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	nfBool CImportStream_Pipelined::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bytes > m_nSize)
+			throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+		return seekPosition(m_nSize - bytes, bHasToSucceed);
+	}
+
+	nfUint64 CImportStream_Pipelined::retrieveSize()
+	{
+		return m_nSize;
+	}
+
+	void CImportStream_Pipelined::writeToFile(_In_ const nfWChar * pwszFileName)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	PImportStream CImportStream_Pipelined::copyToMemory()
+	{
+		return std::make_shared<CImportStream_Unique_Memory>(this, m_nSize - m_nPosition, false);
+	}
+
+	nfUint64 CImportStream_Pipelined::getPosition()
+	{
+		return m_nPosition;
+	}
+
+}
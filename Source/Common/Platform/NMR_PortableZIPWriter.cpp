@@ -32,9 +32,13 @@ NMR_PortableZIPWriter.cpp implements a portable and fast writer of ZIP files
 
 #include "Common/Platform/NMR_PortableZIPWriter.h"
 #include "Common/Platform/NMR_ExportStream_ZIP.h"
+#include "Common/Platform/NMR_ExportStream_ZIPParallel.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_StringUtils.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace NMR {
 
 	CPortableZIPWriter::CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64)
@@ -47,6 +51,7 @@ namespace NMR {
 		m_nNextEntryKey = 1;
 		m_pCurrentEntry = nullptr;
 		m_bIsFinished = false;
+		m_nCompressionThreadCount = 1;
 		m_bWriteZIP64 = bWriteZIP64;
 
 		if (m_bWriteZIP64) {
@@ -69,7 +74,48 @@ namespace NMR {
 			writeDirectory();
 	}
 
-	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp)
+	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfUint32 nCompressionLevel)
+	{
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED)
+			startEntry(sName, nUnixTimeStamp, ZIPFILECOMPRESSION_UNCOMPRESSED);
+		else
+			startEntry(sName, nUnixTimeStamp, ZIPFILECOMPRESSION_DEFLATED);
+
+		// Return new ZIP Entry stream
+		if ((m_nCompressionThreadCount != 1) && (nCompressionLevel != ZIPFILECOMPRESSIONLEVEL_STORED))
+			m_pCurrentStream = std::make_shared<CExportStream_ZIPParallel>(this, m_nCurrentEntryKey, nCompressionLevel, m_nCompressionThreadCount);
+		else
+			m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey, nCompressionLevel);
+		return m_pCurrentStream;
+	}
+
+	void CPortableZIPWriter::writeRawEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info)
+	{
+		if (pRawStream == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if ((Info.m_nCompressionMethod != ZIPFILECOMPRESSION_DEFLATED) && (Info.m_nCompressionMethod != ZIPFILECOMPRESSION_UNCOMPRESSED))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		startEntry(sName, nUnixTimeStamp, Info.m_nCompressionMethod);
+
+		std::vector<nfByte> Buffer((size_t)std::min(Info.m_nCompressedSize, (nfUint64)ZIPFILERAWCOPYBUFFERSIZE));
+		nfUint64 cbBytesLeft = Info.m_nCompressedSize;
+		while (cbBytesLeft > 0) {
+			nfUint32 cbBytesToCopy = (nfUint32)std::min(cbBytesLeft, (nfUint64)Buffer.size());
+			pRawStream->readIntoBuffer(Buffer.data(), cbBytesToCopy, true);
+			m_pExportStream->writeBuffer(Buffer.data(), cbBytesToCopy);
+			m_pCurrentEntry->increaseCompressedSize(cbBytesToCopy);
+			cbBytesLeft -= cbBytesToCopy;
+		}
+		m_pCurrentEntry->setChecksumAndUncompressedSize(Info.m_nCRC32, Info.m_nUncompressedSize);
+
+		closeEntry();
+	}
+
+	void CPortableZIPWriter::startEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfUint16 nCompressionMethod)
 	{
 		if (m_bIsFinished)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
@@ -99,7 +145,7 @@ namespace NMR {
 		LocalHeader.m_nSignature = ZIPFILEHEADERSIGNATURE;
 		LocalHeader.m_nVersion = m_nVersionNeeded;
 		LocalHeader.m_nGeneralPurposeFlags = 0;
-		LocalHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+		LocalHeader.m_nCompressionMethod = nCompressionMethod;
 		LocalHeader.m_nLastModTime = nLastModTime;
 		LocalHeader.m_nLastModDate = nLastModDate;
 		LocalHeader.m_nCRC32 = 0;
@@ -139,12 +185,8 @@ namespace NMR {
 		nfUint64 nDataPosition = m_pExportStream->getPosition();
 
 		// create list entry
-		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition);
+		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition, nCompressionMethod);
 		m_Entries.push_back(m_pCurrentEntry);
-
-		// Return new ZIP Entry stream
-		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey);
-		return m_pCurrentStream;
 	}
 
 	void CPortableZIPWriter::closeEntry()
@@ -153,11 +195,17 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
 		if (m_pCurrentEntry.get() != nullptr) {
-			// finish current stream writing
-			CExportStream_ZIP * pZipStream = dynamic_cast<CExportStream_ZIP *>(m_pCurrentStream.get());
-			if (pZipStream == nullptr)
-				throw CNMRException(NMR_ERROR_NOEXPORTSTREAM);
-			pZipStream->flushZIPStream();
+			// finish current stream writing, raw entries have no stream
+			if (m_pCurrentStream.get() != nullptr) {
+				CExportStream_ZIP * pZipStream = dynamic_cast<CExportStream_ZIP *>(m_pCurrentStream.get());
+				CExportStream_ZIPParallel * pParallelZipStream = dynamic_cast<CExportStream_ZIPParallel *>(m_pCurrentStream.get());
+				if (pZipStream != nullptr)
+					pZipStream->flushZIPStream();
+				else if (pParallelZipStream != nullptr)
+					pParallelZipStream->flushZIPStream();
+				else
+					throw CNMRException(NMR_ERROR_NOEXPORTSTREAM);
+			}
 
 			// Write CRC and Size
 			ZIPLOCALFILEDESCRIPTOR FileDescriptor;
@@ -227,6 +275,23 @@ namespace NMR {
 	}
 
 
+	void CPortableZIPWriter::combineChecksum(_In_ nfUint32 nEntryKey, _In_ nfUint32 nCRC32, _In_ nfUint64 cbUncompressedBytes)
+	{
+		if (m_pCurrentEntry.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRY);
+
+		if (nEntryKey != m_nCurrentEntryKey)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRYKEY);
+
+		if (cbUncompressedBytes > 0)
+			m_pCurrentEntry->combineChecksum(nCRC32, cbUncompressedBytes);
+	}
+
+	void CPortableZIPWriter::setCompressionThreadCount(_In_ nfUint32 nThreadCount)
+	{
+		m_nCompressionThreadCount = nThreadCount;
+	}
+
 	void CPortableZIPWriter::writeDeflatedBuffer(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbCompressedBytes)
 	{
 		if (m_pCurrentEntry.get() == nullptr)
@@ -271,7 +336,7 @@ namespace NMR {
 			DirectoryHeader.m_nVersionMade = m_nVersionMade;
 			DirectoryHeader.m_nVersionNeeded = m_nVersionNeeded;
 			DirectoryHeader.m_nGeneralPurposeFlags = 0;
-			DirectoryHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+			DirectoryHeader.m_nCompressionMethod = pEntry->getCompressionMethod();
 			DirectoryHeader.m_nLastModTime = pEntry->getLastModTime();
 			DirectoryHeader.m_nLastModDate = pEntry->getLastModDate();
 			DirectoryHeader.m_nCRC32 = pEntry->getCRC32();
@@ -46,4 +46,19 @@ namespace NMR {
 	{
 	}
 
+	nfUint64 CXmlReader::GetElementStreamPosition()
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	void CXmlReader::GetNameSpaces(_Out_ std::map<std::string, std::string> & NameSpaces)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	void CXmlReader::SetNameSpaces(_In_ const std::map<std::string, std::string> & NameSpaces)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
 }
@@ -132,6 +132,9 @@ namespace NMR {
 
 		m_nCurrentBufferSize = 0;
 		m_cbCurrentOverflowSize = 0;
+		m_nStreamBytesRead = 0;
+		m_nCurrentBufferStreamPosition = 0;
+		m_pScanner = fnGetXmlReaderNativeScanner(fnGetXmlReaderNativeScanLevel());
 		m_nCurrentEntityIndex = 0;
 		m_nCurrentFullEntityCount = 0;
 		m_nCurrentEntityCount = 0;
@@ -396,6 +399,53 @@ namespace NMR {
 		// Empty by purpose
 	}
 
+	nfUint64 CXmlReader_Native::GetElementStreamPosition()
+	{
+		// The last read entity is still in the current buffer
+		if (m_nCurrentEntityIndex == 0)
+			throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+		nfUint32 nIndex = m_nCurrentEntityIndex - 1;
+
+		nfChar * pEntity = m_CurrentEntityPrefixes[nIndex];
+		if (pEntity == &m_cNullString)
+			pEntity = m_CurrentEntityList[nIndex];
+		nfUint64 nOffset = (nfUint64)(pEntity - &(*m_pCurrentBuffer)[0]);
+
+		switch (m_CurrentEntityTypes[nIndex]) {
+		case NMR_NATIVEXMLTYPE_ELEMENT: // after "<"
+			if (nOffset < 1)
+				throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+			return m_nCurrentBufferStreamPosition + nOffset - 1;
+		case NMR_NATIVEXMLTYPE_ELEMENTEND: // after "</"
+			if (nOffset < 2)
+				throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+			return m_nCurrentBufferStreamPosition + nOffset - 2;
+		case NMR_NATIVEXMLTYPE_CLOSEELEMENT: // at ">" of "/>"
+			return m_nCurrentBufferStreamPosition + nOffset + 1;
+		default:
+			throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+		}
+	}
+
+	void CXmlReader_Native::GetNameSpaces(_Out_ std::map<std::string, std::string> & NameSpaces)
+	{
+		NameSpaces = m_sNameSpaces;
+		if (!m_sDefaultNameSpace.empty())
+			NameSpaces[""] = m_sDefaultNameSpace;
+	}
+
+	void CXmlReader_Native::SetNameSpaces(_In_ const std::map<std::string, std::string> & NameSpaces)
+	{
+		for (auto iIterator = NameSpaces.begin(); iIterator != NameSpaces.end(); iIterator++) {
+			if (iIterator->first.empty()) {
+				m_sDefaultNameSpace = iIterator->second;
+				m_cbDefaultNameSpaceLength = (nfUint32)m_sDefaultNameSpace.length();
+			}
+			else
+				registerNameSpace(iIterator->first, iIterator->second);
+		}
+	}
+
 	void CXmlReader_Native::readNextBufferFromStream()
 	{
 		if (m_progressCounter++ > PROGRESS_READBUFFERUPDATE) {
@@ -415,6 +465,9 @@ namespace NMR {
 		if (m_nCurrentBufferSize < m_cbCurrentOverflowSize)
 			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
 
+		// The overflow is the start of the new buffer
+		nfUint64 nNextBufferStreamPosition = m_nStreamBytesRead - m_cbCurrentOverflowSize;
+
 		// Copy over unfinished elements of current buffer into new buffer
 		if (m_cbCurrentOverflowSize > 0) {
 			nfUint32 nDeltaIndex = m_nCurrentBufferSize - m_cbCurrentOverflowSize;
@@ -435,6 +488,7 @@ namespace NMR {
 		// Read buffer into memory
 		cbBytesRead = m_pImportStream->readIntoBuffer((nfByte*)(&((*m_pNextBuffer)[m_nCurrentBufferSize])), cbReadSize, false);
 		m_nCurrentBufferSize += (nfUint32)cbBytesRead;
+		m_nStreamBytesRead += cbBytesRead;
 
 		// Update Progress
 		m_pProgressMonitor->IncrementProgress(double(cbBytesRead));
@@ -449,6 +503,7 @@ namespace NMR {
 		std::vector<nfChar> * pDummy = m_pCurrentBuffer;
 		m_pCurrentBuffer = m_pNextBuffer;
 		m_pNextBuffer = pDummy;
+		m_nCurrentBufferStreamPosition = nNextBufferStreamPosition;
 
 		// parse Content
 		m_pCurrentEntityPointer = nullptr;
@@ -545,6 +600,10 @@ namespace NMR {
 	{
 		nfChar * pChar = pszStart;
 		while (pChar != pszEnd) {
+			pChar = m_pScanner->m_fnScanText(pChar, pszEnd);
+			if (pChar == pszEnd)
+				break;
+
 			switch (*pChar) {
 			case '<':
 				if (pChar+1 != pszEnd && *(pChar+1) == '!' &&
@@ -574,6 +633,10 @@ namespace NMR {
 	{
 		nfChar * pChar = pszStart;
 		while (pChar != pszEnd) {
+			pChar = m_pScanner->m_fnScanElementName(pChar, pszEnd);
+			if (pChar == pszEnd)
+				break;
+
 			switch (*pChar) {
 			case 9:  // Tab
 			case 10: // LF
@@ -703,6 +766,10 @@ namespace NMR {
 	{
 		nfChar * pChar = pszStart;
 		while (pChar != pszEnd) {
+			pChar = m_pScanner->m_fnScanEndElementName(pChar, pszEnd);
+			if (pChar == pszEnd)
+				break;
+
 			switch (*pChar) {
 			case 9:
 			case 10:
@@ -811,6 +878,12 @@ namespace NMR {
 		nfBool bHadSpacing = false;
 		nfChar * pChar = skipSpaces(pszStart, pszEnd);
 		while (pChar != pszEnd) {
+			if (!bHadSpacing) {
+				pChar = m_pScanner->m_fnScanAttributeName(pChar, pszEnd);
+				if (pChar == pszEnd)
+					break;
+			}
+
 			switch (*pChar) {
 			// name-ending characters
 			case 9:
@@ -888,6 +961,10 @@ namespace NMR {
 	{
 		nfChar * pChar = pszStart;
 		while (pChar != pszEnd) {
+			pChar = m_pScanner->m_fnScanDoubleQuote(pChar, pszEnd);
+			if (pChar == pszEnd)
+				break;
+
 			switch (*pChar) {
 
 			case 34:
@@ -909,6 +986,10 @@ namespace NMR {
 	{
 		nfChar * pChar = pszStart;
 		while (pChar != pszEnd) {
+			pChar = m_pScanner->m_fnScanSingleQuote(pChar, pszEnd);
+			if (pChar == pszEnd)
+				break;
+
 			switch (*pChar) {
 
 			case 39:
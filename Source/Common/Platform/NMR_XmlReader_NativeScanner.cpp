@@ -0,0 +1,244 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_XmlReader_NativeScanner.cpp implements the delimiter scanners of the native XML reader.
+The SIMD scanners compare a block of characters against every delimiter of the set and
+continue with the scalar scanner for the last, partial block.
+
+--*/
+
+#include "Common/Platform/NMR_XmlReader_NativeScanner.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NMR_XMLREADER_SCANNER_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define NMR_XMLREADER_TARGET_AVX2
+#else
+#define NMR_XMLREADER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace NMR {
+
+	template <nfChar... Delimiters>
+	class CXmlReaderNative_DelimiterSet {
+	public:
+		static inline nfBool isDelimiter(_In_ nfChar cChar)
+		{
+			return ((cChar == Delimiters) || ...);
+		}
+
+		static nfChar * scanScalar(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+		{
+			nfChar * pChar = pszStart;
+			while ((pChar != pszEnd) && !isDelimiter(*pChar))
+				pChar++;
+			return pChar;
+		}
+
+#ifdef NMR_XMLREADER_SCANNER_X64
+	private:
+		static inline nfUint32 firstBit(_In_ nfUint32 nMask)
+		{
+#ifdef _MSC_VER
+			unsigned long nIndex;
+			_BitScanForward(&nIndex, nMask);
+			return (nfUint32)nIndex;
+#else
+			return (nfUint32)__builtin_ctz(nMask);
+#endif
+		}
+
+		template <nfChar cDelimiter>
+		static inline __m128i matchSSE2(_In_ __m128i vBlock)
+		{
+			return _mm_cmpeq_epi8(vBlock, _mm_set1_epi8(cDelimiter));
+		}
+
+		template <nfChar cDelimiter, nfChar cNextDelimiter, nfChar... OtherDelimiters>
+		static inline __m128i matchSSE2(_In_ __m128i vBlock)
+		{
+			return _mm_or_si128(matchSSE2<cDelimiter>(vBlock), matchSSE2<cNextDelimiter, OtherDelimiters...>(vBlock));
+		}
+
+		template <nfChar cDelimiter>
+		NMR_XMLREADER_TARGET_AVX2 static inline __m256i matchAVX2(_In_ __m256i vBlock)
+		{
+			return _mm256_cmpeq_epi8(vBlock, _mm256_set1_epi8(cDelimiter));
+		}
+
+		template <nfChar cDelimiter, nfChar cNextDelimiter, nfChar... OtherDelimiters>
+		NMR_XMLREADER_TARGET_AVX2 static inline __m256i matchAVX2(_In_ __m256i vBlock)
+		{
+			return _mm256_or_si256(matchAVX2<cDelimiter>(vBlock), matchAVX2<cNextDelimiter, OtherDelimiters...>(vBlock));
+		}
+
+	public:
+		static nfChar * scanSSE2(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+		{
+			nfChar * pChar = pszStart;
+			while (pszEnd - pChar >= 16) {
+				__m128i vBlock = _mm_loadu_si128((const __m128i *) pChar);
+				nfUint32 nMask = (nfUint32)_mm_movemask_epi8(matchSSE2<Delimiters...>(vBlock));
+				if (nMask != 0)
+					return pChar + firstBit(nMask);
+				pChar += 16;
+			}
+			return scanScalar(pChar, pszEnd);
+		}
+
+		NMR_XMLREADER_TARGET_AVX2 static nfChar * scanAVX2(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+		{
+			nfChar * pChar = pszStart;
+			while (pszEnd - pChar >= 32) {
+				__m256i vBlock = _mm256_loadu_si256((const __m256i *) pChar);
+				nfUint32 nMask = (nfUint32)_mm256_movemask_epi8(matchAVX2<Delimiters...>(vBlock));
+				if (nMask != 0)
+					return pChar + firstBit(nMask);
+				pChar += 32;
+			}
+			return scanSSE2(pChar, pszEnd);
+		}
+#endif // NMR_XMLREADER_SCANNER_X64
+	};
+
+	typedef CXmlReaderNative_DelimiterSet<'<'> CXmlReaderNative_TextDelimiters;
+	typedef CXmlReaderNative_DelimiterSet<9, 10, 13, 32, '/', '?', '>'> CXmlReaderNative_ElementNameDelimiters;
+	typedef CXmlReaderNative_DelimiterSet<'/', '?', '>'> CXmlReaderNative_EndElementNameDelimiters;
+	typedef CXmlReaderNative_DelimiterSet<9, 10, 13, 32, 34, 39, '='> CXmlReaderNative_AttributeNameDelimiters;
+	typedef CXmlReaderNative_DelimiterSet<34> CXmlReaderNative_DoubleQuoteDelimiters;
+	typedef CXmlReaderNative_DelimiterSet<39> CXmlReaderNative_SingleQuoteDelimiters;
+
+	static const XMLREADERNATIVESCANNER XmlReaderNative_ScalarScanner = {
+		XMLREADERSCANLEVEL_SCALAR,
+		CXmlReaderNative_TextDelimiters::scanScalar,
+		CXmlReaderNative_ElementNameDelimiters::scanScalar,
+		CXmlReaderNative_EndElementNameDelimiters::scanScalar,
+		CXmlReaderNative_AttributeNameDelimiters::scanScalar,
+		CXmlReaderNative_DoubleQuoteDelimiters::scanScalar,
+		CXmlReaderNative_SingleQuoteDelimiters::scanScalar
+	};
+
+#ifdef NMR_XMLREADER_SCANNER_X64
+	static const XMLREADERNATIVESCANNER XmlReaderNative_SSE2Scanner = {
+		XMLREADERSCANLEVEL_SSE2,
+		CXmlReaderNative_TextDelimiters::scanSSE2,
+		CXmlReaderNative_ElementNameDelimiters::scanSSE2,
+		CXmlReaderNative_EndElementNameDelimiters::scanSSE2,
+		CXmlReaderNative_AttributeNameDelimiters::scanSSE2,
+		CXmlReaderNative_DoubleQuoteDelimiters::scanSSE2,
+		CXmlReaderNative_SingleQuoteDelimiters::scanSSE2
+	};
+
+	static const XMLREADERNATIVESCANNER XmlReaderNative_AVX2Scanner = {
+		XMLREADERSCANLEVEL_AVX2,
+		CXmlReaderNative_TextDelimiters::scanAVX2,
+		CXmlReaderNative_ElementNameDelimiters::scanAVX2,
+		CXmlReaderNative_EndElementNameDelimiters::scanAVX2,
+		CXmlReaderNative_AttributeNameDelimiters::scanAVX2,
+		CXmlReaderNative_DoubleQuoteDelimiters::scanAVX2,
+		CXmlReaderNative_SingleQuoteDelimiters::scanAVX2
+	};
+
+	static nfBool fnCPUSupportsAVX2()
+	{
+#ifdef _MSC_VER
+		int CPUInfo[4];
+		__cpuid(CPUInfo, 0);
+		if (CPUInfo[0] < 7)
+			return false;
+
+		// the OS has to save the YMM registers
+		__cpuid(CPUInfo, 1);
+		const int nOSXSaveAndAVX = (1 << 27) | (1 << 28);
+		if ((CPUInfo[2] & nOSXSaveAndAVX) != nOSXSaveAndAVX)
+			return false;
+		if ((_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(CPUInfo, 7, 0);
+		return (CPUInfo[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+#endif // NMR_XMLREADER_SCANNER_X64
+
+	static eXmlReaderNativeScanLevel fnGetCPUScanLevel()
+	{
+#ifdef NMR_XMLREADER_SCANNER_X64
+		// SSE2 is part of every x64 CPU
+		if (fnCPUSupportsAVX2())
+			return XMLREADERSCANLEVEL_AVX2;
+		return XMLREADERSCANLEVEL_SSE2;
+#else
+		return XMLREADERSCANLEVEL_SCALAR;
+#endif
+	}
+
+	eXmlReaderNativeScanLevel fnGetXmlReaderNativeScanLevel()
+	{
+		static const eXmlReaderNativeScanLevel eCPUScanLevel = fnGetCPUScanLevel();
+
+		eXmlReaderNativeScanLevel eLevel = eCPUScanLevel;
+		const char * pszOverride = getenv(NMR_XMLREADER_SCANLEVEL_ENVIRONMENTVARIABLE);
+		if (pszOverride != nullptr) {
+			if (strcmp(pszOverride, "scalar") == 0)
+				eLevel = XMLREADERSCANLEVEL_SCALAR;
+			else if ((strcmp(pszOverride, "sse2") == 0) && (eLevel > XMLREADERSCANLEVEL_SSE2))
+				eLevel = XMLREADERSCANLEVEL_SSE2;
+		}
+
+		return eLevel;
+	}
+
+	const XMLREADERNATIVESCANNER * fnGetXmlReaderNativeScanner(_In_ eXmlReaderNativeScanLevel eLevel)
+	{
+#ifdef NMR_XMLREADER_SCANNER_X64
+		static const eXmlReaderNativeScanLevel eCPUScanLevel = fnGetCPUScanLevel();
+		if (eLevel > eCPUScanLevel)
+			eLevel = eCPUScanLevel;
+
+		switch (eLevel) {
+		case XMLREADERSCANLEVEL_AVX2:
+			return &XmlReaderNative_AVX2Scanner;
+		case XMLREADERSCANLEVEL_SSE2:
+			return &XmlReaderNative_SSE2Scanner;
+		default:
+			return &XmlReaderNative_ScalarScanner;
+		}
+#else
+		return &XmlReaderNative_ScalarScanner;
+#endif
+	}
+
+}
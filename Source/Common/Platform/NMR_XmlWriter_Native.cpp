@@ -278,6 +278,28 @@ namespace NMR {
 		writeData(m_nLineEndingBuffer, m_nLineEndingCharCount);
 	}
 
+	PXmlWriter CXmlWriter_Native::CreateFragmentWriter(_In_ PExportStream pExportStream)
+	{
+		PXmlWriter_Native pFragmentWriter = std::make_shared<CXmlWriter_Native>(pExportStream);
+		pFragmentWriter->m_sNameSpaces = m_sNameSpaces;
+		pFragmentWriter->m_nLayer = m_nLayer;
+		return pFragmentWriter;
+	}
+
+	void CXmlWriter_Native::WriteFragment(_In_ const nfByte * pData, _In_ nfUint64 cbLength)
+	{
+		if (pData == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		// a fragment starts on a line of its own, as WriteStartElement would have started it
+		closeCurrentElement(true);
+
+		if (cbLength > 0) {
+			m_pExportStream->writeBuffer(pData, cbLength);
+			m_bIsFreshLine = (pData[cbLength - 1] == m_nLineEndingBuffer[m_nLineEndingCharCount - 1]);
+		}
+	}
+
 	void CXmlWriter_Native::escapeXMLString(_In_z_ const nfChar * pszString, _Out_ nfChar * pszBuffer)
 	{
 		__NMRASSERT(pszString);
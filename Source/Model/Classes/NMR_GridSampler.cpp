@@ -0,0 +1,259 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+
+#include "Model/Classes/NMR_GridSampler.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_ParallelJobs.h"
+#include "Model/Classes/NMR_Image3DSampler.h"
+#include "Model/Classes/NMR_ImplicitProgram.h"
+#include "Model/Classes/NMR_LevelSetSampler.h"
+#include "Model/Classes/NMR_ModelImplicitFunction.h"
+#include "lib3mf_interfaceexception.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            size_t constexpr MinTilesPerJob = 2;
+
+            size_t pointCount(size_t const* pCounts)
+            {
+                return pCounts[0] * pCounts[1] * pCounts[2];
+            }
+        }  // namespace
+
+        GridSampler::GridSampler(double const* pOrigin, double const* pSpacing, size_t const* pCounts)
+        {
+            bool const bLayer = pCounts[2] == 1;
+            size_t const maxPointCount = std::numeric_limits<size_t>::max() / sizeof(double);
+            size_t points = 1;
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                m_origin[axis] = pOrigin[axis];
+                m_spacing[axis] = pSpacing[axis];
+                m_counts[axis] = pCounts[axis];
+                m_tileSize[axis] = bLayer ? ((axis < 2) ? LayerTileSize : 1) : TileSize;
+                m_tileCounts[axis] = (m_counts[axis] + m_tileSize[axis] - 1) / m_tileSize[axis];
+                if (m_counts[axis] > 0 && points > maxPointCount / m_counts[axis])
+                {
+                    throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                                    "The grid has too many points.");
+                }
+                points *= m_counts[axis];
+            }
+            if (getTileCount() > std::numeric_limits<uint32_t>::max())
+            {
+                throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                                "The grid has too many points.");
+            }
+        }
+
+        size_t GridSampler::getPointCount() const
+        {
+            return pointCount(m_counts);
+        }
+
+        size_t GridSampler::getTileCount() const
+        {
+            return pointCount(m_tileCounts);
+        }
+
+        size_t GridSampler::getJobCount() const
+        {
+            return fnGetParallelJobCount(getTileCount(), MinTilesPerJob);
+        }
+
+        void GridSampler::sampleFunction(CModelImplicitFunction& function,
+                                         std::string const& outputIdentifier,
+                                         float* pValues,
+                                         CProgressMonitor* pProgressMonitor) const
+        {
+            Program const program(function, outputIdentifier);
+            if (program.getInputComponentCount() != 3 || program.getOutputComponentCount() != 1)
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_INVALIDPARAM,
+                    "Function " + function.getIdentifier() + " needs inputs with 3 components and a scalar output " +
+                        outputIdentifier + " to be sampled on a grid.");
+            }
+
+            struct Workspace
+            {
+                Registers registers;
+                std::vector<double> inputs;
+            };
+            std::vector<Workspace> workspaces(getJobCount());
+
+            sampleTiles(
+                [&](size_t nJob, double const* pOrigin, size_t const* pCounts, double* pTileValues)
+                {
+                    auto& workspace = workspaces[nJob];
+                    size_t const count = pointCount(pCounts);
+                    auto& inputs = workspace.inputs;
+                    inputs.resize(count * 3);
+
+                    size_t index = 0;
+                    for (size_t k = 0; k < pCounts[2]; ++k)
+                    {
+                        for (size_t j = 0; j < pCounts[1]; ++j)
+                        {
+                            for (size_t i = 0; i < pCounts[0]; ++i, ++index)
+                            {
+                                inputs[index] = pOrigin[0] + i * m_spacing[0];
+                                inputs[count + index] = pOrigin[1] + j * m_spacing[1];
+                                inputs[2 * count + index] = pOrigin[2] + k * m_spacing[2];
+                            }
+                        }
+                    }
+                    program.evaluateRange(workspace.registers, inputs.data(), count, pTileValues, count, 0, count);
+                },
+                pValues, pProgressMonitor);
+        }
+
+        void GridSampler::sampleLevelSet(LevelSetSampler const& sampler,
+                                         float* pValues,
+                                         CProgressMonitor* pProgressMonitor) const
+        {
+            std::vector<LevelSetSampler::Workspace> workspaces(getJobCount());
+            sampleTiles(
+                [&](size_t nJob, double const* pOrigin, size_t const* pCounts, double* pTileValues)
+                {
+                    sampler.sampleGrid(pOrigin, m_spacing, pCounts, pTileValues, workspaces[nJob]);
+                },
+                pValues, pProgressMonitor);
+        }
+
+        void GridSampler::sampleImage3D(Image3DSampler const& sampler,
+                                        size_t nChannel,
+                                        float* pValues,
+                                        CProgressMonitor* pProgressMonitor) const
+        {
+            std::vector<std::vector<double>> workspaces(getJobCount());
+            sampleTiles(
+                [&](size_t nJob, double const* pOrigin, size_t const* pCounts, double* pTileValues)
+                {
+                    size_t const count = pointCount(pCounts);
+                    auto& coordinates = workspaces[nJob];
+                    coordinates.resize(count * 3);
+
+                    size_t index = 0;
+                    for (size_t k = 0; k < pCounts[2]; ++k)
+                    {
+                        for (size_t j = 0; j < pCounts[1]; ++j)
+                        {
+                            for (size_t i = 0; i < pCounts[0]; ++i, ++index)
+                            {
+                                coordinates[index] = pOrigin[0] + i * m_spacing[0];
+                                coordinates[count + index] = pOrigin[1] + j * m_spacing[1];
+                                coordinates[2 * count + index] = pOrigin[2] + k * m_spacing[2];
+                            }
+                        }
+                    }
+                    sampler.sample(nChannel, coordinates.data(), coordinates.data() + count,
+                                   coordinates.data() + 2 * count, pTileValues, count);
+                },
+                pValues, pProgressMonitor);
+        }
+
+        void GridSampler::sampleTiles(TileFunction const& sampleTile,
+                                      float* pValues,
+                                      CProgressMonitor* pProgressMonitor) const
+        {
+            size_t const tileCount = getTileCount();
+            if (tileCount == 0)
+            {
+                return;
+            }
+
+            if (pProgressMonitor)
+            {
+                pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_SAMPLEGRID);
+                pProgressMonitor->SetMaxProgress(static_cast<double>(tileCount));
+                pProgressMonitor->ReportProgressAndQueryCancelled(true);
+            }
+
+            size_t const jobCount = getJobCount();
+            std::vector<std::vector<double>> buffers(jobCount);
+            std::atomic<size_t> finishedTiles(0);
+            size_t reportedTiles = 0;
+
+            fnRunStealingJobs(
+                static_cast<nfUint32>(jobCount), static_cast<nfUint32>(tileCount),
+                [&](nfUint32 nJob, nfUint32 nTile)
+                {
+                    size_t const tile[3] = {nTile % m_tileCounts[0], (nTile / m_tileCounts[0]) % m_tileCounts[1],
+                                            nTile / (m_tileCounts[0] * m_tileCounts[1])};
+                    size_t first[3];
+                    size_t counts[3];
+                    double origin[3];
+                    for (size_t axis = 0; axis < 3; ++axis)
+                    {
+                        first[axis] = tile[axis] * m_tileSize[axis];
+                        counts[axis] = std::min(m_tileSize[axis], m_counts[axis] - first[axis]);
+                        origin[axis] = m_origin[axis] + first[axis] * m_spacing[axis];
+                    }
+
+                    auto& buffer = buffers[nJob];
+                    buffer.resize(pointCount(counts));
+                    sampleTile(nJob, origin, counts, buffer.data());
+
+                    double const* pSource = buffer.data();
+                    for (size_t k = 0; k < counts[2]; ++k)
+                    {
+                        for (size_t j = 0; j < counts[1]; ++j)
+                        {
+                            float* pTarget = pValues + ((first[2] + k) * m_counts[1] + first[1] + j) * m_counts[0] + first[0];
+                            for (size_t i = 0; i < counts[0]; ++i)
+                            {
+                                pTarget[i] = static_cast<float>(pSource[i]);
+                            }
+                            pSource += counts[0];
+                        }
+                    }
+
+                    size_t const finished = ++finishedTiles;
+                    if (nJob == 0 && pProgressMonitor)
+                    {
+                        // Job 0 runs on the calling thread
+                        pProgressMonitor->IncrementProgress(static_cast<double>(finished - reportedTiles));
+                        reportedTiles = finished;
+                        pProgressMonitor->ReportProgressAndQueryCancelled(true);
+                    }
+                });
+        }
+    }  // namespace implicit
+}  // namespace NMR
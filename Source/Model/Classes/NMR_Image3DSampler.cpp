@@ -0,0 +1,250 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#include "Model/Classes/NMR_Image3DSampler.h"
+
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
+#include "Model/Classes/NMR_ModelImageStack.h"
+#include "Model/Classes/NMR_ModelImplicitPortNames.h"
+#include "lib3mf_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            // Larger positions are clamped before they are converted to voxel indices
+            double constexpr MaxPosition = 4503599627370496.;  // 2^52
+
+            // Number of brick layers a call of Image3DSampler::sample keeps referenced
+            size_t constexpr LayerSlotCount = 4;
+
+            // Up to two voxels along one axis and their weights
+            struct AxisSamples
+            {
+                int64_t indices[2];
+                double weights[2];
+                size_t count;
+            };
+
+            // Maps a voxel index into [0, count), or to -1 outside of the image with tile style none
+            int64_t tileIndex(int64_t index, int64_t count, eModelTextureTileStyle tileStyle)
+            {
+                if (index >= 0 && index < count)
+                {
+                    return index;
+                }
+                switch (tileStyle)
+                {
+                    case MODELTEXTURETILESTYLE_WRAP:
+                    {
+                        int64_t const wrapped = index % count;
+                        return (wrapped < 0) ? wrapped + count : wrapped;
+                    }
+                    case MODELTEXTURETILESTYLE_MIRROR:
+                    {
+                        int64_t const period = 2 * count;
+                        int64_t wrapped = index % period;
+                        if (wrapped < 0)
+                        {
+                            wrapped += period;
+                        }
+                        return (wrapped < count) ? wrapped : period - 1 - wrapped;
+                    }
+                    case MODELTEXTURETILESTYLE_CLAMP:
+                        return (index < 0) ? 0 : count - 1;
+                    default:
+                        return -1;
+                }
+            }
+
+            void computeAxisSamples(double coordinate,
+                                    size_t count,
+                                    eModelTextureTileStyle tileStyle,
+                                    bool bNearest,
+                                    AxisSamples& samples)
+            {
+                double const position = std::max(-MaxPosition, std::min(MaxPosition, coordinate * count));
+                if (bNearest)
+                {
+                    samples.indices[0] = static_cast<int64_t>(std::floor(position));
+                    samples.weights[0] = 1.;
+                    samples.count = 1;
+                }
+                else
+                {
+                    // Linear interpolation between voxel centers
+                    double const centered = position - 0.5;
+                    double const lower = std::floor(centered);
+                    double const fraction = centered - lower;
+                    samples.indices[0] = static_cast<int64_t>(lower);
+                    samples.indices[1] = samples.indices[0] + 1;
+                    samples.weights[0] = 1. - fraction;
+                    samples.weights[1] = fraction;
+                    samples.count = 2;
+                }
+
+                for (size_t index = 0; index < samples.count; ++index)
+                {
+                    samples.indices[index] = tileIndex(samples.indices[index], static_cast<int64_t>(count), tileStyle);
+                }
+            }
+        }  // namespace
+
+        Image3DSampler::Image3DSampler(CModelFunctionFromImage3D& function)
+        {
+            CModel* pModel = function.getModel();
+            auto pImageStack = std::dynamic_pointer_cast<CModelImageStack>(
+                pModel->findResource(function.getImage3DUniqueResourceID()));
+            if (!pImageStack)
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_INVALIDPARAM,
+                    "Function " + std::to_string(function.getPackageResourceID()->getModelResourceID()) +
+                        " does not reference an image stack.");
+            }
+
+            m_pImageStack = pImageStack;
+            m_pCache = pImageStack->getCache();
+            m_counts[0] = m_pCache->getColumnCount();
+            m_counts[1] = m_pCache->getRowCount();
+            m_counts[2] = m_pCache->getSheetCount();
+            m_tileStyles[0] = function.getTileStyleU();
+            m_tileStyles[1] = function.getTileStyleV();
+            m_tileStyles[2] = function.getTileStyleW();
+            m_bNearest = function.getFilter() == MODELTEXTUREFILTER_NEAREST;
+            m_offset = function.getOffset();
+            m_scale = function.getScale();
+        }
+
+        size_t Image3DSampler::findChannel(std::string const& outputIdentifier)
+        {
+            static char const* const channelNames[ChannelCount] = {
+                OutputNames::red, OutputNames::green, OutputNames::blue, OutputNames::alpha};
+            for (size_t channel = 0; channel < ChannelCount; ++channel)
+            {
+                if (outputIdentifier == channelNames[channel])
+                {
+                    return channel;
+                }
+            }
+            return ChannelCount;
+        }
+
+        void Image3DSampler::sample(size_t nChannel,
+                                    double const* pU,
+                                    double const* pV,
+                                    double const* pW,
+                                    double* pValues,
+                                    size_t nCount) const
+        {
+            // Recently used brick layers, indexed by the layer index modulo the slot count
+            nfUint32 slotLayers[LayerSlotCount];
+            PImageStackBrickLayer slots[LayerSlotCount];
+            std::fill_n(slotLayers, LayerSlotCount, std::numeric_limits<nfUint32>::max());
+
+            double const valueScale = m_scale / 65535.;
+            for (size_t point = 0; point < nCount; ++point)
+            {
+                double const coordinates[3] = {pU[point], pV[point], pW[point]};
+                if (std::isnan(coordinates[0]) || std::isnan(coordinates[1]) || std::isnan(coordinates[2]))
+                {
+                    pValues[point] = std::numeric_limits<double>::quiet_NaN();
+                    continue;
+                }
+
+                AxisSamples samples[3];
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    computeAxisSamples(coordinates[axis], m_counts[axis], m_tileStyles[axis], m_bNearest, samples[axis]);
+                }
+
+                double value = 0.;
+                for (size_t k = 0; k < samples[2].count; ++k)
+                {
+                    int64_t const sheet = samples[2].indices[k];
+                    if (sheet < 0)
+                    {
+                        continue;
+                    }
+
+                    nfUint32 const layer = static_cast<nfUint32>(sheet / IMAGESTACKCACHE_BRICKSIZE);
+                    size_t const slot = layer % LayerSlotCount;
+                    if (slotLayers[slot] != layer)
+                    {
+                        slots[slot] = m_pCache->getLayer(layer);
+                        slotLayers[slot] = layer;
+                    }
+                    CImageStackBrickLayer const& bricks = *slots[slot];
+                    nfUint32 const sheetInLayer = static_cast<nfUint32>(sheet % IMAGESTACKCACHE_BRICKSIZE);
+
+                    for (size_t j = 0; j < samples[1].count; ++j)
+                    {
+                        int64_t const row = samples[1].indices[j];
+                        if (row < 0)
+                        {
+                            continue;
+                        }
+                        for (size_t i = 0; i < samples[0].count; ++i)
+                        {
+                            int64_t const column = samples[0].indices[i];
+                            if (column < 0)
+                            {
+                                continue;
+                            }
+                            double const weight = samples[0].weights[i] * samples[1].weights[j] * samples[2].weights[k];
+                            nfUint16 const* pVoxel = bricks.getVoxel(static_cast<nfUint32>(column),
+                                                                     static_cast<nfUint32>(row), sheetInLayer);
+                            value += weight * pVoxel[nChannel];
+                        }
+                    }
+                }
+
+                pValues[point] = m_offset + valueScale * value;
+            }
+        }
+
+        void Image3DSampler::getRange(double& dMin, double& dMax) const
+        {
+            dMin = std::min(m_offset, m_offset + m_scale);
+            dMax = std::max(m_offset, m_offset + m_scale);
+        }
+
+        bool Image3DSampler::isUpToDate() const
+        {
+            auto pImageStack = m_pImageStack.lock();
+            return pImageStack && m_pCache->isValidFor(*pImageStack);
+        }
+    }  // namespace implicit
+}  // namespace NMR
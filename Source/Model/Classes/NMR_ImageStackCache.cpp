@@ -0,0 +1,219 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImageStackCache.cpp implements the cache of the decoded voxels of an image
+stack. The sheets of a brick layer are read from their attachments one after
+another and decoded in parallel.
+
+--*/
+
+#include "Model/Classes/NMR_ImageStackCache.h"
+#include "Model/Classes/NMR_ModelImageStack.h"
+#include "Model/Classes/NMR_ModelAttachment.h"
+
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_ParallelJobs.h"
+#include "Common/NMR_PNGDecoder.h"
+
+#include <algorithm>
+
+namespace NMR {
+
+	CImageStackBrickLayer::CImageStackBrickLayer(_In_ nfUint32 nBrickCountX, _In_ nfUint32 nBrickCountY)
+		: m_nBrickCountX(nBrickCountX)
+	{
+		nfUint64 nVoxelCount = (nfUint64)nBrickCountX * nBrickCountY * IMAGESTACKCACHE_BRICKSIZE * IMAGESTACKCACHE_BRICKSIZE * IMAGESTACKCACHE_BRICKSIZE;
+		m_Voxels.resize((size_t)(nVoxelCount * 4));
+	}
+
+	nfUint64 CImageStackBrickLayer::getMemoryUsage() const
+	{
+		return m_Voxels.size() * sizeof(nfUint16);
+	}
+
+	CImageStackCache::CImageStackCache(_In_ CModelImageStack & ImageStack, _In_ nfUint64 nMemoryBudget)
+		: m_nColumnCount(ImageStack.getColumnCount()), m_nRowCount(ImageStack.getRowCount()), m_nSheetCount(ImageStack.getSheetCount()),
+		m_nMemoryBudget(nMemoryBudget), m_nMemoryUsage(0)
+	{
+		if ((m_nColumnCount == 0) || (m_nRowCount == 0) || (m_nSheetCount == 0))
+			throw CNMRException(NMR_ERROR_INVALIDIMAGE3DSIZE);
+
+		m_Sheets.resize(m_nSheetCount);
+		for (nfUint32 nSheet = 0; nSheet < m_nSheetCount; nSheet++)
+			m_Sheets[nSheet] = ImageStack.getSheet(nSheet);
+
+		m_Layers.resize(getLayerCount());
+		m_UsagePositions.resize(getLayerCount(), m_Usage.end());
+	}
+
+	nfUint32 CImageStackCache::getColumnCount() const
+	{
+		return m_nColumnCount;
+	}
+
+	nfUint32 CImageStackCache::getRowCount() const
+	{
+		return m_nRowCount;
+	}
+
+	nfUint32 CImageStackCache::getSheetCount() const
+	{
+		return m_nSheetCount;
+	}
+
+	nfUint32 CImageStackCache::getLayerCount() const
+	{
+		return (m_nSheetCount + IMAGESTACKCACHE_BRICKSIZE - 1) / IMAGESTACKCACHE_BRICKSIZE;
+	}
+
+	nfBool CImageStackCache::isValidFor(_In_ CModelImageStack & ImageStack) const
+	{
+		if ((ImageStack.getColumnCount() != m_nColumnCount) || (ImageStack.getRowCount() != m_nRowCount) || (ImageStack.getSheetCount() != m_nSheetCount))
+			return false;
+		for (nfUint32 nSheet = 0; nSheet < m_nSheetCount; nSheet++) {
+			if (ImageStack.getSheet(nSheet) != m_Sheets[nSheet])
+				return false;
+		}
+		return true;
+	}
+
+	PImageStackBrickLayer CImageStackCache::findLayer(_In_ nfUint32 nLayer)
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		PImageStackBrickLayer pLayer = m_Layers[nLayer];
+		if (pLayer)
+			m_Usage.splice(m_Usage.begin(), m_Usage, m_UsagePositions[nLayer]);
+		return pLayer;
+	}
+
+	PImageStackBrickLayer CImageStackCache::getLayer(_In_ nfUint32 nLayer)
+	{
+		if (nLayer >= getLayerCount())
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		PImageStackBrickLayer pLayer = findLayer(nLayer);
+		if (pLayer)
+			return pLayer;
+
+		std::lock_guard<std::mutex> DecodeLock(m_DecodeMutex);
+		// Another thread may have decoded the layer in the meantime
+		pLayer = findLayer(nLayer);
+		if (pLayer)
+			return pLayer;
+
+		pLayer = decodeLayer(nLayer);
+
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		m_Layers[nLayer] = pLayer;
+		m_Usage.push_front(nLayer);
+		m_UsagePositions[nLayer] = m_Usage.begin();
+		m_nMemoryUsage += pLayer->getMemoryUsage();
+		evictLayers();
+
+		return pLayer;
+	}
+
+	void CImageStackCache::evictLayers()
+	{
+		// The most recently used layer is kept even if it exceeds the budget on its own
+		while ((m_nMemoryUsage > m_nMemoryBudget) && (m_Usage.size() > 1)) {
+			nfUint32 nEvicted = m_Usage.back();
+			m_Usage.pop_back();
+			m_nMemoryUsage -= m_Layers[nEvicted]->getMemoryUsage();
+			m_Layers[nEvicted].reset();
+			m_UsagePositions[nEvicted] = m_Usage.end();
+		}
+	}
+
+	PImageStackBrickLayer CImageStackCache::decodeLayer(_In_ nfUint32 nLayer)
+	{
+		nfUint32 nFirstSheet = nLayer * IMAGESTACKCACHE_BRICKSIZE;
+		nfUint32 nSheetCount = std::min(IMAGESTACKCACHE_BRICKSIZE, m_nSheetCount - nFirstSheet);
+
+		// Attachment streams are not thread safe, so the encoded sheets are read first
+		std::vector<std::vector<nfByte>> EncodedSheets(nSheetCount);
+		for (nfUint32 nSheet = 0; nSheet < nSheetCount; nSheet++) {
+			PModelAttachment pAttachment = m_Sheets[nFirstSheet + nSheet];
+			if (!pAttachment || !pAttachment->getStream())
+				throw CNMRException(NMR_ERROR_IMAGESHEETNOTFOUND);
+
+			PImportStream pStream = pAttachment->getStream();
+			nfUint64 cbSize = pStream->retrieveSize();
+			EncodedSheets[nSheet].resize((size_t)cbSize);
+			pStream->seekPosition(0, true);
+			if (cbSize > 0)
+				pStream->readIntoBuffer(EncodedSheets[nSheet].data(), cbSize, true);
+		}
+
+		nfUint32 nBrickCountX = (m_nColumnCount + IMAGESTACKCACHE_BRICKSIZE - 1) / IMAGESTACKCACHE_BRICKSIZE;
+		nfUint32 nBrickCountY = (m_nRowCount + IMAGESTACKCACHE_BRICKSIZE - 1) / IMAGESTACKCACHE_BRICKSIZE;
+		std::shared_ptr<CImageStackBrickLayer> pLayer = std::make_shared<CImageStackBrickLayer>(nBrickCountX, nBrickCountY);
+
+		// Every sheet fills its own slice of the bricks
+		nfUint32 nJobCount = fnGetParallelJobCount(nSheetCount, 1);
+		fnRunParallelJobs(nJobCount, [&](nfUint32 nJob) {
+			for (nfUint32 nSheet = nJob; nSheet < nSheetCount; nSheet += nJobCount) {
+				sPNGImage Image;
+				fnDecodePNG(EncodedSheets[nSheet].data(), EncodedSheets[nSheet].size(), Image);
+				EncodedSheets[nSheet].clear();
+				if ((Image.m_nWidth != m_nColumnCount) || (Image.m_nHeight != m_nRowCount))
+					throw CNMRException(NMR_ERROR_INVALIDIMAGE3DSIZE);
+
+				const nfUint16 * pSource = Image.m_RGBA.data();
+				for (nfUint32 nY = 0; nY < m_nRowCount; nY++) {
+					for (nfUint32 nX = 0; nX < m_nColumnCount; nX++) {
+						std::copy(pSource, pSource + 4, pLayer->getVoxel(nX, nY, nSheet));
+						pSource += 4;
+					}
+				}
+			}
+		});
+
+		return pLayer;
+	}
+
+	nfUint64 CImageStackCache::getMemoryBudget()
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		return m_nMemoryBudget;
+	}
+
+	void CImageStackCache::setMemoryBudget(_In_ nfUint64 nMemoryBudget)
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		m_nMemoryBudget = nMemoryBudget;
+		evictLayers();
+	}
+
+	nfUint64 CImageStackCache::getMemoryUsage()
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		return m_nMemoryUsage;
+	}
+
+}
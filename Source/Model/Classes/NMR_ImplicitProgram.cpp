@@ -0,0 +1,1873 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#include "Model/Classes/NMR_ImplicitProgram.h"
+
+#include "Common/NMR_ParallelJobs.h"
+#include "Model/Classes/NMR_Image3DSampler.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
+#include "Model/Classes/NMR_ModelImplicitFunction.h"
+#include "Model/Classes/NMR_ModelImplicitPortNames.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "lib3mf_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            using ValueId = uint32_t;
+            ValueId constexpr NoValue = std::numeric_limits<ValueId>::max();
+
+            // Minimum number of chunks a thread of Program::evaluate processes
+            size_t constexpr MinChunksPerThread = 8;
+
+            double constexpr Pi = 3.14159265358979323846;
+
+            struct Value
+            {
+                OpCode op;
+                ValueId args[4];
+                uint32_t aux;
+                double constant;
+            };
+
+            struct ValueKey
+            {
+                OpCode op;
+                ValueId args[4];
+                uint32_t aux;
+                uint64_t constantBits;
+
+                bool operator==(ValueKey const& other) const
+                {
+                    return op == other.op && aux == other.aux &&
+                           constantBits == other.constantBits &&
+                           std::equal(args, args + 4, other.args);
+                }
+            };
+
+            struct ValueKeyHash
+            {
+                size_t operator()(ValueKey const& key) const
+                {
+                    uint64_t hash = static_cast<uint64_t>(key.op) * 0x9E3779B97F4A7C15ull;
+                    auto combine = [&hash](uint64_t value)
+                    {
+                        hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+                    };
+                    for (auto arg : key.args)
+                    {
+                        combine(arg);
+                    }
+                    combine(key.aux);
+                    combine(key.constantBits);
+                    return static_cast<size_t>(hash);
+                }
+            };
+
+            size_t argumentCount(OpCode op)
+            {
+                switch (op)
+                {
+                    case OpCode::Constant:
+                    case OpCode::Input:
+                        return 0;
+                    case OpCode::Add:
+                    case OpCode::Sub:
+                    case OpCode::Mul:
+                    case OpCode::Div:
+                    case OpCode::Min:
+                    case OpCode::Max:
+                    case OpCode::Pow:
+                    case OpCode::Fmod:
+                    case OpCode::Mod:
+                    case OpCode::ArcTan2:
+                        return 2;
+                    case OpCode::MeshDistance:
+                    case OpCode::UnsignedMeshDistance:
+                    case OpCode::ImageSample:
+                        return 3;
+                    case OpCode::Select:
+                        return 4;
+                    default:
+                        return 1;
+                }
+            }
+
+            bool isCommutative(OpCode op)
+            {
+                return op == OpCode::Add || op == OpCode::Mul ||
+                       op == OpCode::Min || op == OpCode::Max;
+            }
+
+            size_t componentCount(Lib3MF::eImplicitPortType type)
+            {
+                switch (type)
+                {
+                    case Lib3MF::eImplicitPortType::Scalar:
+                        return 1;
+                    case Lib3MF::eImplicitPortType::Vector:
+                        return 3;
+                    case Lib3MF::eImplicitPortType::Matrix:
+                        return 16;
+                    default:
+                        return 0;
+                }
+            }
+
+            template <typename F>
+            inline void applyUnary(double* r, double const* a, size_t n, F f)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    r[i] = f(a[i]);
+                }
+            }
+
+            template <typename F>
+            inline void applyBinary(double* r, double const* a, double const* b, size_t n, F f)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    r[i] = f(a[i], b[i]);
+                }
+            }
+
+            // Evaluates an arithmetic instruction on n points. Also used for
+            // constant folding with n = 1.
+            void executeKernel(OpCode op,
+                               double* r,
+                               double const* const* args,
+                               size_t n)
+            {
+                double const* a = args[0];
+                double const* b = args[1];
+                switch (op)
+                {
+                    case OpCode::Add:
+                        applyBinary(r, a, b, n, [](double x, double y) { return x + y; });
+                        break;
+                    case OpCode::Sub:
+                        applyBinary(r, a, b, n, [](double x, double y) { return x - y; });
+                        break;
+                    case OpCode::Mul:
+                        applyBinary(r, a, b, n, [](double x, double y) { return x * y; });
+                        break;
+                    case OpCode::Div:
+                        applyBinary(r, a, b, n, [](double x, double y) { return x / y; });
+                        break;
+                    case OpCode::Min:
+                        applyBinary(r, a, b, n, [](double x, double y) { return (y < x) ? y : x; });
+                        break;
+                    case OpCode::Max:
+                        applyBinary(r, a, b, n, [](double x, double y) { return (x < y) ? y : x; });
+                        break;
+                    case OpCode::Pow:
+                        applyBinary(r, a, b, n, [](double x, double y) { return std::pow(x, y); });
+                        break;
+                    case OpCode::Fmod:
+                        applyBinary(r, a, b, n, [](double x, double y) { return std::fmod(x, y); });
+                        break;
+                    case OpCode::Mod:
+                        applyBinary(r, a, b, n, [](double x, double y) { return x - y * std::floor(x / y); });
+                        break;
+                    case OpCode::ArcTan2:
+                        applyBinary(r, a, b, n, [](double x, double y) { return std::atan2(x, y); });
+                        break;
+                    case OpCode::Sin:
+                        applyUnary(r, a, n, [](double x) { return std::sin(x); });
+                        break;
+                    case OpCode::Cos:
+                        applyUnary(r, a, n, [](double x) { return std::cos(x); });
+                        break;
+                    case OpCode::Tan:
+                        applyUnary(r, a, n, [](double x) { return std::tan(x); });
+                        break;
+                    case OpCode::ArcSin:
+                        applyUnary(r, a, n, [](double x) { return std::asin(x); });
+                        break;
+                    case OpCode::ArcCos:
+                        applyUnary(r, a, n, [](double x) { return std::acos(x); });
+                        break;
+                    case OpCode::ArcTan:
+                        applyUnary(r, a, n, [](double x) { return std::atan(x); });
+                        break;
+                    case OpCode::Sinh:
+                        applyUnary(r, a, n, [](double x) { return std::sinh(x); });
+                        break;
+                    case OpCode::Cosh:
+                        applyUnary(r, a, n, [](double x) { return std::cosh(x); });
+                        break;
+                    case OpCode::Tanh:
+                        applyUnary(r, a, n, [](double x) { return std::tanh(x); });
+                        break;
+                    case OpCode::Abs:
+                        applyUnary(r, a, n, [](double x) { return std::fabs(x); });
+                        break;
+                    case OpCode::Sqrt:
+                        applyUnary(r, a, n, [](double x) { return std::sqrt(x); });
+                        break;
+                    case OpCode::Exp:
+                        applyUnary(r, a, n, [](double x) { return std::exp(x); });
+                        break;
+                    case OpCode::Log:
+                        applyUnary(r, a, n, [](double x) { return std::log(x); });
+                        break;
+                    case OpCode::Log2:
+                        applyUnary(r, a, n, [](double x) { return std::log2(x); });
+                        break;
+                    case OpCode::Log10:
+                        applyUnary(r, a, n, [](double x) { return std::log10(x); });
+                        break;
+                    case OpCode::Round:
+                        applyUnary(r, a, n, [](double x) { return std::round(x); });
+                        break;
+                    case OpCode::Ceil:
+                        applyUnary(r, a, n, [](double x) { return std::ceil(x); });
+                        break;
+                    case OpCode::Floor:
+                        applyUnary(r, a, n, [](double x) { return std::floor(x); });
+                        break;
+                    case OpCode::Sign:
+                        applyUnary(r, a, n, [](double x) { return (x > 0.) ? 1. : ((x < 0.) ? -1. : 0.); });
+                        break;
+                    case OpCode::Fract:
+                        applyUnary(r, a, n, [](double x) { return x - std::floor(x); });
+                        break;
+                    case OpCode::Select:
+                    {
+                        double const* c = args[2];
+                        double const* d = args[3];
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            r[i] = (a[i] < b[i]) ? c[i] : d[i];
+                        }
+                        break;
+                    }
+                    default:
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_GENERICEXCEPTION,
+                            "Invalid instruction in implicit program.");
+                }
+            }
+
+            Interval unbounded()
+            {
+                double const infinity = std::numeric_limits<double>::infinity();
+                return {-infinity, infinity};
+            }
+
+            template <typename F>
+            Interval increasing(Interval const& a, F f)
+            {
+                return {f(a.lo), f(a.hi)};
+            }
+
+            // Hull of f applied to the corners of a x b
+            template <typename F>
+            Interval corners(Interval const& a, Interval const& b, F f)
+            {
+                double const values[4] = {f(a.lo, b.lo), f(a.lo, b.hi), f(a.hi, b.lo), f(a.hi, b.hi)};
+                if (std::any_of(values, values + 4, [](double value) { return std::isnan(value); }))
+                {
+                    return unbounded();
+                }
+                return {*std::min_element(values, values + 4), *std::max_element(values, values + 4)};
+            }
+
+            // Whether phase + 2 pi k lies in a for some integer k
+            bool containsPeriodic(Interval const& a, double phase)
+            {
+                double const k = std::ceil((a.lo - phase) / (2. * Pi));
+                return phase + 2. * Pi * k <= a.hi;
+            }
+
+            Interval boundSin(Interval const& a)
+            {
+                if (a.hi - a.lo >= 2. * Pi)
+                {
+                    return {-1., 1.};
+                }
+                double const lo = std::sin(a.lo);
+                double const hi = std::sin(a.hi);
+                return {containsPeriodic(a, -0.5 * Pi) ? -1. : std::min(lo, hi),
+                        containsPeriodic(a, 0.5 * Pi) ? 1. : std::max(lo, hi)};
+            }
+
+            // Bounds of an arithmetic instruction for arguments within args
+            Interval boundKernel(OpCode op, Interval const* args)
+            {
+                Interval const& a = args[0];
+                Interval const& b = args[1];
+                switch (op)
+                {
+                    case OpCode::Add:
+                        return {a.lo + b.lo, a.hi + b.hi};
+                    case OpCode::Sub:
+                        return {a.lo - b.hi, a.hi - b.lo};
+                    case OpCode::Mul:
+                        return corners(a, b, [](double x, double y) { return x * y; });
+                    case OpCode::Div:
+                        if (b.lo <= 0. && b.hi >= 0.)
+                        {
+                            return unbounded();
+                        }
+                        return corners(a, b, [](double x, double y) { return x / y; });
+                    case OpCode::Min:
+                        return {std::min(a.lo, b.lo), std::min(a.hi, b.hi)};
+                    case OpCode::Max:
+                        return {std::max(a.lo, b.lo), std::max(a.hi, b.hi)};
+                    case OpCode::Pow:
+                        // pow is monotonic in both arguments for positive bases
+                        if (a.lo <= 0.)
+                        {
+                            return unbounded();
+                        }
+                        return corners(a, b, [](double x, double y) { return std::pow(x, y); });
+                    case OpCode::Fmod:
+                    {
+                        if (b.lo <= 0. && b.hi >= 0.)
+                        {
+                            return unbounded();
+                        }
+                        double const m = std::max(std::fabs(b.lo), std::fabs(b.hi));
+                        return {std::max(-m, std::min(a.lo, 0.)), std::min(m, std::max(a.hi, 0.))};
+                    }
+                    case OpCode::Mod:
+                        if (b.lo > 0.)
+                        {
+                            return {0., b.hi};
+                        }
+                        if (b.hi < 0.)
+                        {
+                            return {b.lo, 0.};
+                        }
+                        return unbounded();
+                    case OpCode::ArcTan2:
+                        return {-Pi, Pi};
+                    case OpCode::Sin:
+                        return boundSin(a);
+                    case OpCode::Cos:
+                        return boundSin({a.lo + 0.5 * Pi, a.hi + 0.5 * Pi});
+                    case OpCode::Tan:
+                        // tan is increasing between its poles at pi/2 + k pi
+                        if (a.hi - a.lo >= Pi || containsPeriodic(a, 0.5 * Pi) || containsPeriodic(a, -0.5 * Pi))
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::tan(x); });
+                    case OpCode::ArcSin:
+                        if (a.lo < -1. || a.hi > 1.)
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::asin(x); });
+                    case OpCode::ArcCos:
+                        if (a.lo < -1. || a.hi > 1.)
+                        {
+                            return unbounded();
+                        }
+                        return {std::acos(a.hi), std::acos(a.lo)};
+                    case OpCode::ArcTan:
+                        return increasing(a, [](double x) { return std::atan(x); });
+                    case OpCode::Sinh:
+                        return increasing(a, [](double x) { return std::sinh(x); });
+                    case OpCode::Cosh:
+                        if (a.lo <= 0. && a.hi >= 0.)
+                        {
+                            return {1., std::max(std::cosh(a.lo), std::cosh(a.hi))};
+                        }
+                        return {std::min(std::cosh(a.lo), std::cosh(a.hi)), std::max(std::cosh(a.lo), std::cosh(a.hi))};
+                    case OpCode::Tanh:
+                        return increasing(a, [](double x) { return std::tanh(x); });
+                    case OpCode::Abs:
+                        if (a.lo >= 0.)
+                        {
+                            return a;
+                        }
+                        if (a.hi <= 0.)
+                        {
+                            return {-a.hi, -a.lo};
+                        }
+                        return {0., std::max(-a.lo, a.hi)};
+                    case OpCode::Sqrt:
+                        if (a.lo < 0.)
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::sqrt(x); });
+                    case OpCode::Exp:
+                        return increasing(a, [](double x) { return std::exp(x); });
+                    case OpCode::Log:
+                        if (a.lo < 0.)
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::log(x); });
+                    case OpCode::Log2:
+                        if (a.lo < 0.)
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::log2(x); });
+                    case OpCode::Log10:
+                        if (a.lo < 0.)
+                        {
+                            return unbounded();
+                        }
+                        return increasing(a, [](double x) { return std::log10(x); });
+                    case OpCode::Round:
+                        return increasing(a, [](double x) { return std::round(x); });
+                    case OpCode::Ceil:
+                        return increasing(a, [](double x) { return std::ceil(x); });
+                    case OpCode::Floor:
+                        return increasing(a, [](double x) { return std::floor(x); });
+                    case OpCode::Sign:
+                        return increasing(a, [](double x) { return (x > 0.) ? 1. : ((x < 0.) ? -1. : 0.); });
+                    case OpCode::Fract:
+                        if (std::floor(a.lo) == std::floor(a.hi))
+                        {
+                            return {a.lo - std::floor(a.lo), a.hi - std::floor(a.hi)};
+                        }
+                        return {0., 1.};
+                    case OpCode::Select:
+                    {
+                        Interval const& c = args[2];
+                        Interval const& d = args[3];
+                        if (a.hi < b.lo)
+                        {
+                            return c;
+                        }
+                        if (a.lo >= b.hi)
+                        {
+                            return d;
+                        }
+                        return {std::min(c.lo, d.lo), std::max(c.hi, d.hi)};
+                    }
+                    default:
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_GENERICEXCEPTION,
+                            "Invalid instruction in implicit program.");
+                }
+            }
+
+            double squaredDistanceToTriangle(double const* t, double const* p)
+            {
+                // Closest point on a triangle, see Ericson, Real-Time Collision Detection, 5.1.5
+                double const* a = t;
+                double const* b = t + 3;
+                double const* c = t + 6;
+                auto dot = [](double const* u, double const* v)
+                { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; };
+
+                double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                double ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+                double ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+                double closest[3];
+                auto setClosest = [&closest](double const* origin, double const* u, double s, double const* v, double t)
+                {
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        closest[k] = origin[k] + u[k] * s + v[k] * t;
+                    }
+                };
+                double const zero[3] = {0., 0., 0.};
+
+                double d1 = dot(ab, ap);
+                double d2 = dot(ac, ap);
+                if (d1 <= 0. && d2 <= 0.)
+                {
+                    setClosest(a, zero, 0., zero, 0.);
+                }
+                else
+                {
+                    double bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+                    double d3 = dot(ab, bp);
+                    double d4 = dot(ac, bp);
+                    double cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+                    double d5 = dot(ab, cp);
+                    double d6 = dot(ac, cp);
+                    double vc = d1 * d4 - d3 * d2;
+                    double vb = d5 * d2 - d1 * d6;
+                    double va = d3 * d6 - d5 * d4;
+                    if (d3 >= 0. && d4 <= d3)
+                    {
+                        setClosest(b, zero, 0., zero, 0.);
+                    }
+                    else if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+                    {
+                        setClosest(a, ab, d1 / (d1 - d3), zero, 0.);
+                    }
+                    else if (d6 >= 0. && d5 <= d6)
+                    {
+                        setClosest(c, zero, 0., zero, 0.);
+                    }
+                    else if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+                    {
+                        setClosest(a, ac, d2 / (d2 - d6), zero, 0.);
+                    }
+                    else if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.)
+                    {
+                        double bc[3] = {c[0] - b[0], c[1] - b[1], c[2] - b[2]};
+                        setClosest(b, bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)), zero, 0.);
+                    }
+                    else
+                    {
+                        double denominator = 1. / (va + vb + vc);
+                        setClosest(a, ab, vb * denominator, ac, vc * denominator);
+                    }
+                }
+
+                double delta[3] = {p[0] - closest[0], p[1] - closest[1], p[2] - closest[2]};
+                return dot(delta, delta);
+            }
+
+            double solidAngle(double const* t, double const* p)
+            {
+                // Van Oosterom and Strackee
+                double a[3] = {t[0] - p[0], t[1] - p[1], t[2] - p[2]};
+                double b[3] = {t[3] - p[0], t[4] - p[1], t[5] - p[2]};
+                double c[3] = {t[6] - p[0], t[7] - p[1], t[8] - p[2]};
+                double la = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+                double lb = std::sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2]);
+                double lc = std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+                double determinant = a[0] * (b[1] * c[2] - b[2] * c[1]) -
+                                     a[1] * (b[0] * c[2] - b[2] * c[0]) +
+                                     a[2] * (b[0] * c[1] - b[1] * c[0]);
+                double ab = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+                double ac = a[0] * c[0] + a[1] * c[1] + a[2] * c[2];
+                double bc = b[0] * c[0] + b[1] * c[1] + b[2] * c[2];
+                double denominator = la * lb * lc + ab * lc + ac * lb + bc * la;
+                return 2. * std::atan2(determinant, denominator);
+            }
+
+            // Distance to the mesh surface, negative inside if bSigned. The
+            // inside is determined by the generalized winding number, so
+            // small holes in the mesh are tolerated.
+            double meshDistance(MeshData const& mesh, double const* p, bool bSigned)
+            {
+                auto const& triangles = mesh.m_triangles;
+                if (triangles.empty())
+                {
+                    return std::numeric_limits<double>::infinity();
+                }
+
+                double minSquaredDistance = std::numeric_limits<double>::max();
+                double windingNumber = 0.;
+                for (size_t index = 0; index < triangles.size(); index += 9)
+                {
+                    double const* t = &triangles[index];
+                    minSquaredDistance = std::min(minSquaredDistance, squaredDistanceToTriangle(t, p));
+                    if (bSigned)
+                    {
+                        windingNumber += solidAngle(t, p);
+                    }
+                }
+
+                double distance = std::sqrt(minSquaredDistance);
+                if (bSigned && std::fabs(windingNumber / (4. * Pi)) > 0.5)
+                {
+                    return -distance;
+                }
+                return distance;
+            }
+        }  // namespace
+
+        /**
+         * @brief Translates the node graph of an implicit function into the
+         * values and instructions of a Program.
+         */
+        class Compiler
+        {
+           public:
+            explicit Compiler(Program& program) : m_program(program)
+            {
+            }
+
+            void compile(CModelImplicitFunction& function, std::string const* pOutputIdentifier)
+            {
+                std::vector<PortValue> inputs;
+                uint32_t inputComponent = 0;
+                for (auto const& port : *function.getInputs())
+                {
+                    PortValue value;
+                    size_t const count = componentCount(port->getType());
+                    for (size_t index = 0; index < count; ++index)
+                    {
+                        value.components.push_back(input(inputComponent++));
+                    }
+                    inputs.push_back(value);
+                }
+                m_program.m_inputComponentCount = inputComponent;
+
+                auto const values = compileFunction(function, inputs);
+                auto const& functionOutputs = *function.getOutputs();
+                std::vector<ValueId> outputs;
+                bool bFound = false;
+                for (size_t index = 0; index < values.size(); ++index)
+                {
+                    if (pOutputIdentifier && functionOutputs[index]->getIdentifier() != *pOutputIdentifier)
+                    {
+                        continue;
+                    }
+                    bFound = true;
+                    outputs.insert(outputs.end(), values[index].components.begin(), values[index].components.end());
+                }
+                if (pOutputIdentifier && !bFound)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "Function " + function.getIdentifier() + " has no output " + *pOutputIdentifier + ".");
+                }
+                generate(outputs);
+            }
+
+           private:
+            struct PortValue
+            {
+                std::vector<ValueId> components;
+                ModelResourceID resourceID = 0;
+                bool hasResourceID = false;
+            };
+
+            using PortValues = std::unordered_map<CModelImplicitPort const*, PortValue>;
+
+            Program& m_program;
+            std::vector<Value> m_values;
+            std::unordered_map<ValueKey, ValueId, ValueKeyHash> m_valueIndex;
+            std::vector<CModelImplicitFunction const*> m_callStack;
+            std::unordered_map<CModelMeshObject const*, uint32_t> m_meshIndices;
+            std::unordered_map<CModelFunctionFromImage3D const*, uint32_t> m_imageIndices;
+            std::unordered_set<CModelFunction const*> m_callees;
+
+            bool isConstant(ValueId id, double value) const
+            {
+                return m_values[id].op == OpCode::Constant && m_values[id].constant == value;
+            }
+
+            ValueId insert(OpCode op, ValueId const* args, uint32_t aux, double constant)
+            {
+                ValueKey key{op, {args[0], args[1], args[2], args[3]}, aux, 0};
+                if (op == OpCode::Constant)
+                {
+                    std::memcpy(&key.constantBits, &constant, sizeof(double));
+                }
+
+                auto it = m_valueIndex.find(key);
+                if (it != m_valueIndex.end())
+                {
+                    return it->second;
+                }
+
+                ValueId const id = static_cast<ValueId>(m_values.size());
+                m_values.push_back(Value{op, {args[0], args[1], args[2], args[3]}, aux, constant});
+                m_valueIndex.emplace(key, id);
+                return id;
+            }
+
+            ValueId constant(double value)
+            {
+                ValueId const args[4] = {NoValue, NoValue, NoValue, NoValue};
+                return insert(OpCode::Constant, args, 0, value);
+            }
+
+            ValueId input(uint32_t component)
+            {
+                ValueId const args[4] = {NoValue, NoValue, NoValue, NoValue};
+                return insert(OpCode::Input, args, component, 0.);
+            }
+
+            ValueId emit(OpCode op,
+                         ValueId a,
+                         ValueId b = NoValue,
+                         ValueId c = NoValue,
+                         ValueId d = NoValue,
+                         uint32_t aux = 0)
+            {
+                ValueId args[4] = {a, b, c, d};
+                size_t const count = argumentCount(op);
+
+                if (op != OpCode::MeshDistance && op != OpCode::UnsignedMeshDistance && op != OpCode::ImageSample)
+                {
+                    bool allConstant = true;
+                    double constants[4] = {0., 0., 0., 0.};
+                    double const* constantPointers[4] = {&constants[0], &constants[1], &constants[2], &constants[3]};
+                    for (size_t index = 0; index < count; ++index)
+                    {
+                        allConstant = allConstant && m_values[args[index]].op == OpCode::Constant;
+                        constants[index] = m_values[args[index]].constant;
+                    }
+                    if (allConstant)
+                    {
+                        double result = 0.;
+                        executeKernel(op, &result, constantPointers, 1);
+                        return constant(result);
+                    }
+                }
+
+                switch (op)
+                {
+                    case OpCode::Add:
+                        if (isConstant(a, 0.))
+                            return b;
+                        if (isConstant(b, 0.))
+                            return a;
+                        break;
+                    case OpCode::Sub:
+                        if (isConstant(b, 0.))
+                            return a;
+                        break;
+                    case OpCode::Mul:
+                        if (isConstant(a, 1.))
+                            return b;
+                        if (isConstant(b, 1.))
+                            return a;
+                        break;
+                    case OpCode::Div:
+                        if (isConstant(b, 1.))
+                            return a;
+                        break;
+                    case OpCode::Min:
+                    case OpCode::Max:
+                        if (a == b)
+                            return a;
+                        break;
+                    case OpCode::Select:
+                        if (c == d)
+                            return c;
+                        if (m_values[a].op == OpCode::Constant && m_values[b].op == OpCode::Constant)
+                            return (m_values[a].constant < m_values[b].constant) ? c : d;
+                        break;
+                    default:
+                        break;
+                }
+
+                if (isCommutative(op) && args[1] < args[0])
+                {
+                    std::swap(args[0], args[1]);
+                }
+                return insert(op, args, aux, 0.);
+            }
+
+            std::vector<ValueId> componentWise(OpCode op, std::vector<ValueId> const& a)
+            {
+                std::vector<ValueId> result;
+                for (auto value : a)
+                {
+                    result.push_back(emit(op, value));
+                }
+                return result;
+            }
+
+            std::vector<ValueId> componentWise(OpCode op,
+                                               std::vector<ValueId> const& a,
+                                               std::vector<ValueId> const& b)
+            {
+                std::vector<ValueId> result;
+                for (size_t index = 0; index < a.size(); ++index)
+                {
+                    result.push_back(emit(op, a[index], b[index]));
+                }
+                return result;
+            }
+
+            ValueId dot(ValueId const* a, ValueId const* b)
+            {
+                return emit(OpCode::Add,
+                            emit(OpCode::Add, emit(OpCode::Mul, a[0], b[0]), emit(OpCode::Mul, a[1], b[1])),
+                            emit(OpCode::Mul, a[2], b[2]));
+            }
+
+            std::vector<ValueId> inverse(std::vector<ValueId> const& m)
+            {
+                // Cofactor expansion using the 2x2 subdeterminants of the
+                // upper (s) and lower (c) two rows
+                auto det2 = [this, &m](int i, int j, int k, int l)
+                {
+                    return emit(OpCode::Sub, emit(OpCode::Mul, m[i], m[j]), emit(OpCode::Mul, m[k], m[l]));
+                };
+                ValueId const factors[12] = {
+                    det2(0, 5, 4, 1),     det2(0, 6, 4, 2),     det2(0, 7, 4, 3),
+                    det2(1, 6, 5, 2),     det2(1, 7, 5, 3),     det2(2, 7, 6, 3),
+                    det2(8, 13, 12, 9),   det2(8, 14, 12, 10),  det2(8, 15, 12, 11),
+                    det2(9, 14, 13, 10),  det2(9, 15, 13, 11),  det2(10, 15, 14, 11)};
+                auto s = [&factors](int index) { return factors[index]; };
+                auto c = [&factors](int index) { return factors[6 + index]; };
+
+                auto term = [this](ValueId x, ValueId y) { return emit(OpCode::Mul, x, y); };
+                ValueId determinant = emit(OpCode::Sub, term(s(0), c(5)), term(s(1), c(4)));
+                determinant = emit(OpCode::Add, determinant, term(s(2), c(3)));
+                determinant = emit(OpCode::Add, determinant, term(s(3), c(2)));
+                determinant = emit(OpCode::Sub, determinant, term(s(4), c(1)));
+                determinant = emit(OpCode::Add, determinant, term(s(5), c(0)));
+                ValueId const inverseDeterminant = emit(OpCode::Div, constant(1.), determinant);
+                ValueId const negativeInverseDeterminant = emit(OpCode::Sub, constant(0.), inverseDeterminant);
+
+                // Entry rc is +-(m[i0] * f0 - m[i1] * f1 + m[i2] * f2), factors 0..5 are s, 6..11 are c
+                static int const table[16][6] = {
+                    {5, 11, 6, 10, 7, 9}, {1, 11, 2, 10, 3, 9}, {13, 5, 14, 4, 15, 3}, {9, 5, 10, 4, 11, 3},
+                    {4, 11, 6, 8, 7, 7},  {0, 11, 2, 8, 3, 7},  {12, 5, 14, 2, 15, 1}, {8, 5, 10, 2, 11, 1},
+                    {4, 10, 5, 8, 7, 6},  {0, 10, 1, 8, 3, 6},  {12, 4, 13, 2, 15, 0}, {8, 4, 9, 2, 11, 0},
+                    {4, 9, 5, 7, 6, 6},   {0, 9, 1, 7, 2, 6},   {12, 3, 13, 1, 14, 0}, {8, 3, 9, 1, 10, 0}};
+
+                std::vector<ValueId> result(16);
+                for (int index = 0; index < 16; ++index)
+                {
+                    auto const& row = table[index];
+                    ValueId sum = emit(OpCode::Sub, term(m[row[0]], factors[row[1]]), term(m[row[2]], factors[row[3]]));
+                    sum = emit(OpCode::Add, sum, term(m[row[4]], factors[row[5]]));
+                    bool const bPositive = ((index / 4 + index % 4) % 2) == 0;
+                    result[index] = emit(OpCode::Mul, sum, bPositive ? inverseDeterminant : negativeInverseDeterminant);
+                }
+                return result;
+            }
+
+            uint32_t meshIndex(CModelImplicitFunction& function, CModelImplicitNode const& node, PortValue const& mesh)
+            {
+                auto meshObject = std::dynamic_pointer_cast<CModelMeshObject>(findResource(function, node, mesh));
+                if (!meshObject)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "The resource referenced by node " + node.getIdentifier() + " is not a mesh object.");
+                }
+
+                auto it = m_meshIndices.find(meshObject.get());
+                if (it != m_meshIndices.end())
+                {
+                    return it->second;
+                }
+
+                CMesh* pMesh = meshObject->getMesh();
+                std::vector<nfFloat> coordinates(static_cast<size_t>(pMesh->getNodeCount()) * 3);
+                std::vector<nfUint32> indices(static_cast<size_t>(pMesh->getFaceCount()) * 3);
+                if (!coordinates.empty())
+                {
+                    pMesh->getNodeCoordinates(coordinates.data());
+                }
+                if (!indices.empty())
+                {
+                    pMesh->getFaceNodeIndices(indices.data());
+                }
+
+                MeshData data;
+                data.m_triangles.reserve(indices.size() * 3);
+                for (auto nodeIndex : indices)
+                {
+                    for (size_t k = 0; k < 3; ++k)
+                    {
+                        data.m_triangles.push_back(coordinates[static_cast<size_t>(nodeIndex) * 3 + k]);
+                    }
+                }
+
+                uint32_t const index = static_cast<uint32_t>(m_program.m_meshes.size());
+                m_program.m_meshes.push_back(std::move(data));
+                m_meshIndices.emplace(meshObject.get(), index);
+
+                std::weak_ptr<CModelMeshObject> pWeakMeshObject = meshObject;
+                nfUint64 const generation = pMesh->getGeneration();
+                m_program.m_dependencies.push_back([pWeakMeshObject, pMesh, generation]() {
+                    auto pMeshObject = pWeakMeshObject.lock();
+                    return pMeshObject && pMeshObject->getMesh() == pMesh && pMesh->getGeneration() == generation;
+                });
+                return index;
+            }
+
+            uint32_t imageIndex(CModelFunctionFromImage3D& imageFunction)
+            {
+                auto it = m_imageIndices.find(&imageFunction);
+                if (it != m_imageIndices.end())
+                {
+                    return it->second;
+                }
+
+                uint32_t const index = static_cast<uint32_t>(m_program.m_images.size());
+                auto pSampler = std::make_shared<Image3DSampler>(imageFunction);
+                m_program.m_images.push_back(pSampler);
+                m_imageIndices.emplace(&imageFunction, index);
+
+                // The sampler captures the sheets and the size of the image stack
+                m_program.m_dependencies.push_back([pSampler]() { return pSampler->isUpToDate(); });
+                return index;
+            }
+
+            // Functions are inlined, so the program depends on the graph of every callee
+            void addCalleeDependency(PModelFunction const& pCallee)
+            {
+                if (!m_callees.insert(pCallee.get()).second)
+                {
+                    return;
+                }
+                std::weak_ptr<CModelFunction> pWeakCallee = pCallee;
+                nfUint64 const version = pCallee->getGraphVersion();
+                m_program.m_dependencies.push_back([pWeakCallee, version]() {
+                    auto pFunction = pWeakCallee.lock();
+                    return pFunction && pFunction->getGraphVersion() == version;
+                });
+            }
+
+            PModelResource findResource(CModelImplicitFunction& function,
+                                        CModelImplicitNode const& node,
+                                        PortValue const& value)
+            {
+                if (!value.hasResourceID)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_NOTIMPLEMENTED,
+                        "Node " + node.getIdentifier() + " must reference a constant resource ID.");
+                }
+                CModel* pModel = function.getModel();
+                auto resource = pModel->findResource(pModel->currentPath(), value.resourceID);
+                if (!resource)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "Resource " + std::to_string(value.resourceID) + " referenced by node " +
+                            node.getIdentifier() + " does not exist.");
+                }
+                return resource;
+            }
+
+            static CModelImplicitPort* outputSource(CModelImplicitFunction& function, CModelImplicitPort& output)
+            {
+                auto source = function.findPort(output.getReference());
+                if (!source)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "Output " + output.getIdentifier() + " of function " +
+                            function.getIdentifier() + " is not connected.");
+                }
+                return source.get();
+            }
+
+            std::vector<PortValue> compileFunction(CModelImplicitFunction& function,
+                                                   std::vector<PortValue> const& inputs)
+            {
+                if (std::find(m_callStack.begin(), m_callStack.end(), &function) != m_callStack.end())
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_GRAPHISCYCLIC,
+                        "Function " + function.getIdentifier() + " calls itself.");
+                }
+                m_callStack.push_back(&function);
+
+                PortValues values;
+                auto const& functionInputs = *function.getInputs();
+                for (size_t index = 0; index < functionInputs.size(); ++index)
+                {
+                    values[functionInputs[index].get()] = inputs[index];
+                }
+
+                std::vector<CModelImplicitPort*> outputSources;
+                for (auto const& output : *function.getOutputs())
+                {
+                    outputSources.push_back(outputSource(function, *output));
+                }
+
+                for (auto node : sortedNodes(outputSources))
+                {
+                    compileNode(function, *node, values);
+                }
+
+                std::vector<PortValue> outputs;
+                auto const& functionOutputs = *function.getOutputs();
+                for (size_t index = 0; index < functionOutputs.size(); ++index)
+                {
+                    PortValue const& value = valueOf(values, outputSources[index]);
+                    if (value.components.size() != componentCount(functionOutputs[index]->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Output " + functionOutputs[index]->getIdentifier() + " of function " +
+                                function.getIdentifier() + " has an incompatible type.");
+                    }
+                    outputs.push_back(value);
+                }
+
+                m_callStack.pop_back();
+                return outputs;
+            }
+
+            // Nodes that contribute to the outputs, in topological order
+            static std::vector<CModelImplicitNode*> sortedNodes(std::vector<CModelImplicitPort*> const& outputSources)
+            {
+                std::vector<CModelImplicitNode*> reachable;
+                std::unordered_set<CModelImplicitNode*> visited;
+                for (auto source : outputSources)
+                {
+                    auto node = source->getParent();
+                    if (node && visited.insert(node).second)
+                    {
+                        reachable.push_back(node);
+                    }
+                }
+
+                std::unordered_map<CModelImplicitNode*, size_t> pendingInputs;
+                std::unordered_map<CModelImplicitNode*, std::vector<CModelImplicitNode*>> dependents;
+                for (size_t index = 0; index < reachable.size(); ++index)
+                {
+                    auto node = reachable[index];
+                    size_t& pending = pendingInputs[node];
+                    for (auto const& input : *node->getInputs())
+                    {
+                        auto sourceNode = input->getReferencedPort()->getParent();
+                        if (!sourceNode)
+                        {
+                            continue;
+                        }
+                        ++pending;
+                        dependents[sourceNode].push_back(node);
+                        if (visited.insert(sourceNode).second)
+                        {
+                            reachable.push_back(sourceNode);
+                        }
+                    }
+                }
+
+                std::vector<CModelImplicitNode*> sorted;
+                sorted.reserve(reachable.size());
+                std::queue<CModelImplicitNode*> ready;
+                for (auto node : reachable)
+                {
+                    if (pendingInputs[node] == 0)
+                    {
+                        ready.push(node);
+                    }
+                }
+                while (!ready.empty())
+                {
+                    auto node = ready.front();
+                    ready.pop();
+                    sorted.push_back(node);
+                    for (auto dependent : dependents[node])
+                    {
+                        if (--pendingInputs[dependent] == 0)
+                        {
+                            ready.push(dependent);
+                        }
+                    }
+                }
+
+                if (sorted.size() != reachable.size())
+                {
+                    throw ELib3MFInterfaceException(LIB3MF_ERROR_GRAPHISCYCLIC);
+                }
+                return sorted;
+            }
+
+            static PortValue const& valueOf(PortValues const& values, CModelImplicitPort const* source)
+            {
+                auto it = values.find(source);
+                if (it == values.end())
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "Port " + source->getIdentifier() + " has no value.");
+                }
+                return it->second;
+            }
+
+            void compileNode(CModelImplicitFunction& function,
+                             CModelImplicitNode& node,
+                             PortValues& values)
+            {
+                auto in = [&](std::string const& name) -> PortValue const&
+                {
+                    auto port = node.findInput(name);
+                    if (!port)
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                            "Input " + name + " of node " + node.getIdentifier() + " is missing.");
+                    }
+                    PortValue const& value = valueOf(values, port->getReferencedPort().get());
+                    if (value.components.size() != componentCount(port->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Input " + name + " of node " + node.getIdentifier() + " has an incompatible type.");
+                    }
+                    return value;
+                };
+                auto out = [&](std::string const& name, std::vector<ValueId> components)
+                {
+                    auto port = node.findOutput(name);
+                    if (!port || components.size() != componentCount(port->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                            "Output " + name + " of node " + node.getIdentifier() + " is invalid.");
+                    }
+                    values[port.get()].components = std::move(components);
+                };
+                auto sameSize = [&](std::vector<ValueId> const& a, std::vector<ValueId> const& b)
+                {
+                    if (a.size() != b.size())
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Inputs of node " + node.getIdentifier() + " have different types.");
+                    }
+                };
+                auto binary = [&](OpCode op)
+                {
+                    auto const& a = in(InputNames::A).components;
+                    auto const& b = in(InputNames::B).components;
+                    sameSize(a, b);
+                    out(OutputNames::result, componentWise(op, a, b));
+                };
+                auto unary = [&](OpCode op)
+                {
+                    out(OutputNames::result, componentWise(op, in(InputNames::A).components));
+                };
+
+                using Lib3MF::eImplicitNodeType;
+                switch (node.getNodeType())
+                {
+                    case eImplicitNodeType::Addition: binary(OpCode::Add); break;
+                    case eImplicitNodeType::Subtraction: binary(OpCode::Sub); break;
+                    case eImplicitNodeType::Multiplication: binary(OpCode::Mul); break;
+                    case eImplicitNodeType::Division: binary(OpCode::Div); break;
+                    case eImplicitNodeType::Min: binary(OpCode::Min); break;
+                    case eImplicitNodeType::Max: binary(OpCode::Max); break;
+                    case eImplicitNodeType::Pow: binary(OpCode::Pow); break;
+                    case eImplicitNodeType::Fmod: binary(OpCode::Fmod); break;
+                    case eImplicitNodeType::Mod: binary(OpCode::Mod); break;
+                    case eImplicitNodeType::ArcTan2: binary(OpCode::ArcTan2); break;
+                    case eImplicitNodeType::Sinus: unary(OpCode::Sin); break;
+                    case eImplicitNodeType::Cosinus: unary(OpCode::Cos); break;
+                    case eImplicitNodeType::Tan: unary(OpCode::Tan); break;
+                    case eImplicitNodeType::ArcSin: unary(OpCode::ArcSin); break;
+                    case eImplicitNodeType::ArcCos: unary(OpCode::ArcCos); break;
+                    case eImplicitNodeType::ArcTan: unary(OpCode::ArcTan); break;
+                    case eImplicitNodeType::Sinh: unary(OpCode::Sinh); break;
+                    case eImplicitNodeType::Cosh: unary(OpCode::Cosh); break;
+                    case eImplicitNodeType::Tanh: unary(OpCode::Tanh); break;
+                    case eImplicitNodeType::Abs: unary(OpCode::Abs); break;
+                    case eImplicitNodeType::Sqrt: unary(OpCode::Sqrt); break;
+                    case eImplicitNodeType::Exp: unary(OpCode::Exp); break;
+                    case eImplicitNodeType::Log: unary(OpCode::Log); break;
+                    case eImplicitNodeType::Log2: unary(OpCode::Log2); break;
+                    case eImplicitNodeType::Log10: unary(OpCode::Log10); break;
+                    case eImplicitNodeType::Round: unary(OpCode::Round); break;
+                    case eImplicitNodeType::Ceil: unary(OpCode::Ceil); break;
+                    case eImplicitNodeType::Floor: unary(OpCode::Floor); break;
+                    case eImplicitNodeType::Sign: unary(OpCode::Sign); break;
+                    case eImplicitNodeType::Fract: unary(OpCode::Fract); break;
+
+                    case eImplicitNodeType::Select:
+                    {
+                        auto const& a = in(InputNames::A).components;
+                        auto const& b = in(InputNames::B).components;
+                        auto const& c = in(InputNames::C).components;
+                        auto const& d = in(InputNames::D).components;
+                        sameSize(a, b);
+                        sameSize(a, c);
+                        sameSize(a, d);
+                        std::vector<ValueId> result;
+                        for (size_t index = 0; index < a.size(); ++index)
+                        {
+                            result.push_back(emit(OpCode::Select, a[index], b[index], c[index], d[index]));
+                        }
+                        out(OutputNames::result, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Clamp:
+                    {
+                        auto const& a = in(InputNames::A).components;
+                        auto const& lower = in(InputNames::min).components;
+                        auto const& upper = in(InputNames::max).components;
+                        sameSize(a, lower);
+                        sameSize(a, upper);
+                        out(OutputNames::result,
+                            componentWise(OpCode::Min, componentWise(OpCode::Max, a, lower), upper));
+                        break;
+                    }
+
+                    case eImplicitNodeType::Constant:
+                        out(OutputNames::value, {constant(node.getConstant())});
+                        break;
+
+                    case eImplicitNodeType::ConstVec:
+                    {
+                        auto const vector = node.getVector();
+                        out(OutputNames::vector,
+                            {constant(vector.m_Coordinates[0]), constant(vector.m_Coordinates[1]),
+                             constant(vector.m_Coordinates[2])});
+                        break;
+                    }
+
+                    case eImplicitNodeType::ConstMat:
+                    {
+                        auto const matrix = node.getMatrix();
+                        std::vector<ValueId> result;
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                result.push_back(constant(matrix.m_Field[row][column]));
+                            }
+                        }
+                        out(OutputNames::matrix, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::ConstResourceID:
+                    {
+                        auto port = node.findOutput(OutputNames::value);
+                        if (!port)
+                        {
+                            throw ELib3MFInterfaceException(
+                                LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                                "Output value of node " + node.getIdentifier() + " is missing.");
+                        }
+                        PortValue& value = values[port.get()];
+                        value.resourceID = node.getModelResourceID();
+                        value.hasResourceID = true;
+                        break;
+                    }
+
+                    case eImplicitNodeType::ComposeVector:
+                        out(OutputNames::result,
+                            {in(InputNames::x).components[0], in(InputNames::y).components[0],
+                             in(InputNames::z).components[0]});
+                        break;
+
+                    case eImplicitNodeType::DecomposeVector:
+                    {
+                        auto const a = in(InputNames::A).components;
+                        out("x", {a[0]});
+                        out("y", {a[1]});
+                        out("z", {a[2]});
+                        break;
+                    }
+
+                    case eImplicitNodeType::VectorFromScalar:
+                    {
+                        ValueId const a = in(InputNames::A).components[0];
+                        out(OutputNames::result, {a, a, a});
+                        break;
+                    }
+
+                    case eImplicitNodeType::ComposeMatrix:
+                    {
+                        static char const* const names[16] = {
+                            InputNames::m00, InputNames::m01, InputNames::m02, InputNames::m03,
+                            InputNames::m10, InputNames::m11, InputNames::m12, InputNames::m13,
+                            InputNames::m20, InputNames::m21, InputNames::m22, InputNames::m23,
+                            InputNames::m30, InputNames::m31, InputNames::m32, InputNames::m33};
+                        std::vector<ValueId> result;
+                        for (auto name : names)
+                        {
+                            result.push_back(in(name).components[0]);
+                        }
+                        out(OutputNames::result, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::MatrixFromRows:
+                    case eImplicitNodeType::MatrixFromColumns:
+                    {
+                        // The vectors are completed to (v, 0) and (D, 1)
+                        std::vector<ValueId> const* vectors[4] = {
+                            &in(InputNames::A).components, &in(InputNames::B).components,
+                            &in(InputNames::C).components, &in(InputNames::D).components};
+                        bool const bRows = node.getNodeType() == eImplicitNodeType::MatrixFromRows;
+                        std::vector<ValueId> result(16);
+                        for (int vectorIndex = 0; vectorIndex < 4; ++vectorIndex)
+                        {
+                            for (int component = 0; component < 4; ++component)
+                            {
+                                ValueId const value = (component < 3)
+                                    ? (*vectors[vectorIndex])[component]
+                                    : constant((vectorIndex == 3) ? 1. : 0.);
+                                int const index = bRows ? vectorIndex * 4 + component : component * 4 + vectorIndex;
+                                result[index] = value;
+                            }
+                        }
+                        out(OutputNames::result, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Dot:
+                        out(OutputNames::result,
+                            {dot(in(InputNames::A).components.data(), in(InputNames::B).components.data())});
+                        break;
+
+                    case eImplicitNodeType::Cross:
+                    {
+                        auto const& a = in(InputNames::A).components;
+                        auto const& b = in(InputNames::B).components;
+                        auto component = [&](int i, int j)
+                        {
+                            return emit(OpCode::Sub, emit(OpCode::Mul, a[i], b[j]), emit(OpCode::Mul, a[j], b[i]));
+                        };
+                        out(OutputNames::result, {component(1, 2), component(2, 0), component(0, 1)});
+                        break;
+                    }
+
+                    case eImplicitNodeType::Length:
+                    {
+                        auto const& a = in(InputNames::A).components;
+                        out(OutputNames::result, {emit(OpCode::Sqrt, dot(a.data(), a.data()))});
+                        break;
+                    }
+
+                    case eImplicitNodeType::MatVecMultiplication:
+                    {
+                        // The vector is transformed as a point (w = 1)
+                        auto const& m = in(InputNames::A).components;
+                        auto const& v = in(InputNames::B).components;
+                        std::vector<ValueId> result;
+                        for (int row = 0; row < 3; ++row)
+                        {
+                            result.push_back(emit(OpCode::Add, dot(&m[row * 4], v.data()), m[row * 4 + 3]));
+                        }
+                        out(OutputNames::result, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Transpose:
+                    {
+                        auto const& m = in(InputNames::A).components;
+                        std::vector<ValueId> result(16);
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                result[column * 4 + row] = m[row * 4 + column];
+                            }
+                        }
+                        out(OutputNames::result, result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Inverse:
+                        out(OutputNames::result, inverse(in(InputNames::A).components));
+                        break;
+
+                    case eImplicitNodeType::Mesh:
+                    case eImplicitNodeType::UnsignedMesh:
+                    {
+                        auto const& pos = in(InputNames::pos).components;
+                        uint32_t const index = meshIndex(function, node, in(InputNames::mesh));
+                        OpCode const op = (node.getNodeType() == eImplicitNodeType::Mesh)
+                            ? OpCode::MeshDistance
+                            : OpCode::UnsignedMeshDistance;
+                        out(OutputNames::distance, {emit(op, pos[0], pos[1], pos[2], NoValue, index)});
+                        break;
+                    }
+
+                    case eImplicitNodeType::FunctionCall:
+                        compileFunctionCall(function, node, values);
+                        break;
+
+                    default:
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_NOTIMPLEMENTED,
+                            "Node " + node.getIdentifier() + " has an unsupported type.");
+                }
+            }
+
+            void compileFunctionCall(CModelImplicitFunction& function,
+                                     CModelImplicitNode& node,
+                                     PortValues& values)
+            {
+                auto functionIDPort = node.findInput(InputNames::functionID);
+                if (!functionIDPort)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                        "Input functionID of node " + node.getIdentifier() + " is missing.");
+                }
+                auto resource = findResource(function, node, valueOf(values, functionIDPort->getReferencedPort().get()));
+                auto imageFunction = std::dynamic_pointer_cast<CModelFunctionFromImage3D>(resource);
+                if (imageFunction)
+                {
+                    addCalleeDependency(imageFunction);
+                    compileImageCall(*imageFunction, node, values);
+                    return;
+                }
+                auto callee = std::dynamic_pointer_cast<CModelImplicitFunction>(resource);
+                if (!callee)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_NOTIMPLEMENTED,
+                        "Node " + node.getIdentifier() + " calls a function that is not an implicit function.");
+                }
+
+                std::vector<PortValue> arguments;
+                for (auto const& calleeInput : *callee->getInputs())
+                {
+                    auto port = node.findInput(calleeInput->getIdentifier());
+                    if (!port)
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INVALIDPARAM,
+                            "Input " + calleeInput->getIdentifier() + " of node " + node.getIdentifier() +
+                                " is missing.");
+                    }
+                    PortValue const& argument = valueOf(values, port->getReferencedPort().get());
+                    if (argument.components.size() != componentCount(calleeInput->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Input " + calleeInput->getIdentifier() + " of node " + node.getIdentifier() +
+                                " has an incompatible type.");
+                    }
+                    arguments.push_back(argument);
+                }
+
+                addCalleeDependency(callee);
+                auto results = compileFunction(*callee, arguments);
+                auto const& calleeOutputs = *callee->getOutputs();
+                for (size_t index = 0; index < calleeOutputs.size(); ++index)
+                {
+                    auto port = node.findOutput(calleeOutputs[index]->getIdentifier());
+                    if (port)
+                    {
+                        values[port.get()] = results[index];
+                    }
+                }
+            }
+
+            // Calls a function from an image stack. Its input is uvw, or the
+            // only vector input of the node if there is no uvw input.
+            void compileImageCall(CModelFunctionFromImage3D& imageFunction,
+                                  CModelImplicitNode& node,
+                                  PortValues& values)
+            {
+                auto uvwPort = node.findInput(InputNames::uvw);
+                if (!uvwPort)
+                {
+                    for (auto const& input : *node.getInputs())
+                    {
+                        if (input->getIdentifier() == InputNames::functionID)
+                        {
+                            continue;
+                        }
+                        if (uvwPort)
+                        {
+                            throw ELib3MFInterfaceException(
+                                LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                                "Node " + node.getIdentifier() + " has more than one input for the uvw coordinates.");
+                        }
+                        uvwPort = input;
+                    }
+                }
+                if (!uvwPort)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                        "Input uvw of node " + node.getIdentifier() + " is missing.");
+                }
+                auto const& uvw = valueOf(values, uvwPort->getReferencedPort().get()).components;
+                if (uvw.size() != 3)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                        "Input " + uvwPort->getIdentifier() + " of node " + node.getIdentifier() +
+                            " has an incompatible type.");
+                }
+
+                uint32_t const index = imageIndex(imageFunction);
+                auto channel = [&](size_t nChannel)
+                {
+                    uint32_t const aux = index * static_cast<uint32_t>(Image3DSampler::ChannelCount) +
+                                         static_cast<uint32_t>(nChannel);
+                    return emit(OpCode::ImageSample, uvw[0], uvw[1], uvw[2], NoValue, aux);
+                };
+                for (auto const& output : *node.getOutputs())
+                {
+                    std::vector<ValueId> components;
+                    size_t const nChannel = Image3DSampler::findChannel(output->getIdentifier());
+                    if (output->getIdentifier() == OutputNames::color)
+                    {
+                        components = {channel(0), channel(1), channel(2)};
+                    }
+                    else if (nChannel < Image3DSampler::ChannelCount)
+                    {
+                        components = {channel(nChannel)};
+                    }
+                    else
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                            "Output " + output->getIdentifier() + " of node " + node.getIdentifier() +
+                                " is not an output of a function from an image stack.");
+                    }
+                    if (components.size() != componentCount(output->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Output " + output->getIdentifier() + " of node " + node.getIdentifier() +
+                                " has an incompatible type.");
+                    }
+                    values[output.get()].components = std::move(components);
+                }
+            }
+
+            // Removes unused values and assigns registers, reusing the
+            // registers of values after their last use
+            void generate(std::vector<ValueId> const& outputs)
+            {
+                size_t const valueCount = m_values.size();
+                std::vector<bool> live(valueCount, false);
+                for (auto output : outputs)
+                {
+                    live[output] = true;
+                }
+                for (size_t index = valueCount; index-- > 0;)
+                {
+                    if (live[index])
+                    {
+                        for (size_t arg = 0; arg < argumentCount(m_values[index].op); ++arg)
+                        {
+                            live[m_values[index].args[arg]] = true;
+                        }
+                    }
+                }
+
+                uint32_t constexpr Forever = std::numeric_limits<uint32_t>::max();
+                std::vector<uint32_t> lastUse(valueCount, 0);
+                for (size_t index = 0; index < valueCount; ++index)
+                {
+                    if (live[index])
+                    {
+                        for (size_t arg = 0; arg < argumentCount(m_values[index].op); ++arg)
+                        {
+                            lastUse[m_values[index].args[arg]] = static_cast<uint32_t>(index);
+                        }
+                    }
+                }
+                for (auto output : outputs)
+                {
+                    lastUse[output] = Forever;
+                }
+
+                std::vector<RegisterIndex> registers(valueCount, 0);
+                std::vector<RegisterIndex> freeRegisters;
+                RegisterIndex registerCount = 0;
+                for (size_t index = 0; index < valueCount; ++index)
+                {
+                    if (!live[index])
+                    {
+                        continue;
+                    }
+                    Value const& value = m_values[index];
+                    if (value.op == OpCode::Constant)
+                    {
+                        registers[index] = registerCount++;
+                        m_program.m_constants.emplace_back(registers[index], value.constant);
+                        continue;
+                    }
+
+                    size_t const count = argumentCount(value.op);
+                    for (size_t arg = 0; arg < count; ++arg)
+                    {
+                        ValueId const argument = value.args[arg];
+                        bool const bRepeated = std::find(value.args, value.args + arg, argument) != value.args + arg;
+                        if (!bRepeated && lastUse[argument] == index && m_values[argument].op != OpCode::Constant)
+                        {
+                            freeRegisters.push_back(registers[argument]);
+                        }
+                    }
+
+                    if (freeRegisters.empty())
+                    {
+                        registers[index] = registerCount++;
+                    }
+                    else
+                    {
+                        registers[index] = freeRegisters.back();
+                        freeRegisters.pop_back();
+                    }
+
+                    Instruction instruction{value.op, registers[index], {0, 0, 0, 0}, value.aux};
+                    for (size_t arg = 0; arg < count; ++arg)
+                    {
+                        instruction.args[arg] = registers[value.args[arg]];
+                    }
+                    m_program.m_instructions.push_back(instruction);
+                }
+
+                for (auto output : outputs)
+                {
+                    m_program.m_outputs.push_back(registers[output]);
+                }
+                m_program.m_registerCount = registerCount;
+            }
+        };
+
+        Program::Program(CModelImplicitFunction& function)
+        {
+            Compiler compiler(*this);
+            compiler.compile(function, nullptr);
+        }
+
+        Program::Program(CModelImplicitFunction& function, std::string const& outputIdentifier)
+        {
+            Compiler compiler(*this);
+            compiler.compile(function, &outputIdentifier);
+        }
+
+        size_t Program::getInputComponentCount() const
+        {
+            return m_inputComponentCount;
+        }
+
+        size_t Program::getOutputComponentCount() const
+        {
+            return m_outputs.size();
+        }
+
+        std::vector<Instruction> const& Program::getInstructions() const
+        {
+            return m_instructions;
+        }
+
+        size_t Program::getRegisterCount() const
+        {
+            return m_registerCount;
+        }
+
+        void Program::initRegisters(Registers& registers) const
+        {
+            registers.assign(m_registerCount * ChunkSize, 0.);
+            for (auto const& constant : m_constants)
+            {
+                std::fill_n(registers.begin() + constant.first * ChunkSize, ChunkSize, constant.second);
+            }
+        }
+
+        void Program::execute(Instruction const& instruction,
+                              double* registers,
+                              double const* pInputs,
+                              size_t nInputStride,
+                              size_t nFirst,
+                              size_t nCount) const
+        {
+            double* result = registers + instruction.result * ChunkSize;
+            switch (instruction.op)
+            {
+                case OpCode::Input:
+                    std::memcpy(result, pInputs + instruction.aux * nInputStride + nFirst, nCount * sizeof(double));
+                    break;
+                case OpCode::MeshDistance:
+                case OpCode::UnsignedMeshDistance:
+                {
+                    MeshData const& mesh = m_meshes[instruction.aux];
+                    bool const bSigned = instruction.op == OpCode::MeshDistance;
+                    double const* x = registers + instruction.args[0] * ChunkSize;
+                    double const* y = registers + instruction.args[1] * ChunkSize;
+                    double const* z = registers + instruction.args[2] * ChunkSize;
+                    for (size_t index = 0; index < nCount; ++index)
+                    {
+                        double const point[3] = {x[index], y[index], z[index]};
+                        result[index] = meshDistance(mesh, point, bSigned);
+                    }
+                    break;
+                }
+                case OpCode::ImageSample:
+                {
+                    size_t const channelCount = Image3DSampler::ChannelCount;
+                    m_images[instruction.aux / channelCount]->sample(
+                        instruction.aux % channelCount,
+                        registers + instruction.args[0] * ChunkSize,
+                        registers + instruction.args[1] * ChunkSize,
+                        registers + instruction.args[2] * ChunkSize,
+                        result, nCount);
+                    break;
+                }
+                default:
+                {
+                    double const* args[4];
+                    for (size_t arg = 0; arg < 4; ++arg)
+                    {
+                        args[arg] = registers + instruction.args[arg] * ChunkSize;
+                    }
+                    executeKernel(instruction.op, result, args, nCount);
+                    break;
+                }
+            }
+        }
+
+        void Program::evaluateRange(Registers& registers,
+                                    double const* pInputs,
+                                    size_t nInputStride,
+                                    double* pOutputs,
+                                    size_t nOutputStride,
+                                    size_t nFirst,
+                                    size_t nCount) const
+        {
+            if (registers.size() != m_registerCount * ChunkSize)
+            {
+                initRegisters(registers);
+            }
+
+            for (size_t start = nFirst; start < nFirst + nCount; start += ChunkSize)
+            {
+                size_t const count = std::min(ChunkSize, nFirst + nCount - start);
+                for (auto const& instruction : m_instructions)
+                {
+                    execute(instruction, registers.data(), pInputs, nInputStride, start, count);
+                }
+                for (size_t output = 0; output < m_outputs.size(); ++output)
+                {
+                    std::memcpy(pOutputs + output * nOutputStride + start,
+                                registers.data() + m_outputs[output] * ChunkSize,
+                                count * sizeof(double));
+                }
+            }
+        }
+
+        void Program::evaluate(double const* pInputs,
+                               double* pOutputs,
+                               size_t nPointCount) const
+        {
+            size_t const chunkCount = (nPointCount + ChunkSize - 1) / ChunkSize;
+            nfUint32 const jobCount = fnGetParallelJobCount(chunkCount, MinChunksPerThread);
+            fnRunParallelJobs(jobCount, [&](nfUint32 nJob)
+            {
+                size_t const firstChunk = chunkCount * nJob / jobCount;
+                size_t const endChunk = chunkCount * (nJob + 1) / jobCount;
+                size_t const first = firstChunk * ChunkSize;
+                size_t const end = std::min(endChunk * ChunkSize, nPointCount);
+                if (end <= first)
+                {
+                    return;
+                }
+
+                Registers registers;
+                initRegisters(registers);
+                evaluateRange(registers, pInputs, nPointCount, pOutputs, nPointCount, first, end - first);
+            });
+        }
+
+        void Program::evaluateBounds(Interval const* pInputs, Interval* pOutputs) const
+        {
+            std::vector<Interval> registers(m_registerCount, Interval{0., 0.});
+            for (auto const& constant : m_constants)
+            {
+                registers[constant.first] = {constant.second, constant.second};
+            }
+
+            for (auto const& instruction : m_instructions)
+            {
+                Interval& result = registers[instruction.result];
+                switch (instruction.op)
+                {
+                    case OpCode::Input:
+                        result = pInputs[instruction.aux];
+                        break;
+                    case OpCode::MeshDistance:
+                    case OpCode::UnsignedMeshDistance:
+                    {
+                        // The distance is 1-Lipschitz, so it deviates from the
+                        // distance of the box center by at most the half diagonal
+                        double center[3];
+                        double radiusSquared = 0.;
+                        for (size_t arg = 0; arg < 3; ++arg)
+                        {
+                            Interval const& coordinate = registers[instruction.args[arg]];
+                            center[arg] = 0.5 * (coordinate.lo + coordinate.hi);
+                            radiusSquared += 0.25 * (coordinate.hi - coordinate.lo) * (coordinate.hi - coordinate.lo);
+                        }
+                        double const radius = std::sqrt(radiusSquared);
+                        double const distance = meshDistance(m_meshes[instruction.aux], center,
+                                                             instruction.op == OpCode::MeshDistance);
+                        result = {distance - radius, distance + radius};
+                        if (instruction.op == OpCode::UnsignedMeshDistance)
+                        {
+                            result.lo = std::max(result.lo, 0.);
+                        }
+                        break;
+                    }
+                    case OpCode::ImageSample:
+                    {
+                        // Unbounded coordinates may be NaN, which samples to NaN
+                        bool bBounded = true;
+                        for (size_t arg = 0; arg < 3; ++arg)
+                        {
+                            Interval const& coordinate = registers[instruction.args[arg]];
+                            bBounded = bBounded && std::isfinite(coordinate.lo) && std::isfinite(coordinate.hi);
+                        }
+                        if (bBounded)
+                        {
+                            m_images[instruction.aux / Image3DSampler::ChannelCount]->getRange(result.lo, result.hi);
+                        }
+                        else
+                        {
+                            result = unbounded();
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        Interval args[4];
+                        for (size_t arg = 0; arg < argumentCount(instruction.op); ++arg)
+                        {
+                            args[arg] = registers[instruction.args[arg]];
+                        }
+                        result = boundKernel(instruction.op, args);
+                        break;
+                    }
+                }
+
+                if (std::isnan(result.lo) || std::isnan(result.hi))
+                {
+                    result = unbounded();
+                }
+            }
+
+            for (size_t output = 0; output < m_outputs.size(); ++output)
+            {
+                pOutputs[output] = registers[m_outputs[output]];
+            }
+        }
+
+        bool Program::isUpToDate() const
+        {
+            return std::all_of(m_dependencies.begin(), m_dependencies.end(),
+                               [](std::function<bool()> const& isUnchanged) { return isUnchanged(); });
+        }
+    }  // namespace implicit
+}  // namespace NMR
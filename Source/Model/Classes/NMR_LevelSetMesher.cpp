@@ -0,0 +1,432 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+#include "Model/Classes/NMR_LevelSetMesher.h"
+#include "Common/Math/NMR_Matrix.h"
+#include "Common/Mesh/NMR_Mesh.h"
+#include "Common/NMR_ParallelJobs.h"
+#include "Model/Classes/NMR_ModelLevelSetObject.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            size_t constexpr MinTilesPerThread = 2;
+            size_t constexpr TilesPerBatchAndThread = 8;
+
+            // Vertices are kept at least this fraction of a cell away from
+            // the samples, which avoids triangles without area
+            double constexpr MinEdgeFraction = 1e-3;
+
+            uint64_t constexpr NoKey = std::numeric_limits<uint64_t>::max();
+
+            // Edge of a cell, starting at corner and pointing along axis.
+            // Corner c of a cell has the offset (c & 1, (c >> 1) & 1, (c >> 2) & 1).
+            struct CellEdge
+            {
+                uint8_t corner;
+                uint8_t axis;
+            };
+
+            struct CaseTable
+            {
+                CellEdge edges[12];
+                // Three cell edges per triangle, for each configuration of
+                // inside corners
+                std::vector<uint8_t> triangles[256];
+            };
+
+            /**
+             * Derives the triangulation of each configuration from the cell
+             * faces. On every face, the crossed edges are connected such that
+             * each inside corner is cut off separately. Both cells of a face
+             * thus agree on its segments, which makes the result closed. The
+             * segments are chained to loops around the inside part of the cell
+             * surface, and each loop is triangulated as a fan.
+             */
+            CaseTable buildCaseTable()
+            {
+                CaseTable table;
+                int edgeIndex[8][3];
+                int edgeCount = 0;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    for (int corner = 0; corner < 8; ++corner)
+                    {
+                        if (((corner >> axis) & 1) == 0)
+                        {
+                            table.edges[edgeCount] = {static_cast<uint8_t>(corner), static_cast<uint8_t>(axis)};
+                            edgeIndex[corner][axis] = edgeCount++;
+                        }
+                    }
+                }
+                auto edgeBetween = [&edgeIndex](int a, int b)
+                {
+                    int const axis = ((a ^ b) == 1) ? 0 : (((a ^ b) == 2) ? 1 : 2);
+                    return edgeIndex[std::min(a, b)][axis];
+                };
+
+                // Corners of the faces, counter-clockwise seen from outside
+                std::vector<std::array<int, 4>> faces;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    int const u = 1 << ((axis + 1) % 3);
+                    int const v = 1 << ((axis + 2) % 3);
+                    int const base = 1 << axis;
+                    faces.push_back({base, base | u, base | u | v, base | v});
+                    faces.push_back({0, v, u | v, u});
+                }
+
+                for (int configuration = 1; configuration < 255; ++configuration)
+                {
+                    auto inside = [configuration](int corner) { return ((configuration >> corner) & 1) == 1; };
+
+                    // next[e] is the edge that follows e on its loop
+                    int next[12];
+                    std::fill_n(next, 12, -1);
+                    for (auto const& face : faces)
+                    {
+                        for (int k = 0; k < 4; ++k)
+                        {
+                            // Entering the inside part along the face boundary
+                            if (inside(face[k]) || !inside(face[(k + 1) % 4]))
+                            {
+                                continue;
+                            }
+                            for (int step = 1; step < 4; ++step)
+                            {
+                                int const l = (k + step) % 4;
+                                if (inside(face[l]) && !inside(face[(l + 1) % 4]))
+                                {
+                                    next[edgeBetween(face[l], face[(l + 1) % 4])] = edgeBetween(face[k], face[(k + 1) % 4]);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    bool visited[12] = {};
+                    for (int start = 0; start < 12; ++start)
+                    {
+                        if (next[start] < 0 || visited[start])
+                        {
+                            continue;
+                        }
+                        std::vector<uint8_t> loop;
+                        for (int edge = start; !visited[edge]; edge = next[edge])
+                        {
+                            visited[edge] = true;
+                            loop.push_back(static_cast<uint8_t>(edge));
+                        }
+                        // The loops run counter-clockwise around the inside,
+                        // the triangles have to face the outside
+                        std::reverse(loop.begin(), loop.end());
+                        for (size_t index = 1; index + 1 < loop.size(); ++index)
+                        {
+                            table.triangles[configuration].insert(
+                                table.triangles[configuration].end(), {loop[0], loop[index], loop[index + 1]});
+                        }
+                    }
+                }
+                return table;
+            }
+
+            CaseTable const& caseTable()
+            {
+                static CaseTable const table = buildCaseTable();
+                return table;
+            }
+        }  // namespace
+
+        struct LevelSetMesher::TileMesh
+        {
+            std::vector<double> positions;
+            // Grid edge of vertices on the tile boundary, NoKey otherwise
+            std::vector<uint64_t> keys;
+            std::vector<uint32_t> triangles;
+        };
+
+        struct LevelSetMesher::TileBuffers
+        {
+            std::vector<double> values;
+            std::vector<double> clip;
+            std::vector<int32_t> edgeVertices;
+        };
+
+        LevelSetMesher::LevelSetMesher(CModelLevelSetObject& levelSet)
+            : m_sampler(levelSet)
+        {
+            double boxMin[3];
+            double boxMax[3];
+            if (!m_sampler.getBoundingBox(boxMin, boxMax))
+            {
+                return;
+            }
+
+            double longestSide = 0.;
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                longestSide = std::max(longestSide, boxMax[axis] - boxMin[axis]);
+            }
+            if (!(longestSide > 0.))
+            {
+                return;
+            }
+
+            double const minFeatureSize = levelSet.getMinFeatureSize();
+            double const cellSize = (minFeatureSize > 0.) ? 0.5 * minFeatureSize
+                                                          : longestSide / DefaultCellsPerAxis;
+            m_cellSize = std::max(cellSize, longestSide / MaxCellsPerAxis);
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                m_origin[axis] = boxMin[axis] - m_cellSize;
+                m_cellCounts[axis] = static_cast<size_t>(std::ceil((boxMax[axis] - boxMin[axis]) / m_cellSize)) + 2;
+            }
+        }
+
+        void LevelSetMesher::meshTile(size_t const* pTile,
+                                      TileBuffers& buffers,
+                                      LevelSetSampler::Workspace& workspace,
+                                      TileMesh& result) const
+        {
+            result.positions.clear();
+            result.keys.clear();
+            result.triangles.clear();
+
+            size_t first[3];
+            size_t cells[3];
+            size_t samples[3];
+            double origin[3];
+            double tileMax[3];
+            double const spacing[3] = {m_cellSize, m_cellSize, m_cellSize};
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                first[axis] = pTile[axis] * TileSize;
+                cells[axis] = std::min(TileSize, m_cellCounts[axis] - first[axis]);
+                samples[axis] = cells[axis] + 1;
+                origin[axis] = m_origin[axis] + first[axis] * m_cellSize;
+                tileMax[axis] = origin[axis] + cells[axis] * m_cellSize;
+            }
+            size_t const sampleCount = samples[0] * samples[1] * samples[2];
+
+            // The field is the maximum of the function and the clip value
+            auto& clip = buffers.clip;
+            clip.resize(sampleCount);
+            m_sampler.sampleClip(origin, spacing, samples, clip.data(), workspace);
+            if (std::all_of(clip.begin(), clip.end(), [](double value) { return value >= 0.; }))
+            {
+                return;
+            }
+            Interval const bounds = m_sampler.boundFunction(origin, tileMax);
+            if (bounds.lo >= 0.)
+            {
+                return;
+            }
+            if (bounds.hi < 0. && std::all_of(clip.begin(), clip.end(), [](double value) { return value < 0.; }))
+            {
+                return;
+            }
+
+            auto& values = buffers.values;
+            values.resize(sampleCount);
+            m_sampler.sampleFunction(origin, spacing, samples, values.data(), workspace);
+            for (size_t index = 0; index < sampleCount; ++index)
+            {
+                values[index] = std::max(values[index], clip[index]);
+            }
+
+            CaseTable const& table = caseTable();
+            size_t const strides[3] = {1, samples[0], samples[0] * samples[1]};
+            size_t cornerOffsets[8];
+            for (size_t corner = 0; corner < 8; ++corner)
+            {
+                cornerOffsets[corner] = (corner & 1) * strides[0] + ((corner >> 1) & 1) * strides[1] +
+                                        ((corner >> 2) & 1) * strides[2];
+            }
+            uint64_t const gridSamples[2] = {m_cellCounts[0] + 1, m_cellCounts[1] + 1};
+
+            auto& edgeVertices = buffers.edgeVertices;
+            edgeVertices.assign(sampleCount * 3, -1);
+            auto edgeVertex = [&](size_t const* pCell, CellEdge const& edge)
+            {
+                size_t const sample[3] = {pCell[0] + (edge.corner & 1),
+                                          pCell[1] + ((edge.corner >> 1) & 1),
+                                          pCell[2] + ((edge.corner >> 2) & 1)};
+                size_t const sampleIndex = sample[0] + sample[1] * strides[1] + sample[2] * strides[2];
+                int32_t& vertex = edgeVertices[sampleIndex * 3 + edge.axis];
+                if (vertex >= 0)
+                {
+                    return static_cast<uint32_t>(vertex);
+                }
+
+                double const v0 = values[sampleIndex];
+                double const v1 = values[sampleIndex + strides[edge.axis]];
+                double const t = std::min(std::max(v0 / (v0 - v1), MinEdgeFraction), 1. - MinEdgeFraction);
+                bool bOnBoundary = false;
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    double offset = static_cast<double>(sample[axis]);
+                    if (axis == edge.axis)
+                    {
+                        offset += t;
+                    }
+                    else if (sample[axis] == 0 || sample[axis] == cells[axis])
+                    {
+                        bOnBoundary = true;
+                    }
+                    result.positions.push_back(origin[axis] + offset * m_cellSize);
+                }
+
+                uint64_t key = NoKey;
+                if (bOnBoundary)
+                {
+                    key = (((first[2] + sample[2]) * gridSamples[1] + (first[1] + sample[1])) * gridSamples[0] +
+                           (first[0] + sample[0])) * 3 + edge.axis;
+                }
+                result.keys.push_back(key);
+                vertex = static_cast<int32_t>(result.keys.size() - 1);
+                return static_cast<uint32_t>(vertex);
+            };
+
+            size_t cell[3];
+            for (cell[2] = 0; cell[2] < cells[2]; ++cell[2])
+            {
+                for (cell[1] = 0; cell[1] < cells[1]; ++cell[1])
+                {
+                    for (cell[0] = 0; cell[0] < cells[0]; ++cell[0])
+                    {
+                        size_t const base = cell[0] + cell[1] * strides[1] + cell[2] * strides[2];
+                        size_t configuration = 0;
+                        for (size_t corner = 0; corner < 8; ++corner)
+                        {
+                            if (values[base + cornerOffsets[corner]] < 0.)
+                            {
+                                configuration |= size_t(1) << corner;
+                            }
+                        }
+
+                        for (uint8_t edge : table.triangles[configuration])
+                        {
+                            result.triangles.push_back(edgeVertex(cell, table.edges[edge]));
+                        }
+                    }
+                }
+            }
+        }
+
+        void LevelSetMesher::mesh(CMesh* pMesh, NMATRIX3 const& mMatrix) const
+        {
+            if (!(m_cellSize > 0.))
+            {
+                return;
+            }
+
+            size_t tileCounts[3];
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                tileCounts[axis] = (m_cellCounts[axis] + TileSize - 1) / TileSize;
+            }
+            size_t const tileCount = tileCounts[0] * tileCounts[1] * tileCounts[2];
+            nfUint32 const jobCount = fnGetParallelJobCount(tileCount, MinTilesPerThread);
+            size_t const batchSize = jobCount * TilesPerBatchAndThread;
+
+            std::vector<TileBuffers> buffers(jobCount);
+            std::vector<LevelSetSampler::Workspace> workspaces(jobCount);
+            std::vector<TileMesh> tiles(batchSize);
+
+            // Tiles are meshed in parallel batches and merged in order, so that
+            // the result does not depend on the thread count
+            nfUint32 const firstNode = pMesh->getNodeCount();
+            std::vector<nfFloat> coordinates;
+            std::vector<nfUint32> indices;
+            std::unordered_map<uint64_t, nfUint32> sharedVertices;
+            std::vector<nfUint32> vertexMap;
+            for (size_t firstTile = 0; firstTile < tileCount; firstTile += batchSize)
+            {
+                size_t const count = std::min(batchSize, tileCount - firstTile);
+                std::atomic<size_t> nextTile(0);
+                fnRunParallelJobs(jobCount, [&](nfUint32 nJob)
+                {
+                    for (size_t index = nextTile++; index < count; index = nextTile++)
+                    {
+                        size_t const tileIndex = firstTile + index;
+                        size_t const tile[3] = {tileIndex % tileCounts[0],
+                                                (tileIndex / tileCounts[0]) % tileCounts[1],
+                                                tileIndex / (tileCounts[0] * tileCounts[1])};
+                        meshTile(tile, buffers[nJob], workspaces[nJob], tiles[index]);
+                    }
+                });
+
+                for (size_t index = 0; index < count; ++index)
+                {
+                    TileMesh const& tile = tiles[index];
+                    vertexMap.resize(tile.keys.size());
+                    for (size_t vertex = 0; vertex < tile.keys.size(); ++vertex)
+                    {
+                        nfUint32 const newNode = firstNode + static_cast<nfUint32>(coordinates.size() / 3);
+                        if (tile.keys[vertex] != NoKey)
+                        {
+                            auto const inserted = sharedVertices.emplace(tile.keys[vertex], newNode);
+                            if (!inserted.second)
+                            {
+                                vertexMap[vertex] = inserted.first->second;
+                                continue;
+                            }
+                        }
+                        vertexMap[vertex] = newNode;
+
+                        NVEC3 position;
+                        for (size_t axis = 0; axis < 3; ++axis)
+                        {
+                            position.m_fields[axis] = static_cast<nfFloat>(tile.positions[vertex * 3 + axis]);
+                        }
+                        position = fnMATRIX3_apply(mMatrix, position);
+                        coordinates.insert(coordinates.end(), position.m_fields, position.m_fields + 3);
+                    }
+
+                    for (uint32_t vertex : tile.triangles)
+                    {
+                        indices.push_back(vertexMap[vertex]);
+                    }
+                }
+            }
+
+            pMesh->addNodes(coordinates.data(), static_cast<nfUint32>(coordinates.size() / 3));
+            pMesh->addFaces(indices.data(), static_cast<nfUint32>(indices.size() / 3));
+        }
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,463 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+
+#include "Model/Classes/NMR_LevelSetSampler.h"
+#include "Common/Mesh/NMR_Mesh.h"
+#include "Model/Classes/NMR_ModelImplicitFunction.h"
+#include "Model/Classes/NMR_ModelLevelSetObject.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "lib3mf_interfaceexception.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            size_t constexpr MaxBucketsPerAxis = 256;
+
+            struct Point2
+            {
+                double x;
+                double y;
+            };
+
+            // Left side test of (x, y) against the edge from p to q. The
+            // value only depends on the unordered pair of end points, so
+            // neighbouring triangles see exactly opposite values.
+            double edgeFunction(Point2 p, Point2 q, double x, double y)
+            {
+                if (q.x < p.x || (q.x == p.x && q.y < p.y))
+                {
+                    return -edgeFunction(q, p, x, y);
+                }
+                return (q.x - p.x) * (y - p.y) - (q.y - p.y) * (x - p.x);
+            }
+
+            // Tie break for points on an edge, equivalent to moving the point
+            // by an infinitesimal (-e, -e^2). Exactly one of two triangles
+            // sharing the edge contains such a point.
+            bool ownsEdge(Point2 p, Point2 q)
+            {
+                double const dx = q.x - p.x;
+                double const dy = q.y - p.y;
+                return dy > 0. || (dy == 0. && dx < 0.);
+            }
+
+            bool insideEdge(double value, Point2 p, Point2 q)
+            {
+                return value > 0. || (value == 0. && ownsEdge(p, q));
+            }
+
+            size_t pointCount(size_t const* pCounts)
+            {
+                return pCounts[0] * pCounts[1] * pCounts[2];
+            }
+        }  // namespace
+
+        LevelSetSampler::LevelSetSampler(CModelLevelSetObject& levelSet)
+        {
+            auto pFunction = std::dynamic_pointer_cast<CModelImplicitFunction>(levelSet.getFunction());
+            if (!pFunction)
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_NOTIMPLEMENTED,
+                    "Level sets can only be evaluated for implicit functions.");
+            }
+            auto pMeshObject = levelSet.getMesh();
+            if (!pMeshObject)
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_INVALIDPARAM,
+                    "The level set has no bounding mesh.");
+            }
+
+            std::string channel = levelSet.getChannelName();
+            if (channel.empty() && !pFunction->getOutputs()->empty())
+            {
+                channel = pFunction->getOutputs()->front()->getIdentifier();
+            }
+            m_program = std::make_shared<Program>(*pFunction, channel);
+            if (m_program->getInputComponentCount() != 3 || m_program->getOutputComponentCount() != 1)
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_INVALIDPARAM,
+                    "Function " + pFunction->getIdentifier() +
+                        " needs a vector input and a scalar output " + channel + " to be used by a level set.");
+            }
+
+            NMATRIX3 const transform = levelSet.getTransform();
+            for (size_t row = 0; row < 3; ++row)
+            {
+                for (size_t column = 0; column < 4; ++column)
+                {
+                    m_transform[row][column] = transform.m_fields[row][column];
+                }
+            }
+            m_fallBackValue = levelSet.getFallBackValue();
+            m_bBoxOnly = levelSet.getMeshBBoxOnly();
+
+            CMesh* pMesh = pMeshObject->getMesh();
+            nfUint32 const nodeCount = pMesh->getNodeCount();
+            if (nodeCount == 0)
+            {
+                return;
+            }
+
+            std::vector<nfFloat> coordinates(static_cast<size_t>(nodeCount) * 3);
+            pMesh->getNodeCoordinates(coordinates.data());
+            std::fill_n(m_boxMin, 3, std::numeric_limits<double>::max());
+            std::fill_n(m_boxMax, 3, std::numeric_limits<double>::lowest());
+            for (size_t index = 0; index < coordinates.size(); ++index)
+            {
+                m_boxMin[index % 3] = std::min(m_boxMin[index % 3], static_cast<double>(coordinates[index]));
+                m_boxMax[index % 3] = std::max(m_boxMax[index % 3], static_cast<double>(coordinates[index]));
+            }
+            m_bHasBox = true;
+
+            if (m_bBoxOnly)
+            {
+                return;
+            }
+
+            std::vector<nfUint32> indices(static_cast<size_t>(pMesh->getFaceCount()) * 3);
+            pMesh->getFaceNodeIndices(indices.data());
+            m_triangles.reserve(indices.size() * 3);
+            for (nfUint32 index : indices)
+            {
+                m_triangles.insert(m_triangles.end(), &coordinates[index * 3], &coordinates[index * 3] + 3);
+            }
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                buildProjection(axis);
+            }
+        }
+
+        void LevelSetSampler::buildProjection(size_t axis)
+        {
+            Projection& projection = m_projections[axis];
+            projection.axes[0] = (axis + 1) % 3;
+            projection.axes[1] = (axis + 2) % 3;
+            projection.axes[2] = axis;
+
+            size_t const triangleCount = m_triangles.size() / 9;
+            size_t const bucketsPerAxis = std::min(
+                MaxBucketsPerAxis,
+                std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(triangleCount)))));
+            for (size_t index = 0; index < 2; ++index)
+            {
+                size_t const u = projection.axes[index];
+                double const extent = m_boxMax[u] - m_boxMin[u];
+                projection.bucketCounts[index] = (extent > 0.) ? bucketsPerAxis : 1;
+                projection.bucketSize[index] = (extent > 0.) ? extent / bucketsPerAxis : 1.;
+            }
+
+            auto bucketIndex = [this, &projection](size_t index, double value)
+            {
+                double const position = std::floor(
+                    (value - m_boxMin[projection.axes[index]]) / projection.bucketSize[index]);
+                return static_cast<size_t>(
+                    std::min(std::max(position, 0.), static_cast<double>(projection.bucketCounts[index] - 1)));
+            };
+
+            // Counting sort of the triangles into all buckets they overlap
+            auto& starts = projection.bucketStarts;
+            starts.assign(projection.bucketCounts[0] * projection.bucketCounts[1] + 1, 0);
+            std::vector<uint32_t> cursors;
+            for (size_t pass = 0; pass < 2; ++pass)
+            {
+                if (pass == 1)
+                {
+                    for (size_t bucket = 1; bucket < starts.size(); ++bucket)
+                    {
+                        starts[bucket] += starts[bucket - 1];
+                    }
+                    projection.bucketTriangles.resize(starts.back());
+                    cursors.assign(starts.begin(), starts.end() - 1);
+                }
+
+                for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    double const* t = &m_triangles[triangle * 9];
+                    size_t range[2][2];
+                    for (size_t index = 0; index < 2; ++index)
+                    {
+                        size_t const u = projection.axes[index];
+                        range[index][0] = bucketIndex(index, std::min({t[u], t[3 + u], t[6 + u]}));
+                        range[index][1] = bucketIndex(index, std::max({t[u], t[3 + u], t[6 + u]}));
+                    }
+                    for (size_t y = range[1][0]; y <= range[1][1]; ++y)
+                    {
+                        for (size_t x = range[0][0]; x <= range[0][1]; ++x)
+                        {
+                            size_t const bucket = y * projection.bucketCounts[0] + x;
+                            if (pass == 0)
+                            {
+                                ++starts[bucket + 1];
+                            }
+                            else
+                            {
+                                projection.bucketTriangles[cursors[bucket]++] = static_cast<uint32_t>(triangle);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        void LevelSetSampler::findCrossings(size_t axis, double u, double v, std::vector<double>& crossings) const
+        {
+            crossings.clear();
+            Projection const& projection = m_projections[axis];
+            size_t const axisU = projection.axes[0];
+            size_t const axisV = projection.axes[1];
+            if (m_triangles.empty() || u < m_boxMin[axisU] || u > m_boxMax[axisU] ||
+                v < m_boxMin[axisV] || v > m_boxMax[axisV])
+            {
+                return;
+            }
+
+            size_t const bucketU = std::min(projection.bucketCounts[0] - 1,
+                                            static_cast<size_t>((u - m_boxMin[axisU]) / projection.bucketSize[0]));
+            size_t const bucketV = std::min(projection.bucketCounts[1] - 1,
+                                            static_cast<size_t>((v - m_boxMin[axisV]) / projection.bucketSize[1]));
+            size_t const bucket = bucketV * projection.bucketCounts[0] + bucketU;
+            for (size_t index = projection.bucketStarts[bucket]; index < projection.bucketStarts[bucket + 1]; ++index)
+            {
+                double const* t = &m_triangles[projection.bucketTriangles[index] * 9];
+                Point2 const a = {t[axisU], t[axisV]};
+                Point2 b = {t[3 + axisU], t[3 + axisV]};
+                Point2 c = {t[6 + axisU], t[6 + axisV]};
+                double const area = (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+                // Triangles parallel to the line are never crossed
+                if (area == 0.)
+                {
+                    continue;
+                }
+
+                // Barycentric weights of the counter-clockwise projection
+                double const* vertices[3] = {t, t + 3, t + 6};
+                if (area < 0.)
+                {
+                    std::swap(b, c);
+                    std::swap(vertices[1], vertices[2]);
+                }
+                double const weights[3] = {edgeFunction(b, c, u, v), edgeFunction(c, a, u, v), edgeFunction(a, b, u, v)};
+                if (insideEdge(weights[0], b, c) && insideEdge(weights[1], c, a) && insideEdge(weights[2], a, b))
+                {
+                    crossings.push_back((weights[0] * vertices[0][axis] + weights[1] * vertices[1][axis] +
+                                         weights[2] * vertices[2][axis]) /
+                                        (weights[0] + weights[1] + weights[2]));
+                }
+            }
+            std::sort(crossings.begin(), crossings.end());
+        }
+
+        bool LevelSetSampler::getBoundingBox(double* pMin, double* pMax) const
+        {
+            std::copy(m_boxMin, m_boxMin + 3, pMin);
+            std::copy(m_boxMax, m_boxMax + 3, pMax);
+            return m_bHasBox;
+        }
+
+        void LevelSetSampler::sampleGrid(double const* pOrigin,
+                                         double const* pSpacing,
+                                         size_t const* pCounts,
+                                         double* pValues,
+                                         Workspace& workspace) const
+        {
+            sampleFunction(pOrigin, pSpacing, pCounts, pValues, workspace);
+            workspace.clip.resize(pointCount(pCounts));
+            sampleClip(pOrigin, pSpacing, pCounts, workspace.clip.data(), workspace);
+            for (size_t index = 0; index < workspace.clip.size(); ++index)
+            {
+                pValues[index] = std::max(pValues[index], workspace.clip[index]);
+            }
+        }
+
+        void LevelSetSampler::sampleClip(double const* pOrigin,
+                                         double const* pSpacing,
+                                         size_t const* pCounts,
+                                         double* pValues,
+                                         Workspace& workspace) const
+        {
+            double const infinity = std::numeric_limits<double>::infinity();
+            if (!m_bHasBox)
+            {
+                std::fill_n(pValues, pointCount(pCounts), infinity);
+                return;
+            }
+
+            if (m_bBoxOnly)
+            {
+                double center[3];
+                double halfSize[3];
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    center[axis] = 0.5 * (m_boxMin[axis] + m_boxMax[axis]);
+                    halfSize[axis] = 0.5 * (m_boxMax[axis] - m_boxMin[axis]);
+                }
+
+                size_t index = 0;
+                for (size_t k = 0; k < pCounts[2]; ++k)
+                {
+                    for (size_t j = 0; j < pCounts[1]; ++j)
+                    {
+                        for (size_t i = 0; i < pCounts[0]; ++i, ++index)
+                        {
+                            double const position[3] = {pOrigin[0] + i * pSpacing[0],
+                                                        pOrigin[1] + j * pSpacing[1],
+                                                        pOrigin[2] + k * pSpacing[2]};
+                            double outside = 0.;
+                            double inside = -infinity;
+                            for (size_t axis = 0; axis < 3; ++axis)
+                            {
+                                double const q = std::fabs(position[axis] - center[axis]) - halfSize[axis];
+                                outside += (q > 0.) ? q * q : 0.;
+                                inside = std::max(inside, q);
+                            }
+                            pValues[index] = std::sqrt(outside) + std::min(inside, 0.);
+                        }
+                    }
+                }
+                return;
+            }
+
+            double cap = std::max({pSpacing[0], pSpacing[1], pSpacing[2]});
+            if (!(cap > 0.))
+            {
+                cap = infinity;
+            }
+
+            // Distances along x and y, then along z, where the crossings also
+            // give the sign
+            size_t const strides[3] = {1, pCounts[0], pCounts[0] * pCounts[1]};
+            std::fill_n(pValues, pointCount(pCounts), infinity);
+            auto& crossings = workspace.crossings;
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                size_t const axisU = m_projections[axis].axes[0];
+                size_t const axisV = m_projections[axis].axes[1];
+                for (size_t v = 0; v < pCounts[axisV]; ++v)
+                {
+                    for (size_t u = 0; u < pCounts[axisU]; ++u)
+                    {
+                        findCrossings(axis, pOrigin[axisU] + u * pSpacing[axisU],
+                                      pOrigin[axisV] + v * pSpacing[axisV], crossings);
+                        double* pLine = pValues + u * strides[axisU] + v * strides[axisV];
+                        for (size_t w = 0; w < pCounts[axis]; ++w)
+                        {
+                            double const position = pOrigin[axis] + w * pSpacing[axis];
+                            auto const above = std::upper_bound(crossings.begin(), crossings.end(), position);
+                            double distance = infinity;
+                            if (above != crossings.end())
+                            {
+                                distance = *above - position;
+                            }
+                            if (above != crossings.begin())
+                            {
+                                distance = std::min(distance, position - *(above - 1));
+                            }
+
+                            double& value = pLine[w * strides[axis]];
+                            value = std::min(value, distance);
+                            if (axis == 2)
+                            {
+                                bool const bInside = ((above - crossings.begin()) % 2) == 1;
+                                value = bInside ? -value : std::min(value, cap);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        void LevelSetSampler::sampleFunction(double const* pOrigin,
+                                             double const* pSpacing,
+                                             size_t const* pCounts,
+                                             double* pValues,
+                                             Workspace& workspace) const
+        {
+            size_t const count = pointCount(pCounts);
+            auto& inputs = workspace.inputs;
+            inputs.resize(count * 3);
+
+            size_t index = 0;
+            for (size_t k = 0; k < pCounts[2]; ++k)
+            {
+                for (size_t j = 0; j < pCounts[1]; ++j)
+                {
+                    for (size_t i = 0; i < pCounts[0]; ++i, ++index)
+                    {
+                        double const x = pOrigin[0] + i * pSpacing[0];
+                        double const y = pOrigin[1] + j * pSpacing[1];
+                        double const z = pOrigin[2] + k * pSpacing[2];
+                        for (size_t row = 0; row < 3; ++row)
+                        {
+                            inputs[row * count + index] = m_transform[row][0] * x + m_transform[row][1] * y +
+                                                          m_transform[row][2] * z + m_transform[row][3];
+                        }
+                    }
+                }
+            }
+
+            m_program->evaluateRange(workspace.registers, inputs.data(), count, pValues, count, 0, count);
+            for (size_t point = 0; point < count; ++point)
+            {
+                if (std::isnan(pValues[point]))
+                {
+                    pValues[point] = m_fallBackValue;
+                }
+            }
+        }
+
+        Interval LevelSetSampler::boundFunction(double const* pMin, double const* pMax) const
+        {
+            Interval inputs[3];
+            for (size_t row = 0; row < 3; ++row)
+            {
+                // Extremes of an affine function over a box
+                double const center = m_transform[row][0] * 0.5 * (pMin[0] + pMax[0]) +
+                                      m_transform[row][1] * 0.5 * (pMin[1] + pMax[1]) +
+                                      m_transform[row][2] * 0.5 * (pMin[2] + pMax[2]) + m_transform[row][3];
+                double const radius = std::fabs(m_transform[row][0]) * 0.5 * (pMax[0] - pMin[0]) +
+                                      std::fabs(m_transform[row][1]) * 0.5 * (pMax[1] - pMin[1]) +
+                                      std::fabs(m_transform[row][2]) * 0.5 * (pMax[2] - pMin[2]);
+                inputs[row] = {center - radius, center + radius};
+            }
+
+            Interval bounds;
+            m_program->evaluateBounds(inputs, &bounds);
+            return bounds;
+        }
+    }  // namespace implicit
+}  // namespace NMR
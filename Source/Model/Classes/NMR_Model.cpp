@@ -34,6 +34,7 @@ A model is an in memory representation of the 3MF file.
 #include "Model/Classes/NMR_Model.h"
 #include "Model/Classes/NMR_ModelObject.h"
 #include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Model/Classes/NMR_ModelComponentsObject.h"
 #include "Model/Classes/NMR_ModelConstants.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 #include "Model/Classes/NMR_ModelAttachment.h"
@@ -57,11 +58,13 @@ A model is an in memory representation of the 3MF file.
 #include "Common/MeshInformation/NMR_MeshInformation.h"
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_ParallelJobs.h"
 #include <sstream>
 #include <memory>
 #include <random>
 #include <mutex>
 #include <array>
+#include <unordered_set>
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_SliceRefModel.h"
 #include "Common/Platform/NMR_XmlReader.h"
@@ -72,6 +75,9 @@ A model is an in memory representation of the 3MF file.
 
 #include "Model/Classes/NMR_KeyStoreFactory.h"
 
+// Build items per thread below which no further threads are used for outboxes
+#define NMR_MODEL_MINBUILDITEMSPERTHREAD 64
+
 namespace NMR {
 
 	CModel::CModel()
@@ -351,6 +357,46 @@ namespace NMR {
 		return m_BuildItems[nIdx];
 	}
 
+	void CModel::getBuildItemOutboxes(_Out_ std::vector<NOUTBOX3> & Outboxes)
+	{
+		nfUint32 nBuildItemCount = getBuildItemCount();
+		Outboxes.resize(nBuildItemCount);
+
+		// Objects are loaded and their outbox data is cached first, the build items only read it afterwards
+		std::unordered_set<CModelObject *> VisitedObjects;
+		std::vector<CModelObject *> PendingObjects;
+		for (auto & pBuildItem : m_BuildItems) {
+			CModelObject * pObject = pBuildItem->getObject();
+			if (VisitedObjects.insert(pObject).second)
+				PendingObjects.push_back(pObject);
+		}
+
+		while (!PendingObjects.empty()) {
+			CModelObject * pObject = PendingObjects.back();
+			PendingObjects.pop_back();
+			pObject->prepareOutbox();
+
+			CModelComponentsObject * pComponentsObject = dynamic_cast<CModelComponentsObject *>(pObject);
+			if (pComponentsObject != nullptr) {
+				for (nfUint32 nIndex = 0; nIndex < pComponentsObject->getComponentCount(); nIndex++) {
+					CModelObject * pChildObject = pComponentsObject->getComponent(nIndex)->getObject();
+					if (VisitedObjects.insert(pChildObject).second)
+						PendingObjects.push_back(pChildObject);
+				}
+			}
+		}
+
+		nfUint32 nThreadCount = std::min(fnGetParallelJobCount(nBuildItemCount, NMR_MODEL_MINBUILDITEMSPERTHREAD), std::max(nBuildItemCount, 1u));
+		fnRunParallelJobs(nThreadCount, [&](nfUint32 nThreadIndex) {
+			nfUint32 nFirstItem = (nfUint32)((nfUint64)nBuildItemCount * nThreadIndex / nThreadCount);
+			nfUint32 nEndItem = (nfUint32)((nfUint64)nBuildItemCount * (nThreadIndex + 1) / nThreadCount);
+			for (nfUint32 nIndex = nFirstItem; nIndex < nEndItem; nIndex++) {
+				fnOutboxInitialize(Outboxes[nIndex]);
+				m_BuildItems[nIndex]->getObject()->extendOutbox(Outboxes[nIndex], m_BuildItems[nIndex]->getTransform());
+			}
+		});
+	}
+
 	void CModel::removeBuildItem(_In_ nfUint32 nHandle, _In_ nfBool bThrowExceptionIfNotFound)
 	{
 		auto iIterator = m_BuildItems.begin();
@@ -1114,11 +1160,6 @@ namespace NMR {
 				pNewImplicitFunction->setPackageResourceID(newPkgId);
 				pNewImplicitFunction->setModel(this);
 
-				for (auto &node : *pNewImplicitFunction->getNodes())
-				{
-					node->setParent(pNewImplicitFunction.get());
-				}
-
 				addResource(pNewImplicitFunction);
 				oldToNewMapping[pOldImplicitFunction->getPackageResourceID()->getUniqueID()] = pNewImplicitFunction->getPackageResourceID()->getUniqueID();
 
@@ -1817,5 +1858,110 @@ namespace NMR {
 
 		throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
 	}
+
+	void CModel::shareModelAttachments(_In_ CModel * pSourceModel)
+	{
+		if (pSourceModel == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		for (auto pAttachment : pSourceModel->m_Attachments) {
+			m_Attachments.push_back(pAttachment);
+			m_AttachmentURIMap.insert(std::make_pair(pAttachment->getPathURI(), pAttachment));
+		}
+	}
+
+	nfBool CModel::canAdoptStagedResources(_In_ CModel * pStagedModel)
+	{
+		if (pStagedModel == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		// Every package resource ID must belong to a resource, and unique IDs must have been
+		// handed out as 1..n, so that shifting them reproduces a serial read into this model.
+		nfUint32 nResourceCount = (nfUint32)pStagedModel->m_Resources.size();
+		if (pStagedModel->m_resourceHandler.getResourceIDCount() != nResourceCount)
+			return false;
+		if (pStagedModel->m_resourceHandler.getMaxUniqueID() != nResourceCount)
+			return false;
+
+		for (auto pResource : pStagedModel->m_Resources) {
+			PPackageResourceID pPackageResourceID = pResource->getPackageResourceID();
+			if (findPackageResourceID(pPackageResourceID->getPath(), pPackageResourceID->getModelResourceID()))
+				return false;
+
+			// Only resources that reference other resources by pointer or by patchable
+			// unique ID can be moved. Textures refer to attachments of the main model.
+			CModelResource * pRawResource = pResource.get();
+			CModelObject * pObject = dynamic_cast<CModelObject *>(pRawResource);
+			if (pObject != nullptr) {
+				if (pObject->getSliceStack().get() != nullptr)
+					return false;
+
+				CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *>(pObject);
+				if (pMeshObject != nullptr) {
+					if (pMeshObject->getVolumeData().get() != nullptr)
+						return false;
+				}
+				else if (dynamic_cast<CModelComponentsObject *>(pObject) == nullptr)
+					return false;
+			}
+			else if ((dynamic_cast<CModelBaseMaterialResource *>(pRawResource) == nullptr) &&
+				(dynamic_cast<CModelColorGroupResource *>(pRawResource) == nullptr) &&
+				(dynamic_cast<CModelCompositeMaterialsResource *>(pRawResource) == nullptr) &&
+				(dynamic_cast<CModelMultiPropertyGroupResource *>(pRawResource) == nullptr))
+				return false;
+		}
+
+		for (auto iIterator : pStagedModel->usedUUIDs) {
+			if (iIterator.second == pStagedModel->m_buildUUID)
+				continue;
+			if (usedUUIDs.find(iIterator.first) != usedUUIDs.end())
+				return false;
+		}
+
+		return true;
+	}
+
+	void CModel::adoptStagedResources(_In_ CModel * pStagedModel)
+	{
+		if (!canAdoptStagedResources(pStagedModel))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		UniqueResourceID nUniqueIDOffset = m_resourceHandler.getMaxUniqueID();
+		UniqueResourceIDMapping oldToNewMapping;
+		for (auto pResource : pStagedModel->m_Resources) {
+			UniqueResourceID nOldID = pResource->getPackageResourceID()->getUniqueID();
+			oldToNewMapping[nOldID] = nOldID + nUniqueIDOffset;
+		}
+
+		m_resourceHandler.adoptPackageResourceIDs(&pStagedModel->m_resourceHandler, nUniqueIDOffset);
+
+		for (auto pResource : pStagedModel->m_Resources) {
+			pResource->setModel(this);
+
+			CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *>(pResource.get());
+			if (pMeshObject != nullptr)
+				pMeshObject->getMesh()->patchMeshInformationResources(oldToNewMapping);
+
+			CModelMultiPropertyGroupResource * pMultiPropertyGroup = dynamic_cast<CModelMultiPropertyGroupResource *>(pResource.get());
+			if (pMultiPropertyGroup != nullptr) {
+				nfUint32 nLayerCount = pMultiPropertyGroup->getLayerCount();
+				for (nfUint32 nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++) {
+					MODELMULTIPROPERTYLAYER sLayer = pMultiPropertyGroup->getLayer(nLayerIndex);
+					sLayer.m_nUniqueResourceID = oldToNewMapping[sLayer.m_nUniqueResourceID];
+					pMultiPropertyGroup->setLayer(nLayerIndex, sLayer);
+				}
+			}
+
+			addResource(pResource);
+		}
+
+		for (auto iIterator : pStagedModel->usedUUIDs) {
+			if (iIterator.second != pStagedModel->m_buildUUID)
+				registerUUID(iIterator.second);
+		}
+
+		pStagedModel->usedUUIDs.clear();
+		pStagedModel->clearAll();
+	}
 }  // namespace NMR
 
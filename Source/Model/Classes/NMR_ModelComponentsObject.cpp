@@ -35,6 +35,9 @@ component object.
 #include "Model/Classes/NMR_ModelComponentsObject.h" 
 #include "Common/NMR_Exception.h"
 
+#include <unordered_set>
+#include <vector>
+
 namespace NMR {
 	
 	CModelComponentsObject::CModelComponentsObject(_In_ const ModelResourceID sID, _In_ CModel * pModel)
@@ -87,15 +90,32 @@ namespace NMR {
 
 	nfBool CModelComponentsObject::isValid()
 	{
-		if (m_Components.size() == 0)
-			return false;
+		// Objects that are referenced by several components are only validated once
+		std::unordered_set<CModelObject *> VisitedObjects;
+		std::vector<CModelComponentsObject *> PendingObjects;
+		VisitedObjects.insert(this);
+		PendingObjects.push_back(this);
 
-		for (auto iIterator = m_Components.begin(); iIterator != m_Components.end(); iIterator++) {
-			CModelObject * pObject = (*iIterator)->getObject();
-			__NMRASSERT(pObject);
+		while (!PendingObjects.empty()) {
+			CModelComponentsObject * pComponentsObject = PendingObjects.back();
+			PendingObjects.pop_back();
 
-			if (!pObject->isValid())
+			if (pComponentsObject->m_Components.size() == 0)
 				return false;
+
+			for (auto iIterator = pComponentsObject->m_Components.begin(); iIterator != pComponentsObject->m_Components.end(); iIterator++) {
+				CModelObject * pObject = (*iIterator)->getObject();
+				__NMRASSERT(pObject);
+
+				if (!VisitedObjects.insert(pObject).second)
+					continue;
+
+				CModelComponentsObject * pChildComponentsObject = dynamic_cast<CModelComponentsObject *>(pObject);
+				if (pChildComponentsObject != nullptr)
+					PendingObjects.push_back(pChildComponentsObject);
+				else if (!pObject->isValid())
+					return false;
+			}
 		}
 
 		return true;
@@ -40,6 +40,39 @@ namespace NMR
         m_outputs = std::make_shared<Ports>();
     }
 
+    CModelFunction::CModelFunction(const CModelFunction & other)
+        : CModelResource(other)
+        , m_displayname(other.m_displayname)
+    {
+        copyPorts(other);
+    }
+
+    CModelFunction & CModelFunction::operator=(const CModelFunction & other)
+    {
+        if (this != &other)
+        {
+            CModelResource::operator=(other);
+            m_displayname = other.m_displayname;
+            copyPorts(other);
+            onGraphChanged();
+        }
+        return *this;
+    }
+
+    void CModelFunction::copyPorts(const CModelFunction & other)
+    {
+        m_inputs = std::make_shared<Ports>();
+        for (auto & port : *other.m_inputs)
+        {
+            m_inputs->push_back(std::make_shared<CModelImplicitPort>(nullptr, this, *port));
+        }
+        m_outputs = std::make_shared<Ports>();
+        for (auto & port : *other.m_outputs)
+        {
+            m_outputs->push_back(std::make_shared<CModelImplicitPort>(nullptr, this, *port));
+        }
+    }
+
     std::string const & CModelFunction::getDisplayName() const
     {
         return m_displayname;
@@ -55,8 +88,9 @@ namespace NMR
                                                         const Lib3MF::eImplicitPortType ePortType)
     {
         auto newPort =
-          std::make_shared<CModelImplicitPort>(sPortIdentifier, sDisplayName, ePortType);
+          std::make_shared<CModelImplicitPort>(this, sPortIdentifier, sDisplayName, ePortType);
         m_inputs->push_back(newPort);
+        onGraphChanged();
         return newPort;
     }
 
@@ -65,8 +99,9 @@ namespace NMR
                                                          const Lib3MF::eImplicitPortType ePortType)
     {
         auto newPort =
-          std::make_shared<CModelImplicitPort>(sPortIdentifier, sDisplayName, ePortType);
+          std::make_shared<CModelImplicitPort>(this, sPortIdentifier, sDisplayName, ePortType);
         m_outputs->push_back(newPort);
+        onGraphChanged();
         return newPort;
     }
 
@@ -108,5 +143,16 @@ namespace NMR
     {
         m_inputs->clear();
         m_outputs->clear();
+        onGraphChanged();
+    }
+
+    void CModelFunction::onGraphChanged()
+    {
+        m_nGraphVersion++;
+    }
+
+    nfUint64 CModelFunction::getGraphVersion() const
+    {
+        return m_nGraphVersion;
     }
 }
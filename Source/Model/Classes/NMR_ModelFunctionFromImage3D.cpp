@@ -39,6 +39,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setImage3DUniqueResourceID(const UniqueResourceID sID)
     {
         m_image3DUniqueResourceID = sID;
+        onGraphChanged();
     }
 
     UniqueResourceID CModelFunctionFromImage3D::getImage3DUniqueResourceID()
@@ -54,6 +55,7 @@ namespace NMR
         if (pResource == nullptr)
             throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
         m_image3DUniqueResourceID = pResource->getPackageResourceID()->getUniqueID();
+        onGraphChanged();
     }
 
     ModelResourceID CModelFunctionFromImage3D::getImage3DModelResourceID()
@@ -75,6 +77,7 @@ namespace NMR
         const eModelTextureTileStyle tileStyleU)
     {
         m_tileStyleU = tileStyleU;
+        onGraphChanged();
     }
 
     eModelTextureTileStyle CModelFunctionFromImage3D::getTileStyleU()
@@ -85,6 +88,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setTileStyleV(const eModelTextureTileStyle tileStyleV)
     {
         m_tileStyleV = tileStyleV;
+        onGraphChanged();
     }
 
     eModelTextureTileStyle CModelFunctionFromImage3D::getTileStyleV()
@@ -95,6 +99,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setTileStyleW(const eModelTextureTileStyle tileStyleW)
     {
         m_tileStyleW = tileStyleW;
+        onGraphChanged();
     }
 
     eModelTextureTileStyle CModelFunctionFromImage3D::getTileStyleW()
@@ -105,6 +110,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setFilter(const eModelTextureFilter filter)
     {
         m_filter = filter;
+        onGraphChanged();
     }
 
     eModelTextureFilter CModelFunctionFromImage3D::getFilter()
@@ -115,6 +121,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setOffset(double offset)
     {
         m_offset = offset;
+        onGraphChanged();
     }
 
     double CModelFunctionFromImage3D::getOffset()
@@ -125,6 +132,7 @@ namespace NMR
     void CModelFunctionFromImage3D::setScale(double scale)
     {
         m_scale = scale;
+        onGraphChanged();
     }
 
     double CModelFunctionFromImage3D::getScale()
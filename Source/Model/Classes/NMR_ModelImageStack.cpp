@@ -127,4 +127,11 @@ namespace NMR {
 		return pAttachment;
 	}
 
+	PImageStackCache CModelImageStack::getCache()
+	{
+		if (!m_pCache || !m_pCache->isValidFor(*this))
+			m_pCache = std::make_shared<CImageStackCache>(*this, IMAGESTACKCACHE_DEFAULTMEMORYBUDGET);
+		return m_pCache;
+	}
+
 }
@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "lib3mf_interfaceexception.hpp"
 #include "lib3mf_types.hpp"
 #include "Model/Classes/NMR_ImplicitNodeTypes.h"
+#include "Model/Classes/NMR_ImplicitProgram.h"
 #include "Model/Classes/NMR_ModelImplicitFunction.h"
 #include "Model/Classes/NMR_ModelImplicitPort.h"
 #include "Common/Graph/GraphAlgorithms.h"
@@ -47,14 +48,83 @@ namespace NMR
     CModelImplicitNode *
     CModelImplicitFunction::findNode(const ImplicitIdentifier & sIdentifier) const
     {
+        if (sIdentifier.empty())
+        {
+            for (auto & node : *m_nodes)
+            {
+                if (node->getIdentifier().empty())
+                {
+                    return node.get();
+                }
+            }
+            return nullptr;
+        }
+
+        if (!m_bNodeIndexValid)
+        {
+            rebuildNodeIndex();
+        }
+        auto it = m_nodeIndex.find(sIdentifier);
+        return (it != m_nodeIndex.end()) ? it->second.get() : nullptr;
+    }
+
+    void CModelImplicitFunction::rebuildNodeIndex() const
+    {
+        m_nodeIndex.clear();
+        m_nodeIndex.reserve(m_nodes->size());
+        m_bNodeIndexHasDuplicates = false;
         for (auto & node : *m_nodes)
         {
-            if (node->getIdentifier() == sIdentifier)
+            if (node->getIdentifier().empty())
             {
-                return node.get();
+                continue;
+            }
+            if (!m_nodeIndex.emplace(node->getIdentifier(), node).second)
+            {
+                m_bNodeIndexHasDuplicates = true;
             }
         }
-        return nullptr;
+        m_bNodeIndexValid = true;
+    }
+
+    void CModelImplicitFunction::indexNode(PModelImplicitNode const & node)
+    {
+        if (!m_bNodeIndexValid || node->getIdentifier().empty())
+        {
+            return;
+        }
+        auto result = m_nodeIndex.emplace(node->getIdentifier(), node);
+        if (!result.second && result.first->second != node)
+        {
+            // Which of the nodes comes first depends on their position in m_nodes
+            m_bNodeIndexValid = false;
+        }
+    }
+
+    void CModelImplicitFunction::unindexNode(CModelImplicitNode & node,
+                                             const ImplicitIdentifier & sIdentifier)
+    {
+        if (!m_bNodeIndexValid || sIdentifier.empty())
+        {
+            return;
+        }
+        auto it = m_nodeIndex.find(sIdentifier);
+        if (it != m_nodeIndex.end() && it->second.get() == &node)
+        {
+            m_nodeIndex.erase(it);
+            if (m_bNodeIndexHasDuplicates)
+            {
+                // Another node with the same identifier may take its place
+                m_bNodeIndexValid = false;
+            }
+        }
+    }
+
+    void CModelImplicitFunction::onNodeIdentifierChanged(CModelImplicitNode & node,
+                                                         const ImplicitIdentifier & sOldIdentifier)
+    {
+        unindexNode(node, sOldIdentifier);
+        indexNode(node.shared_from_this());
     }
 
     CModelImplicitFunction::CModelImplicitFunction(const ModelResourceID sID,
@@ -64,6 +134,42 @@ namespace NMR
         m_nodes = std::make_shared<ImplicitNodes>();
     }
 
+    CModelImplicitFunction::CModelImplicitFunction(const CModelImplicitFunction & other)
+        : CModelFunction(other)
+        , m_identifier(other.m_identifier)
+    {
+        copyNodes(other);
+    }
+
+    CModelImplicitFunction & CModelImplicitFunction::operator=(const CModelImplicitFunction & other)
+    {
+        if (this != &other)
+        {
+            CModelFunction::operator=(other);
+            m_identifier = other.m_identifier;
+            for (auto & node : *m_nodes)
+            {
+                node->setParent(nullptr);
+            }
+            copyNodes(other);
+            onGraphChanged();
+        }
+        return *this;
+    }
+
+    void CModelImplicitFunction::copyNodes(const CModelImplicitFunction & other)
+    {
+        m_nodes = std::make_shared<ImplicitNodes>();
+        m_nodes->reserve(other.m_nodes->size());
+        for (auto & node : *other.m_nodes)
+        {
+            m_nodes->push_back(node->clone(this));
+        }
+        m_nodeIndex.clear();
+        m_bNodeIndexValid = false;
+        m_bNodeIndexHasDuplicates = false;
+    }
+
     std::string const & CModelImplicitFunction::getIdentifier() const
     {
         return m_identifier;
@@ -84,6 +190,8 @@ namespace NMR
 
         m_nodeTypes.addExpectedPortsToNode(*node, eConfiguration);
         m_nodes->push_back(node);
+        indexNode(node);
+        onGraphChanged();
         return node;
     }
 
@@ -258,16 +366,27 @@ namespace NMR
         {
             throw CNMRException(NMR_ERROR_INVALIDPOINTER);
         }
+        unindexNode(*node, sIdentifier);
+        // Renaming the removed node must not affect the index
+        node->setParent(nullptr);
         m_nodes->erase(std::remove_if(m_nodes->begin(), m_nodes->end(),
                                       [node](PModelImplicitNode const& n)
                                       { return n.get() == node; }),
                        m_nodes->end());
+        onGraphChanged();
     }
 
     void CModelImplicitFunction::clear() 
     {
         CModelFunction::clear();
+        for (auto & node : *m_nodes)
+        {
+            node->setParent(nullptr);
+        }
         m_nodes->clear();
+        m_nodeIndex.clear();
+        m_bNodeIndexValid = true;
+        m_bNodeIndexHasDuplicates = false;
     }
 
     void CModelImplicitFunction::replaceResourceID(const ModelResourceID sOldID,
@@ -418,6 +537,13 @@ namespace NMR
             sortedNodes->push_back(m_nodes->at(nodeIndex));
         }
         std::swap(m_nodes, sortedNodes);
+
+        // The nodes are unchanged, only the first of nodes with the same
+        // identifier may differ
+        if (m_bNodeIndexHasDuplicates)
+        {
+            m_bNodeIndexValid = false;
+        }
     }
 
     PModelImplicitPort
@@ -441,6 +567,73 @@ namespace NMR
         return node->findOutput(portName);
     }
 
+    void CModelImplicitFunction::onGraphChanged()
+    {
+        CModelFunction::onGraphChanged();
+        std::lock_guard<std::mutex> lock(m_programMutex);
+        m_pProgram.reset();
+    }
+
+    std::shared_ptr<implicit::Program const> CModelImplicitFunction::getProgram()
+    {
+        std::lock_guard<std::mutex> lock(m_programMutex);
+        if (!m_pProgram || !m_pProgram->isUpToDate())
+        {
+            m_pProgram = std::make_shared<implicit::Program const>(*this);
+        }
+        return m_pProgram;
+    }
+
+    void CModelImplicitFunction::evaluateBatch(double const* pInputs,
+                                               size_t nValueCount,
+                                               size_t nOutputBufferSize,
+                                               size_t* pOutputNeededCount,
+                                               double* pOutputs)
+    {
+        auto const program = getProgram();
+
+        size_t const inputComponentCount = program->getInputComponentCount();
+        if (inputComponentCount == 0)
+        {
+            throw ELib3MFInterfaceException(
+                LIB3MF_ERROR_INVALIDPARAM,
+                "Function " + m_identifier + " has no inputs to evaluate.");
+        }
+        if ((nValueCount % inputComponentCount) != 0)
+        {
+            throw ELib3MFInterfaceException(
+                LIB3MF_ERROR_INVALIDPARAM,
+                "The number of input values must be a multiple of " +
+                    std::to_string(inputComponentCount) + ".");
+        }
+
+        size_t const pointCount = nValueCount / inputComponentCount;
+        size_t const outputCount =
+            pointCount * program->getOutputComponentCount();
+        if (pOutputNeededCount)
+        {
+            *pOutputNeededCount = outputCount;
+        }
+        if (pOutputs == nullptr)
+        {
+            return;
+        }
+        if (nOutputBufferSize < outputCount)
+        {
+            throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
+        }
+        if (nValueCount > 0 && pInputs == nullptr)
+        {
+            throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                            "Inputs must not be nullptr.");
+        }
+
+        if (outputCount > 0)
+        {
+            program->evaluate(pInputs, pOutputs, pointCount);
+        }
+    }
+
     ResourceDependencies CModelImplicitFunction::getDependencies()
     {  
         ResourceDependencies dependencies;
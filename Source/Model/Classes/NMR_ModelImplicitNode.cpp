@@ -62,6 +62,32 @@ namespace NMR
         m_inputs = std::make_shared<Ports>();
     }
 
+    std::shared_ptr<CModelImplicitNode> CModelImplicitNode::clone(CModelImplicitFunction * parent) const
+    {
+        auto node = std::make_shared<CModelImplicitNode>(m_type, m_identifier, m_displayname, m_tag, parent);
+        for (auto & port : *m_inputs)
+        {
+            node->m_inputs->push_back(std::make_shared<CModelImplicitPort>(node.get(), nullptr, *port));
+        }
+        for (auto & port : *m_outputs)
+        {
+            node->m_outputs->push_back(std::make_shared<CModelImplicitPort>(node.get(), nullptr, *port));
+        }
+        node->m_constant = m_constant;
+        if (m_vector)
+        {
+            node->m_vector = std::unique_ptr<Lib3MF::sVector>(new Lib3MF::sVector(*m_vector));
+        }
+        if (m_matrix)
+        {
+            node->m_matrix = std::unique_ptr<Lib3MF::sMatrix4x4>(new Lib3MF::sMatrix4x4(*m_matrix));
+        }
+        node->m_modelResourceID = m_modelResourceID;
+        node->m_graphId = m_graphId;
+        node->m_topologicalOrderIndex = m_topologicalOrderIndex;
+        return node;
+    }
+
     ImplicitIdentifier const & CModelImplicitNode::getIdentifier() const
     {
         return m_identifier;
@@ -74,7 +100,17 @@ namespace NMR
 
     void CModelImplicitNode::setIdentifier(ImplicitIdentifier const & identifier)
     {
+        if (identifier == m_identifier)
+        {
+            return;
+        }
+        ImplicitIdentifier const oldIdentifier = m_identifier;
         m_identifier = identifier;
+        if (m_parent)
+        {
+            m_parent->onNodeIdentifierChanged(*this, oldIdentifier);
+            m_parent->onGraphChanged();
+        }
     }
 
     void CModelImplicitNode::setDisplayName(std::string const & displayname)
@@ -85,6 +121,7 @@ namespace NMR
     void NMR::CModelImplicitNode::setType(Lib3MF::eImplicitNodeType type)
     {
         m_type = type;
+        onChanged();
     }
 
     void CModelImplicitNode::setTag(std::string const & tag)
@@ -107,6 +144,7 @@ namespace NMR
     {
         auto newPort = std::make_shared<CModelImplicitPort>(this, sIdentifier, sDisplayName);
         m_inputs->push_back(newPort);
+        onChanged();
         return newPort;
     }
 
@@ -115,6 +153,7 @@ namespace NMR
     {
         auto newPort = std::make_shared<CModelImplicitPort>(this, sIdentifier, sDisplayName);
         m_outputs->push_back(newPort);
+        onChanged();
         return newPort;
     }
 
@@ -157,6 +196,7 @@ namespace NMR
         if (m_type != Lib3MF::eImplicitNodeType::Constant)
             throw CNMRException(NMR_ERROR_INVALIDPARAM);
         m_constant = value;
+        onChanged();
     }
     double CModelImplicitNode::getConstant() const
     {
@@ -171,6 +211,7 @@ namespace NMR
         if (m_type != Lib3MF::eImplicitNodeType::ConstVec)
             throw CNMRException(NMR_ERROR_INVALIDPARAM);
         m_vector = std::unique_ptr<Lib3MF::sVector>(new Lib3MF::sVector(value));
+        onChanged();
     }
 
     Lib3MF::sVector CModelImplicitNode::getVector() const
@@ -188,6 +229,7 @@ namespace NMR
         if (m_type != Lib3MF::eImplicitNodeType::ConstMat)
             throw CNMRException(NMR_ERROR_INVALIDPARAM);
         m_matrix = std::unique_ptr<Lib3MF::sMatrix4x4>(new Lib3MF::sMatrix4x4(value));
+        onChanged();
     }
 
     Lib3MF::sMatrix4x4 CModelImplicitNode::getMatrix() const
@@ -205,6 +247,7 @@ namespace NMR
         if (m_type != Lib3MF::eImplicitNodeType::ConstResourceID)
             throw CNMRException(NMR_ERROR_INVALIDPARAM);
         m_modelResourceID = resourceID;
+        onChanged();
     }
 
     ModelResourceID CModelImplicitNode::getModelResourceID() const
@@ -256,4 +299,12 @@ namespace NMR
     {
         m_parent = parent;
     }
+
+    void CModelImplicitNode::onChanged()
+    {
+        if (m_parent)
+        {
+            m_parent->onGraphChanged();
+        }
+    }
 } // namespace NMR
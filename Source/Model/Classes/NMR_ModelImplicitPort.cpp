@@ -43,15 +43,29 @@ namespace NMR
     {
     }
 
-    CModelImplicitPort::CModelImplicitPort(ImplicitIdentifier const & identifier,
+    CModelImplicitPort::CModelImplicitPort(CModelFunction * function,
+                                           ImplicitIdentifier const & identifier,
                                            std::string const & displayname,
                                            Lib3MF::eImplicitPortType type)
-        : m_identifier(identifier)
+        : m_function(function)
+        , m_identifier(identifier)
         , m_displayname(displayname)
         , m_type(type)
     {
     }
 
+    CModelImplicitPort::CModelImplicitPort(CModelImplicitNode * parent,
+                                           CModelFunction * function,
+                                           CModelImplicitPort const & other)
+        : m_parent(parent)
+        , m_function(function)
+        , m_identifier(other.m_identifier)
+        , m_displayname(other.m_displayname)
+        , m_type(other.m_type)
+        , m_reference(other.getReference())
+    {
+    }
+
     ImplicitIdentifier const & CModelImplicitPort::getIdentifier() const
     {
         return m_identifier;
@@ -65,6 +79,7 @@ namespace NMR
     void CModelImplicitPort::setIdentifier(std::string const & identifier)
     {
         m_identifier = identifier;
+        onChanged();
     }
 
     void CModelImplicitPort::setDisplayName(std::string const & displayname)
@@ -80,6 +95,7 @@ namespace NMR
     void CModelImplicitPort::setType(Lib3MF::eImplicitPortType type)
     {
         m_type = type;
+        onChanged();
     }
 
     ImplicitIdentifier CModelImplicitPort::getReference() const
@@ -108,6 +124,7 @@ namespace NMR
         m_referencedPort.reset();
         m_reference = reference;
         updateReference();
+        onChanged();
     }
 
     CModelImplicitNode * CModelImplicitPort::getParent() const
@@ -141,6 +158,7 @@ namespace NMR
       std::shared_ptr<CModelImplicitPort> const & referencedPort)
     {
         m_referencedPort = referencedPort;
+        onChanged();
     }
 
     void CModelImplicitPort::updateReference() const
@@ -158,4 +176,17 @@ namespace NMR
 
         m_referencedPort = function->findPort(m_reference);
     }
+
+    void CModelImplicitPort::onChanged() const
+    {
+        CModelFunction * function = m_function;
+        if (m_parent)
+        {
+            function = m_parent->getParent();
+        }
+        if (function)
+        {
+            function->onGraphChanged();
+        }
+    }
 } //namespace NMR
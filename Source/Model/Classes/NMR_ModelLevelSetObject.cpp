@@ -36,6 +36,8 @@ levelset object.
 
 #include "Common/Math/NMR_PairMatchingTree.h"
 #include "Common/Mesh/NMR_Mesh.h"
+#include "Common/Math/NMR_Matrix.h"
+#include "Model/Classes/NMR_LevelSetMesher.h"
 #include "Model/Classes/NMR_ModelMeshObject.h"
 #include "Model/Classes/NMR_ModelObject.h"
 #include "Model/Classes/NMR_ModelVolumeData.h"
@@ -54,7 +56,9 @@ namespace NMR
     void CModelLevelSetObject::mergeToMesh(CMesh* pMesh,
                                                 const NMATRIX3 mMatrix)
     {
-		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+		__NMRASSERT(pMesh);
+		implicit::LevelSetMesher mesher(*this);
+		mesher.mesh(pMesh, mMatrix);
     }
 
     PModelMeshObject CModelLevelSetObject::getMesh()
@@ -95,7 +99,33 @@ namespace NMR
     void CModelLevelSetObject::extendOutbox(
         NOUTBOX3& vOutBox, const NMATRIX3 mAccumulatedMatrix)
     {
-		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+		// The surface lies within the bounding mesh, or within its bounding box
+		if (!m_pMesh)
+			return;
+
+		if (!m_meshBBoxOnly) {
+			m_pMesh->extendOutbox(vOutBox, mAccumulatedMatrix);
+			return;
+		}
+
+		NOUTBOX3 localBox;
+		fnOutboxInitialize(localBox);
+		m_pMesh->extendOutbox(localBox, fnMATRIX3_identity());
+		if (localBox.m_min.m_fields[0] > localBox.m_max.m_fields[0])
+			return;
+
+		for (nfUint32 nCorner = 0; nCorner < 8; nCorner++) {
+			NVEC3 vCorner;
+			for (nfUint32 nAxis = 0; nAxis < 3; nAxis++)
+				vCorner.m_fields[nAxis] = ((nCorner >> nAxis) & 1) ? localBox.m_max.m_fields[nAxis] : localBox.m_min.m_fields[nAxis];
+			fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, vCorner));
+		}
+    }
+
+    void CModelLevelSetObject::prepareOutbox()
+    {
+		if (m_pMesh)
+			m_pMesh->prepareOutbox();
     }
 
     PModelFunction CModelLevelSetObject::getFunction()
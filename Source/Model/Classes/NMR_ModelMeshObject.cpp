@@ -34,7 +34,7 @@ mesh object.
 
 #include "Model/Classes/NMR_ModelObject.h" 
 #include "Model/Classes/NMR_ModelMeshObject.h" 
-#include "Common/Math/NMR_PairMatchingTree.h" 
+#include "Common/Mesh/NMR_MeshEdgeTopology.h"
 
 #define TRIANGLESET_MAXCOUNT (1024 * 1024 * 1024)
 
@@ -45,6 +45,7 @@ namespace NMR {
 	{
 		m_pMesh = std::make_shared<CMesh>();
 		m_pBeamLatticeAttributes = std::make_shared<CModelMeshBeamLatticeAttributes>();
+		resetTopologyCache();
 	}
 
 	CModelMeshObject::CModelMeshObject(_In_ const ModelResourceID sID, _In_ CModel * pModel, _In_ PMesh pMesh)
@@ -54,6 +55,7 @@ namespace NMR {
 		if (m_pMesh.get() == nullptr)
 			m_pMesh = std::make_shared<CMesh>();
 		m_pBeamLatticeAttributes = std::make_shared<CModelMeshBeamLatticeAttributes>();
+		resetTopologyCache();
 	}
 
 	CModelMeshObject::~CModelMeshObject()
@@ -61,8 +63,44 @@ namespace NMR {
 		m_pMesh = NULL;
 	}
 
+	void CModelMeshObject::ensureMeshLoaded()
+	{
+		if (m_pMeshLoader.get() != nullptr) {
+			// release the loader first, the loader itself accesses the mesh
+			PModelMeshLoader pMeshLoader = m_pMeshLoader;
+			m_pMeshLoader = nullptr;
+			try {
+				pMeshLoader->loadMesh(this);
+			}
+			catch (...) {
+				// discard partial content, so that the next access fails the same way
+				m_pMesh = std::make_shared<CMesh>();
+				m_pBeamLatticeAttributes = std::make_shared<CModelMeshBeamLatticeAttributes>();
+				resetTopologyCache();
+				m_pVolumeData = nullptr;
+				m_TriangleSets.clear();
+				m_TriangleSetMap.clear();
+				m_pMeshLoader = pMeshLoader;
+				throw;
+			}
+		}
+	}
+
+	void CModelMeshObject::resetTopologyCache()
+	{
+		m_pTopologyMesh = nullptr;
+		m_nTopologyGeneration = 0;
+		m_bManifoldAndOriented = false;
+	}
+
+	void CModelMeshObject::setMeshLoader(_In_ PModelMeshLoader pMeshLoader)
+	{
+		m_pMeshLoader = pMeshLoader;
+	}
+
 	_Ret_notnull_ CMesh * CModelMeshObject::getMesh()
 	{
+		ensureMeshLoaded();
 		return m_pMesh.get();
 	}
 
@@ -71,18 +109,22 @@ namespace NMR {
 		if (!pMesh)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		m_pMeshLoader = nullptr;
 		m_pMesh = pMesh;
+		resetTopologyCache();
 	}
 
 	void CModelMeshObject::mergeToMesh(_In_ CMesh * pMesh, _In_ const NMATRIX3 mMatrix)
 	{
 		__NMRASSERT(pMesh);
+		ensureMeshLoaded();
 		pMesh->mergeMesh(m_pMesh.get(), mMatrix);
 	}
 
 	void CModelMeshObject::setObjectType(_In_ eModelObjectType ObjectType)
 	{
 		if ((ObjectType != MODELOBJECTTYPE_MODEL) && (ObjectType != MODELOBJECTTYPE_SOLIDSUPPORT)) {
+			ensureMeshLoaded();
 			if (m_pMesh->getBeamCount() > 0)
 				throw CNMRException(NMR_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
 		}
@@ -125,98 +167,35 @@ namespace NMR {
 
 	nfBool CModelMeshObject::isManifoldAndOriented()
 	{
-		if (!m_pMesh->checkSanity())
-			return false;
-
-		nfUint32 nNodeCount = m_pMesh->getNodeCount();
-		nfUint32 nFaceCount = m_pMesh->getFaceCount();
-
-		if (nNodeCount < 3)
-			return false;
-		if (nFaceCount < 3)
-			return false;
+		ensureMeshLoaded();
 
-		CPairMatchingTree PairMatchingTree;
-		nfUint32 nFaceIndex;
-		nfInt32 nEdgeIndex;
-		nfInt32 nEdgeCounter = 0;
-		nfUint32 j;
+		// Shared objects are checked once per modification of their mesh
+		if ((m_pTopologyMesh == m_pMesh.get()) && (m_nTopologyGeneration == m_pMesh->getGeneration()))
+			return m_bManifoldAndOriented;
 
-		// Build Edge Tree
-		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
-			MESHFACE * pFace = m_pMesh->getFace(nFaceIndex);
-
-			for (j = 0; j < 3; j++) {
-				nfInt32 nNodeIndex1 = pFace->m_nodeindices[j];
-				nfInt32 nNodeIndex2 = pFace->m_nodeindices[(j + 1) % 3];
-
-				if (!PairMatchingTree.checkMatch(nNodeIndex1, nNodeIndex2, nEdgeIndex)) {
-					PairMatchingTree.addMatch(nNodeIndex1, nNodeIndex2, nEdgeCounter);
-					nEdgeCounter++;
-
-					if (nEdgeCounter > NMR_MESH_MAXEDGECOUNT)
-						throw CNMRException(NMR_ERROR_INVALIDEDGEINDEX);
-				}
-			}
-
-		}
-
-		// Count positively and negatively oriented edges...
-		std::vector<nfInt32> PositiveOrientations;
-		std::vector<nfInt32> NegativeOrientations;
-
-		// Create Edge arrays
-		PositiveOrientations.resize(nEdgeCounter);
-		NegativeOrientations.resize(nEdgeCounter);
-		for (nEdgeIndex = 0; nEdgeIndex < nEdgeCounter; nEdgeIndex++) {
-			PositiveOrientations[nEdgeIndex] = 0;
-			NegativeOrientations[nEdgeIndex] = 0;
+		nfBool bManifoldAndOriented = false;
+		if (m_pMesh->checkSanity()) {
+			// The edge count of large meshes makes this the most expensive check of an object, so it runs multithreaded
+			CMeshEdgeTopology EdgeTopology(m_pMesh.get(), 0);
+			bManifoldAndOriented = EdgeTopology.isManifoldAndOriented();
 		}
 
-		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
-			MESHFACE * pFace = m_pMesh->getFace(nFaceIndex);
-
-			for (j = 0; j < 3; j++) {
-				nfInt32 nNodeIndex1 = pFace->m_nodeindices[j];
-				nfInt32 nNodeIndex2 = pFace->m_nodeindices[(j + 1) % 3];
-
-				if (PairMatchingTree.checkMatch(nNodeIndex1, nNodeIndex2, nEdgeIndex)) {
-					if ((nEdgeIndex < 0) || (nEdgeIndex >= nEdgeCounter))
-						throw CNMRException(NMR_ERROR_INVALIDEDGEINDEX);
-
-					if (nNodeIndex1 <= nNodeIndex2) {
-						PositiveOrientations[nEdgeIndex]++;
-					}
-					else {
-						NegativeOrientations[nEdgeIndex]++;
-					}
-				}
-				else {
-					throw CNMRException(NMR_ERROR_INVALIDMESHTOPOLOGY);
-				}
-			}
-		}
-
-		// Check Edge Orientations and determine manifoldness
-		for (nEdgeIndex = 0; nEdgeIndex < nEdgeCounter; nEdgeIndex++) {
-			if (PositiveOrientations[nEdgeIndex] != 1)
-				return false;
-			if (NegativeOrientations[nEdgeIndex] != 1)
-				return false;
-		}
-
-		// Mesh is non-empty, oriented and manifold
-		return true;
+		m_pTopologyMesh = m_pMesh.get();
+		m_nTopologyGeneration = m_pMesh->getGeneration();
+		m_bManifoldAndOriented = bManifoldAndOriented;
+		return bManifoldAndOriented;
 	}
 
 
 	_Ret_notnull_ PModelMeshBeamLatticeAttributes CModelMeshObject::getBeamLatticeAttributes()
 	{
+		ensureMeshLoaded();
 		return m_pBeamLatticeAttributes;
 	}
 
 	void CModelMeshObject::setBeamLatticeAttributes(_In_ PModelMeshBeamLatticeAttributes pBeamLatticeAttributes)
 	{
+		ensureMeshLoaded();
 		if (!pBeamLatticeAttributes)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -225,11 +204,13 @@ namespace NMR {
 
 	PModelVolumeData CModelMeshObject::getVolumeData()
 	{
+		ensureMeshLoaded();
 		return m_pVolumeData;
 	}
 
 	void CModelMeshObject::setVolumeData(_In_ PModelVolumeData pVolumeData)
 	{
+		ensureMeshLoaded();
 		if (!pVolumeData)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -238,11 +219,19 @@ namespace NMR {
 
 	void CModelMeshObject::extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix)
 	{
+		ensureMeshLoaded();
 		m_pMesh->extendOutbox(vOutBox, mAccumulatedMatrix);
 	}
 
+	void CModelMeshObject::prepareOutbox()
+	{
+		ensureMeshLoaded();
+		m_pMesh->updateOutboxCache();
+	}
+
 	ResourceDependencies CModelMeshObject::getDependencies()
 	{
+		ensureMeshLoaded();
 		ResourceDependencies dependencies;
 		if(m_pVolumeData)
 		{
@@ -255,6 +244,7 @@ namespace NMR {
 
 	void CModelMeshObject::deleteTriangleSet(_In_ CModelTriangleSet* pTriangleSet)
 	{
+		ensureMeshLoaded();
 		if (pTriangleSet != nullptr) {
 			auto sIdentifier = pTriangleSet->getIdentifier();
 			m_TriangleSets.erase(std::remove_if(
@@ -270,6 +260,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::findTriangleSet(const std::string& sIdentifier)
 	{
+		ensureMeshLoaded();
 		auto iIterator = m_TriangleSetMap.find(sIdentifier);
 		if (iIterator == m_TriangleSetMap.end())
 			return nullptr;
@@ -280,6 +271,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::addTriangleSet(const std::string& sIdentifier, const std::string& sName)
 	{
+		ensureMeshLoaded();
 		auto iIterator = m_TriangleSetMap.find(sIdentifier);
 		if (iIterator != m_TriangleSetMap.end())
 			throw CNMRException(NMR_ERROR_DUPLICATETRIANGLESET);
@@ -297,6 +289,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::addTriangleSet(PModelTriangleSet pModelTriangleSet)
 	{
+		ensureMeshLoaded();
 		if (pModelTriangleSet.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -315,11 +308,13 @@ namespace NMR {
 
 	uint32_t CModelMeshObject::getTriangleSetCount()
 	{
+		ensureMeshLoaded();
 		return (uint32_t)m_TriangleSets.size();
 	}
 
 	PModelTriangleSet CModelMeshObject::getTriangleSet(const uint32_t nIndex)
 	{
+		ensureMeshLoaded();
 		if (nIndex >= m_TriangleSets.size())
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
 
@@ -203,6 +203,11 @@ namespace NMR {
 		m_nComponentDepthLevel = 0;
 	}
 
+	void CModelObject::prepareOutbox()
+	{
+		// empty on purpose, to be implemented by child classes
+	}
+
 	void CModelObject::calculateComponentDepthLevel(nfUint32 nLevel)
 	{
 		if (nLevel >= m_nComponentDepthLevel)
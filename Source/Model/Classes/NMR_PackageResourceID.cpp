@@ -146,15 +146,7 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_DUPLICATERESOURCEID);
 
 		PPackageResourceID pPackageResourceID = std::make_shared<CPackageResourceID>(this, pModelPath, id);
-		UniqueIDPackageIdMap::const_iterator biggestId = std::max_element(m_resourceIDs.begin(), m_resourceIDs.end(), [](const UniqueIdPackageIdPair & v1, const UniqueIdPackageIdPair v2) {
-			return v1.first < v2.first;
-		});
-		if (biggestId != m_resourceIDs.end()) {
-			pPackageResourceID->setUniqueID(int(biggestId->first) + 1);
-		} else {
-			pPackageResourceID->setUniqueID(1);
-		}
-
+		pPackageResourceID->setUniqueID(getMaxUniqueID() + 1);
 
 		m_resourceIDs.insert(std::make_pair(pPackageResourceID->getUniqueID(), pPackageResourceID));
 		m_IdAndPathToPackageResourceIDs.insert(std::make_pair(std::make_pair(id, pModelPath), pPackageResourceID));
@@ -232,6 +224,50 @@ namespace NMR {
 		m_resourceIDs.erase(itID);
 	}
 
+	UniqueResourceID CResourceHandler::getMaxUniqueID()
+	{
+		UniqueIDPackageIdMap::const_iterator biggestId = std::max_element(m_resourceIDs.begin(), m_resourceIDs.end(), [](const UniqueIdPackageIdPair & v1, const UniqueIdPackageIdPair v2) {
+			return v1.first < v2.first;
+		});
+		if (biggestId != m_resourceIDs.end())
+			return biggestId->first;
+		return 0;
+	}
+
+	nfUint32 CResourceHandler::getResourceIDCount()
+	{
+		return (nfUint32)m_resourceIDs.size();
+	}
+
+	void CResourceHandler::adoptPackageResourceIDs(CResourceHandler* pSourceHandler, UniqueResourceID nUniqueIDOffset)
+	{
+		if (pSourceHandler == nullptr || pSourceHandler == this)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		for (auto iIterator : pSourceHandler->m_resourceIDs) {
+			PPackageResourceID pPackageResourceID = iIterator.second;
+			UniqueResourceID nNewUniqueID = iIterator.first + nUniqueIDOffset;
+
+			PPackageModelPath pModelPath = findPackageModelPath(pPackageResourceID->getPath());
+			if (!pModelPath) {
+				pModelPath = makePackageModelPath(pPackageResourceID->getPath());
+			}
+
+			if ((m_resourceIDs.find(nNewUniqueID) != m_resourceIDs.end()) ||
+				(m_IdAndPathToPackageResourceIDs.find(std::make_pair(pPackageResourceID->m_id, pModelPath)) != m_IdAndPathToPackageResourceIDs.end()))
+				throw CNMRException(NMR_ERROR_DUPLICATERESOURCEID);
+
+			pPackageResourceID->m_pResourceHandler = this;
+			pPackageResourceID->m_pModelPath = pModelPath;
+			pPackageResourceID->setUniqueID(nNewUniqueID);
+
+			m_resourceIDs.insert(std::make_pair(nNewUniqueID, pPackageResourceID));
+			m_IdAndPathToPackageResourceIDs.insert(std::make_pair(std::make_pair(pPackageResourceID->m_id, pModelPath), pPackageResourceID));
+		}
+
+		pSourceHandler->clear();
+	}
+
 	void CResourceHandler::clear() {
 		m_resourceIDs.clear();
 		m_IdAndPathToPackageResourceIDs.clear();
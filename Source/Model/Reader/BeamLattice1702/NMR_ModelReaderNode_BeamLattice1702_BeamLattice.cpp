@@ -48,7 +48,7 @@ NMR_ModelReaderNode_BeamLattice1702_BeamLattice.cpp covers the official 3MF beam
 
 namespace NMR {
 
-	CModelReaderNode_BeamLattice1702_BeamLattice::CModelReaderNode_BeamLattice1702_BeamLattice(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ PModelWarnings pWarnings)
+	CModelReaderNode_BeamLattice1702_BeamLattice::CModelReaderNode_BeamLattice1702_BeamLattice(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ PModelWarnings pWarnings, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh)
 		: CModelReaderNode(pWarnings)
 	{
 		m_pModel = pModel;
@@ -62,6 +62,7 @@ namespace NMR {
 		m_dDefaultRadius = 0.0001;
 		m_eDefaultCapMode = eModelBeamLatticeCapMode::MODELBEAMLATTICECAPMODE_SPHERE;
 		m_dDefaultBallRadius = 0.0;
+		m_pStreamingMesh = pStreamingMesh;
 	}
 
 	void CModelReaderNode_BeamLattice1702_BeamLattice::parseXML(_In_ CXmlReader * pXMLReader)
@@ -174,9 +175,14 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_BEAMLATTICESPEC) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_BEAMS) == 0)
 			{
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_Beams>(m_pModel, m_pMesh, m_dDefaultRadius, m_eDefaultCapMode, m_pWarnings);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_Beams>(m_pModel, m_pMesh, m_dDefaultRadius, m_eDefaultCapMode, m_pWarnings, m_pStreamingMesh);
 				pXMLNode->parseXML(pXMLReader);
 			}
+			else if (m_pStreamingMesh && ((strcmp(pChildName, XML_3MF_ELEMENT_BEAMSETS) == 0) || (strcmp(pChildName, XML_3MF_ELEMENT_BALLS) == 0)))
+			{
+				// beam sets and balls reference stored beams and vertices, which a streamed mesh does not have
+				skipContent(pXMLReader, pChildName);
+			}
 			else if (strcmp(pChildName, XML_3MF_ELEMENT_BEAMSETS) == 0)
 			{
 				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_BeamSets>(m_pMesh, m_pWarnings);
@@ -43,7 +43,7 @@ namespace NMR {
 
 	CModelReaderNode_BeamLattice1702_Beams::CModelReaderNode_BeamLattice1702_Beams(_In_ CModel * pModel, _In_ CMesh * pMesh,
 		_In_ nfDouble defaultRadius, _In_ eModelBeamLatticeCapMode defaultCapMode,
-		_In_ PModelWarnings pWarnings)
+		_In_ PModelWarnings pWarnings, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh)
 		: CModelReaderNode(pWarnings)
 	{
 		__NMRASSERT(pMesh);
@@ -53,6 +53,7 @@ namespace NMR {
 		m_pMesh = pMesh;
 		m_dDefaultRadius = defaultRadius;
 		m_eDefaultCapMode = defaultCapMode;
+		m_pStreamingMesh = pStreamingMesh;
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beams::parseXML(_In_ CXmlReader * pXMLReader)
@@ -65,6 +66,9 @@ namespace NMR {
 
 		// Parse Content
 		parseContent(pXMLReader);
+
+		if (m_pStreamingMesh)
+			m_pStreamingMesh->flush();
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beams::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
@@ -87,13 +91,17 @@ namespace NMR {
 
 				// Retrieve node indices
 				nfInt32 nIndex1, nIndex2;
-				pXMLNode->retrieveIndices(nIndex1, nIndex2, m_pMesh->getNodeCount());
+				nfInt32 nNodeCount = m_pStreamingMesh ? (nfInt32)m_pStreamingMesh->getVertexCount() : (nfInt32)m_pMesh->getNodeCount();
+				pXMLNode->retrieveIndices(nIndex1, nIndex2, nNodeCount);
+
+				// the minimum length can only be checked against stored vertices
+				if (!m_pStreamingMesh) {
+					MESHNODE* pNode1 = m_pMesh->getNode(nIndex1);
+					MESHNODE* pNode2 = m_pMesh->getNode(nIndex2);
 
-				MESHNODE* pNode1 = m_pMesh->getNode(nIndex1);
-				MESHNODE* pNode2 = m_pMesh->getNode(nIndex2);
-				
-				if (fnVEC3_length(fnVEC3_sub(pNode1->m_position, pNode2->m_position)) < m_pMesh->getBeamLatticeMinLength())
-					m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICENODESTOOCLOSE), mrwInvalidMandatoryValue);
+					if (fnVEC3_length(fnVEC3_sub(pNode1->m_position, pNode2->m_position)) < m_pMesh->getBeamLatticeMinLength())
+						m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICENODESTOOCLOSE), mrwInvalidMandatoryValue);
+				}
 
 				nfInt32 nTag;
 				nfBool bHasTag, bHasRadius1, bHasRadius2;
@@ -121,9 +129,14 @@ namespace NMR {
 
 				// Create beam if valid
 				if (nIndex1 != nIndex2) {
-					MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
-					MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
-					m_pMesh->addBeam(pNode1, pNode2, dRadius1, dRadius2, nCap1, nCap2);
+					if (m_pStreamingMesh) {
+						m_pStreamingMesh->addBeam(nIndex1, nIndex2, dRadius1, dRadius2, nCap1, nCap2);
+					}
+					else {
+						MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
+						MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
+						m_pMesh->addBeam(pNode1, pNode2, dRadius1, dRadius2, nCap1, nCap2);
+					}
 				}
 			}
 			else
@@ -108,6 +108,20 @@ namespace NMR {
 		return pPart;
 	}
 
+	PImportStream CKeyStoreOpcPackageReader::openPartStream(std::string sPath) {
+		// encrypted parts can only be read once
+		if (m_pContext.secureContext()->hasDekCtx() && (m_pContext.keyStore()->findResourceDataGroupByResourceDataPath(sPath) != nullptr))
+			return nullptr;
+		return m_pPackageReader->openPartStream(sPath);
+	}
+
+	PImportStream CKeyStoreOpcPackageReader::openRawPartStream(std::string sPath, ZIPRAWENTRYINFO & Info) {
+		// the stored bytes of encrypted parts are bound to the key store of this package
+		if (m_pContext.keyStore()->findResourceDataGroupByResourceDataPath(sPath) != nullptr)
+			return nullptr;
+		return m_pPackageReader->openRawPartStream(sPath, Info);
+	}
+
 	nfUint64 CKeyStoreOpcPackageReader::getPartSize(std::string sPath) {
 		return m_pPackageReader->getPartSize(sPath);
 	}
@@ -43,7 +43,7 @@ A model reader reads in a model file and generates an in-memory representation o
 namespace NMR {
 
 	CModelReader::CModelReader(_In_ PModel pModel)
-		:CModelContext(pModel)
+		:CModelContext(pModel), m_nSubModelThreadCount(1), m_bLazyMeshLoading(false), m_bBackgroundDecompression(false), m_bLazyAttachmentLoading(false)
 	{
 	}
 
@@ -82,4 +82,60 @@ namespace NMR {
 		m_RelationsToRead.erase(sRelationShipType);
 	}
 
+	void CModelReader::setSubModelThreadCount(_In_ nfUint32 nThreadCount)
+	{
+		m_nSubModelThreadCount = nThreadCount;
+	}
+
+	nfUint32 CModelReader::getSubModelThreadCount()
+	{
+		return m_nSubModelThreadCount;
+	}
+
+	CModelReader_Streaming * CModelReader::streaming()
+	{
+		if (!m_pStreaming)
+			m_pStreaming = std::make_shared<CModelReader_Streaming>();
+
+		return m_pStreaming.get();
+	}
+
+	PModelReader_Streaming CModelReader::getActiveStreaming()
+	{
+		if (m_pStreaming && m_pStreaming->isActive())
+			return m_pStreaming;
+
+		return nullptr;
+	}
+
+	void CModelReader::setLazyMeshLoading(_In_ nfBool bLazyMeshLoading)
+	{
+		m_bLazyMeshLoading = bLazyMeshLoading;
+	}
+
+	nfBool CModelReader::getLazyMeshLoading()
+	{
+		return m_bLazyMeshLoading;
+	}
+
+	void CModelReader::setBackgroundDecompression(_In_ nfBool bBackgroundDecompression)
+	{
+		m_bBackgroundDecompression = bBackgroundDecompression;
+	}
+
+	nfBool CModelReader::getBackgroundDecompression()
+	{
+		return m_bBackgroundDecompression;
+	}
+
+	void CModelReader::setLazyAttachmentLoading(_In_ nfBool bLazyAttachmentLoading)
+	{
+		m_bLazyAttachmentLoading = bLazyAttachmentLoading;
+	}
+
+	nfBool CModelReader::getLazyAttachmentLoading()
+	{
+		return m_bLazyAttachmentLoading;
+	}
+
 }
@@ -213,6 +213,62 @@ namespace NMR {
 		}
 	}
 
+	nfBool CModelReaderNode::readAttribute(_In_ CXmlReader * pXMLReader, _Out_ const nfChar * & pszAttributeName, _Out_ const nfChar * & pszAttributeValue)
+	{
+		__NMRASSERT(pXMLReader);
+
+		pszAttributeName = nullptr;
+		pszAttributeValue = nullptr;
+
+		if (pXMLReader->IsDefault())
+			return false;
+
+		LPCSTR pszNameSpaceURI = nullptr;
+		UINT nNameSpaceCount = 0;
+		pXMLReader->GetNamespaceURI(&pszNameSpaceURI, &nNameSpaceCount);
+		if (!pszNameSpaceURI)
+			throw CNMRException(NMR_ERROR_COULDNOTGETNAMESPACE);
+
+		pXMLReader->GetLocalName(&pszAttributeName, nullptr);
+		if (!pszAttributeName)
+			throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+		pXMLReader->GetValue(&pszAttributeValue, nullptr);
+		if (!pszAttributeValue)
+			throw CNMRException(NMR_ERROR_COULDNOTGETXMLVALUE);
+
+		// Only non-namespaced attributes are of interest for leaf elements
+		return (*pszAttributeName != 0) && (nNameSpaceCount == 0);
+	}
+
+	void CModelReaderNode::skipContent(_In_ CXmlReader * pXMLReader, _In_z_ const nfChar * pszElementName)
+	{
+		__NMRASSERT(pXMLReader);
+		__NMRASSERT(pszElementName);
+
+		if (pXMLReader->IsEmptyElement()) {
+			pXMLReader->CloseElement();
+			return;
+		}
+
+		while (!pXMLReader->IsEOF()) {
+			eXmlReaderNodeType NodeType;
+			pXMLReader->Read(NodeType);
+
+			if (NodeType == XMLREADERNODETYPE_ENDELEMENT) {
+				LPCSTR pszLocalName = nullptr;
+				pXMLReader->GetLocalName(&pszLocalName, nullptr);
+				if (!pszLocalName)
+					throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+				if (strcmp(pszLocalName, pszElementName) == 0) {
+					pXMLReader->CloseElement();
+					return;
+				}
+			}
+		}
+	}
+
 	void CModelReaderNode::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
 	{
 		// empty on purpose, to be implemented by child classes
@@ -52,8 +52,8 @@ A model reader node is an abstract base class for all XML nodes of a 3MF Model S
 namespace NMR {
 
 	CModelReaderNode_ModelBase::CModelReaderNode_ModelBase(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, const std::string sPath,
-		_In_ PProgressMonitor pProgressMonitor)
-		: CModelReaderNode(pWarnings, pProgressMonitor), m_bIgnoreBuild(false), m_bIgnoreMetaData(false), m_bHaveWarnedAboutV093(false)
+		_In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming, _In_ PModelReader_LazyMeshSource pLazyMeshSource)
+		: CModelReaderNode(pWarnings, pProgressMonitor), m_bIgnoreBuild(false), m_bIgnoreMetaData(false), m_bHaveWarnedAboutV093(false), m_pStreaming(pStreaming), m_pLazyMeshSource(pLazyMeshSource)
 	{
 		__NMRASSERT(pModel);
 		m_pModel = pModel;
@@ -63,6 +63,7 @@ namespace NMR {
 
 		m_bHasResources = false;
 		m_bHasBuild = false;
+		m_bHasUnit = false;
 		m_bWithinIgnoredElement = false;
 
 		m_sPath = sPath;
@@ -121,6 +122,7 @@ namespace NMR {
 			// set unit string  and set validity
 			try {
 				m_pModel->setUnitString(pAttributeValue);
+				m_bHasUnit = true;
 			}
 			catch (CNMRException & e) {
 				m_pWarnings->addException(e, mrwInvalidMandatoryValue);
@@ -197,7 +199,7 @@ namespace NMR {
 				m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READRESOURCES);
 				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Resources>(m_pModel, m_pWarnings, m_sPath.c_str(), m_pProgressMonitor);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Resources>(m_pModel, m_pWarnings, m_sPath.c_str(), m_pProgressMonitor, m_pStreaming, m_pLazyMeshSource);
 				if (m_bHasResources)
 					throw CNMRException(NMR_ERROR_DUPLICATERESOURCES);
 				pXMLNode->parseXML(pXMLReader);
@@ -214,7 +216,7 @@ namespace NMR {
 					m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READBUILD);
 					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 
-					PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Build>(m_pModel, m_pWarnings);
+					PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Build>(m_pModel, m_pWarnings, m_pStreaming);
 					pXMLNode->parseXML(pXMLReader);
 				}
 				m_bHasBuild = true;
@@ -277,6 +279,16 @@ namespace NMR {
 		return m_bHasBuild;
 	}
 
+	nfBool CModelReaderNode_ModelBase::getHasUnit()
+	{
+		return m_bHasUnit;
+	}
+
+	nfBool CModelReaderNode_ModelBase::getHasV093Content()
+	{
+		return m_bHaveWarnedAboutV093;
+	}
+
 	nfBool CModelReaderNode_ModelBase::ignoreBuild()
 	{
 		return m_bIgnoreBuild;
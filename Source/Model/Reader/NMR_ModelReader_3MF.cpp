@@ -42,6 +42,8 @@ NMR_ModelReader_3MF.cpp implements the Model Reader Class for
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/MeshImport/NMR_MeshImporter_STL.h"
 #include "Common/Platform/NMR_Platform.h"
+#include "Common/Platform/NMR_ImportStream_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Pipelined.h"
 #include "Model/Classes/NMR_ModelAttachment.h" 
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_SliceRefModel.h"
@@ -49,6 +51,10 @@ NMR_ModelReader_3MF.cpp implements the Model Reader Class for
 
 #include "Common/3MF_ProgressMonitor.h"
 
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
 namespace NMR {
 
 	CModelReader_3MF::CModelReader_3MF(_In_ PModel pModel)
@@ -57,9 +63,176 @@ namespace NMR {
 		// empty on purpose
 	}
 
-	void readProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
+	// Parses a single non-root model part into pModel. Returns nullptr if the part contains no model element.
+	PModelReaderNode_ModelBase readProductionAttachmentModel(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ const std::string & sPath, _In_ PImportStream pSubModelStream, _In_ PModelReader_Streaming pStreaming, _In_ nfBool bLazyMeshLoading)
+	{
+		// attachment streams stay in memory, so the mesh content can be parsed from there later
+		PModelReader_LazyMeshSource pLazyMeshSource;
+		if (bLazyMeshLoading)
+			pLazyMeshSource = CModelReader_LazyMeshSource::makeFromStream(sPath, pWarnings, pSubModelStream);
+
+		// Create XML Reader
+		PXmlReader pXMLReader = fnCreateXMLReaderInstance(pSubModelStream, pProgressMonitor);
+
+		PModelReaderNode_ModelBase pModelNode;
+		eXmlReaderNodeType NodeType;
+		// Read all XML Root Nodes
+		while (!pXMLReader->IsEOF()) {
+			if (!pXMLReader->Read(NodeType))
+				break;
+
+			// Get Node Name
+			LPCSTR pszLocalName = nullptr;
+			pXMLReader->GetLocalName(&pszLocalName, nullptr);
+			if (!pszLocalName)
+				throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+			if (strcmp(pszLocalName, XML_3MF_ATTRIBUTE_PREFIX_XML) == 0) {
+				PModelReader_InstructionElement pXMLNode = std::make_shared<CModelReader_InstructionElement>(pWarnings);
+				pXMLNode->parseXML(pXMLReader.get());
+			}
+
+			// Compare with Model Node Name
+			if (strcmp(pszLocalName, XML_3MF_ELEMENT_MODEL) == 0) {
+				if (pModelNode)
+					throw CNMRException(NMR_ERROR_DUPLICATEMODELNODE);
+
+				pModel->setCurrentPath(sPath);
+
+				pModelNode = std::make_shared<CModelReaderNode_ModelBase>(pModel, pWarnings, sPath, pProgressMonitor, pStreaming, pLazyMeshSource);
+				pModelNode->setIgnoreBuild(true);
+				pModelNode->setIgnoreMetaData(true);
+				pModelNode->parseXML(pXMLReader.get());
+
+				if (!pModelNode->getHasResources())
+					throw CNMRException(NMR_ERROR_NORESOURCES);
+				if (!pModelNode->getHasBuild())
+					throw CNMRException(NMR_ERROR_BUILDITEMNOTFOUND);
+			}
+		}
+
+		return pModelNode;
+	}
+
+	// A non-root model part that has been parsed ahead of time into a staging model of its own
+	struct sStagedProductionModel {
+		PModel m_pModel;
+		PModelWarnings m_pWarnings;
+		PModelReaderNode_ModelBase m_pModelNode;
+		nfBool m_bSucceeded;
+	};
+	typedef std::shared_ptr<sStagedProductionModel> PStagedProductionModel;
+
+	void stageProductionAttachmentModel(_In_ CModel * pModel, _In_ eModelWarningLevel CriticalWarningLevel, _In_ const std::string & sPath, _In_ PImportStream pSubModelStream, _In_ sStagedProductionModel & StagedModel)
+	{
+		StagedModel.m_bSucceeded = false;
+		try {
+			StagedModel.m_pModel = std::make_shared<CModel>();
+			StagedModel.m_pModel->setRootPath(pModel->rootPath());
+			StagedModel.m_pModel->shareModelAttachments(pModel);
+
+			StagedModel.m_pWarnings = std::make_shared<CModelWarnings>();
+			StagedModel.m_pWarnings->setCriticalWarningLevel(CriticalWarningLevel);
+
+			StagedModel.m_pModelNode = readProductionAttachmentModel(StagedModel.m_pModel.get(), StagedModel.m_pWarnings, std::make_shared<CProgressMonitor>(), sPath, pSubModelStream, nullptr, false);
+
+			// v0.93 content resolves texture groups across all parts read so far
+			StagedModel.m_bSucceeded = StagedModel.m_pModelNode && !StagedModel.m_pModelNode->getHasV093Content();
+		}
+		catch (...) {
+			// the part is read again serially, which reports the error in the same order as without staging
+			StagedModel.m_bSucceeded = false;
+		}
+	}
+
+	// Parses all parts with a stream of their own on nThreadCount threads. Only the calling thread queries the progress monitor.
+	void stageProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nThreadCount, _Out_ std::vector<PStagedProductionModel> & StagedModels)
+	{
+		nfUint32 prodAttCount = pModel->getProductionAttachmentCount();
+		StagedModels.resize(prodAttCount);
+
+		// Parts that share a stream (i.e. are referenced more than once) depend on the stream position the previous read left behind
+		std::map<CImportStream *, nfUint32> StreamReferenceCount;
+		for (nfUint32 i = 0; i < prodAttCount; i++)
+			StreamReferenceCount[pModel->getProductionModelAttachment(i)->getStream().get()]++;
+
+		std::vector<nfUint32> PartIndices;
+		std::vector<PImportStream> PartStreams(prodAttCount);
+		for (nfInt32 i = prodAttCount - 1; i >= 0; i--) {
+			PImportStream pSubModelStream = pModel->getProductionModelAttachment(i)->getStream();
+			CImportStream_Memory * pMemoryStream = dynamic_cast<CImportStream_Memory *>(pSubModelStream.get());
+			if ((pMemoryStream == nullptr) || (StreamReferenceCount[pMemoryStream] != 1) ||
+				(pMemoryStream->getPosition() != 0) || (pMemoryStream->retrieveSize() == 0))
+				continue;
+
+			PartStreams[i] = pMemoryStream->createSharedView();
+			StagedModels[i] = std::make_shared<sStagedProductionModel>();
+			PartIndices.push_back(i);
+		}
+
+		if (PartIndices.size() < 2)
+			return;
+
+		eModelWarningLevel CriticalWarningLevel = pWarnings->getCriticalWarningLevel();
+		std::atomic<nfUint32> nNextPart(0);
+		std::atomic<nfBool> bAbort(false);
+		std::exception_ptr pAbortException;
+
+		auto fnStageParts = [&](nfBool bQueryMonitor) {
+			while (!bAbort) {
+				if (bQueryMonitor && pProgressMonitor) {
+					try {
+						pProgressMonitor->QueryCancelled(true);
+					}
+					catch (...) {
+						pAbortException = std::current_exception();
+						bAbort = true;
+						break;
+					}
+				}
+
+				nfUint32 nPart = nNextPart++;
+				if (nPart >= PartIndices.size())
+					break;
+
+				nfUint32 nIndex = PartIndices[nPart];
+				stageProductionAttachmentModel(pModel.get(), CriticalWarningLevel, pModel->getProductionModelAttachment(nIndex)->getPathURI(), PartStreams[nIndex], *StagedModels[nIndex]);
+			}
+		};
+
+		nfUint32 nWorkerCount = std::min(nThreadCount, (nfUint32)PartIndices.size()) - 1;
+		std::vector<std::thread> Workers;
+		for (nfUint32 nWorker = 0; nWorker < nWorkerCount; nWorker++) {
+			try {
+				Workers.push_back(std::thread(fnStageParts, false));
+			}
+			catch (std::system_error &) {
+				// continue with the threads we have
+				break;
+			}
+		}
+
+		fnStageParts(true);
+		for (auto & Worker : Workers)
+			Worker.join();
+
+		if (pAbortException)
+			std::rethrow_exception(pAbortException);
+	}
+
+	void readProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nThreadCount, _In_ PModelReader_Streaming pStreaming, _In_ nfBool bLazyMeshLoading)
 	{
 		nfUint32 prodAttCount = pModel->getProductionAttachmentCount();
+
+		if (nThreadCount == 0)
+			nThreadCount = std::thread::hardware_concurrency();
+
+		std::vector<PStagedProductionModel> StagedModels(prodAttCount);
+		// streaming callbacks are called in document order on the calling thread, deferred meshes refer to the part streams of the model
+		if ((nThreadCount > 1) && (prodAttCount > 1) && (!pStreaming) && (!bLazyMeshLoading))
+			stageProductionAttachmentModels(pModel, pWarnings, pProgressMonitor, nThreadCount, StagedModels);
+
+		// Merge in the same order as the serial read, so that unique resource IDs and warnings do not depend on the thread count
 		for (nfInt32 i = prodAttCount-1; i >=0; i--)
 		{
 			if (pProgressMonitor) {
@@ -71,47 +244,25 @@ namespace NMR {
 			std::string sPath = pProdAttachment->getPathURI();
 			PImportStream pSubModelStream = pProdAttachment->getStream();
 
-			// Create XML Reader
-			PXmlReader pXMLReader = fnCreateXMLReaderInstance(pSubModelStream, pProgressMonitor);
-
-			nfBool bHasModel = false;
-			eXmlReaderNodeType NodeType;
-			// Read all XML Root Nodes
-			while (!pXMLReader->IsEOF()) {
-				if (!pXMLReader->Read(NodeType))
-					break;
-
-				// Get Node Name
-				LPCSTR pszLocalName = nullptr;
-				pXMLReader->GetLocalName(&pszLocalName, nullptr);
-				if (!pszLocalName)
-					throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
-
-				if (strcmp(pszLocalName, XML_3MF_ATTRIBUTE_PREFIX_XML) == 0) {
-					PModelReader_InstructionElement pXMLNode = std::make_shared<CModelReader_InstructionElement>(pWarnings);
-					pXMLNode->parseXML(pXMLReader.get());
-				}
-
-				// Compare with Model Node Name
-				if (strcmp(pszLocalName, XML_3MF_ELEMENT_MODEL) == 0) {
-					if (bHasModel)
-						throw CNMRException(NMR_ERROR_DUPLICATEMODELNODE);
-					bHasModel = true;
-
-					PModelReaderNode_ModelBase pXMLNode;
-					pModel->setCurrentPath(sPath);
-
-					pXMLNode = std::make_shared<CModelReaderNode_ModelBase>(pModel.get(), pWarnings, sPath, pProgressMonitor);
-					pXMLNode->setIgnoreBuild(true);
-					pXMLNode->setIgnoreMetaData(true);
-					pXMLNode->parseXML(pXMLReader.get());
-
-					if (!pXMLNode->getHasResources())
-						throw CNMRException(NMR_ERROR_NORESOURCES);
-					if (!pXMLNode->getHasBuild())
-						throw CNMRException(NMR_ERROR_BUILDITEMNOTFOUND);
-				}
+			PStagedProductionModel pStagedModel = StagedModels[i];
+			StagedModels[i] = nullptr;
+			if (pStagedModel && pStagedModel->m_bSucceeded && pModel->canAdoptStagedResources(pStagedModel->m_pModel.get())) {
+				pModel->setCurrentPath(sPath);
+				pModel->setLanguage(pStagedModel->m_pModel->getLanguage());
+				if (pStagedModel->m_pModelNode->getHasUnit())
+					pModel->setUnit(pStagedModel->m_pModel->getUnit());
+
+				pModel->adoptStagedResources(pStagedModel->m_pModel.get());
+				pWarnings->appendWarnings(*pStagedModel->m_pWarnings);
+
+				// leave the part stream consumed, as the serial read does
+				pSubModelStream->seekPosition(pSubModelStream->retrieveSize(), true);
+				if (pProgressMonitor)
+					pProgressMonitor->IncrementProgress((double)pSubModelStream->retrieveSize());
+				continue;
 			}
+
+			readProductionAttachmentModel(pModel.get(), pWarnings, pProgressMonitor, sPath, pSubModelStream, pStreaming, bLazyMeshLoading);
 		}
 	}
 
@@ -129,12 +280,27 @@ namespace NMR {
 		// Extract Stream from Package
 		PImportStream pModelStream = extract3MFOPCPackage(pStream);
 		
+		// streamed meshes are never stored, so there is nothing to defer
+		PModelReader_Streaming pStreaming = getActiveStreaming();
+		nfBool bLazyMeshLoading = getLazyMeshLoading() && !pStreaming;
+
 		// before reading the root model, read the other models in the file
-		readProductionAttachmentModels(model(), warnings(), monitor());
+		readProductionAttachmentModels(model(), warnings(), monitor(), getSubModelThreadCount(), pStreaming, bLazyMeshLoading);
+
+		PModelReader_LazyMeshSource pLazyMeshSource;
+		if (bLazyMeshLoading) {
+			ModelReader_PartStreamOpener fnOpener = getPartStreamOpener(model()->rootPath());
+			if (fnOpener)
+				pLazyMeshSource = std::make_shared<CModelReader_LazyMeshSource>(model()->rootPath(), warnings(), fnOpener);
+		}
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READROOTMODEL);
 		monitor()->ReportProgressAndQueryCancelled(true);
 
+		// Deferred meshes may read the package while the root model is parsed, libzip does not allow this from two threads
+		if (getBackgroundDecompression() && !pLazyMeshSource && (pModelStream->retrieveSize() > IMPORTSTREAM_PIPELINED_BUFFERSIZE))
+			pModelStream = std::make_shared<CImportStream_Pipelined>(pModelStream, monitor());
+
 		// Create XML Reader
 		PXmlReader pXMLReader = fnCreateXMLReaderInstance(pModelStream, monitor());
 
@@ -162,7 +328,7 @@ namespace NMR {
 				bHasModel = true;
 
 				model()->setCurrentPath(model()->rootPath());
-				PModelReaderNode_ModelBase pXMLNode = std::make_shared<CModelReaderNode_ModelBase>(model().get(), warnings(), model()->rootPath(), monitor());
+				PModelReaderNode_ModelBase pXMLNode = std::make_shared<CModelReaderNode_ModelBase>(model().get(), warnings(), model()->rootPath(), monitor(), pStreaming, pLazyMeshSource);
 				pXMLNode->parseXML(pXMLReader.get());
 
 				if (!pXMLNode->getHasResources())
@@ -176,6 +342,10 @@ namespace NMR {
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_CLEANUP);
 		monitor()->ReportProgressAndQueryCancelled(false);
 
+		// A background decompression thread has to stop before the package is closed
+		pXMLReader = nullptr;
+		pModelStream = nullptr;
+
 		// Release Memory of 3MF Package
 		release3MFOPCPackage();
 
@@ -42,6 +42,7 @@ It uses libzip and irrxml to parse the OPC package.
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/NMR_StringUtils.h"
 #include "Common/Platform/NMR_Platform.h"
+#include "Common/Platform/NMR_ImportStream_Deferred.h"
 #include "Model/Reader/NMR_ModelReader_InstructionElement.h"
 
 namespace NMR {
@@ -89,10 +90,9 @@ namespace NMR {
 		COpcPackageRelationship * pThumbnailRelation = m_pPackageReader->findRootRelation(PACKAGE_THUMBNAIL_RELATIONSHIP_TYPE, true);
 		if (pThumbnailRelation != nullptr) {
 			std::string sTargetPartURI = pThumbnailRelation->getTargetPartURI();
-			POpcPackagePart pThumbnailPart = m_pPackageReader->createPart(sTargetPartURI);
-			if (pThumbnailPart == nullptr)
+			PImportStream pThumbnailStream = readAttachmentStream(sTargetPartURI);
+			if (pThumbnailStream == nullptr)
 				throw CNMRException(NMR_ERROR_OPCCOULDNOTGETTHUMBNAILSTREAM);
-			PImportStream pThumbnailStream = pThumbnailPart->getImportStream()->copyToMemory();
 			model()->addPackageThumbnail()->setStream(pThumbnailStream);
 			monitor()->IncrementProgress((double)pThumbnailStream->retrieveSize());
 			monitor()->ReportProgressAndQueryCancelled(true);
@@ -108,6 +108,39 @@ namespace NMR {
 		m_pPackageReader = nullptr;
 	}
 
+	ModelReader_PartStreamOpener CModelReader_3MF_Native::getPartStreamOpener(_In_ std::string sPath)
+	{
+		if (m_pPackageReader.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_pPackageReader->openPartStream(sPath).get() == nullptr)
+			return nullptr;
+
+		// the opener keeps the package open
+		PKeyStoreOpcPackageReader pPackageReader = m_pPackageReader;
+		return [pPackageReader, sPath]() {
+			return pPackageReader->openPartStream(sPath);
+		};
+	}
+
+	PImportStream CModelReader_3MF_Native::readAttachmentStream(_In_ const std::string & sURI)
+	{
+		// Parts that can be opened again stay compressed in the package until they are accessed
+		if (getLazyAttachmentLoading()) {
+			ModelReader_PartStreamOpener fnOpener = getPartStreamOpener(sURI);
+			if (fnOpener) {
+				PKeyStoreOpcPackageReader pPackageReader = m_pPackageReader;
+				ImportStream_RawOpenerType fnRawOpener = [pPackageReader, sURI](ZIPRAWENTRYINFO & Info) {
+					return pPackageReader->openRawPartStream(sURI, Info);
+				};
+				return std::make_shared<CImportStream_Deferred>(fnOpener, fnRawOpener, m_pPackageReader->getPartSize(sURI));
+			}
+		}
+
+		POpcPackagePart pPart = m_pPackageReader->createPart(sURI);
+		return pPart->getImportStream()->copyToMemory();
+	}
+
 	void CModelReader_3MF_Native::extractTexturesFromRelationships(_In_ std::string& sTargetPartURIDir, _In_ COpcPackagePart * pModelPart)
 	{
 		if (pModelPart == nullptr)
@@ -134,9 +167,7 @@ namespace NMR {
 
 				PModelAttachment pModelAttachment = model()->findModelAttachment(sURI);
 				if (!pModelAttachment) {
-					POpcPackagePart pTexturePart = m_pPackageReader->createPart(sURI);
-					PImportStream pTextureAttachmentStream = pTexturePart->getImportStream();
-					PImportStream pMemoryStream = pTextureAttachmentStream->copyToMemory();
+					PImportStream pMemoryStream = readAttachmentStream(sURI);
 
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
@@ -172,10 +203,8 @@ namespace NMR {
 
 			auto iRelationIterator = m_RelationsToRead.find(sRelationShipType);
 			if (iRelationIterator != m_RelationsToRead.end()) {
-				POpcPackagePart pPart = m_pPackageReader->createPart(sURI);
-				PImportStream pAttachmentStream = pPart->getImportStream();
 				try {
-					PImportStream pMemoryStream = pAttachmentStream->copyToMemory();
+					PImportStream pMemoryStream = readAttachmentStream(sURI);
 
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
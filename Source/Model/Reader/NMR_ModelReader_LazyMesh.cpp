@@ -0,0 +1,177 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_ModelReader_LazyMesh.cpp implements the Model Reader Lazy Mesh Classes.
+
+--*/
+
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
+#include "Model/Reader/v100/NMR_ModelReaderNode100_Mesh.h"
+#include "Common/Platform/NMR_ImportStream_Shared_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/Platform/NMR_Platform.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Exception.h"
+
+#include <vector>
+#include <algorithm>
+
+#define NMR_LAZYMESH_SKIPBUFFERSIZE (1024*1024)
+
+namespace NMR {
+
+	CModelReader_LazyMeshSource::CModelReader_LazyMeshSource(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ PImportStream pMemoryStream)
+		: m_sPath(sPath), m_pWarnings(pWarnings), m_pMemoryStream(pMemoryStream), m_nCursorPosition(0)
+	{
+		m_pMemory = dynamic_cast<CImportStream_Memory *>(pMemoryStream.get());
+		if (m_pMemory == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		m_nBasePosition = m_pMemory->getPosition();
+	}
+
+	CModelReader_LazyMeshSource::CModelReader_LazyMeshSource(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ ModelReader_PartStreamOpener fnOpener)
+		: m_sPath(sPath), m_pWarnings(pWarnings), m_pMemory(nullptr), m_nBasePosition(0), m_fnOpener(fnOpener), m_nCursorPosition(0)
+	{
+		if (!m_fnOpener)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	PModelReader_LazyMeshSource CModelReader_LazyMeshSource::makeFromStream(_In_ const std::string & sPath, _In_ PModelWarnings pWarnings, _In_ PImportStream pStream)
+	{
+		if (dynamic_cast<CImportStream_Memory *>(pStream.get()) == nullptr)
+			return nullptr;
+		return std::make_shared<CModelReader_LazyMeshSource>(sPath, pWarnings, pStream);
+	}
+
+	std::string CModelReader_LazyMeshSource::getPath()
+	{
+		return m_sPath;
+	}
+
+	PModelWarnings CModelReader_LazyMeshSource::getWarnings()
+	{
+		return m_pWarnings;
+	}
+
+	PImportStream CModelReader_LazyMeshSource::readRange(_In_ nfUint64 nStartPosition, _In_ nfUint64 nEndPosition)
+	{
+		if (nEndPosition < nStartPosition)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		nfUint64 cbSize = nEndPosition - nStartPosition;
+
+		if (m_pMemory != nullptr) {
+			// the part stays in memory, read the range in place
+			if (m_nBasePosition + nEndPosition > m_pMemory->retrieveSize())
+				throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+			return std::make_shared<CImportStream_Shared_Memory>(m_pMemory->getData() + m_nBasePosition + nStartPosition, cbSize);
+		}
+
+		// part streams can not seek, so start over if the range lies behind the last one
+		if ((m_pCursorStream.get() == nullptr) || (m_nCursorPosition > nStartPosition)) {
+			m_pCursorStream = m_fnOpener();
+			m_nCursorPosition = 0;
+			if (m_pCursorStream.get() == nullptr)
+				throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+		}
+
+		if (m_nCursorPosition < nStartPosition) {
+			std::vector<nfByte> SkipBuffer((size_t)std::min(nStartPosition - m_nCursorPosition, (nfUint64)NMR_LAZYMESH_SKIPBUFFERSIZE));
+			while (m_nCursorPosition < nStartPosition) {
+				nfUint64 cbSkip = std::min(nStartPosition - m_nCursorPosition, (nfUint64)SkipBuffer.size());
+				m_pCursorStream->readIntoBuffer(SkipBuffer.data(), cbSkip, true);
+				m_nCursorPosition += cbSkip;
+			}
+		}
+
+		PImportStream pRangeStream = std::make_shared<CImportStream_Unique_Memory>(m_pCursorStream.get(), cbSize, true);
+		m_nCursorPosition += cbSize;
+		return pRangeStream;
+	}
+
+	CModelReader_LazyMesh::CModelReader_LazyMesh(_In_ PModelReader_LazyMeshSource pSource, _In_ nfUint64 nStartPosition, _In_ nfUint64 nEndPosition, _In_ const std::map<std::string, std::string> & NameSpaces)
+		: m_pSource(pSource), m_nStartPosition(nStartPosition), m_nEndPosition(nEndPosition), m_NameSpaces(NameSpaces),
+		m_nObjectLevelPropertyIndex(0), m_bHasDefaultProperty(false), m_nDefaultPropertyModelID(0)
+	{
+		if (!m_pSource)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelReader_LazyMesh::setObjectLevelProperty(_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nObjectLevelPropertyIndex, _In_ nfBool bHasDefaultProperty, _In_ ModelResourceID nDefaultPropertyModelID)
+	{
+		m_pObjectLevelPropertyID = pObjectLevelPropertyID;
+		m_nObjectLevelPropertyIndex = nObjectLevelPropertyIndex;
+		m_bHasDefaultProperty = bHasDefaultProperty;
+		m_nDefaultPropertyModelID = nDefaultPropertyModelID;
+	}
+
+	void CModelReader_LazyMesh::loadMesh(_In_ CModelMeshObject * pMeshObject)
+	{
+		if (pMeshObject == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		CModel * pModel = pMeshObject->getModel();
+
+		PXmlReader pXMLReader = fnCreateXMLReaderInstance(m_pSource->readRange(m_nStartPosition, m_nEndPosition), std::make_shared<CProgressMonitor>());
+		pXMLReader->SetNameSpaces(m_NameSpaces);
+
+		eXmlReaderNodeType NodeType;
+		if (!pXMLReader->Read(NodeType) || (NodeType != XMLREADERNODETYPE_STARTELEMENT))
+			throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+
+		// the mesh node does not hold on to the object beyond parsing
+		PModelMeshObject pMesh(pMeshObject, [](CModelMeshObject *) {});
+
+		// resource IDs are resolved relative to the part the mesh was defined in
+		std::string sPreviousPath = pModel->currentPath();
+		pModel->setCurrentPath(m_pSource->getPath());
+		try {
+			PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(pModel, pMesh,
+				m_pSource->getWarnings(), std::make_shared<CProgressMonitor>(), m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex);
+
+			// resolve the IDs against the resources which preceded the mesh element, as eager parsing does.
+			// The object itself is added before its beam lattice is resolved.
+			UniqueResourceID nObjectID = pMeshObject->getPackageResourceID()->getUniqueID();
+			pXMLNode->setResourceIDLimit(nObjectID);
+			pXMLNode->parseXML(pXMLReader.get());
+
+			auto triangleSets = pXMLNode->getTriangleSets();
+			for (auto triangleSet : triangleSets)
+				pMeshObject->addTriangleSet(triangleSet);
+
+			pXMLNode->setResourceIDLimit(nObjectID + 1);
+			pXMLNode->handleBeamLatticeExtension();
+
+			if (m_bHasDefaultProperty)
+				pXMLNode->createDefaultProperties(m_nDefaultPropertyModelID, m_nObjectLevelPropertyIndex);
+		}
+		catch (...) {
+			pModel->setCurrentPath(sPreviousPath);
+			throw;
+		}
+		pModel->setCurrentPath(sPreviousPath);
+	}
+
+}
@@ -0,0 +1,178 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+NMR_ModelReader_Streaming.cpp implements the Model Reader Streaming Classes.
+
+--*/
+
+#include "Model/Reader/NMR_ModelReader_Streaming.h"
+#include "Common/Mesh/NMR_MeshTypes.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR {
+
+	CModelReader_Streaming::CModelReader_Streaming()
+	{
+	}
+
+	void CModelReader_Streaming::setVertexCallback(_In_ ModelStreaming_VertexCallback callback)
+	{
+		m_VertexCallback = callback;
+	}
+
+	void CModelReader_Streaming::setTriangleCallback(_In_ ModelStreaming_TriangleCallback callback)
+	{
+		m_TriangleCallback = callback;
+	}
+
+	void CModelReader_Streaming::setBeamCallback(_In_ ModelStreaming_BeamCallback callback)
+	{
+		m_BeamCallback = callback;
+	}
+
+	void CModelReader_Streaming::setComponentCallback(_In_ ModelStreaming_ComponentCallback callback)
+	{
+		m_ComponentCallback = callback;
+	}
+
+	void CModelReader_Streaming::setBuildItemCallback(_In_ ModelStreaming_BuildItemCallback callback)
+	{
+		m_BuildItemCallback = callback;
+	}
+
+	nfBool CModelReader_Streaming::streamsMeshes() const
+	{
+		return m_VertexCallback || m_TriangleCallback || m_BeamCallback;
+	}
+
+	nfBool CModelReader_Streaming::isActive() const
+	{
+		return streamsMeshes() || m_ComponentCallback || m_BuildItemCallback;
+	}
+
+	void CModelReader_Streaming::onVertices(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGVERTEX * pVertices, _In_ nfUint32 nCount)
+	{
+		if (m_VertexCallback && (nCount > 0))
+			m_VertexCallback(nObjectID, pVertices, nCount);
+	}
+
+	void CModelReader_Streaming::onTriangles(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGTRIANGLE * pTriangles, _In_ nfUint32 nCount)
+	{
+		if (m_TriangleCallback && (nCount > 0))
+			m_TriangleCallback(nObjectID, pTriangles, nCount);
+	}
+
+	void CModelReader_Streaming::onBeams(_In_ UniqueResourceID nObjectID, _In_ const MODELSTREAMINGBEAM * pBeams, _In_ nfUint32 nCount)
+	{
+		if (m_BeamCallback && (nCount > 0))
+			m_BeamCallback(nObjectID, pBeams, nCount);
+	}
+
+	void CModelReader_Streaming::onComponent(_In_ UniqueResourceID nObjectID, _In_ UniqueResourceID nComponentObjectID, _In_ const NMATRIX3 & mTransform)
+	{
+		if (m_ComponentCallback)
+			m_ComponentCallback(nObjectID, nComponentObjectID, mTransform);
+	}
+
+	void CModelReader_Streaming::onBuildItem(_In_ UniqueResourceID nObjectID, _In_ const NMATRIX3 & mTransform)
+	{
+		if (m_BuildItemCallback)
+			m_BuildItemCallback(nObjectID, mTransform);
+	}
+
+
+	CModelReader_StreamingMesh::CModelReader_StreamingMesh(_In_ CModelReader_Streaming * pStreaming, _In_ UniqueResourceID nObjectID)
+		: m_pStreaming(pStreaming), m_nObjectID(nObjectID), m_nVertexCount(0), m_nTriangleCount(0), m_nBeamCount(0)
+	{
+		if (pStreaming == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelReader_StreamingMesh::addVertex(_In_ nfFloat fX, _In_ nfFloat fY, _In_ nfFloat fZ)
+	{
+		if (m_nVertexCount >= NMR_MESH_MAXNODECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYNODES);
+
+		if (m_Vertices.size() >= MODELREADER_STREAMING_BATCHSIZE)
+			flush();
+
+		m_Vertices.push_back({ { fX, fY, fZ } });
+		m_nVertexCount++;
+	}
+
+	void CModelReader_StreamingMesh::addTriangle(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfUint32 nIndex3)
+	{
+		if (m_nTriangleCount >= NMR_MESH_MAXFACECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYFACES);
+
+		if (m_Triangles.size() >= MODELREADER_STREAMING_BATCHSIZE)
+			flush();
+
+		m_Triangles.push_back({ { nIndex1, nIndex2, nIndex3 } });
+		m_nTriangleCount++;
+	}
+
+	void CModelReader_StreamingMesh::addBeam(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfDouble dRadius1, _In_ nfDouble dRadius2, _In_ nfInt32 nCapMode1, _In_ nfInt32 nCapMode2)
+	{
+		if (m_nBeamCount >= NMR_MESH_MAXBEAMCOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYBEAMS);
+
+		if (m_Beams.size() >= MODELREADER_STREAMING_BATCHSIZE)
+			flush();
+
+		m_Beams.push_back({ { nIndex1, nIndex2 }, { dRadius1, dRadius2 }, { nCapMode1, nCapMode2 } });
+		m_nBeamCount++;
+	}
+
+	void CModelReader_StreamingMesh::flush()
+	{
+		// vertices are always passed on before the triangles and beams that reference them
+		m_pStreaming->onVertices(m_nObjectID, m_Vertices.data(), (nfUint32)m_Vertices.size());
+		m_pStreaming->onTriangles(m_nObjectID, m_Triangles.data(), (nfUint32)m_Triangles.size());
+		m_pStreaming->onBeams(m_nObjectID, m_Beams.data(), (nfUint32)m_Beams.size());
+
+		m_Vertices.clear();
+		m_Triangles.clear();
+		m_Beams.clear();
+	}
+
+	nfUint32 CModelReader_StreamingMesh::getVertexCount() const
+	{
+		return m_nVertexCount;
+	}
+
+	nfUint32 CModelReader_StreamingMesh::getTriangleCount() const
+	{
+		return m_nTriangleCount;
+	}
+
+	nfUint32 CModelReader_StreamingMesh::getBeamCount() const
+	{
+		return m_nBeamCount;
+	}
+
+}
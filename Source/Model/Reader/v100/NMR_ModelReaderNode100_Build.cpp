@@ -41,8 +41,8 @@ A build reader model node is a parser for the build node of an XML Model Stream.
 
 namespace NMR {
 
-	CModelReaderNode100_Build::CModelReaderNode100_Build(_In_ CModel * pModel, _In_ PModelWarnings pWarnings)
-		: CModelReaderNode(pWarnings)
+	CModelReaderNode100_Build::CModelReaderNode100_Build(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming)
+		: CModelReaderNode(pWarnings), m_pStreaming(pStreaming)
 	{
 		__NMRASSERT(pModel);
 		m_pModel = pModel;
@@ -101,7 +101,7 @@ namespace NMR {
 
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_CORESPEC100) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_ITEM) == 0) {
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_BuildItem>(m_pModel, m_pWarnings);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_BuildItem>(m_pModel, m_pWarnings, m_pStreaming);
 				pXMLNode->parseXML(pXMLReader);
 			}
 			else
@@ -42,8 +42,8 @@ A builditem reader model node is a parser for the builditem node of an XML Model
 
 namespace NMR {
 
-	CModelReaderNode100_BuildItem::CModelReaderNode100_BuildItem(_In_ CModel * pModel, _In_ PModelWarnings pWarnings)
-		: CModelReaderNode(pWarnings)
+	CModelReaderNode100_BuildItem::CModelReaderNode100_BuildItem(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming)
+		: CModelReaderNode(pWarnings), m_pStreaming(pStreaming)
 	{
 		__NMRASSERT(pModel);
 		m_pModel = pModel;
@@ -103,6 +103,9 @@ namespace NMR {
 
 		m_pModel->addBuildItem(pBuildItem);
 
+		if (m_pStreaming)
+			m_pStreaming->onBuildItem(pID->getUniqueID(), m_mTransform);
+
 		// Set Item Reference
 		pBuildItem->setPartNumber(m_sPartNumber);
 
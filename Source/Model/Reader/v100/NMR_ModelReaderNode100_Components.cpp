@@ -41,8 +41,8 @@ Node Class.
 
 namespace NMR {
 
-	CModelReaderNode100_Components::CModelReaderNode100_Components(_In_ CModelComponentsObject * pComponentsObject, _In_ PModelWarnings pWarnings)
-		: CModelReaderNode(pWarnings)
+	CModelReaderNode100_Components::CModelReaderNode100_Components(_In_ CModelComponentsObject * pComponentsObject, _In_ PModelWarnings pWarnings, _In_ PModelReader_Streaming pStreaming)
+		: CModelReaderNode(pWarnings), m_pStreaming(pStreaming)
 	{
 		__NMRASSERT(pComponentsObject);
 		m_pComponentsObject = pComponentsObject;
@@ -100,6 +100,9 @@ namespace NMR {
 				pComponent->setUUID(uuid);
 
 				m_pComponentsObject->addComponent(pComponent);
+
+				if (m_pStreaming)
+					m_pStreaming->onComponent(m_pComponentsObject->getPackageResourceID()->getUniqueID(), pObject->getPackageResourceID()->getUniqueID(), mTransform);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
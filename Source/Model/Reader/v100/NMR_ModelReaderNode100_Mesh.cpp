@@ -43,14 +43,16 @@ A mesh reader model node is a parser for the mesh node of an XML Model Stream.
 #include "Common/NMR_StringUtils.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
+#include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 
 namespace NMR {
 
 	CModelReaderNode100_Mesh::CModelReaderNode100_Mesh(_In_ CModel * pModel, PModelMeshObject pMesh, _In_ PModelWarnings pWarnings,
-		_In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex)
+		_In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh)
 		: CModelReaderNode(pWarnings, pProgressMonitor),
 		 m_pModel(pModel),
-		 m_pMesh(pMesh)
+		 m_pMesh(pMesh),
+		 m_pStreamingMesh(pStreamingMesh)
 	{
 		__NMRASSERT(pMesh);
 		__NMRASSERT(pModel);
@@ -81,9 +83,7 @@ namespace NMR {
 
 		if(m_bHasVolumeDataID)
 		{
-			PPackageResourceID volumePackageId =
-				m_pModel->findPackageResourceID(m_pModel->currentPath(),
-												m_nVolumeDataID);
+			PPackageResourceID volumePackageId = findPackageResourceID(m_nVolumeDataID);
 
 			if(!volumePackageId.get())
 			{
@@ -97,6 +97,19 @@ namespace NMR {
 		}
 	}
 
+	void CModelReaderNode100_Mesh::setResourceIDLimit(_In_ UniqueResourceID nResourceIDLimit)
+	{
+		m_nResourceIDLimit = nResourceIDLimit;
+	}
+
+	PPackageResourceID CModelReaderNode100_Mesh::findPackageResourceID(_In_ ModelResourceID nResourceID)
+	{
+		PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nResourceID);
+		if (pID.get() && (m_nResourceIDLimit != 0) && (pID->getUniqueID() >= m_nResourceIDLimit))
+			return nullptr;
+		return pID;
+	}
+
 	void CModelReaderNode100_Mesh::retrieveClippingInfo(_Out_ eModelBeamLatticeClipMode &eClipMode, _Out_ nfBool & bHasClippingMode, _Out_ ModelResourceID & nClippingMeshID)
 	{
 		bHasClippingMode = m_bHasClippingMeshID;
@@ -153,7 +166,7 @@ namespace NMR {
 					m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READMESH);
 					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				}
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Vertices>(mesh, m_pWarnings);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Vertices>(mesh, m_pWarnings, m_pStreamingMesh);
 				pXMLNode->parseXML(pXMLReader);
 			}
 			else if (strcmp(pChildName, XML_3MF_ELEMENT_TRIANGLES) == 0)
@@ -163,7 +176,8 @@ namespace NMR {
 					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				}
 				PModelReaderNode100_Triangles pXMLNode = std::make_shared<CModelReaderNode100_Triangles>(m_pModel, mesh, m_pWarnings,
-					m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex);
+					m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, m_pStreamingMesh);
+				pXMLNode->setResourceIDLimit(m_nResourceIDLimit);
 				pXMLNode->parseXML(pXMLReader);
 				if (m_pObjectLevelPropertyID && m_pObjectLevelPropertyID->getPackageModelPath() == 0) {
 					// warn, if object does not have an object-level property, but a triangle has one
@@ -172,7 +186,7 @@ namespace NMR {
 					}
 					// Try and define an object-level property as some PropertyID used by a triangle in the meshobject
 					ModelResourceID nObjectLevelPropertyID = pXMLNode->getUsedPropertyID();
-					m_pObjectLevelPropertyID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nObjectLevelPropertyID);
+					m_pObjectLevelPropertyID = findPackageResourceID(nObjectLevelPropertyID);
 					m_nObjectLevelPropertyIndex = 0;
 				}
 			}
@@ -184,7 +198,7 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_BEAMLATTICESPEC) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_BEAMLATTICE) == 0)
 			{
-				PModelReaderNode_BeamLattice1702_BeamLattice pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_BeamLattice>(m_pModel, mesh, m_pWarnings);
+				PModelReaderNode_BeamLattice1702_BeamLattice pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_BeamLattice>(m_pModel, mesh, m_pWarnings, m_pStreamingMesh);
 				pXMLNode->parseXML(pXMLReader);
 
 				pXMLNode->retrieveClippingInfo(m_eClipMode, m_bHasClippingMeshID, m_nClippingMeshID);
@@ -198,6 +212,12 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_TRIANGLESETS) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_TRIANGLESETS) == 0)
 			{
+				// triangle sets reference stored triangles, which a streamed mesh does not have
+				if (m_pStreamingMesh) {
+					skipContent(pXMLReader, XML_3MF_ELEMENT_TRIANGLESETS);
+					return;
+				}
+
 				PModelReaderNode100_TriangleSets pXMLNode = std::make_shared<CModelReaderNode100_TriangleSets>(m_pModel, m_pMesh->getMesh(), m_pWarnings);
 				pXMLNode->parseXML(pXMLReader);
 
@@ -214,4 +234,100 @@ namespace NMR {
 		return m_pTriangleSets;
 	}
 
+	// Create the object-level property from nPropertyModelID and nPropertyIndex
+	void CModelReaderNode100_Mesh::createDefaultProperties(_In_ ModelResourceID nPropertyModelID, _In_ ModelResourceIndex nPropertyIndex)
+	{
+		CMesh * pMesh = m_pMesh->getMesh();
+		if (pMesh) {
+
+			// Assign Default Resource Property
+			PPackageResourceID pID = findPackageResourceID(nPropertyModelID);
+			PModelResource pResource = pID.get() ? m_pModel->findResource(pID->getUniqueID()) : nullptr;
+			if (pResource.get() == nullptr) {
+				throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
+			}
+			if(!pResource->hasResourceIndexMap())
+				pResource->buildResourceIndexMap();
+
+			auto pInformationHandler = pMesh->createMeshInformationHandler();
+			CMeshInformation_Properties * pInformation = dynamic_cast<CMeshInformation_Properties *> (pInformationHandler->getInformationByType(0, NMR::emiProperties));
+			if (pInformation == nullptr) {
+				NMR::PMeshInformation_Properties pNewInformation = std::make_shared<NMR::CMeshInformation_Properties>(pMesh->getFaceCount());
+				pInformationHandler->addInformation(pNewInformation);
+
+				pInformation = pNewInformation.get();
+			}
+			
+			ModelResourceID pPropertyID;
+			if (pResource->mapResourceIndexToPropertyID(nPropertyIndex, pPropertyID)) {
+				NMR::MESHINFORMATION_PROPERTIES * pDefaultData = new NMR::MESHINFORMATION_PROPERTIES;
+				pDefaultData->m_nUniqueResourceID = pResource->getPackageResourceID()->getUniqueID();
+				pDefaultData->m_nPropertyIDs[0] = pPropertyID;
+				pDefaultData->m_nPropertyIDs[1] = pPropertyID;
+				pDefaultData->m_nPropertyIDs[2] = pPropertyID;
+				pInformation->setDefaultData((NMR::MESHINFORMATIONFACEDATA*)pDefaultData);
+			}
+			else {
+				throw CNMRException(NMR_ERROR_INVALID_RESOURCE_INDEX);
+			}
+
+		}
+	}
+
+	void CModelReaderNode100_Mesh::handleBeamLatticeExtension()
+	{
+		CModelMeshObject* pMeshObject = m_pMesh.get();
+
+		if (pMeshObject->getMesh()->getBeamCount() > 0) {
+			if ( (pMeshObject->getObjectType() != MODELOBJECTTYPE_MODEL) && (pMeshObject->getObjectType() != MODELOBJECTTYPE_SOLIDSUPPORT)) {
+				m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE), mrwInvalidOptionalValue);
+			}
+		}
+
+		eModelBeamLatticeClipMode eClipMode;
+		nfBool bHasClippingMeshID;
+		ModelResourceID nClippingMeshID;
+
+		retrieveClippingInfo(eClipMode, bHasClippingMeshID, nClippingMeshID);
+		if (bHasClippingMeshID) {
+			PPackageResourceID pID = findPackageResourceID(nClippingMeshID);
+			if (!pID.get()) {
+				m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICECLIPPINGRESOURCENOTDEFINED, mrwInvalidMandatoryValue);
+			}
+			else {
+				CModelObject * pModelObject = m_pModel->findObject(pID->getUniqueID());
+				if (pModelObject) {
+					pMeshObject->getBeamLatticeAttributes()->m_bHasClippingMeshID = bHasClippingMeshID;
+					pMeshObject->getBeamLatticeAttributes()->m_pClippingMeshUniqueID = pID;
+					pMeshObject->getBeamLatticeAttributes()->m_eClipMode = eClipMode;
+				}
+				else {
+					pMeshObject->getBeamLatticeAttributes()->m_bHasClippingMeshID = false;
+					m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICECLIPPINGRESOURCENOTDEFINED, mrwInvalidMandatoryValue);
+				}
+			}
+		}
+
+		nfBool bHasRepresentationMeshID;
+		ModelResourceID nRepresentationMeshID;
+		retrieveRepresentationInfo(bHasRepresentationMeshID, nRepresentationMeshID);
+		if (nRepresentationMeshID) {
+			PPackageResourceID pID = findPackageResourceID(nRepresentationMeshID);
+			if (!pID.get()) {
+				m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICE_INVALID_REPRESENTATIONRESOURCE, mrwInvalidMandatoryValue);
+			}
+			else {
+				CModelObject * pModelObject = m_pModel->findObject(pID->getUniqueID());
+				if (pModelObject) {
+					pMeshObject->getBeamLatticeAttributes()->m_bHasRepresentationMeshID = bHasRepresentationMeshID;
+					pMeshObject->getBeamLatticeAttributes()->m_pRepresentationUniqueID = pID;
+				}
+				else {
+					pMeshObject->getBeamLatticeAttributes()->m_bHasRepresentationMeshID = false;
+					m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICE_INVALID_REPRESENTATIONRESOURCE, mrwInvalidMandatoryValue);
+				}
+			}
+		}
+	}
+
 }
@@ -49,8 +49,8 @@ Stream.
 
 namespace NMR {
 
-	CModelReaderNode100_Object::CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
-		: CModelReaderNode(pWarnings, pProgressMonitor)
+	CModelReaderNode100_Object::CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming, _In_ PModelReader_LazyMeshSource pLazyMeshSource)
+		: CModelReaderNode(pWarnings, pProgressMonitor), m_pStreaming(pStreaming), m_pLazyMeshSource(pLazyMeshSource)
 	{
 		// Initialize variables
 		m_nID = 0;
@@ -245,24 +245,36 @@ namespace NMR {
 						m_pWarnings->addWarning(NMR_ERROR_INVALIDMODELOBJECTTYPE, mrwInvalidOptionalValue);
 				}
 				
-				// Read Mesh
-				PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(m_pModel, meshObject,
-					m_pWarnings, m_pProgressMonitor, m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex);
-				pXMLNode->parseXML(pXMLReader);
+				// Parse the mesh content on first access, if requested
+				if (m_pLazyMeshSource && !pXMLReader->IsEmptyElement()) {
+					deferMeshContent(meshObject, pXMLReader);
+					m_pModel->addResource(m_pObject);
+				}
+				else {
+					// Stream the mesh content instead of storing it, if requested
+					PModelReader_StreamingMesh pStreamingMesh;
+					if (m_pStreaming && m_pStreaming->streamsMeshes())
+						pStreamingMesh = std::make_shared<CModelReader_StreamingMesh>(m_pStreaming.get(), meshObject->getPackageResourceID()->getUniqueID());
 
-				// store triangle sets in memory model
-				auto triangleSets = pXMLNode->getTriangleSets();
-				for (auto triangleSet : triangleSets)
-					meshObject->addTriangleSet(triangleSet);
+					// Read Mesh
+					PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(m_pModel, meshObject,
+						m_pWarnings, m_pProgressMonitor, m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, pStreamingMesh.get());
+					pXMLNode->parseXML(pXMLReader);
 
-				// Add Object to Parent
-				m_pModel->addResource(m_pObject);
+					// store triangle sets in memory model
+					auto triangleSets = pXMLNode->getTriangleSets();
+					for (auto triangleSet : triangleSets)
+						meshObject->addTriangleSet(triangleSet);
 
-				// Handle BeamLattice Data
-				handleBeamLatticeExtension(pXMLNode.get());
+					// Add Object to Parent
+					m_pModel->addResource(m_pObject);
 
-				// Create Default Properties
-				createDefaultProperties();
+					// Handle BeamLattice Data
+					pXMLNode->handleBeamLatticeExtension();
+
+					// Create Default Properties
+					createDefaultProperties(pXMLNode.get());
+				}
 			}
 			// Read a component object
 			else if (strcmp(pChildName, XML_3MF_ELEMENT_COMPONENTS) == 0) {
@@ -280,7 +292,7 @@ namespace NMR {
 				}
 
 				// Read Components
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Components>(pComponentsObject.get(), m_pWarnings);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Components>(pComponentsObject.get(), m_pWarnings, m_pStreaming);
 				pXMLNode->parseXML(pXMLReader);
 
 				// Add Object to Parent
@@ -346,108 +358,24 @@ namespace NMR {
 		}
     }
 
-	// Create the object-level property from m_nObjectLevelPropertyID, if defined
-	void CModelReaderNode100_Object::createDefaultProperties()
+	void CModelReaderNode100_Object::createDefaultProperties(_In_ CModelReaderNode100_Mesh * pXMLNode)
 	{
-		if (m_pObject.get() == nullptr)
-			return;
-
-		if (m_bHasDefaultPropertyIndex && m_bHasDefaultPropertyID) {
-			CModelMeshObject* pMeshObject = dynamic_cast<CModelMeshObject*>(m_pObject.get());
-			if (pMeshObject) {
-				CMesh * pMesh = pMeshObject->getMesh();
-				if (pMesh) {
-
-					// Assign Default Resource Property
-					PModelResource pResource = m_pModel->findResource(m_pModel->currentPath(), m_nObjectLevelPropertyModelID);
-					if (pResource.get() == nullptr) {
-						throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
-					}
-					if(!pResource->hasResourceIndexMap())
-						pResource->buildResourceIndexMap();
-
-					auto pInformationHandler = pMesh->createMeshInformationHandler();
-					CMeshInformation_Properties * pInformation = dynamic_cast<CMeshInformation_Properties *> (pInformationHandler->getInformationByType(0, NMR::emiProperties));
-					if (pInformation == nullptr) {
-						NMR::PMeshInformation_Properties pNewInformation = std::make_shared<NMR::CMeshInformation_Properties>(pMesh->getFaceCount());
-						pInformationHandler->addInformation(pNewInformation);
-
-						pInformation = pNewInformation.get();
-					}
-					
-					ModelResourceID pPropertyID;
-					if (pResource->mapResourceIndexToPropertyID(m_nObjectLevelPropertyIndex, pPropertyID)) {
-						NMR::MESHINFORMATION_PROPERTIES * pDefaultData = new NMR::MESHINFORMATION_PROPERTIES;
-						pDefaultData->m_nUniqueResourceID = pResource->getPackageResourceID()->getUniqueID();
-						pDefaultData->m_nPropertyIDs[0] = pPropertyID;
-						pDefaultData->m_nPropertyIDs[1] = pPropertyID;
-						pDefaultData->m_nPropertyIDs[2] = pPropertyID;
-						pInformation->setDefaultData((NMR::MESHINFORMATIONFACEDATA*)pDefaultData);
-					}
-					else {
-						throw CNMRException(NMR_ERROR_INVALID_RESOURCE_INDEX);
-					}
-
-				}
-			}
-		}
+		if (m_bHasDefaultPropertyIndex && m_bHasDefaultPropertyID)
+			pXMLNode->createDefaultProperties(m_nObjectLevelPropertyModelID, m_nObjectLevelPropertyIndex);
 	}
 
-	void CModelReaderNode100_Object::handleBeamLatticeExtension(CModelReaderNode100_Mesh* pXMLNode)
+	// Record where the mesh content is located and skip it. It is parsed when the mesh is accessed for the first time.
+	void CModelReaderNode100_Object::deferMeshContent(_In_ PModelMeshObject pMeshObject, _In_ CXmlReader * pXMLReader)
 	{
-		CModelMeshObject* pMeshObject = dynamic_cast<CModelMeshObject*>(m_pObject.get());
-		if (pMeshObject == nullptr || pXMLNode == nullptr)
-			return;
+		std::map<std::string, std::string> NameSpaces;
+		pXMLReader->GetNameSpaces(NameSpaces);
+		nfUint64 nStartPosition = pXMLReader->GetElementStreamPosition();
 
-		if (pMeshObject->getMesh()->getBeamCount() > 0) {
-			if ( (pMeshObject->getObjectType() != MODELOBJECTTYPE_MODEL) && (pMeshObject->getObjectType() != MODELOBJECTTYPE_SOLIDSUPPORT)) {
-				m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE), mrwInvalidOptionalValue);
-			}
-		}
-
-		eModelBeamLatticeClipMode eClipMode;
-		nfBool bHasClippingMeshID;
-		ModelResourceID nClippingMeshID;
-
-		pXMLNode->retrieveClippingInfo(eClipMode, bHasClippingMeshID, nClippingMeshID);
-		if (bHasClippingMeshID) {
-			PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nClippingMeshID);
-			if (!pID.get()) {
-				m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICECLIPPINGRESOURCENOTDEFINED, mrwInvalidMandatoryValue);
-			}
-			else {
-				CModelObject * pModelObject = m_pModel->findObject(pID->getUniqueID());
-				if (pModelObject) {
-					pMeshObject->getBeamLatticeAttributes()->m_bHasClippingMeshID = bHasClippingMeshID;
-					pMeshObject->getBeamLatticeAttributes()->m_pClippingMeshUniqueID = pID;
-					pMeshObject->getBeamLatticeAttributes()->m_eClipMode = eClipMode;
-				}
-				else {
-					pMeshObject->getBeamLatticeAttributes()->m_bHasClippingMeshID = false;
-					m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICECLIPPINGRESOURCENOTDEFINED, mrwInvalidMandatoryValue);
-				}
-			}
-		}
+		skipContent(pXMLReader, XML_3MF_ELEMENT_MESH);
+		nfUint64 nEndPosition = pXMLReader->GetElementStreamPosition();
 
-		nfBool bHasRepresentationMeshID;
-		ModelResourceID nRepresentationMeshID;
-		pXMLNode->retrieveRepresentationInfo(bHasRepresentationMeshID, nRepresentationMeshID);
-		if (nRepresentationMeshID) {
-			PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nRepresentationMeshID);
-			if (!pID.get()) {
-				m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICE_INVALID_REPRESENTATIONRESOURCE, mrwInvalidMandatoryValue);
-			}
-			else {
-				CModelObject * pModelObject = m_pModel->findObject(pID->getUniqueID());
-				if (pModelObject) {
-					pMeshObject->getBeamLatticeAttributes()->m_bHasRepresentationMeshID = bHasRepresentationMeshID;
-					pMeshObject->getBeamLatticeAttributes()->m_pRepresentationUniqueID = pID;
-				}
-				else {
-					pMeshObject->getBeamLatticeAttributes()->m_bHasRepresentationMeshID = false;
-					m_pWarnings->addWarning(NMR_ERROR_BEAMLATTICE_INVALID_REPRESENTATIONRESOURCE, mrwInvalidMandatoryValue);
-				}
-			}
-		}
+		auto pLazyMesh = std::make_shared<CModelReader_LazyMesh>(m_pLazyMeshSource, nStartPosition, nEndPosition, NameSpaces);
+		pLazyMesh->setObjectLevelProperty(m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, m_bHasDefaultPropertyIndex && m_bHasDefaultPropertyID, m_nObjectLevelPropertyModelID);
+		pMeshObject->setMeshLoader(pLazyMesh);
 	}
 }
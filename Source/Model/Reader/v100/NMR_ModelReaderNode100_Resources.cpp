@@ -55,8 +55,8 @@ XML Model Stream.
 namespace NMR {
 
 	CModelReaderNode100_Resources::CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath,
-		_In_ PProgressMonitor pProgressMonitor)
-		: CModelReaderNode(pWarnings, pProgressMonitor)
+		_In_ PProgressMonitor pProgressMonitor, _In_ PModelReader_Streaming pStreaming, _In_ PModelReader_LazyMeshSource pLazyMeshSource)
+		: CModelReaderNode(pWarnings, pProgressMonitor), m_pStreaming(pStreaming), m_pLazyMeshSource(pLazyMeshSource)
 	{
 		__NMRASSERT(pModel);
 		__NMRASSERT(sPath);
@@ -94,7 +94,7 @@ namespace NMR {
 				m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READRESOURCES);
 				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Object>(m_pModel, m_pWarnings, m_pProgressMonitor);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Object>(m_pModel, m_pWarnings, m_pProgressMonitor, m_pStreaming, m_pLazyMeshSource);
 				pXMLNode->parseXML(pXMLReader);
 
 			}
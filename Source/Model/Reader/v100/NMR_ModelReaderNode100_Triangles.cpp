@@ -33,7 +33,6 @@ XML Model Stream.
 --*/
 
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Triangles.h"
-#include "Model/Reader/v100/NMR_ModelReaderNode100_Triangle.h"
 
 #include "Model/Classes/NMR_ModelConstants.h"
 #include "Common/NMR_StringUtils.h"
@@ -44,7 +43,7 @@ XML Model Stream.
 namespace NMR {
 
 	CModelReaderNode100_Triangles::CModelReaderNode100_Triangles(_In_ CModel * pModel, _In_ CMesh * pMesh,
-		_In_ PModelWarnings pWarnings, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex)
+		_In_ PModelWarnings pWarnings, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh)
 		: CModelReaderNode(pWarnings)
 	{
 		__NMRASSERT(pMesh);
@@ -57,6 +56,16 @@ namespace NMR {
 
 		m_pModel = pModel;
 		m_pMesh = pMesh;
+		m_bHasCachedResource = false;
+		m_nCachedResourceID = 0;
+		m_pPropertiesInformation = nullptr;
+		m_pStreamingMesh = pStreamingMesh;
+		m_nResourceIDLimit = 0;
+	}
+
+	void CModelReaderNode100_Triangles::setResourceIDLimit(_In_ UniqueResourceID nResourceIDLimit)
+	{
+		m_nResourceIDLimit = nResourceIDLimit;
 	}
 
 	void CModelReaderNode100_Triangles::parseXML(_In_ CXmlReader * pXMLReader)
@@ -69,6 +78,9 @@ namespace NMR {
 
 		// Parse Content
 		parseContent(pXMLReader);
+
+		if (m_pStreamingMesh)
+			m_pStreamingMesh->flush();
 	}
 
 	void CModelReaderNode100_Triangles::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
@@ -107,72 +119,152 @@ namespace NMR {
 
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_CORESPEC100) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_TRIANGLE) == 0) {
-				// Parse XML
-				PModelReaderNode100_Triangle pXMLNode = std::make_shared<CModelReaderNode100_Triangle>(m_pWarnings);
-				pXMLNode->parseXML(pXMLReader);
-
-				// Retrieve node indices
-				nfInt32 nIndex1, nIndex2, nIndex3;
-				pXMLNode->retrieveIndices(nIndex1, nIndex2, nIndex3, m_pMesh->getNodeCount());
-
-				// Create face if valid
-				if ((nIndex1 != nIndex2) && (nIndex1 != nIndex3) && (nIndex2 != nIndex3)) {
-					MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
-					MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
-					MESHNODE * pNode3 = m_pMesh->getNode(nIndex3);
-					MESHFACE * pFace = m_pMesh->addFace(pNode1, pNode2, pNode3);
-
-					ModelResourceID nModelResourceID = 0;
-					if (m_pObjectLevelPropertyID)
-						nModelResourceID = m_pObjectLevelPropertyID->getModelResourceID();
-					ModelResourceIndex nResourceIndex1 = m_nDefaultResourceIndex;
-					ModelResourceIndex nResourceIndex2 = m_nDefaultResourceIndex;
-					ModelResourceIndex nResourceIndex3 = m_nDefaultResourceIndex;
-
-					if (pXMLNode->retrieveProperties(nModelResourceID, nResourceIndex1, nResourceIndex2, nResourceIndex3) || (nModelResourceID != 0)) {
-						// set potential default properties (i.e. used pid)
-						m_nUsedResourceID = nModelResourceID;
-
-						PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nModelResourceID);
-						if (pID.get()) {
-							// Find and Assign Resource of this Property
-							PModelResource pResource = m_pModel->findResource(pID->getUniqueID());
-							if (pResource.get () != nullptr) {
-								if (!pResource->hasResourceIndexMap())
-									pResource->buildResourceIndexMap();
-
-								ModelPropertyID pPropertyID1;
-								ModelPropertyID pPropertyID2;
-								ModelPropertyID pPropertyID3;
-								if (pResource->mapResourceIndexToPropertyID(nResourceIndex1, pPropertyID1)
-									&& pResource->mapResourceIndexToPropertyID(nResourceIndex2, pPropertyID2) 
-									&& pResource->mapResourceIndexToPropertyID(nResourceIndex3, pPropertyID3)) {
-
-									CMeshInformation_Properties * pProperties = createPropertiesInformation();
-									MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(pFace->m_index);
-									if (pFaceData) {
-										pFaceData->m_nUniqueResourceID = pID->getUniqueID();
-										pFaceData->m_nPropertyIDs[0] = pPropertyID1;
-										pFaceData->m_nPropertyIDs[1] = pPropertyID2;
-										pFaceData->m_nPropertyIDs[2] = pPropertyID3;
-									}
-								} else {
-									m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMESHINFORMATIONINDEX), mrwInvalidOptionalValue);
-								}
-							}
-						}
-						else {
-							m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMODELRESOURCE), mrwInvalidOptionalValue);
-						}
-
-					}
-				}
-				else
-					throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATEINDICES);
+				parseTriangle(pXMLReader);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
+		}
+	}
+
+	void CModelReaderNode100_Triangles::parseTriangle(_In_ CXmlReader * pXMLReader)
+	{
+		// Triangles make up the bulk of every model stream, so they are parsed in place
+		// instead of creating a reader node for every single element.
+		nfInt32 nIndices[3] = { -1, -1, -1 };
+		nfInt32 nPropertyIndices[3] = { -1, -1, -1 };
+		nfInt32 nPropertyID = 0;
+
+		if (pXMLReader->MoveToFirstAttribute()) {
+			do {
+				const nfChar * pszAttributeName = nullptr;
+				const nfChar * pszAttributeValue = nullptr;
+				if (!readAttribute(pXMLReader, pszAttributeName, pszAttributeValue))
+					continue;
+
+				// Attribute names are "v1", "v2", "v3", "p1", "p2", "p3" and "pid"
+				nfInt32 * pTarget = nullptr;
+				nfInt32 nMaxValue = XML_3MF_MAXRESOURCEINDEX;
+				nfChar cFirst = pszAttributeName[0];
+				nfChar cSecond = pszAttributeName[1];
+				if ((cSecond >= '1') && (cSecond <= '3') && (pszAttributeName[2] == 0)) {
+					if (cFirst == 'v')
+						pTarget = &nIndices[cSecond - '1'];
+					else if (cFirst == 'p')
+						pTarget = &nPropertyIndices[cSecond - '1'];
+				}
+				else if (strcmp(pszAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_PID) == 0) {
+					pTarget = &nPropertyID;
+					nMaxValue = XML_3MF_MAXRESOURCEID;
+				}
+
+				if (pTarget != nullptr) {
+					nfInt32 nValue = fnStringToInt32(pszAttributeValue);
+					if ((nValue >= 0) && (nValue < nMaxValue))
+						*pTarget = nValue;
+				}
+				else
+					m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ATTRIBUTE), mrwInvalidOptionalValue);
+
+			} while (pXMLReader->MoveToNextAttribute());
+		}
+
+		skipContent(pXMLReader, XML_3MF_ELEMENT_TRIANGLE);
+
+		// Check node indices
+		nfInt32 nNodeCount = m_pStreamingMesh ? (nfInt32)m_pStreamingMesh->getVertexCount() : (nfInt32)m_pMesh->getNodeCount();
+		for (nfUint32 j = 0; j < 3; j++) {
+			if ((nIndices[j] < 0) || (nIndices[j] >= nNodeCount))
+				throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+		}
 
+		// Create face if valid
+		if ((nIndices[0] == nIndices[1]) || (nIndices[0] == nIndices[2]) || (nIndices[1] == nIndices[2]))
+			throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATEINDICES);
+
+		MESHFACE * pFace = nullptr;
+		if (m_pStreamingMesh) {
+			m_pStreamingMesh->addTriangle(nIndices[0], nIndices[1], nIndices[2]);
+		}
+		else {
+			MESHNODE * pNode1 = m_pMesh->getNode(nIndices[0]);
+			MESHNODE * pNode2 = m_pMesh->getNode(nIndices[1]);
+			MESHNODE * pNode3 = m_pMesh->getNode(nIndices[2]);
+			pFace = m_pMesh->addFace(pNode1, pNode2, pNode3);
+		}
+
+		ModelResourceID nModelResourceID = 0;
+		if (m_pObjectLevelPropertyID)
+			nModelResourceID = m_pObjectLevelPropertyID->getModelResourceID();
+
+		ModelResourceIndex nResourceIndex1 = m_nDefaultResourceIndex;
+		ModelResourceIndex nResourceIndex2 = m_nDefaultResourceIndex;
+		ModelResourceIndex nResourceIndex3 = m_nDefaultResourceIndex;
+
+		// See Core Spec 4.1.3.1 (Triangle)
+		if ((nPropertyID != 0) && (nPropertyIndices[0] >= 0)) {
+			nModelResourceID = nPropertyID;
+			nResourceIndex1 = nPropertyIndices[0];
+			nResourceIndex2 = (nPropertyIndices[1] >= 0) ? nPropertyIndices[1] : nPropertyIndices[0];
+			nResourceIndex3 = (nPropertyIndices[2] >= 0) ? nPropertyIndices[2] : nPropertyIndices[0];
+		}
+
+		if (nModelResourceID != 0) {
+			// set potential default properties (i.e. used pid)
+			m_nUsedResourceID = nModelResourceID;
+			// streamed triangles carry no properties
+			if (pFace)
+				assignTriangleProperties(pFace, nModelResourceID, nResourceIndex1, nResourceIndex2, nResourceIndex3);
+		}
+	}
+
+	void CModelReaderNode100_Triangles::assignTriangleProperties(_In_ MESHFACE * pFace, _In_ ModelResourceID nModelResourceID, _In_ ModelResourceIndex nResourceIndex1, _In_ ModelResourceIndex nResourceIndex2, _In_ ModelResourceIndex nResourceIndex3)
+	{
+		__NMRASSERT(pFace);
+
+		if ((!m_bHasCachedResource) || (m_nCachedResourceID != nModelResourceID)) {
+			m_pCachedPackageResourceID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nModelResourceID);
+			if (m_pCachedPackageResourceID.get() && (m_nResourceIDLimit != 0) && (m_pCachedPackageResourceID->getUniqueID() >= m_nResourceIDLimit))
+				m_pCachedPackageResourceID = nullptr;
+			m_pCachedResource = nullptr;
+			if (m_pCachedPackageResourceID.get()) {
+				// Find Resource of this Property
+				m_pCachedResource = m_pModel->findResource(m_pCachedPackageResourceID->getUniqueID());
+				if ((m_pCachedResource.get() != nullptr) && (!m_pCachedResource->hasResourceIndexMap()))
+					m_pCachedResource->buildResourceIndexMap();
+			}
+			m_nCachedResourceID = nModelResourceID;
+			m_bHasCachedResource = true;
+		}
+
+		if (!m_pCachedPackageResourceID.get()) {
+			m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMODELRESOURCE), mrwInvalidOptionalValue);
+			return;
+		}
+
+		if (m_pCachedResource.get() == nullptr)
+			return;
+
+		// Assign Resource of this Property
+		ModelPropertyID pPropertyID1;
+		ModelPropertyID pPropertyID2;
+		ModelPropertyID pPropertyID3;
+		if (m_pCachedResource->mapResourceIndexToPropertyID(nResourceIndex1, pPropertyID1)
+			&& m_pCachedResource->mapResourceIndexToPropertyID(nResourceIndex2, pPropertyID2)
+			&& m_pCachedResource->mapResourceIndexToPropertyID(nResourceIndex3, pPropertyID3)) {
+
+			if (m_pPropertiesInformation == nullptr)
+				m_pPropertiesInformation = createPropertiesInformation();
+
+			MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)m_pPropertiesInformation->getFaceData(pFace->m_index);
+			if (pFaceData) {
+				pFaceData->m_nUniqueResourceID = m_pCachedPackageResourceID->getUniqueID();
+				pFaceData->m_nPropertyIDs[0] = pPropertyID1;
+				pFaceData->m_nPropertyIDs[1] = pPropertyID2;
+				pFaceData->m_nPropertyIDs[2] = pPropertyID3;
+			}
+		}
+		else {
+			m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMESHINFORMATIONINDEX), mrwInvalidOptionalValue);
 		}
 	}
 
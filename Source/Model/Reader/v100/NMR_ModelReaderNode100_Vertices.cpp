@@ -33,20 +33,21 @@ XML Model Stream.
 --*/
 
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Vertices.h"
-#include "Model/Reader/v100/NMR_ModelReaderNode100_Vertex.h"
 
 #include "Model/Classes/NMR_ModelConstants.h"
 #include "Common/NMR_StringUtils.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
+#include <cmath>
 
 namespace NMR {
 
-	CModelReaderNode100_Vertices::CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings)
+	CModelReaderNode100_Vertices::CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings, _In_opt_ CModelReader_StreamingMesh * pStreamingMesh)
 		: CModelReaderNode(pWarnings)
 	{
 		__NMRASSERT(pMesh);
 		m_pMesh = pMesh;
+		m_pStreamingMesh = pStreamingMesh;
 	}
 
 	void CModelReaderNode100_Vertices::parseXML(_In_ CXmlReader * pXMLReader)
@@ -59,6 +60,9 @@ namespace NMR {
 
 		// Parse Content
 		parseContent(pXMLReader);
+
+		if (m_pStreamingMesh)
+			m_pStreamingMesh->flush();
 	}
 
 	void CModelReaderNode100_Vertices::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
@@ -76,17 +80,57 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_CORESPEC100) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_VERTEX) == 0)
 			{
-				PModelReaderNode100_Vertex pXMLNode = std::make_shared<CModelReaderNode100_Vertex>(m_pWarnings);
-				pXMLNode->parseXML(pXMLReader);
-
-				// Create Mesh Node
-				nfFloat fX, fY, fZ;
-				pXMLNode->retrievePosition(fX, fY, fZ);
-				m_pMesh->addNode(fnVEC3_make(fX, fY, fZ));
+				parseVertex(pXMLReader);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
 		}
 	}
 
+	void CModelReaderNode100_Vertices::parseVertex(_In_ CXmlReader * pXMLReader)
+	{
+		// Vertices make up the bulk of every model stream, so they are parsed in place
+		// instead of creating a reader node for every single element.
+		nfFloat fCoordinates[3] = { 0.0f, 0.0f, 0.0f };
+		nfBool bHasCoordinate[3] = { false, false, false };
+
+		if (pXMLReader->MoveToFirstAttribute()) {
+			do {
+				const nfChar * pszAttributeName = nullptr;
+				const nfChar * pszAttributeValue = nullptr;
+				if (!readAttribute(pXMLReader, pszAttributeName, pszAttributeValue))
+					continue;
+
+				// Attribute names are "x", "y" and "z"
+				nfUint32 nAxis = 3;
+				if (pszAttributeName[1] == 0)
+					nAxis = (nfUint32)(pszAttributeName[0] - XML_3MF_ATTRIBUTE_VERTEX_X[0]);
+
+				if (nAxis < 3) {
+					nfFloat fValue = fnStringToFloat(pszAttributeValue);
+					if (std::isnan(fValue))
+						throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATES);
+					if (fabs(fValue) > XML_3MF_MAXIMUMCOORDINATEVALUE)
+						throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATES);
+					fCoordinates[nAxis] = fValue;
+					bHasCoordinate[nAxis] = true;
+				}
+				else
+					m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ATTRIBUTE), mrwInvalidOptionalValue);
+
+			} while (pXMLReader->MoveToNextAttribute());
+		}
+
+		skipContent(pXMLReader, XML_3MF_ELEMENT_VERTEX);
+
+		// Model Coordinate is missing
+		if ((!bHasCoordinate[0]) || (!bHasCoordinate[1]) || (!bHasCoordinate[2]))
+			throw CNMRException(NMR_ERROR_MODELCOORDINATEMISSING);
+
+		if (m_pStreamingMesh)
+			m_pStreamingMesh->addVertex(fCoordinates[0], fCoordinates[1], fCoordinates[2]);
+		else
+			m_pMesh->addNode(fnVEC3_make(fCoordinates[0], fCoordinates[1], fCoordinates[2]));
+	}
+
 }
@@ -56,13 +56,13 @@ NMR_OpcPackageWriter.cpp defines an OPC Package writer in a portable way.
 namespace NMR {
 
 
-	CKeyStoreOpcPackageWriter::CKeyStoreOpcPackageWriter(_In_ PExportStream pImportStream, _In_ CModelContext const & context)
+	CKeyStoreOpcPackageWriter::CKeyStoreOpcPackageWriter(_In_ PExportStream pImportStream, _In_ CModelContext const & context, _In_ nfUint32 nCompressionThreadCount)
 		:m_pContext(context)
 	{
 		if (!context.isComplete())
 			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
 
-		m_pPackageWriter = std::make_shared<COpcPackageWriter>(pImportStream);
+		m_pPackageWriter = std::make_shared<COpcPackageWriter>(pImportStream, nCompressionThreadCount);
 		refreshAllResourceDataGroups();
 	}
 
@@ -149,12 +149,12 @@ namespace NMR {
 		}
 	}
 
-	POpcPackagePart CKeyStoreOpcPackageWriter::addPart(_In_ std::string sPath)
+	POpcPackagePart CKeyStoreOpcPackageWriter::addPart(_In_ std::string sPath, _In_ nfUint32 nCompressionLevel)
 	{
 		PSecureContext const & secureContext = m_pContext.secureContext();
 		PKeyStore const & keyStore = m_pContext.keyStore();
 
-		auto pPart = m_pPackageWriter->addPart(sPath);
+		auto pPart = m_pPackageWriter->addPart(sPath, nCompressionLevel);
 		NMR::PKeyStoreResourceData rd = keyStore->findResourceData(sPath);
 		if (nullptr != rd) {
 			if (secureContext->hasDekCtx()) {
@@ -166,6 +166,15 @@ namespace NMR {
 		return pPart;
 	}
 
+	POpcPackagePart CKeyStoreOpcPackageWriter::addRawPart(_In_ std::string sPath, _In_ CImportStream * pRawStream, _In_ const ZIPRAWENTRYINFO & Info)
+	{
+		// parts that are encrypted by this package have to be written through addPart
+		if (m_pContext.keyStore()->findResourceData(sPath) != nullptr)
+			return nullptr;
+
+		return m_pPackageWriter->addRawPart(sPath, pRawStream, Info);
+	}
+
 	void CKeyStoreOpcPackageWriter::close() {
 		PSecureContext const & secureContext = m_pContext.secureContext();
 		PKeyStore const & keyStore = m_pContext.keyStore();
@@ -178,7 +187,7 @@ namespace NMR {
 		}
 
 		if (!keyStore->empty()) {
-			POpcPackagePart pKeyStorePart = m_pPackageWriter->addPart(PACKAGE_3D_KEYSTORE_URI);
+			POpcPackagePart pKeyStorePart = m_pPackageWriter->addPart(PACKAGE_3D_KEYSTORE_URI, ZIPFILECOMPRESSIONLEVEL_DEFAULT);
 			m_pPackageWriter->addContentType(pKeyStorePart, PACKAGE_KEYSTORE_CONTENT_TYPE);
 			m_pPackageWriter->addRootRelationship(PACKAGE_KEYSTORE_RELATIONSHIP_TYPE, pKeyStorePart.get());
 			m_pPackageWriter->addRootRelationship(PACKAGE_MUST_PRESERVE_RELATIONSHIP_TYPE, pKeyStorePart.get());
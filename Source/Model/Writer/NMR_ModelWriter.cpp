@@ -38,6 +38,7 @@ A model writer exports the in memory represenation into a model file.
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_Exception_Windows.h" 
 #include "Common/NMR_SecureContext.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 
 #include <sstream>
@@ -49,7 +50,13 @@ namespace NMR {
 
 	CModelWriter::CModelWriter(_In_ PModel pModel):
 		CModelContext(pModel),
-		m_nDecimalPrecision(6)
+		m_nDecimalPrecision(6),
+		m_nObjectThreadCount(1),
+		m_nCompressionThreadCount(1),
+		m_nSubModelThreadCount(1),
+		m_nModelCompressionLevel(ZIPFILECOMPRESSIONLEVEL_DEFAULT),
+		m_nTextureCompressionLevel(ZIPFILECOMPRESSIONLEVEL_DEFAULT),
+		m_nAttachmentCompressionLevel(ZIPFILECOMPRESSIONLEVEL_DEFAULT)
 	{
 	}
 
@@ -65,4 +72,70 @@ namespace NMR {
 		return m_nDecimalPrecision;
 	}
 
+	void CModelWriter::SetObjectThreadCount(nfUint32 nThreadCount)
+	{
+		m_nObjectThreadCount = nThreadCount;
+	}
+
+	nfUint32 CModelWriter::GetObjectThreadCount()
+	{
+		return m_nObjectThreadCount;
+	}
+
+	void CModelWriter::SetCompressionThreadCount(nfUint32 nThreadCount)
+	{
+		m_nCompressionThreadCount = nThreadCount;
+	}
+
+	nfUint32 CModelWriter::GetCompressionThreadCount()
+	{
+		return m_nCompressionThreadCount;
+	}
+
+	void CModelWriter::SetSubModelThreadCount(nfUint32 nThreadCount)
+	{
+		m_nSubModelThreadCount = nThreadCount;
+	}
+
+	nfUint32 CModelWriter::GetSubModelThreadCount()
+	{
+		return m_nSubModelThreadCount;
+	}
+
+	void CModelWriter::SetModelCompressionLevel(nfUint32 nCompressionLevel)
+	{
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		m_nModelCompressionLevel = nCompressionLevel;
+	}
+
+	nfUint32 CModelWriter::GetModelCompressionLevel()
+	{
+		return m_nModelCompressionLevel;
+	}
+
+	void CModelWriter::SetTextureCompressionLevel(nfUint32 nCompressionLevel)
+	{
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		m_nTextureCompressionLevel = nCompressionLevel;
+	}
+
+	nfUint32 CModelWriter::GetTextureCompressionLevel()
+	{
+		return m_nTextureCompressionLevel;
+	}
+
+	void CModelWriter::SetAttachmentCompressionLevel(nfUint32 nCompressionLevel)
+	{
+		if (nCompressionLevel > ZIPFILECOMPRESSIONLEVEL_MAX)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		m_nAttachmentCompressionLevel = nCompressionLevel;
+	}
+
+	nfUint32 CModelWriter::GetAttachmentCompressionLevel()
+	{
+		return m_nAttachmentCompressionLevel;
+	}
+
 }
@@ -35,7 +35,7 @@ This is the abstract base class for all 3MF model stream exporters.
 
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_Exception_Windows.h" 
-#include <sstream>
+#include "Common/NMR_NumberFormat.h"
 
 namespace NMR {
 
@@ -78,40 +78,40 @@ namespace NMR {
 
 	void CModelWriterNode::writeIntAttribute(_In_z_ const nfChar * pAttributeName, _In_ nfInt32 nAttributeValue)
 	{
-		std::stringstream sStream;
-		sStream << nAttributeValue;
-		writeConstStringAttribute(pAttributeName, sStream.str().c_str());
+		nfChar szBuffer[NMR_NUMBERFORMAT_BUFFERSIZE + 1];
+		szBuffer[fnFormatInt32(szBuffer, nAttributeValue)] = 0;
+		writeConstStringAttribute(pAttributeName, szBuffer);
 	}
 
 	void CModelWriterNode::writePrefixedIntAttribute(
 		const nfChar* pPrefix, const nfChar* pAttributeName,
 		nfInt32 nAttributeValue)
 	{
-		std::stringstream sStream;
-		sStream << nAttributeValue;
-		writeConstPrefixedStringAttribute(pPrefix, pAttributeName, sStream.str().c_str());
+		nfChar szBuffer[NMR_NUMBERFORMAT_BUFFERSIZE + 1];
+		szBuffer[fnFormatInt32(szBuffer, nAttributeValue)] = 0;
+		writeConstPrefixedStringAttribute(pPrefix, pAttributeName, szBuffer);
 	}
 	
 	void CModelWriterNode::writeUintAttribute(
 		_In_z_ const nfChar* pAttributeName, _In_ nfUint32 nAttributeValue)
         {
-		std::stringstream sStream;
-		sStream << nAttributeValue;
-		writeConstStringAttribute(pAttributeName, sStream.str().c_str());
+		nfChar szBuffer[NMR_NUMBERFORMAT_BUFFERSIZE + 1];
+		szBuffer[fnFormatUInt32(szBuffer, nAttributeValue)] = 0;
+		writeConstStringAttribute(pAttributeName, szBuffer);
 	}
 
 	void CModelWriterNode::writeFloatAttribute(_In_z_ const nfChar * pAttributeName, _In_ nfFloat fAttributeValue)
 	{
-		std::stringstream sStream;
-		sStream << fAttributeValue;
-		writeConstStringAttribute(pAttributeName, sStream.str().c_str());
+		nfChar szBuffer[NMR_NUMBERFORMAT_BUFFERSIZE + 1];
+		szBuffer[fnFormatFloat(szBuffer, fAttributeValue)] = 0;
+		writeConstStringAttribute(pAttributeName, szBuffer);
 	}
 
 	void CModelWriterNode::writeDoubleAttribute(_In_z_ const nfChar* pAttributeName, _In_ nfDouble dAttributeValue)
 	{
-		std::stringstream sStream;
-		sStream << dAttributeValue;
-		writeConstStringAttribute(pAttributeName, sStream.str().c_str());
+		nfChar szBuffer[NMR_NUMBERFORMAT_BUFFERSIZE + 1];
+		szBuffer[fnFormatDouble(szBuffer, dAttributeValue)] = 0;
+		writeConstStringAttribute(pAttributeName, szBuffer);
 	}
 
 	void CModelWriterNode::writeStartElement(_In_z_ const nfChar * pElementName)
@@ -31,10 +31,9 @@ Writer node for implicit functions
 #include "Model/Writer/NMR_ModelWriterNode_Implicit.h"
 #include "Model/Classes/NMR_ImplicitNodeTypes.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_NumberFormat.h"
 #include "lib3mf_types.hpp"
 
-#include <sstream>
-
 namespace NMR
 {
     const implicit::NodeTypes CModelWriterNode_Implicit::m_nodeTypes;
@@ -98,14 +97,20 @@ namespace NMR
 
     std::string mat4x4ToString(Lib3MF::sMatrix4x4 const & mat)
     {
-        std::stringstream outStream;
-        outStream << mat.m_Field[0][0] << " " << mat.m_Field[0][1] << " " << mat.m_Field[0][2] << " "
-           << mat.m_Field[0][3] << " " << mat.m_Field[1][0] << " " << mat.m_Field[1][1] << " "
-           << mat.m_Field[1][2] << " " << mat.m_Field[1][3] << " " << mat.m_Field[2][0] << " "
-           << mat.m_Field[2][1] << " " << mat.m_Field[2][2] << " " << mat.m_Field[2][3] << " "
-           << mat.m_Field[3][0] << " " << mat.m_Field[3][1] << " " << mat.m_Field[3][2] << " "
-           << mat.m_Field[3][3];
-        return outStream.str();
+        nfChar szBuffer[16 * (NMR_NUMBERFORMAT_BUFFERSIZE + 1)];
+        nfChar * pTarget = szBuffer;
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                if ((row != 0) || (column != 0))
+                {
+                    *(pTarget++) = ' ';
+                }
+                pTarget += fnFormatDouble(pTarget, mat.m_Field[row][column]);
+            }
+        }
+        return std::string(szBuffer, pTarget);
     }
 
    
@@ -135,7 +135,7 @@ namespace NMR
         auto pVolumeData = levelSet.getVolumeData();
         if (pVolumeData) {
             PPackageResourceID pID = pVolumeData->getPackageResourceID();
-            if (pID->getPath() != m_pModel->currentPath())
+            if (pID->getPath() != m_sModelPath)
                 throw CNMRException(NMR_ERROR_MODELRESOURCE_IN_DIFFERENT_MODEL);
             writeIntAttribute(XML_3MF_ATTRIBUTE_LEVELSET_VOLUMEDATA, pID->getModelResourceID());
         }
@@ -40,10 +40,16 @@ namespace NMR {
 		:CModelWriterNode(pXMLWriter, pProgressMonitor) {
 		__NMRASSERT(pModel);
 		m_pModel = pModel;
+		m_sModelPath = pModel->currentPath();
+	}
+
+	void CModelWriterNode_ModelBase::setModelPath(_In_ const std::string & sModelPath)
+	{
+		m_sModelPath = sModelPath;
 	}
 
 	void CModelWriterNode_ModelBase::assertResourceIsInCurrentPath(PPackageResourceID pID) {
-		if (pID->getPath() != m_pModel->currentPath())
+		if (pID->getPath() != m_sModelPath)
 			throw CNMRException(NMR_ERROR_MODELRESOURCE_IN_DIFFERENT_MODEL);
 	}
 }
@@ -79,13 +79,17 @@ namespace NMR {
 		monitor()->ReportProgressAndQueryCancelled(true);
 	}
 
-	void CModelWriter_3MF::writeNonRootModelStream(_In_ CXmlWriter *pXMLWriter)
+	void CModelWriter_3MF::writeNonRootModelStream(_In_ CXmlWriter * pXMLWriter, _In_ const std::string & sPath, _In_ PProgressMonitor pProgressMonitor,
+		_In_ nfUint32 nObjectThreadCount, _In_opt_ const std::list<CModelObject *> * pSortedObjectList)
 	{
-		if (pXMLWriter == nullptr)
+		if ((pXMLWriter == nullptr) || (pProgressMonitor.get() == nullptr))
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		pXMLWriter->WriteStartDocument();
-		CModelWriterNode100_Model ModelNode(model().get(), pXMLWriter, monitor(), GetDecimalPrecision(), false);
+		CModelWriterNode100_Model ModelNode(model().get(), pXMLWriter, pProgressMonitor, GetDecimalPrecision(), false);
+		ModelNode.setModelPath(sPath);
+		ModelNode.setObjectThreadCount(nObjectThreadCount);
+		ModelNode.setSortedObjectList(pSortedObjectList);
 		ModelNode.writeToXML();
 
 		pXMLWriter->WriteEndDocument();
@@ -103,6 +107,7 @@ namespace NMR {
 		pXMLWriter->WriteStartDocument();
 
 		CModelWriterNode100_Model ModelNode(pModel, pXMLWriter, monitor(), GetDecimalPrecision(), true);
+		ModelNode.setObjectThreadCount(GetObjectThreadCount());
 		ModelNode.writeToXML();
 
 		pXMLWriter->WriteEndDocument();
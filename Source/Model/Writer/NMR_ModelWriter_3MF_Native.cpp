@@ -43,12 +43,23 @@ using LibZ and a native XML writer implementation.
 #include "Common/Platform/NMR_XmlWriter.h" 
 #include "Common/Platform/NMR_XmlWriter_Native.h" 
 #include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Deferred.h"
 #include "Common/Platform/NMR_ExportStream_Memory.h"
+#include "Common/Platform/NMR_ExportStream_ZIPMemory.h"
 #include "Common/NMR_StringUtils.h" 
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Model/Classes/NMR_ModelFunction.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <mutex>
 #include <sstream>
+#include <system_error>
+#include <thread>
 
 namespace NMR {
 	
@@ -82,8 +93,8 @@ namespace NMR {
 		monitor()->SetMaxProgress(m_pOtherModel->getResourceCount() + m_pOtherModel->getAttachmentCount() + 1 + 1);
 
 		// Write Model Stream
-		m_pPackageWriter = std::make_shared<CKeyStoreOpcPackageWriter>(pStream, *this);
-		POpcPackagePart pModelPart = m_pPackageWriter->addPart(m_pOtherModel->rootPath());
+		m_pPackageWriter = std::make_shared<CKeyStoreOpcPackageWriter>(pStream, *this, GetCompressionThreadCount());
+		POpcPackagePart pModelPart = m_pPackageWriter->addPart(m_pOtherModel->rootPath(), GetModelCompressionLevel());
 		PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pModelPart->getExportStream());
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITEROOTMODEL);
@@ -98,12 +109,7 @@ namespace NMR {
 		if (pPackageThumbnail.get() != nullptr)
 		{
 			// create Package Thumbnail Part
-			POpcPackagePart pThumbnailPart = m_pPackageWriter->addPart(pPackageThumbnail->getPathURI());
-			PExportStream pExportStream = pThumbnailPart->getExportStream();
-			// Copy data
-			PImportStream pPackageThumbnailStream = pPackageThumbnail->getStream();
-			pPackageThumbnailStream->seekPosition(0, true);
-			pExportStream->copyFrom(pPackageThumbnailStream.get(), pPackageThumbnailStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+			POpcPackagePart pThumbnailPart = addAttachmentPart(pPackageThumbnail->getPathURI(), pPackageThumbnail->getStream(), GetTextureCompressionLevel());
 			// add root relationship
 			m_pPackageWriter->addRootRelationship(pPackageThumbnail->getRelationShipType(), pThumbnailPart.get());
 		}
@@ -140,28 +146,182 @@ namespace NMR {
 		}
 	}
 
+	PImportStream CModelWriter_3MF_Native::writeNonRootModelPart(_In_ const std::string & sPath, _In_ PProgressMonitor pProgressMonitor,
+		_In_ nfUint32 nObjectThreadCount, _In_opt_ const std::list<CModelObject *> * pSortedObjectList)
+	{
+		// The XML is deflated while it is written, so that only the compressed part is kept in memory.
+		// It is copied into the package later without being compressed again.
+		PExportStream_ZIPMemory pExportStream = std::make_shared<CExportStream_ZIPMemory>(GetModelCompressionLevel());
+		{
+			PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pExportStream);
+			writeNonRootModelStream(pXMLWriter.get(), sPath, pProgressMonitor, nObjectThreadCount, pSortedObjectList);
+		}
+		pExportStream->finishEntry();
+
+		ZIPRAWENTRYINFO Info;
+		pExportStream->openRawStream(Info);
+
+		ImportStream_OpenerType fnOpener = [pExportStream]() {
+			return pExportStream->openUncompressedStream();
+		};
+		ImportStream_RawOpenerType fnRawOpener = [pExportStream](ZIPRAWENTRYINFO & RawInfo) {
+			return pExportStream->openRawStream(RawInfo);
+		};
+		return std::make_shared<CImportStream_Deferred>(fnOpener, fnRawOpener, Info.m_nUncompressedSize);
+	}
+
+	void CModelWriter_3MF_Native::writeNonRootModelParts(_In_ const std::vector<std::string> & Paths, _In_ std::vector<PImportStream> & Streams, _In_ nfUint32 nThreadCount)
+	{
+		// Parts whose functions look up resources through the current path of the model stay on this thread
+		std::vector<nfBool> IsParallel(Paths.size(), true);
+		std::vector<nfUint32> ResourceCounts(Paths.size(), 0);
+		nfUint32 nResourceCount = m_pOtherModel->getResourceCount();
+		for (nfUint32 nResourceIndex = 0; nResourceIndex < nResourceCount; nResourceIndex++) {
+			PModelResource pResource = m_pOtherModel->getResource(nResourceIndex);
+			auto iPath = std::find(Paths.begin(), Paths.end(), pResource->getPackageResourceID()->getPath());
+			if (iPath == Paths.end())
+				continue;
+			size_t nPart = iPath - Paths.begin();
+			ResourceCounts[nPart]++;
+			if (dynamic_cast<CModelFunction *>(pResource.get()) != nullptr)
+				IsParallel[nPart] = false;
+		}
+
+		std::vector<size_t> Parts;
+		for (size_t nPart = 0; nPart < Paths.size(); nPart++) {
+			if (IsParallel[nPart])
+				Parts.push_back(nPart);
+		}
+		if (Parts.size() < 2)
+			return;
+
+		// Deferred meshes are loaded here, as their loader reads the package and changes the current path of the model
+		for (nfUint32 nResourceIndex = 0; nResourceIndex < nResourceCount; nResourceIndex++) {
+			CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *>(m_pOtherModel->getResource(nResourceIndex).get());
+			if (pMeshObject)
+				pMeshObject->getMesh();
+		}
+		std::list<CModelObject *> SortedObjectList = m_pOtherModel->getSortedObjectList();
+
+		struct sNonRootModelPart {
+			PImportStream m_pStream;
+			std::exception_ptr m_pException;
+			nfBool m_bDone;
+		};
+
+		std::vector<sNonRootModelPart> Results(Parts.size());
+		for (auto & Result : Results)
+			Result.m_bDone = false;
+		std::mutex Mutex;
+		std::condition_variable DoneCondition;
+		std::atomic<bool> bAbort(false);
+		size_t nNextPart = 0;
+
+		// Workers report to a monitor of their own, which only forwards the cancellation of this thread
+		auto fnWriteParts = [&]() {
+			PProgressMonitor pMonitor = std::make_shared<CProgressMonitor>();
+			pMonitor->SetProgressCallback([&bAbort](int, ProgressIdentifier, void *) { return bAbort.load(); }, nullptr);
+
+			while (true) {
+				size_t nIndex;
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					if (bAbort || (nNextPart >= Parts.size()))
+						break;
+					nIndex = nNextPart++;
+				}
+
+				sNonRootModelPart & Result = Results[nIndex];
+				try {
+					Result.m_pStream = writeNonRootModelPart(Paths[Parts[nIndex]], pMonitor, 1, &SortedObjectList);
+				}
+				catch (...) {
+					Result.m_pException = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Result.m_bDone = true;
+				}
+				DoneCondition.notify_all();
+			}
+		};
+
+		std::vector<std::thread> Workers;
+		size_t nWorkerCount = std::min((size_t)nThreadCount, Parts.size());
+		for (size_t nWorker = 0; nWorker < nWorkerCount; nWorker++) {
+			try {
+				Workers.push_back(std::thread(fnWriteParts));
+			}
+			catch (std::system_error &) {
+				// continue with the threads we have
+				break;
+			}
+		}
+
+		auto fnStopWorkers = [&]() {
+			bAbort = true;
+			for (auto & Worker : Workers)
+				Worker.join();
+		};
+
+		try {
+			for (size_t nIndex = 0; nIndex < Parts.size(); nIndex++) {
+				sNonRootModelPart & Result = Results[nIndex];
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					while (!Result.m_bDone && !Workers.empty()) {
+						if (!DoneCondition.wait_for(Lock, std::chrono::milliseconds(50), [&]() { return Result.m_bDone; })) {
+							Lock.unlock();
+							monitor()->QueryCancelled(true);
+							Lock.lock();
+						}
+					}
+				}
+				// without workers, the part is written serially by the caller
+				if (!Result.m_bDone)
+					break;
+				if (Result.m_pException)
+					std::rethrow_exception(Result.m_pException);
+
+				Streams[Parts[nIndex]] = Result.m_pStream;
+				monitor()->IncrementProgress(ResourceCounts[Parts[nIndex]]);
+			}
+		}
+		catch (...) {
+			fnStopWorkers();
+			throw;
+		}
+
+		fnStopWorkers();
+	}
+
 	void CModelWriter_3MF_Native::addNonRootModels() {
 
 		// do this based on resource-paths
 		std::vector<PPackageModelPath> vctPPaths = m_pOtherModel->retrieveAllModelPaths();
-		nfUint64 nCount = vctPPaths.size();
+		std::vector<std::string> Paths;
+		for (auto pPath : vctPPaths) {
+			if (pPath->getPath() != m_pOtherModel->rootPath())
+				Paths.push_back(pPath->getPath());
+		}
+
+		std::vector<PImportStream> Streams(Paths.size());
+		nfUint32 nThreadCount = GetSubModelThreadCount();
+		if (nThreadCount == 0)
+			nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		if (nThreadCount > 1)
+			writeNonRootModelParts(Paths, Streams, nThreadCount);
 
-		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+		for (size_t nIndex = 0; nIndex < Paths.size(); nIndex++) {
 			monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITENONROOTMODELS);
 			monitor()->ReportProgressAndQueryCancelled(true);
 
-			std::string sNonRootModelPath = vctPPaths[nIndex]->getPath();
-			if (sNonRootModelPath == m_pOtherModel->rootPath())
-				continue;
-
-			m_pOtherModel->setCurrentPath(sNonRootModelPath);
-			PImportStream pStream;
-			{
-				PExportStreamMemory pExportStream = std::make_shared<CExportStreamMemory>();
-				PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pExportStream);
-				writeNonRootModelStream(pXMLWriter.get());
-
-				pStream = std::make_shared<CImportStream_Unique_Memory>(pExportStream->getData(), pExportStream->getDataSize());
+			std::string sNonRootModelPath = Paths[nIndex];
+			PImportStream pStream = Streams[nIndex];
+			if (pStream.get() == nullptr) {
+				m_pOtherModel->setCurrentPath(sNonRootModelPath);
+				pStream = writeNonRootModelPart(sNonRootModelPath, monitor(), GetObjectThreadCount(), nullptr);
 			}
 			
 			// check, whether this non-root model is already in here
@@ -176,6 +336,44 @@ namespace NMR {
 		}
 	}
 
+	nfUint32 CModelWriter_3MF_Native::getAttachmentCompressionLevel(_In_ const std::string & sRelationShipType)
+	{
+		if (sRelationShipType == PACKAGE_START_PART_RELATIONSHIP_TYPE)
+			return GetModelCompressionLevel();
+		if ((sRelationShipType == PACKAGE_TEXTURE_RELATIONSHIP_TYPE) || (sRelationShipType == PACKAGE_THUMBNAIL_RELATIONSHIP_TYPE))
+			return GetTextureCompressionLevel();
+		return GetAttachmentCompressionLevel();
+	}
+
+	POpcPackagePart CModelWriter_3MF_Native::addAttachmentPart(_In_ std::string sPath, _In_ PImportStream pStream, _In_ nfUint32 nCompressionLevel)
+	{
+		if (pStream.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		// Attachments that are still compressed in the package they were read from are copied without recompression
+		CImportStream_Deferred * pDeferredStream = dynamic_cast<CImportStream_Deferred *>(pStream.get());
+		if (pDeferredStream != nullptr) {
+			ZIPRAWENTRYINFO Info;
+			PImportStream pRawStream = pDeferredStream->openRawStream(Info);
+			// the raw copy keeps the compression method of the source, so it is only used if it matches the requested one
+			nfBool bStored = (nCompressionLevel == ZIPFILECOMPRESSIONLEVEL_STORED);
+			if ((pRawStream.get() != nullptr) && (bStored == (Info.m_nCompressionMethod == ZIPFILECOMPRESSION_UNCOMPRESSED))) {
+				POpcPackagePart pPart = m_pPackageWriter->addRawPart(sPath, pRawStream.get(), Info);
+				if (pPart.get() != nullptr)
+					return pPart;
+			}
+		}
+
+		POpcPackagePart pPart = m_pPackageWriter->addPart(sPath, nCompressionLevel);
+		PExportStream pExportStream = pPart->getExportStream();
+
+		// Copy data
+		pStream->seekPosition(0, true);
+		pExportStream->copyFrom(pStream.get(), pStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+
+		return pPart;
+	}
+
 	void CModelWriter_3MF_Native::addAttachments(_In_ CModel * pModel, _In_ POpcPackagePart pModelPart)
 	{
 		__NMRASSERT(pModel != nullptr);
@@ -201,12 +399,7 @@ namespace NMR {
 					throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 				// create Attachment Part
-				POpcPackagePart pAttachmentPart = m_pPackageWriter->addPart(sPath);
-				PExportStream pExportStream = pAttachmentPart->getExportStream();
-
-				// Copy data
-				pStream->seekPosition(0, true);
-				pExportStream->copyFrom(pStream.get(), pStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+				POpcPackagePart pAttachmentPart = addAttachmentPart(sPath, pStream, getAttachmentCompressionLevel(sRelationShipType));
 
 				// add relationships
 				m_pPackageWriter->addPartRelationship(pModelPart, sRelationShipType.c_str(), pAttachmentPart.get());
@@ -37,15 +37,12 @@ This is the class for exporting the 3mf mesh node.
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/NMR_StringUtils.h"
+#include "Common/NMR_NumberFormat.h"
 
 #include "Common/3MF_ProgressMonitor.h"
 
 #include <cmath>
 
-#ifdef __GNUC__
-#include <stdio.h>
-#endif // __GNUC__
-
 #define MAX(a,b) (((a)>(b))?(a):(b))
 
 namespace NMR {
@@ -140,7 +137,7 @@ namespace NMR {
 			auto pVolumeData = m_pModelMeshObject->getVolumeData();
 			if (pVolumeData) {
 				PPackageResourceID pID = pVolumeData->getPackageResourceID();
-				if (pID->getPath() != m_pModel->currentPath())
+				if (pID->getPath() != m_sModelPath)
 					throw CNMRException(NMR_ERROR_MODELRESOURCE_IN_DIFFERENT_MODEL);
 				writePrefixedIntAttribute(XML_3MF_NAMESPACEPREFIX_VOLUMETRIC, XML_3MF_ATTRIBUTE_MESH_VOLUMEDATA, pID->getModelResourceID());
 			}
@@ -339,14 +336,14 @@ namespace NMR {
 				if (m_pModelMeshObject->getBeamLatticeAttributes()->m_bHasClippingMeshID) {
 					writeStringAttribute(XML_3MF_ATTRIBUTE_BEAMLATTICE_CLIPPINGMODE, clipModeToString(m_pModelMeshObject->getBeamLatticeAttributes()->m_eClipMode));
 					PPackageResourceID pID = m_pModelMeshObject->getBeamLatticeAttributes()->m_pClippingMeshUniqueID;
-					if (pID->getPath() != m_pModel->currentPath())
+					if (pID->getPath() != m_sModelPath)
 						throw CNMRException(NMR_ERROR_MODELRESOURCE_IN_DIFFERENT_MODEL);
 					writeIntAttribute(XML_3MF_ATTRIBUTE_BEAMLATTICE_CLIPPINGMESH, pID->getModelResourceID());
 				}
 
 				if (m_pModelMeshObject->getBeamLatticeAttributes()->m_bHasRepresentationMeshID) {
 					PPackageResourceID pID = m_pModelMeshObject->getBeamLatticeAttributes()->m_pRepresentationUniqueID;
-					if (pID->getPath() != m_pModel->currentPath())
+					if (pID->getPath() != m_sModelPath)
 						throw CNMRException(NMR_ERROR_MODELRESOURCE_IN_DIFFERENT_MODEL);
 					writeIntAttribute(XML_3MF_ATTRIBUTE_BEAMLATTICE_REPRESENTATIONMESH, pID->getModelResourceID());
 				}
@@ -429,88 +426,12 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putFloat(_In_ const nfFloat fValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
 		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
-		nfInt64 nAbsValue = (nfInt64)(fValue * m_nPutDoubleFactor);
-		nAbsValue = MAX(nAbsValue, -nAbsValue);
-		nfBool bIsNegative = fValue < 0;
-
-		int nStart = nBufferPos;
-		int nCount = 0;
-
-		if (!nAbsValue) {
-			line[nBufferPos++] = '0';
-		}
-		else {
-			// Write the string in reverse order
-			while (nAbsValue || nCount < m_nPosAfterDecPoint) {
-				line[nBufferPos++] = '0' + (nAbsValue % 10);
-				nAbsValue /= 10;
-				nCount++;
-				if (nCount == m_nPosAfterDecPoint) {
-					line[nBufferPos++] = '.';
-					if (!nAbsValue) {
-						line[nBufferPos++] = '0';
-					}
-					nCount++;
-				}
-			}
-			if (bIsNegative) {
-				line[nBufferPos++] = '-';
-				nCount++;
-			}
-		}
-
-		// Reverse the float string
-		int nEnd = nBufferPos - 1;
-		while (nStart < nEnd) {
-			char temp = line[nStart];
-			line[nStart] = line[nEnd];
-			line[nEnd] = temp;
-			nStart++;
-			nEnd--;
-		}
+		nBufferPos += fnFormatFloatFixed(&line[nBufferPos], fValue, m_nPutDoubleFactor, m_nPosAfterDecPoint);
 	}
 
 	void CModelWriterNode100_Mesh::putDouble(_In_ const nfDouble dValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
-		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
-		nfInt64 nAbsValue = (nfInt64)(dValue * m_nPutDoubleFactor);
-		nAbsValue = MAX(nAbsValue, -nAbsValue);
-		nfBool bIsNegative = dValue < 0;
-
-		int nStart = nBufferPos;
-		int nCount = 0;
-
-		if (!nAbsValue) {
-			line[nBufferPos++] = '0';
-		}
-		else {
-			// Write the string in reverse order
-			while (nAbsValue || nCount < m_nPosAfterDecPoint) {
-				line[nBufferPos++] = '0' + (nAbsValue % 10);
-				nAbsValue /= 10;
-				nCount++;
-				if (nCount == m_nPosAfterDecPoint) {
-					line[nBufferPos++] = '.';
-					if (!nAbsValue) {
-						line[nBufferPos++] = '0';
-					}
-					nCount++;
-				}
-			}
-			if (bIsNegative) {
-				line[nBufferPos++] = '-';
-				nCount++;
-			}
-		}
-
-		// Reverse the float string
-		int nEnd = nBufferPos - 1;
-		while (nStart < nEnd) {
-			char temp = line[nStart];
-			line[nStart] = line[nEnd];
-			line[nEnd] = temp;
-			nStart++;
-			nEnd--;
-		}
+		// Format double with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
+		nBufferPos += fnFormatDoubleFixed(&line[nBufferPos], dValue, m_nPutDoubleFactor, m_nPosAfterDecPoint);
 	}
 
 	void CModelWriterNode100_Mesh::putVertexFloat(_In_ const nfFloat fValue)
@@ -535,16 +456,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putTriangleUInt32(_In_ const nfUint32 nValue)
 	{
-
-#ifdef __GNUC__
-		int nCount = sprintf(&m_TriangleLine[m_nTriangleBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_TriangleLine[m_nTriangleBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nTriangleBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nTriangleBufferPos += nCount;
+		m_nTriangleBufferPos += fnFormatUInt32(&m_TriangleLine[m_nTriangleBufferPos], nValue);
 	}
 
 
@@ -564,15 +476,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBeamUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BeamLine[m_nBeamBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BeamLine[m_nBeamBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBeamBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBeamBufferPos += nCount;
+		m_nBeamBufferPos += fnFormatUInt32(&m_BeamLine[m_nBeamBufferPos], nValue);
 	}
 
 	void CModelWriterNode100_Mesh::putBeamDouble(_In_ const nfDouble dValue)
@@ -596,15 +500,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBallUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BallLine[m_nBallBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BallLine[m_nBallBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBallBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBallBufferPos += nCount;
+		m_nBallBufferPos += fnFormatUInt32(&m_BallLine[m_nBallBufferPos], nValue);
 	}
 
 	void CModelWriterNode100_Mesh::putBallDouble(_In_ const nfDouble dValue)
@@ -628,15 +524,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBeamRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BeamRefLine[m_nBeamRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BeamRefLine[m_nBeamRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBeamRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBeamRefBufferPos += nCount;
+		m_nBeamRefBufferPos += fnFormatUInt32(&m_BeamRefLine[m_nBeamRefBufferPos], nValue);
 	}
 
 	void CModelWriterNode100_Mesh::putTriangleSetRefString(_In_ const nfChar* pszString)
@@ -655,15 +543,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putTriangleSetRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_TriangleSetRefLine[m_nTriangleSetRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_TriangleSetRefLine[m_nTriangleSetRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nTriangleSetRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nTriangleSetRefBufferPos += nCount;
+		m_nTriangleSetRefBufferPos += fnFormatUInt32(&m_TriangleSetRefLine[m_nTriangleSetRefBufferPos], nValue);
 	}
 
 
@@ -683,15 +563,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBallRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BallRefLine[m_nBallRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BallRefLine[m_nBallRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBallRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBallRefBufferPos += nCount;
+		m_nBallRefBufferPos += fnFormatUInt32(&m_BallRefLine[m_nBallRefBufferPos], nValue);
 	}
 
 	void CModelWriterNode100_Mesh::writeVertexData(_In_ MESHNODE * pNode)
@@ -66,11 +66,21 @@ This is the class for exporting the 3mf model stream root node.
 
 
 #include "Common/3MF_ProgressMonitor.h"
+#include "Common/Platform/NMR_ExportStream_Memory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 namespace NMR {
 
 	CModelWriterNode100_Model::CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor,
-		_In_ nfUint32 nDecimalPrecision, nfBool bWritesRootModel) : CModelWriterNode_ModelBase(pModel, pXMLWriter, pProgressMonitor), m_nDecimalPrecision(nDecimalPrecision)
+		_In_ nfUint32 nDecimalPrecision, nfBool bWritesRootModel) : CModelWriterNode_ModelBase(pModel, pXMLWriter, pProgressMonitor), m_nDecimalPrecision(nDecimalPrecision), m_nObjectThreadCount(1), m_pSortedObjectList(nullptr)
 	{
 		m_pPropertyIndexMapping = std::make_shared<CMeshInformation_PropertyIndexMapping>();
 		m_bIsRootModel = bWritesRootModel;
@@ -92,6 +102,16 @@ namespace NMR {
 		RegisterMetaDataNameSpaces();
 	}
 
+	void CModelWriterNode100_Model::setObjectThreadCount(_In_ nfUint32 nThreadCount)
+	{
+		m_nObjectThreadCount = nThreadCount;
+	}
+
+	void CModelWriterNode100_Model::setSortedObjectList(_In_ const std::list<CModelObject *> * pSortedObjectList)
+	{
+		m_pSortedObjectList = pSortedObjectList;
+	}
+
 	void CModelWriterNode100_Model::RegisterMetaDataGroupNameSpaces(PModelMetaDataGroup mdg)
 	{
 		for (nfUint32 i = 0; i < mdg->getMetaDataCount(); i++)
@@ -370,7 +390,7 @@ namespace NMR {
 
 		std::string sNameSpacePrefix = XML_3MF_NAMESPACEPREFIX_SLICE;
 
-		if (pSliceStackResource->OwnPath() == m_pModel->currentPath())
+		if (pSliceStackResource->OwnPath() == m_sModelPath)
 		{
 			writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICESTACKRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
 
@@ -385,7 +405,7 @@ namespace NMR {
 
 					writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEREFRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
 					writeIntAttribute(XML_3MF_ATTRIBUTE_SLICEREF_ID, sliceRef->getPackageResourceID()->getModelResourceID());
-					if (sliceRef->OwnPath() != m_pModel->currentPath()) {
+					if (sliceRef->OwnPath() != m_sModelPath) {
 						writeStringAttribute(XML_3MF_ATTRIBUTE_SLICEREF_PATH, sliceRef->OwnPath());
 					}
 					writeEndElement();
@@ -449,8 +469,9 @@ namespace NMR {
 
 	void CModelWriterNode100_Model::writeObjects()
 	{
-		std::list <CModelObject *> objectList = m_pModel->getSortedObjectList();
+		std::list <CModelObject *> objectList = (m_pSortedObjectList != nullptr) ? *m_pSortedObjectList : m_pModel->getSortedObjectList();
 
+		std::vector<CModelResource *> Resources;
 		for(auto iIterator = objectList.begin();
 			iIterator != objectList.end(); iIterator++)
 		{
@@ -459,15 +480,17 @@ namespace NMR {
 			{
 				throw CNMRException(NMR_ERROR_INVALIDMODEL);
 			}
-			writeObject(*pObject);
+			Resources.push_back(pObject);
 		}
+
+		writeResourceSequence(Resources);
     }
 
 	void CModelWriterNode100_Model::writeObject(CModelObject &object)
 	{
 		PPackageModelPath pPath =
 			object.getPackageResourceID()->getPackageModelPath();
-		if(m_pModel->currentModelPath()->getPath() != pPath->getPath())
+		if(m_sModelPath != pPath->getPath())
 		{
 			return;
 		}
@@ -477,6 +500,11 @@ namespace NMR {
 		m_pProgressMonitor->IncrementProgress(1);
 		m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 
+		writeObjectElement(object);
+	}
+
+	void CModelWriterNode100_Model::writeObjectElement(CModelObject &object)
+	{
 		writeStartElement(XML_3MF_ELEMENT_OBJECT);
 		// Write Object ID (mandatory)
 		writeIntAttribute(
@@ -614,6 +642,7 @@ namespace NMR {
 				m_pPropertyIndexMapping, m_nDecimalPrecision,
 				m_bWriteMaterialExtension, m_bWriteBeamLatticeExtension,
 				m_bWriteVolumetricExtension, m_bWriteTriangleSetExtension);
+			ModelWriter_Mesh.setModelPath(m_sModelPath);
 
 			ModelWriter_Mesh.writeToXML();
 		}
@@ -632,6 +661,7 @@ namespace NMR {
 		{
 			CModelWriterNode_LevelSet ModelWriter_LevelSet(
 				m_pModel, pLevelSet, m_pXMLWriter, m_pProgressMonitor);
+			ModelWriter_LevelSet.setModelPath(m_sModelPath);
 			ModelWriter_LevelSet.writeToXML();
 		}
 
@@ -1001,6 +1031,7 @@ namespace NMR {
     void CModelWriterNode100_Model::writeImplicitFunctions()
 	{
 		CModelWriterNode_Implicit implicitWriter(m_pModel, m_pXMLWriter, m_pProgressMonitor);
+		implicitWriter.setModelPath(m_sModelPath);
 		implicitWriter.writeImplicitFunctions();
 	}
 
@@ -1008,6 +1039,7 @@ namespace NMR {
 	{
 		CModelWriterNode_VolumeData volumeWriter(m_pModel, m_pXMLWriter,
 													m_pProgressMonitor);
+		volumeWriter.setModelPath(m_sModelPath);
 		volumeWriter.writeToXML();
 	}
 
@@ -1060,9 +1092,10 @@ namespace NMR {
 			CResourceDependencySorter sorter(m_pModel);
 			auto sortedResources = sorter.sort();
 
+			std::vector<CModelResource *> Resources;
 			for(auto &resId : sortedResources)
 			{
-				if(resId->getPath() != m_pModel->currentPath())
+				if(resId->getPath() != m_sModelPath)
 				{
 					continue;
 				}
@@ -1075,8 +1108,10 @@ namespace NMR {
 						NMR_ERROR_INVALID_RESOURCE_INDEX,
 						"Invalid Resource");
 				}
-				writeResource(pResource.get());
+				Resources.push_back(pResource.get());
 			}
+
+			writeResourceSequence(Resources);
         }
 		else {
 			if (m_bWriteSliceExtension) {
@@ -1098,6 +1133,8 @@ namespace NMR {
 		}
 		CModelWriterNode_Implicit implicitWriter(m_pModel, m_pXMLWriter, m_pProgressMonitor);
 		CModelWriterNode_VolumeData volumeWriter(m_pModel, m_pXMLWriter, m_pProgressMonitor);
+		implicitWriter.setModelPath(m_sModelPath);
+		volumeWriter.setModelPath(m_sModelPath);
 
 		CModelImage3D * pImage3DResource = dynamic_cast<CModelImage3D *>(pResource);
 		if (pImage3DResource)
@@ -1135,6 +1172,170 @@ namespace NMR {
 		}
 	}
 
+	void CModelWriterNode100_Model::writeResourceSequence(_In_ const std::vector<CModelResource *> & Resources)
+	{
+		nfUint32 nThreadCount = m_nObjectThreadCount;
+		if (nThreadCount == 0)
+			nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+		// Objects of the current part are formatted on worker threads into fragments of their own,
+		// which are inserted in resource order. Everything else is written on this thread.
+		std::vector<CModelObject *> Objects;
+		if (nThreadCount > 1) {
+			for (auto pResource : Resources) {
+				CModelObject * pObject = dynamic_cast<CModelObject *>(pResource);
+				if (pObject && (pObject->getPackageResourceID()->getPackageModelPath()->getPath() == m_sModelPath))
+					Objects.push_back(pObject);
+			}
+		}
+
+		if (Objects.size() < 2) {
+			for (auto pResource : Resources)
+				writeResource(pResource);
+			return;
+		}
+
+		struct sObjectFragment {
+			PExportStreamMemory m_pBuffer;
+			PXmlWriter m_pXMLWriter;
+			std::exception_ptr m_pException;
+			nfBool m_bDone;
+		};
+
+		std::vector<sObjectFragment> Fragments(Objects.size());
+		std::mutex Mutex;
+		std::condition_variable ReleasedCondition;
+		std::condition_variable DoneCondition;
+		std::atomic<bool> bAbort(false);
+		size_t nReleased = 0;
+		size_t nNextFragment = 0;
+
+		// Workers report to a monitor of their own, which only forwards the cancellation of this thread
+		auto fnFormatFragments = [&]() {
+			PProgressMonitor pMonitor = std::make_shared<CProgressMonitor>();
+			pMonitor->SetProgressCallback([&bAbort](int, ProgressIdentifier, void *) { return bAbort.load(); }, nullptr);
+
+			while (true) {
+				size_t nFragment;
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					ReleasedCondition.wait(Lock, [&]() { return bAbort || (nNextFragment >= Objects.size()) || (nNextFragment < nReleased); });
+					if (bAbort || (nNextFragment >= Objects.size()))
+						break;
+					nFragment = nNextFragment++;
+				}
+
+				sObjectFragment & Fragment = Fragments[nFragment];
+				try {
+					CModelWriterNode100_Model FragmentNode(*this);
+					FragmentNode.m_pXMLWriter = Fragment.m_pXMLWriter.get();
+					FragmentNode.m_pProgressMonitor = pMonitor;
+					FragmentNode.writeObjectElement(*Objects[nFragment]);
+				}
+				catch (...) {
+					Fragment.m_pException = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Fragment.m_bDone = true;
+				}
+				DoneCondition.notify_all();
+			}
+		};
+
+		std::vector<std::thread> Workers;
+		size_t nWorkerCount = std::min((size_t)nThreadCount, Objects.size());
+		for (size_t nWorker = 0; nWorker < nWorkerCount; nWorker++) {
+			try {
+				Workers.push_back(std::thread(fnFormatFragments));
+			}
+			catch (std::system_error &) {
+				// continue with the threads we have
+				break;
+			}
+		}
+
+		if (Workers.empty()) {
+			for (auto pResource : Resources)
+				writeResource(pResource);
+			return;
+		}
+
+		auto fnStopWorkers = [&]() {
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bAbort = true;
+			}
+			ReleasedCondition.notify_all();
+			for (auto & Worker : Workers)
+				Worker.join();
+		};
+
+		// Hands out fragments up to a window ahead of the writing position, which bounds the buffered output.
+		// Deferred meshes are loaded here, as their loader reads the package.
+		size_t nWindow = (size_t)nThreadCount * 2;
+		auto fnReleaseFragments = [&](size_t nCount) {
+			nCount = std::min(nCount, Objects.size());
+			while (nReleased < nCount) {
+				CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *>(Objects[nReleased]);
+				if (pMeshObject)
+					pMeshObject->getMesh();
+
+				sObjectFragment & Fragment = Fragments[nReleased];
+				Fragment.m_pBuffer = std::make_shared<CExportStreamMemory>();
+				Fragment.m_pXMLWriter = m_pXMLWriter->CreateFragmentWriter(Fragment.m_pBuffer);
+				Fragment.m_bDone = false;
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					nReleased++;
+				}
+				ReleasedCondition.notify_all();
+			}
+		};
+
+		try {
+			size_t nFragment = 0;
+			for (auto pResource : Resources) {
+				if ((nFragment >= Objects.size()) || (pResource != Objects[nFragment])) {
+					writeResource(pResource);
+					continue;
+				}
+
+				fnReleaseFragments(nFragment + nWindow);
+
+				sObjectFragment & Fragment = Fragments[nFragment];
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					while (!Fragment.m_bDone) {
+						if (!DoneCondition.wait_for(Lock, std::chrono::milliseconds(50), [&]() { return Fragment.m_bDone; })) {
+							Lock.unlock();
+							m_pProgressMonitor->QueryCancelled(true);
+							Lock.lock();
+						}
+					}
+				}
+				if (Fragment.m_pException)
+					std::rethrow_exception(Fragment.m_pException);
+
+				m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITEOBJECTS);
+				m_pProgressMonitor->IncrementProgress(1);
+				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+
+				m_pXMLWriter->WriteFragment(Fragment.m_pBuffer->getData(), Fragment.m_pBuffer->getDataSize());
+				Fragment.m_pXMLWriter = nullptr;
+				Fragment.m_pBuffer = nullptr;
+				nFragment++;
+			}
+		}
+		catch (...) {
+			fnStopWorkers();
+			throw;
+		}
+
+		fnStopWorkers();
+	}
+
 	void CModelWriterNode100_Model::writeBuild()
 	{
 		writeStartElement(XML_3MF_ELEMENT_BUILD);
@@ -1160,7 +1361,7 @@ namespace NMR {
 				PPackageResourceID pID = pObject->getPackageResourceID();
 
 				writeIntAttribute(XML_3MF_ATTRIBUTE_ITEM_OBJECTID, pID->getModelResourceID());
-				if (pID->getPath() != m_pModel->currentPath())
+				if (pID->getPath() != m_sModelPath)
 					writePrefixedStringAttribute(XML_3MF_NAMESPACEPREFIX_PRODUCTION, XML_3MF_PRODUCTION_PATH, pID->getPath());
 
 				if (!pBuildItem->getPartNumber().empty())
@@ -1204,8 +1405,8 @@ namespace NMR {
 			writeStartElement(XML_3MF_ELEMENT_COMPONENT);
 			PPackageResourceID pObjectID = pComponent->getObject()->getPackageResourceID();
 			writeIntAttribute(XML_3MF_ATTRIBUTE_COMPONENT_OBJECTID, pObjectID->getModelResourceID());
-			if (pObjectID->getPath() != m_pModel->currentPath()) {
-				if (m_pModel->currentPath() != m_pModel->rootPath()) {
+			if (pObjectID->getPath() != m_sModelPath) {
+				if (m_sModelPath != m_pModel->rootPath()) {
 					throw CNMRException(NMR_ERROR_REFERENCESTOODEEP);
 				}
 				if (m_bWriteProductionExtension) {
@@ -0,0 +1,77 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Generators.h: Synthetic models of configurable size for the lib3mf
+benchmarks.
+
+--*/
+
+#ifndef __BENCHMARK_GENERATORS
+#define __BENCHMARK_GENERATORS
+
+#include "lib3mf_implicit.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Lib3MFBenchmark {
+
+	// A generated model, together with the number of elements that dominate its size
+	struct sBenchmarkModel {
+		Lib3MF::PModel m_pModel;
+		Lib3MF_uint64 m_nItems;
+		std::string m_sItemUnit;
+	};
+
+	// Creates a tessellated height field with at least nTriangles triangles (rounded up to a square grid)
+	void createGridGeometry(Lib3MF_uint32 nTriangles, std::vector<Lib3MF::sPosition> & vertices, std::vector<Lib3MF::sTriangle> & triangles);
+
+	// A single grid mesh; with properties every triangle references three colors of a large color group
+	sBenchmarkModel createMeshModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nTriangles, bool bWithProperties);
+
+	// A cubic lattice of about nBeams beams inside a box hull
+	sBenchmarkModel createBeamLatticeModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nBeams);
+
+	// A components object that places nComponents instances of a small mesh
+	sBenchmarkModel createComponentsModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nComponents);
+
+	// A box mesh with a slice stack of nSlices slices, each holding one closed polygon
+	sBenchmarkModel createSliceModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nSlices);
+
+	// A level set whose implicit function is a chain of about nNodes nodes
+	sBenchmarkModel createImplicitModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nNodes);
+
+	// An implicit function of about nNodes nodes whose links are all added by port names
+	sBenchmarkModel createImplicitGraphModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nNodes);
+
+	// A gyroid level set in a box that is meshed with about nCellsPerAxis grid cells along each axis
+	sBenchmarkModel createGyroidModel(Lib3MF::PWrapper pWrapper, Lib3MF_uint32 nCellsPerAxis);
+
+}
+
+#endif // __BENCHMARK_GENERATORS
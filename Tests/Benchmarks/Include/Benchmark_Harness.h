@@ -0,0 +1,107 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Harness.h: Self-contained harness of the lib3mf benchmarks. Measures
+the best and mean time of repeated iterations, the peak resident set size, and
+writes the results as machine-readable JSON.
+
+--*/
+
+#ifndef __BENCHMARK_HARNESS
+#define __BENCHMARK_HARNESS
+
+#include "lib3mf_implicit.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Lib3MFBenchmark {
+
+	struct sBenchmarkOptions {
+		Lib3MF_uint32 m_nIterations;
+		Lib3MF_uint32 m_nTriangles;
+		Lib3MF_uint32 m_nBeams;
+		Lib3MF_uint32 m_nComponents;
+		Lib3MF_uint32 m_nSlices;
+		Lib3MF_uint32 m_nImplicitNodes;
+		Lib3MF_uint32 m_nGraphNodes;
+		Lib3MF_uint32 m_nPoints;
+		Lib3MF_uint32 m_nLevelSetCells;
+		std::string m_sFilter;
+		std::string m_sJSONPath;
+	};
+
+	struct sBenchmarkResult {
+		std::string m_sName;
+		Lib3MF_uint32 m_nIterations;
+		double m_dBestSeconds;
+		double m_dMeanSeconds;
+		Lib3MF_uint64 m_nItems;
+		std::string m_sItemUnit;
+		Lib3MF_uint64 m_nBytes;
+		Lib3MF_uint64 m_nPeakRSS;
+	};
+
+	class CBenchmarkSuite {
+	private:
+		Lib3MF::PWrapper m_pWrapper;
+		sBenchmarkOptions m_Options;
+		std::vector<sBenchmarkResult> m_Results;
+
+	public:
+		CBenchmarkSuite(Lib3MF::PWrapper pWrapper, const sBenchmarkOptions & Options);
+
+		Lib3MF::PWrapper wrapper();
+		const sBenchmarkOptions & options();
+
+		// Returns true if the name contains the filter of the options (an empty filter selects everything)
+		bool isSelected(const std::string & sName);
+
+		// Calls fnIteration once per iteration; fnIteration returns the seconds it measured, so that setup is not timed
+		void run(const std::string & sName, Lib3MF_uint64 nItems, const std::string & sItemUnit, Lib3MF_uint64 nBytes, const std::function<double()> & fnIteration);
+
+		const std::vector<sBenchmarkResult> & results();
+
+		void writeJSON(const std::string & sPath);
+	};
+
+	// Resets the peak resident set size of the process, returns false if the platform cannot reset it
+	bool resetPeakRSS();
+
+	// Returns the peak resident set size of the process in bytes, or 0 if it is unknown
+	Lib3MF_uint64 queryPeakRSS();
+
+	// Benchmark groups
+	void runMeshReaderBenchmarks(CBenchmarkSuite & suite);
+	void runModelBenchmarks(CBenchmarkSuite & suite);
+	void runNumberFormatBenchmarks(CBenchmarkSuite & suite);
+
+}
+
+#endif // __BENCHMARK_HARNESS
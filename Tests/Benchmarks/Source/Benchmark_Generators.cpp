@@ -0,0 +1,395 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Generators.cpp: Implements the synthetic models of the lib3mf
+benchmarks.
+
+--*/
+
+#include "Benchmark_Generators.h"
+
+#include <cmath>
+
+using namespace Lib3MF;
+
+namespace Lib3MFBenchmark {
+
+	static sPosition makePosition(float fX, float fY, float fZ)
+	{
+		sPosition position;
+		position.m_Coordinates[0] = fX;
+		position.m_Coordinates[1] = fY;
+		position.m_Coordinates[2] = fZ;
+		return position;
+	}
+
+	static sTriangle makeTriangle(Lib3MF_uint32 nIndex1, Lib3MF_uint32 nIndex2, Lib3MF_uint32 nIndex3)
+	{
+		sTriangle triangle;
+		triangle.m_Indices[0] = nIndex1;
+		triangle.m_Indices[1] = nIndex2;
+		triangle.m_Indices[2] = nIndex3;
+		return triangle;
+	}
+
+	// Appends a closed, outward oriented box
+	static void addBox(std::vector<sPosition> & vertices, std::vector<sTriangle> & triangles, float fMinX, float fMinY, float fMinZ, float fMaxX, float fMaxY, float fMaxZ)
+	{
+		Lib3MF_uint32 nBase = (Lib3MF_uint32)vertices.size();
+		vertices.push_back(makePosition(fMinX, fMinY, fMinZ));
+		vertices.push_back(makePosition(fMaxX, fMinY, fMinZ));
+		vertices.push_back(makePosition(fMaxX, fMaxY, fMinZ));
+		vertices.push_back(makePosition(fMinX, fMaxY, fMinZ));
+		vertices.push_back(makePosition(fMinX, fMinY, fMaxZ));
+		vertices.push_back(makePosition(fMaxX, fMinY, fMaxZ));
+		vertices.push_back(makePosition(fMaxX, fMaxY, fMaxZ));
+		vertices.push_back(makePosition(fMinX, fMaxY, fMaxZ));
+
+		const Lib3MF_uint32 boxIndices[12][3] = {
+			{ 0, 2, 1 }, { 0, 3, 2 }, { 4, 5, 6 }, { 4, 6, 7 },
+			{ 0, 1, 5 }, { 0, 5, 4 }, { 3, 7, 6 }, { 3, 6, 2 },
+			{ 0, 4, 7 }, { 0, 7, 3 }, { 1, 2, 6 }, { 1, 6, 5 }
+		};
+		for (const auto & indices : boxIndices)
+			triangles.push_back(makeTriangle(nBase + indices[0], nBase + indices[1], nBase + indices[2]));
+	}
+
+	static PMeshObject addBoxMesh(PModel pModel, float fSizeX, float fSizeY, float fSizeZ)
+	{
+		std::vector<sPosition> vertices;
+		std::vector<sTriangle> triangles;
+		addBox(vertices, triangles, 0.0f, 0.0f, 0.0f, fSizeX, fSizeY, fSizeZ);
+
+		PMeshObject pMeshObject = pModel->AddMeshObject();
+		pMeshObject->SetGeometry(vertices, triangles);
+		return pMeshObject;
+	}
+
+	void createGridGeometry(Lib3MF_uint32 nTriangles, std::vector<sPosition> & vertices, std::vector<sTriangle> & triangles)
+	{
+		Lib3MF_uint32 nQuadsPerRow = 1;
+		while ((nQuadsPerRow * nQuadsPerRow * 2) < nTriangles)
+			nQuadsPerRow++;
+
+		vertices.clear();
+		triangles.clear();
+		vertices.reserve((size_t)(nQuadsPerRow + 1) * (nQuadsPerRow + 1));
+		triangles.reserve((size_t)nQuadsPerRow * nQuadsPerRow * 2);
+
+		for (Lib3MF_uint32 nY = 0; nY <= nQuadsPerRow; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX <= nQuadsPerRow; nX++)
+				vertices.push_back(makePosition(nX * 0.125f, nY * 0.125f, (float)((nX * 7 + nY * 13) % 17) * 0.0625f));
+		}
+
+		for (Lib3MF_uint32 nY = 0; nY < nQuadsPerRow; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nQuadsPerRow; nX++) {
+				Lib3MF_uint32 nBase = nY * (nQuadsPerRow + 1) + nX;
+				triangles.push_back(makeTriangle(nBase, nBase + 1, nBase + nQuadsPerRow + 1));
+				triangles.push_back(makeTriangle(nBase + 1, nBase + nQuadsPerRow + 2, nBase + nQuadsPerRow + 1));
+			}
+		}
+	}
+
+	sBenchmarkModel createMeshModel(PWrapper pWrapper, Lib3MF_uint32 nTriangles, bool bWithProperties)
+	{
+		std::vector<sPosition> vertices;
+		std::vector<sTriangle> triangles;
+		createGridGeometry(nTriangles, vertices, triangles);
+
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_nItems = triangles.size();
+		result.m_sItemUnit = "triangles";
+
+		PMeshObject pMeshObject = result.m_pModel->AddMeshObject();
+		pMeshObject->SetGeometry(vertices, triangles);
+
+		if (bWithProperties) {
+			const Lib3MF_uint32 nColorCount = 256;
+			PColorGroup pColorGroup = result.m_pModel->AddColorGroup();
+			std::vector<Lib3MF_uint32> colorIDs(nColorCount);
+			for (Lib3MF_uint32 nColor = 0; nColor < nColorCount; nColor++)
+				colorIDs[nColor] = pColorGroup->AddColor(pWrapper->RGBAToColor((Lib3MF_uint8)nColor, (Lib3MF_uint8)(255 - nColor), (Lib3MF_uint8)(nColor * 7), 255));
+
+			std::vector<sTriangleProperties> properties(triangles.size());
+			for (size_t nIndex = 0; nIndex < properties.size(); nIndex++) {
+				properties[nIndex].m_ResourceID = pColorGroup->GetResourceID();
+				for (Lib3MF_uint32 nCorner = 0; nCorner < 3; nCorner++)
+					properties[nIndex].m_PropertyIDs[nCorner] = colorIDs[(nIndex + nCorner * 85) % nColorCount];
+			}
+			pMeshObject->SetObjectLevelProperty(pColorGroup->GetResourceID(), colorIDs[0]);
+			pMeshObject->SetAllTriangleProperties(properties);
+		}
+
+		result.m_pModel->AddBuildItem(pMeshObject.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createBeamLatticeModel(PWrapper pWrapper, Lib3MF_uint32 nBeams)
+	{
+		// n^3 nodes connected along the three axes give 3 n^2 (n - 1) beams
+		Lib3MF_uint32 nNodesPerAxis = 2;
+		while (3 * (Lib3MF_uint64)nNodesPerAxis * nNodesPerAxis * (nNodesPerAxis - 1) < nBeams)
+			nNodesPerAxis++;
+
+		std::vector<sPosition> vertices;
+		std::vector<sTriangle> triangles;
+		addBox(vertices, triangles, -1.0f, -1.0f, -1.0f, (float)nNodesPerAxis, (float)nNodesPerAxis, (float)nNodesPerAxis);
+
+		Lib3MF_uint32 nFirstNode = (Lib3MF_uint32)vertices.size();
+		for (Lib3MF_uint32 nZ = 0; nZ < nNodesPerAxis; nZ++)
+			for (Lib3MF_uint32 nY = 0; nY < nNodesPerAxis; nY++)
+				for (Lib3MF_uint32 nX = 0; nX < nNodesPerAxis; nX++)
+					vertices.push_back(makePosition((float)nX, (float)nY, (float)nZ));
+
+		sBeam beam;
+		beam.m_Radii[0] = 0.1;
+		beam.m_Radii[1] = 0.05;
+		beam.m_CapModes[0] = eBeamLatticeCapMode::Sphere;
+		beam.m_CapModes[1] = eBeamLatticeCapMode::Butt;
+
+		std::vector<sBeam> beams;
+		beams.reserve(3 * (size_t)nNodesPerAxis * nNodesPerAxis * (nNodesPerAxis - 1));
+		const Lib3MF_uint32 strides[3] = { 1, nNodesPerAxis, nNodesPerAxis * nNodesPerAxis };
+		for (Lib3MF_uint32 nZ = 0; nZ < nNodesPerAxis; nZ++) {
+			for (Lib3MF_uint32 nY = 0; nY < nNodesPerAxis; nY++) {
+				for (Lib3MF_uint32 nX = 0; nX < nNodesPerAxis; nX++) {
+					const Lib3MF_uint32 coordinates[3] = { nX, nY, nZ };
+					Lib3MF_uint32 nNode = nFirstNode + nX + nY * strides[1] + nZ * strides[2];
+					for (Lib3MF_uint32 nAxis = 0; nAxis < 3; nAxis++) {
+						if (coordinates[nAxis] + 1 < nNodesPerAxis) {
+							beam.m_Indices[0] = nNode;
+							beam.m_Indices[1] = nNode + strides[nAxis];
+							beams.push_back(beam);
+						}
+					}
+				}
+			}
+		}
+
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_nItems = beams.size();
+		result.m_sItemUnit = "beams";
+
+		PMeshObject pMeshObject = result.m_pModel->AddMeshObject();
+		pMeshObject->SetGeometry(vertices, triangles);
+		PBeamLattice pBeamLattice = pMeshObject->BeamLattice();
+		pBeamLattice->SetMinLength(0.0001);
+		pBeamLattice->SetBeams(beams);
+
+		result.m_pModel->AddBuildItem(pMeshObject.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createComponentsModel(PWrapper pWrapper, Lib3MF_uint32 nComponents)
+	{
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_nItems = nComponents;
+		result.m_sItemUnit = "components";
+
+		PMeshObject pMeshObject = addBoxMesh(result.m_pModel, 1.0f, 1.0f, 1.0f);
+		PComponentsObject pComponentsObject = result.m_pModel->AddComponentsObject();
+
+		Lib3MF_uint32 nPerRow = (Lib3MF_uint32)std::ceil(std::sqrt((double)nComponents));
+		sTransform transform = pWrapper->GetIdentityTransform();
+		for (Lib3MF_uint32 nComponent = 0; nComponent < nComponents; nComponent++) {
+			transform.m_Fields[3][0] = (float)(nComponent % nPerRow) * 2.0f;
+			transform.m_Fields[3][1] = (float)(nComponent / nPerRow) * 2.0f;
+			pComponentsObject->AddComponent(pMeshObject.get(), transform);
+		}
+
+		result.m_pModel->AddBuildItem(pComponentsObject.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createSliceModel(PWrapper pWrapper, Lib3MF_uint32 nSlices)
+	{
+		const Lib3MF_uint32 nPolygonVertices = 64;
+		const double dLayerHeight = 0.1;
+		const double dPi = 3.14159265358979323846;
+
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_nItems = nSlices;
+		result.m_sItemUnit = "slices";
+
+		PSliceStack pSliceStack = result.m_pModel->AddSliceStack(0.0);
+		std::vector<sPosition2D> vertices(nPolygonVertices);
+		std::vector<Lib3MF_uint32> indices(nPolygonVertices + 1);
+		for (Lib3MF_uint32 nIndex = 0; nIndex <= nPolygonVertices; nIndex++)
+			indices[nIndex] = nIndex % nPolygonVertices;
+
+		for (Lib3MF_uint32 nSlice = 0; nSlice < nSlices; nSlice++) {
+			float fRadius = 3.0f + (float)(nSlice % 10) * 0.1f;
+			for (Lib3MF_uint32 nIndex = 0; nIndex < nPolygonVertices; nIndex++) {
+				double dAngle = 2.0 * dPi * nIndex / nPolygonVertices;
+				vertices[nIndex].m_Coordinates[0] = 5.0f + fRadius * (float)std::cos(dAngle);
+				vertices[nIndex].m_Coordinates[1] = 5.0f + fRadius * (float)std::sin(dAngle);
+			}
+
+			PSlice pSlice = pSliceStack->AddSlice((nSlice + 1) * dLayerHeight);
+			pSlice->SetVertices(vertices);
+			pSlice->AddPolygon(indices);
+		}
+
+		PMeshObject pMeshObject = addBoxMesh(result.m_pModel, 10.0f, 10.0f, (float)(nSlices * dLayerHeight));
+		pMeshObject->AssignSliceStack(pSliceStack.get());
+
+		result.m_pModel->AddBuildItem(pMeshObject.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createImplicitModel(PWrapper pWrapper, Lib3MF_uint32 nNodes)
+	{
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_sItemUnit = "nodes";
+
+		PImplicitFunction pFunction = result.m_pModel->AddImplicitFunction();
+		pFunction->SetDisplayName("chain");
+		PImplicitPort pPosition = pFunction->AddInput("pos", "position", eImplicitPortType::Vector);
+
+		PDecomposeVectorNode pDecompose = pFunction->AddDecomposeVectorNode("decompose", "decompose pos", "");
+		pFunction->AddLink(pPosition, pDecompose->GetInputA());
+
+		// x + c_1 + c_2 + ..., every step adds a constant and an addition node
+		PImplicitPort pValue = pDecompose->GetOutputX();
+		Lib3MF_uint32 nSteps = (nNodes > 3) ? ((nNodes - 1) / 2) : 1;
+		for (Lib3MF_uint32 nStep = 0; nStep < nSteps; nStep++) {
+			std::string sStep = std::to_string(nStep);
+			PConstantNode pConstant = pFunction->AddConstantNode("c" + sStep, "constant " + sStep, "");
+			pConstant->SetConstant(0.001 * (nStep % 7));
+
+			PAdditionNode pAddition = pFunction->AddAdditionNode("a" + sStep, eImplicitNodeConfiguration::ScalarToScalar, "addition " + sStep, "");
+			pFunction->AddLink(pValue, pAddition->GetInputA());
+			pFunction->AddLink(pConstant->GetOutputValue(), pAddition->GetInputB());
+			pValue = pAddition->GetOutputResult();
+		}
+
+		PImplicitPort pOutput = pFunction->AddOutput("shape", "signed distance", eImplicitPortType::Scalar);
+		pFunction->AddLink(pValue, pOutput);
+		result.m_nItems = 1 + 2 * (Lib3MF_uint64)nSteps;
+
+		PLevelSet pLevelSet = result.m_pModel->AddLevelSet();
+		pLevelSet->SetMesh(addBoxMesh(result.m_pModel, 10.0f, 10.0f, 10.0f));
+		pLevelSet->SetFunction(pFunction.get());
+		pLevelSet->SetChannelName("shape");
+		pLevelSet->SetMinFeatureSize(0.1);
+
+		result.m_pModel->AddBuildItem(pLevelSet.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createImplicitGraphModel(PWrapper pWrapper, Lib3MF_uint32 nNodes)
+	{
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_sItemUnit = "nodes";
+
+		PImplicitFunction pFunction = result.m_pModel->AddImplicitFunction();
+		pFunction->SetDisplayName("graph");
+		pFunction->AddInput("pos", "position", eImplicitPortType::Vector);
+		pFunction->AddDecomposeVectorNode("decompose", "decompose pos", "");
+		pFunction->AddLinkByNames("inputs.pos", "decompose.A");
+
+		// Step k adds the constant c_k to step k - 1 and the minimum of step k / 2,
+		// so that links also reach back to nodes far from the end of the graph
+		Lib3MF_uint32 nSteps = (nNodes > 4) ? ((nNodes - 1) / 3) : 1;
+		std::string sPrevious = "decompose.x";
+		for (Lib3MF_uint32 nStep = 0; nStep < nSteps; nStep++) {
+			std::string sStep = std::to_string(nStep);
+			pFunction->AddConstantNode("c" + sStep, "constant " + sStep, "")->SetConstant(0.001 * (nStep % 7));
+			pFunction->AddAdditionNode("a" + sStep, eImplicitNodeConfiguration::ScalarToScalar, "addition " + sStep, "");
+			pFunction->AddMinNode("m" + sStep, eImplicitNodeConfiguration::ScalarToScalar, "minimum " + sStep, "");
+			pFunction->AddLinkByNames(sPrevious, "a" + sStep + ".A");
+			pFunction->AddLinkByNames("c" + sStep + ".value", "a" + sStep + ".B");
+			pFunction->AddLinkByNames("a" + sStep + ".result", "m" + sStep + ".A");
+			pFunction->AddLinkByNames("a" + std::to_string(nStep / 2) + ".result", "m" + sStep + ".B");
+			sPrevious = "m" + sStep + ".result";
+		}
+
+		pFunction->AddOutput("shape", "signed distance", eImplicitPortType::Scalar);
+		pFunction->AddLinkByNames(sPrevious, "outputs.shape");
+		result.m_nItems = 1 + 3 * (Lib3MF_uint64)nSteps;
+
+		PLevelSet pLevelSet = result.m_pModel->AddLevelSet();
+		pLevelSet->SetMesh(addBoxMesh(result.m_pModel, 10.0f, 10.0f, 10.0f));
+		pLevelSet->SetFunction(pFunction.get());
+		pLevelSet->SetChannelName("shape");
+		pLevelSet->SetMinFeatureSize(0.1);
+
+		result.m_pModel->AddBuildItem(pLevelSet.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+	sBenchmarkModel createGyroidModel(PWrapper pWrapper, Lib3MF_uint32 nCellsPerAxis)
+	{
+		const double dSize = 100.0;
+
+		sBenchmarkModel result;
+		result.m_pModel = pWrapper->CreateModel();
+		result.m_sItemUnit = "cells";
+
+		// sin(x) cos(y) + sin(y) cos(z) + sin(z) cos(x)
+		PImplicitFunction pFunction = result.m_pModel->AddImplicitFunction();
+		pFunction->SetDisplayName("gyroid");
+		PImplicitPort pPosition = pFunction->AddInput("pos", "position", eImplicitPortType::Vector);
+
+		PDecomposeVectorNode pDecompose = pFunction->AddDecomposeVectorNode("decompose", "decompose pos", "");
+		pFunction->AddLink(pPosition, pDecompose->GetInputA());
+		PComposeVectorNode pCompose = pFunction->AddComposeVectorNode("compose", "compose yzx", "");
+		pFunction->AddLink(pDecompose->GetOutputY(), pCompose->GetInputX());
+		pFunction->AddLink(pDecompose->GetOutputZ(), pCompose->GetInputY());
+		pFunction->AddLink(pDecompose->GetOutputX(), pCompose->GetInputZ());
+
+		PSinNode pSin = pFunction->AddSinNode("sin", eImplicitNodeConfiguration::VectorToVector, "sin pos", "");
+		pFunction->AddLink(pPosition, pSin->GetInputA());
+		PCosNode pCos = pFunction->AddCosNode("cos", eImplicitNodeConfiguration::VectorToVector, "cos yzx", "");
+		pFunction->AddLink(pCompose->GetOutputResult(), pCos->GetInputA());
+		PDotNode pDot = pFunction->AddDotNode("dot", "dot", "");
+		pFunction->AddLink(pSin->GetOutputResult(), pDot->GetInputA());
+		pFunction->AddLink(pCos->GetOutputResult(), pDot->GetInputB());
+
+		PImplicitPort pOutput = pFunction->AddOutput("shape", "gyroid", eImplicitPortType::Scalar);
+		pFunction->AddLink(pDot->GetOutputResult(), pOutput);
+
+		// The mesher samples with half the minimal feature size
+		PLevelSet pLevelSet = result.m_pModel->AddLevelSet();
+		pLevelSet->SetMesh(addBoxMesh(result.m_pModel, (float)dSize, (float)dSize, (float)dSize));
+		pLevelSet->SetFunction(pFunction.get());
+		pLevelSet->SetChannelName("shape");
+		pLevelSet->SetMinFeatureSize(2.0 * dSize / nCellsPerAxis);
+		result.m_nItems = (Lib3MF_uint64)nCellsPerAxis * nCellsPerAxis * nCellsPerAxis;
+
+		result.m_pModel->AddBuildItem(pLevelSet.get(), pWrapper->GetIdentityTransform());
+		return result;
+	}
+
+}
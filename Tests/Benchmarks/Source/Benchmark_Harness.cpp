@@ -0,0 +1,241 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Harness.cpp: Implements the timing, peak memory and JSON output of
+the benchmark harness.
+
+--*/
+
+#include "Benchmark_Harness.h"
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <cstdlib>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Lib3MFBenchmark {
+
+	bool resetPeakRSS()
+	{
+#if defined(__linux__)
+		// Writing 5 to clear_refs resets VmHWM to the current resident set size (Linux 4.0 and later)
+		std::ofstream clearRefs("/proc/self/clear_refs");
+		if (!clearRefs)
+			return false;
+		clearRefs << "5";
+		clearRefs.flush();
+		return clearRefs.good();
+#else
+		return false;
+#endif
+	}
+
+	Lib3MF_uint64 queryPeakRSS()
+	{
+#if defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS counters;
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return 0;
+		return (Lib3MF_uint64)counters.PeakWorkingSetSize;
+#elif defined(__linux__)
+		std::ifstream status("/proc/self/status");
+		std::string sLine;
+		while (std::getline(status, sLine)) {
+			if (sLine.compare(0, 6, "VmHWM:") == 0)
+				return (Lib3MF_uint64)strtoull(sLine.c_str() + 6, nullptr, 10) * 1024;
+		}
+		return 0;
+#else
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+#if defined(__APPLE__)
+		return (Lib3MF_uint64)usage.ru_maxrss;
+#else
+		return (Lib3MF_uint64)usage.ru_maxrss * 1024;
+#endif
+#endif
+	}
+
+	CBenchmarkSuite::CBenchmarkSuite(Lib3MF::PWrapper pWrapper, const sBenchmarkOptions & Options)
+		: m_pWrapper(pWrapper), m_Options(Options)
+	{
+		if (!pWrapper)
+			throw std::invalid_argument("invalid wrapper");
+		if (m_Options.m_nIterations == 0)
+			m_Options.m_nIterations = 1;
+	}
+
+	Lib3MF::PWrapper CBenchmarkSuite::wrapper()
+	{
+		return m_pWrapper;
+	}
+
+	const sBenchmarkOptions & CBenchmarkSuite::options()
+	{
+		return m_Options;
+	}
+
+	bool CBenchmarkSuite::isSelected(const std::string & sName)
+	{
+		return m_Options.m_sFilter.empty() || (sName.find(m_Options.m_sFilter) != std::string::npos);
+	}
+
+	void CBenchmarkSuite::run(const std::string & sName, Lib3MF_uint64 nItems, const std::string & sItemUnit, Lib3MF_uint64 nBytes, const std::function<double()> & fnIteration)
+	{
+		if (!isSelected(sName))
+			return;
+
+		resetPeakRSS();
+
+		sBenchmarkResult result;
+		result.m_sName = sName;
+		result.m_nIterations = m_Options.m_nIterations;
+		result.m_dBestSeconds = 0.0;
+		result.m_nItems = nItems;
+		result.m_sItemUnit = sItemUnit;
+		result.m_nBytes = nBytes;
+
+		double dTotal = 0.0;
+		for (Lib3MF_uint32 nIteration = 0; nIteration < m_Options.m_nIterations; nIteration++) {
+			double dSeconds = fnIteration();
+			if ((nIteration == 0) || (dSeconds < result.m_dBestSeconds))
+				result.m_dBestSeconds = dSeconds;
+			dTotal += dSeconds;
+		}
+		result.m_dMeanSeconds = dTotal / m_Options.m_nIterations;
+		result.m_nPeakRSS = queryPeakRSS();
+
+		std::cout << sName << ": " << nItems << " " << sItemUnit;
+		if (nBytes > 0)
+			std::cout << ", " << nBytes << " bytes";
+		std::cout << ", best " << result.m_dBestSeconds << " s, mean " << result.m_dMeanSeconds << " s";
+		if (result.m_dBestSeconds > 0.0)
+			std::cout << ", " << (nItems / result.m_dBestSeconds / 1.0e6) << " M" << sItemUnit << "/s";
+		std::cout << ", peak RSS " << (result.m_nPeakRSS / (1024 * 1024)) << " MB" << std::endl;
+
+		m_Results.push_back(result);
+	}
+
+	const std::vector<sBenchmarkResult> & CBenchmarkSuite::results()
+	{
+		return m_Results;
+	}
+
+	static std::string escapeJSON(const std::string & sValue)
+	{
+		std::string sResult;
+		for (char cChar : sValue) {
+			if ((cChar == '"') || (cChar == '\\')) {
+				sResult += '\\';
+				sResult += cChar;
+			}
+			else if ((unsigned char)cChar < 0x20) {
+				char buffer[8];
+				snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned int)cChar);
+				sResult += buffer;
+			}
+			else
+				sResult += cChar;
+		}
+		return sResult;
+	}
+
+	void CBenchmarkSuite::writeJSON(const std::string & sPath)
+	{
+		std::ofstream stream(sPath);
+		if (!stream)
+			throw std::runtime_error("could not create " + sPath);
+
+		Lib3MF_uint32 nMajor, nMinor, nMicro;
+		m_pWrapper->GetLibraryVersion(nMajor, nMinor, nMicro);
+
+		char dateBuffer[32] = { 0 };
+		std::time_t now = std::time(nullptr);
+		std::strftime(dateBuffer, sizeof(dateBuffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+		stream << std::setprecision(9);
+		stream << "{\n";
+		stream << "  \"context\": {\n";
+		stream << "    \"date\": \"" << dateBuffer << "\",\n";
+		stream << "    \"library_version\": \"" << nMajor << "." << nMinor << "." << nMicro << "\",\n";
+		stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+		stream << "    \"iterations\": " << m_Options.m_nIterations << ",\n";
+		stream << "    \"triangles\": " << m_Options.m_nTriangles << ",\n";
+		stream << "    \"beams\": " << m_Options.m_nBeams << ",\n";
+		stream << "    \"components\": " << m_Options.m_nComponents << ",\n";
+		stream << "    \"slices\": " << m_Options.m_nSlices << ",\n";
+		stream << "    \"implicit_nodes\": " << m_Options.m_nImplicitNodes << ",\n";
+		stream << "    \"graph_nodes\": " << m_Options.m_nGraphNodes << ",\n";
+		stream << "    \"points\": " << m_Options.m_nPoints << ",\n";
+		stream << "    \"levelset_cells\": " << m_Options.m_nLevelSetCells << ",\n";
+		stream << "    \"filter\": \"" << escapeJSON(m_Options.m_sFilter) << "\"\n";
+		stream << "  },\n";
+		stream << "  \"benchmarks\": [";
+
+		for (size_t nIndex = 0; nIndex < m_Results.size(); nIndex++) {
+			const sBenchmarkResult & result = m_Results[nIndex];
+			double dItemsPerSecond = (result.m_dBestSeconds > 0.0) ? (result.m_nItems / result.m_dBestSeconds) : 0.0;
+			double dBytesPerSecond = (result.m_dBestSeconds > 0.0) ? (result.m_nBytes / result.m_dBestSeconds) : 0.0;
+
+			stream << ((nIndex > 0) ? ",\n" : "\n");
+			stream << "    {\n";
+			stream << "      \"name\": \"" << escapeJSON(result.m_sName) << "\",\n";
+			stream << "      \"iterations\": " << result.m_nIterations << ",\n";
+			stream << "      \"real_time\": " << result.m_dBestSeconds << ",\n";
+			stream << "      \"mean_time\": " << result.m_dMeanSeconds << ",\n";
+			stream << "      \"time_unit\": \"s\",\n";
+			stream << "      \"items\": " << result.m_nItems << ",\n";
+			stream << "      \"item_unit\": \"" << escapeJSON(result.m_sItemUnit) << "\",\n";
+			stream << "      \"items_per_second\": " << dItemsPerSecond << ",\n";
+			stream << "      \"bytes\": " << result.m_nBytes << ",\n";
+			stream << "      \"bytes_per_second\": " << dBytesPerSecond << ",\n";
+			stream << "      \"peak_rss_bytes\": " << result.m_nPeakRSS << "\n";
+			stream << "    }";
+		}
+
+		stream << "\n  ]\n";
+		stream << "}\n";
+
+		if (!stream)
+			throw std::runtime_error("could not write " + sPath);
+	}
+
+}
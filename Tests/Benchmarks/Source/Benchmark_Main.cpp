@@ -0,0 +1,124 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Main.cpp: Command line of the lib3mf benchmarks.
+
+--*/
+
+#include "Benchmark_Harness.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace Lib3MFBenchmark;
+
+static void printUsage(const char * pszProgram)
+{
+	std::cerr << "usage: " << pszProgram << " [options]" << std::endl
+		<< "  --iterations N      repetitions of every benchmark (default 3)" << std::endl
+		<< "  --triangles N       triangles of the mesh models (default 2000000)" << std::endl
+		<< "  --beams N           beams of the beam lattice model (default 1000000)" << std::endl
+		<< "  --components N      components of the components model (default 100000)" << std::endl
+		<< "  --slices N          slices of the slice stack model (default 10000)" << std::endl
+		<< "  --implicit-nodes N  nodes of the implicit function model (default 20000)" << std::endl
+		<< "  --graph-nodes N     nodes of the implicit graph that is linked by names (default 100000)" << std::endl
+		<< "  --points N          points of the implicit function evaluation (default 100000)" << std::endl
+		<< "  --levelset-cells N  grid cells along each axis when meshing a level set (default 256)" << std::endl
+		<< "  --filter TEXT       only runs benchmarks whose name contains TEXT" << std::endl
+		<< "  --json PATH         writes the results as JSON to PATH" << std::endl;
+}
+
+int main(int argc, char ** argv)
+{
+	sBenchmarkOptions options;
+	options.m_nIterations = 3;
+	options.m_nTriangles = 2000000;
+	options.m_nBeams = 1000000;
+	options.m_nComponents = 100000;
+	options.m_nSlices = 10000;
+	options.m_nImplicitNodes = 20000;
+	options.m_nGraphNodes = 100000;
+	options.m_nPoints = 100000;
+	options.m_nLevelSetCells = 256;
+
+	struct sCountOption {
+		const char * m_pszName;
+		Lib3MF_uint32 * m_pnValue;
+	};
+	const sCountOption countOptions[] = {
+		{ "--iterations", &options.m_nIterations },
+		{ "--triangles", &options.m_nTriangles },
+		{ "--beams", &options.m_nBeams },
+		{ "--components", &options.m_nComponents },
+		{ "--slices", &options.m_nSlices },
+		{ "--implicit-nodes", &options.m_nImplicitNodes },
+		{ "--graph-nodes", &options.m_nGraphNodes },
+		{ "--points", &options.m_nPoints },
+		{ "--levelset-cells", &options.m_nLevelSetCells },
+	};
+
+	for (int nArg = 1; nArg < argc; nArg++) {
+		bool bHasValue = (nArg + 1 < argc);
+		bool bParsed = false;
+		for (const sCountOption & countOption : countOptions) {
+			if (bHasValue && (strcmp(argv[nArg], countOption.m_pszName) == 0)) {
+				*countOption.m_pnValue = (Lib3MF_uint32)strtoul(argv[++nArg], nullptr, 10);
+				bParsed = true;
+				break;
+			}
+		}
+
+		if (!bParsed) {
+			if (bHasValue && (strcmp(argv[nArg], "--filter") == 0))
+				options.m_sFilter = argv[++nArg];
+			else if (bHasValue && (strcmp(argv[nArg], "--json") == 0))
+				options.m_sJSONPath = argv[++nArg];
+			else {
+				printUsage(argv[0]);
+				return 1;
+			}
+		}
+	}
+
+	try {
+		CBenchmarkSuite suite(Lib3MF::CWrapper::loadLibrary(), options);
+		runModelBenchmarks(suite);
+		runMeshReaderBenchmarks(suite);
+		runNumberFormatBenchmarks(suite);
+
+		if (!options.m_sJSONPath.empty())
+			suite.writeJSON(options.m_sJSONPath);
+	}
+	catch (std::exception & e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_MeshReader.cpp: Compares the delimiter scanners of the XML reader and
+the background decompression of the 3MF reader on a large mesh.
+
+--*/
+
+#include "Benchmark_Harness.h"
+#include "Benchmark_Generators.h"
+
+#include <chrono>
+#include <cstdlib>
+
+using namespace Lib3MF;
+
+namespace Lib3MFBenchmark {
+
+	// Selects the delimiter scanner of the XML reader (see LIB3MF_XML_SCANNER), an empty level selects the fastest one
+	static void setXmlScanner(const std::string & sLevel)
+	{
+#ifdef _WIN32
+		_putenv_s("LIB3MF_XML_SCANNER", sLevel.c_str());
+#else
+		if (sLevel.empty())
+			unsetenv("LIB3MF_XML_SCANNER");
+		else
+			setenv("LIB3MF_XML_SCANNER", sLevel.c_str(), 1);
+#endif
+	}
+
+	static double readPackage(PWrapper pWrapper, const std::vector<Lib3MF_uint8> & buffer, bool bBackgroundDecompression)
+	{
+		PModel pModel = pWrapper->CreateModel();
+		PReader pReader = pModel->QueryReader("3mf");
+		pReader->SetBackgroundDecompressionActive(bBackgroundDecompression);
+
+		auto start = std::chrono::steady_clock::now();
+		pReader->ReadFromBuffer(buffer);
+		auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double>(end - start).count();
+	}
+
+	void runMeshReaderBenchmarks(CBenchmarkSuite & suite)
+	{
+		const std::string sScannerPrefix = "XmlScanner/";
+		const std::string sBackgroundName = "Read/MeshWithProperties/BackgroundDecompression";
+		// Levels the CPU does not support fall back to the best supported one
+		const std::vector<std::string> scannerLevels = { "scalar", "sse2", "avx2" };
+
+		bool bSelected = suite.isSelected(sBackgroundName);
+		for (const std::string & sLevel : scannerLevels)
+			bSelected |= suite.isSelected(sScannerPrefix + sLevel);
+		if (!bSelected)
+			return;
+
+		PWrapper pWrapper = suite.wrapper();
+		sBenchmarkModel model = createMeshModel(pWrapper, suite.options().m_nTriangles, true);
+		std::vector<Lib3MF_uint8> buffer;
+		model.m_pModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		for (const std::string & sLevel : scannerLevels) {
+			setXmlScanner(sLevel);
+			suite.run(sScannerPrefix + sLevel, model.m_nItems, model.m_sItemUnit, buffer.size(), [&]() {
+				return readPackage(pWrapper, buffer, false);
+			});
+		}
+		setXmlScanner("");
+
+		suite.run(sBackgroundName, model.m_nItems, model.m_sItemUnit, buffer.size(), [&]() {
+			return readPackage(pWrapper, buffer, true);
+		});
+	}
+
+}
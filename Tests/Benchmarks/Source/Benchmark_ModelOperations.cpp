@@ -0,0 +1,249 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_ModelOperations.cpp: Measures writing, reading, merging and the
+outbox computation of the synthetic models, the mesh geometry import, the
+manifold check, the batched evaluation of an implicit function and the
+sampling of functions and level sets on regular grids.
+
+--*/
+
+#include "Benchmark_Harness.h"
+#include "Benchmark_Generators.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace Lib3MF;
+
+namespace Lib3MFBenchmark {
+
+	template <typename F> static double measureSeconds(F fnOperation)
+	{
+		auto start = std::chrono::steady_clock::now();
+		fnOperation();
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(end - start).count();
+	}
+
+	static void runCategory(CBenchmarkSuite & suite, const std::string & sCategory, const std::function<sBenchmarkModel()> & fnCreateModel, bool bMerge, bool bOutbox)
+	{
+		const std::string sWrite = "Write/" + sCategory;
+		const std::string sRead = "Read/" + sCategory;
+		const std::string sMerge = "MergeToModel/" + sCategory;
+		const std::string sOutbox = "GetOutbox/" + sCategory;
+
+		if (!suite.isSelected(sWrite) && !suite.isSelected(sRead) && !(bMerge && suite.isSelected(sMerge)) && !(bOutbox && suite.isSelected(sOutbox)))
+			return;
+
+		PWrapper pWrapper = suite.wrapper();
+		sBenchmarkModel model = fnCreateModel();
+
+		std::vector<Lib3MF_uint8> buffer;
+		model.m_pModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		suite.run(sWrite, model.m_nItems, model.m_sItemUnit, buffer.size(), [&]() {
+			std::vector<Lib3MF_uint8> writeBuffer;
+			PWriter pWriter = model.m_pModel->QueryWriter("3mf");
+			return measureSeconds([&]() { pWriter->WriteToBuffer(writeBuffer); });
+		});
+
+		suite.run(sRead, model.m_nItems, model.m_sItemUnit, buffer.size(), [&]() {
+			PModel pReadModel = pWrapper->CreateModel();
+			PReader pReader = pReadModel->QueryReader("3mf");
+			return measureSeconds([&]() { pReader->ReadFromBuffer(buffer); });
+		});
+
+		if (bMerge) {
+			suite.run(sMerge, model.m_nItems, model.m_sItemUnit, 0, [&]() {
+				PModel pMergedModel;
+				return measureSeconds([&]() { pMergedModel = model.m_pModel->MergeToModel(); });
+			});
+		}
+
+		if (bOutbox) {
+			suite.run(sOutbox, model.m_nItems, model.m_sItemUnit, 0, [&]() {
+				return measureSeconds([&]() { model.m_pModel->GetOutbox(); });
+			});
+		}
+	}
+
+	static void runSetGeometry(CBenchmarkSuite & suite)
+	{
+		const std::string sName = "SetGeometry/Mesh";
+		if (!suite.isSelected(sName))
+			return;
+
+		std::vector<sPosition> vertices;
+		std::vector<sTriangle> triangles;
+		createGridGeometry(suite.options().m_nTriangles, vertices, triangles);
+
+		Lib3MF_uint64 nBytes = vertices.size() * sizeof(sPosition) + triangles.size() * sizeof(sTriangle);
+		suite.run(sName, triangles.size(), "triangles", nBytes, [&]() {
+			PModel pModel = suite.wrapper()->CreateModel();
+			PMeshObject pMeshObject = pModel->AddMeshObject();
+			return measureSeconds([&]() { pMeshObject->SetGeometry(vertices, triangles); });
+		});
+	}
+
+	static void runManifoldCheck(CBenchmarkSuite & suite)
+	{
+		const std::string sName = "IsManifoldAndOriented/Mesh";
+		if (!suite.isSelected(sName))
+			return;
+
+		sBenchmarkModel model = createMeshModel(suite.wrapper(), suite.options().m_nTriangles, false);
+		PMeshObjectIterator pIterator = model.m_pModel->GetMeshObjects();
+		pIterator->MoveNext();
+		PMeshObject pMeshObject = pIterator->GetCurrentMeshObject();
+
+		suite.run(sName, model.m_nItems, model.m_sItemUnit, 0, [&]() {
+			return measureSeconds([&]() { pMeshObject->IsManifoldAndOriented(); });
+		});
+	}
+
+	static void runEvaluateBatch(CBenchmarkSuite & suite)
+	{
+		const std::string sName = "EvaluateBatch/Implicit";
+		if (!suite.isSelected(sName))
+			return;
+
+		sBenchmarkModel model = createImplicitModel(suite.wrapper(), suite.options().m_nImplicitNodes);
+		PFunctionIterator pIterator = model.m_pModel->GetFunctions();
+		pIterator->MoveNext();
+		PImplicitFunction pFunction = std::dynamic_pointer_cast<CImplicitFunction>(pIterator->GetCurrentFunction());
+
+		// x, y and z of all points one after another
+		Lib3MF_uint64 nPoints = suite.options().m_nPoints;
+		std::vector<Lib3MF_double> inputs(3 * nPoints);
+		for (size_t nIndex = 0; nIndex < inputs.size(); nIndex++)
+			inputs[nIndex] = 0.001 * (nIndex % 10007);
+		std::vector<Lib3MF_double> outputs;
+
+		suite.run(sName, nPoints, "points", inputs.size() * sizeof(Lib3MF_double), [&]() {
+			return measureSeconds([&]() { pFunction->EvaluateBatch(inputs, outputs); });
+		});
+	}
+
+	static void runSampleGrid(CBenchmarkSuite & suite)
+	{
+		const std::string sVolume = "SampleGrid/Volume";
+		const std::string sLayer = "SampleGrid/Layer";
+		const std::string sPerPoint = "SampleGrid/PerPoint";
+		const std::string sLevelSet = "SampleGrid/LevelSet";
+		if (!suite.isSelected(sVolume) && !suite.isSelected(sLayer) && !suite.isSelected(sPerPoint) && !suite.isSelected(sLevelSet))
+			return;
+
+		Lib3MF_uint32 nCells = suite.options().m_nLevelSetCells;
+		sBenchmarkModel model = createGyroidModel(suite.wrapper(), nCells);
+		PFunctionIterator pFunctions = model.m_pModel->GetFunctions();
+		pFunctions->MoveNext();
+		PImplicitFunction pFunction = std::dynamic_pointer_cast<CImplicitFunction>(pFunctions->GetCurrentFunction());
+		PLevelSetIterator pLevelSets = model.m_pModel->GetLevelSets();
+		pLevelSets->MoveNext();
+		PLevelSet pLevelSet = pLevelSets->GetCurrentLevelSet();
+
+		// The grids cover the bounding box of the level set
+		const float fSize = 100.0f;
+		Lib3MF_uint32 nVolumeCount = std::max(nCells / 2, 2u);
+		Lib3MF_uint32 nLayerCount = 4 * nCells;
+		sVector origin = { { 0.0f, 0.0f, 0.0f } };
+		sVector volumeSpacing = { { fSize / (nVolumeCount - 1), fSize / (nVolumeCount - 1), fSize / (nVolumeCount - 1) } };
+		sVector layerSpacing = { { fSize / (nLayerCount - 1), fSize / (nLayerCount - 1), 1.0f } };
+		Lib3MF_uint64 nVolumePoints = (Lib3MF_uint64)nVolumeCount * nVolumeCount * nVolumeCount;
+		Lib3MF_uint64 nLayerPoints = (Lib3MF_uint64)nLayerCount * nLayerCount;
+		std::vector<Lib3MF_single> values;
+
+		suite.run(sVolume, nVolumePoints, "points", nVolumePoints * sizeof(Lib3MF_single), [&]() {
+			return measureSeconds([&]() { pFunction->SampleGrid("shape", origin, volumeSpacing, nVolumeCount, nVolumeCount, nVolumeCount, nullptr, nullptr, values); });
+		});
+
+		suite.run(sLayer, nLayerPoints, "points", nLayerPoints * sizeof(Lib3MF_single), [&]() {
+			return measureSeconds([&]() { pFunction->SampleGrid("shape", origin, layerSpacing, nLayerCount, nLayerCount, 1, nullptr, nullptr, values); });
+		});
+
+		// The naive baseline evaluates the first rows of the layer one point at a time
+		Lib3MF_uint32 nPerPointRows = std::max(nLayerCount / 64, 1u);
+		Lib3MF_uint64 nPerPointPoints = (Lib3MF_uint64)nLayerCount * nPerPointRows;
+		suite.run(sPerPoint, nPerPointPoints, "points", nPerPointPoints * sizeof(Lib3MF_single), [&]() {
+			std::vector<Lib3MF_double> inputs(3);
+			std::vector<Lib3MF_double> outputs;
+			values.resize((size_t)nPerPointPoints);
+			return measureSeconds([&]() {
+				for (Lib3MF_uint32 nRow = 0; nRow < nPerPointRows; nRow++) {
+					for (Lib3MF_uint32 nColumn = 0; nColumn < nLayerCount; nColumn++) {
+						inputs[0] = nColumn * (double)layerSpacing.m_Coordinates[0];
+						inputs[1] = nRow * (double)layerSpacing.m_Coordinates[1];
+						inputs[2] = 0.0;
+						pFunction->EvaluateBatch(inputs, outputs);
+						values[(size_t)nRow * nLayerCount + nColumn] = (Lib3MF_single)outputs[0];
+					}
+				}
+			});
+		});
+
+		suite.run(sLevelSet, nVolumePoints, "points", nVolumePoints * sizeof(Lib3MF_single), [&]() {
+			return measureSeconds([&]() { pLevelSet->SampleGrid(origin, volumeSpacing, nVolumeCount, nVolumeCount, nVolumeCount, nullptr, nullptr, values); });
+		});
+	}
+
+	static void runImplicitGraph(CBenchmarkSuite & suite)
+	{
+		const std::string sName = "AddLinkByNames/ImplicitGraph";
+		if (!suite.isSelected(sName))
+			return;
+
+		Lib3MF_uint32 nNodes = suite.options().m_nGraphNodes;
+		suite.run(sName, 1 + 3 * (Lib3MF_uint64)((nNodes > 4) ? ((nNodes - 1) / 3) : 1), "nodes", 0, [&]() {
+			sBenchmarkModel model;
+			return measureSeconds([&]() { model = createImplicitGraphModel(suite.wrapper(), nNodes); });
+		});
+	}
+
+	void runModelBenchmarks(CBenchmarkSuite & suite)
+	{
+		PWrapper pWrapper = suite.wrapper();
+		const sBenchmarkOptions & options = suite.options();
+
+		runSetGeometry(suite);
+		runManifoldCheck(suite);
+		runEvaluateBatch(suite);
+		runSampleGrid(suite);
+		runImplicitGraph(suite);
+
+		runCategory(suite, "Mesh", [&]() { return createMeshModel(pWrapper, options.m_nTriangles, false); }, true, true);
+		runCategory(suite, "MeshWithProperties", [&]() { return createMeshModel(pWrapper, options.m_nTriangles, true); }, true, true);
+		runCategory(suite, "BeamLattice", [&]() { return createBeamLatticeModel(pWrapper, options.m_nBeams); }, true, true);
+		runCategory(suite, "Components", [&]() { return createComponentsModel(pWrapper, options.m_nComponents); }, true, true);
+		runCategory(suite, "Slices", [&]() { return createSliceModel(pWrapper, options.m_nSlices); }, false, true);
+		runCategory(suite, "Implicit", [&]() { return createImplicitModel(pWrapper, options.m_nImplicitNodes); }, false, false);
+		runCategory(suite, "ImplicitGraph", [&]() { return createImplicitGraphModel(pWrapper, options.m_nGraphNodes); }, false, false);
+		runCategory(suite, "LevelSet", [&]() { return createGyroidModel(pWrapper, options.m_nLevelSetCells); }, true, true);
+	}
+
+}
@@ -0,0 +1,85 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_NumberFormat.cpp: Measures the number formatting of the 3MF writer.
+The model part is stored without compression, so that the time is dominated by
+the formatting of coordinates, indices and transforms.
+
+--*/
+
+#include "Benchmark_Harness.h"
+#include "Benchmark_Generators.h"
+
+#include <chrono>
+
+using namespace Lib3MF;
+
+namespace Lib3MFBenchmark {
+
+	static void runStoredWrite(CBenchmarkSuite & suite, const std::string & sCategory, const std::vector<Lib3MF_uint32> & decimalPrecisions, const std::function<sBenchmarkModel()> & fnCreateModel)
+	{
+		const std::string sPrefix = "NumberFormat/" + sCategory + "/Precision";
+
+		bool bSelected = false;
+		for (Lib3MF_uint32 nPrecision : decimalPrecisions)
+			bSelected |= suite.isSelected(sPrefix + std::to_string(nPrecision));
+		if (!bSelected)
+			return;
+
+		sBenchmarkModel model = fnCreateModel();
+
+		for (Lib3MF_uint32 nPrecision : decimalPrecisions) {
+			PWriter pWriter = model.m_pModel->QueryWriter("3mf");
+			pWriter->SetModelCompressionLevel(0);
+			pWriter->SetDecimalPrecision(nPrecision);
+
+			std::vector<Lib3MF_uint8> buffer;
+			pWriter->WriteToBuffer(buffer);
+
+			suite.run(sPrefix + std::to_string(nPrecision), model.m_nItems, model.m_sItemUnit, buffer.size(), [&]() {
+				auto start = std::chrono::steady_clock::now();
+				pWriter->WriteToBuffer(buffer);
+				auto end = std::chrono::steady_clock::now();
+				return std::chrono::duration<double>(end - start).count();
+			});
+		}
+	}
+
+	void runNumberFormatBenchmarks(CBenchmarkSuite & suite)
+	{
+		PWrapper pWrapper = suite.wrapper();
+		const sBenchmarkOptions & options = suite.options();
+
+		// The precision only affects the fixed point coordinates of meshes and beam lattices
+		runStoredWrite(suite, "Mesh", { 6, 16 }, [&]() { return createMeshModel(pWrapper, options.m_nTriangles, false); });
+		runStoredWrite(suite, "BeamLattice", { 6, 16 }, [&]() { return createBeamLatticeModel(pWrapper, options.m_nBeams); });
+		runStoredWrite(suite, "Components", { 6 }, [&]() { return createComponentsModel(pWrapper, options.m_nComponents); });
+		runStoredWrite(suite, "Slices", { 6 }, [&]() { return createSliceModel(pWrapper, options.m_nSlices); });
+	}
+
+}
@@ -267,6 +267,51 @@ namespace Lib3MF
 		ASSERT_TRUE(bAreEqual);
 	}
 
-}
+	TEST_F(AttachmentsT, LazyAttachmentLoading)
+	{
+		std::vector<Lib3MF_uint8> vctPayload(256 * 1024);
+		for (size_t nIndex = 0; nIndex < vctPayload.size(); nIndex++)
+			vctPayload[nIndex] = (Lib3MF_uint8)((nIndex * 7) % 251);
+
+		auto attachment = model->AddAttachment(m_sRelationShipPath + ".bin", m_sAttachmetType);
+		attachment->ReadFromBuffer(vctPayload);
+		model->CreatePackageThumbnailAttachment()->ReadFromFile(m_sThumbnailPath);
+
+		std::vector<Lib3MF_uint8> vctPackage;
+		model->QueryWriter("3mf")->WriteToBuffer(vctPackage);
+
+		auto lazyModel = wrapper->CreateModel();
+		{
+			auto reader = lazyModel->QueryReader("3mf");
+			EXPECT_FALSE(reader->GetLazyAttachmentLoadingActive());
+			reader->SetLazyAttachmentLoadingActive(true);
+			EXPECT_TRUE(reader->GetLazyAttachmentLoadingActive());
+			reader->AddRelationToRead(m_sAttachmetType);
+			reader->ReadFromBuffer(vctPackage);
+		}
+		ASSERT_EQ(lazyModel->GetAttachmentCount(), 1u);
+		EXPECT_EQ(lazyModel->GetAttachment(0)->GetStreamSize(), vctPayload.size());
 
+		// Attachments that were never accessed are copied from the source package
+		std::vector<Lib3MF_uint8> vctRewrittenPackage;
+		lazyModel->QueryWriter("3mf")->WriteToBuffer(vctRewrittenPackage);
 
+		std::vector<Lib3MF_uint8> vctLazyPayload;
+		lazyModel->GetAttachment(0)->WriteToBuffer(vctLazyPayload);
+		EXPECT_TRUE(vctLazyPayload == vctPayload);
+		CheckPackageThumbnailAreEqual(model, lazyModel);
+
+		auto rewrittenModel = wrapper->CreateModel();
+		{
+			auto reader = rewrittenModel->QueryReader("3mf");
+			reader->AddRelationToRead(m_sAttachmetType);
+			reader->ReadFromBuffer(vctRewrittenPackage);
+		}
+		ASSERT_EQ(rewrittenModel->GetAttachmentCount(), 1u);
+		std::vector<Lib3MF_uint8> vctRewrittenPayload;
+		rewrittenModel->GetAttachment(0)->WriteToBuffer(vctRewrittenPayload);
+		EXPECT_TRUE(vctRewrittenPayload == vctPayload);
+		CheckPackageThumbnailAreEqual(model, rewrittenModel);
+	}
+
+}
@@ -191,6 +191,52 @@ namespace Lib3MF
 		
 	}
 
+	TEST_F(MeshObject, LargeGeometryOperations)
+	{
+		// several blocks of the paged node and face storage, with a partial last block
+		const Lib3MF_uint32 nVertexCount = 1000;
+		std::vector<sPosition> vctVertices(nVertexCount);
+		for (Lib3MF_uint32 i = 0; i < nVertexCount; i++)
+			vctVertices[i] = fnCreateVertex((float)i, 0.5f * i, -0.25f * i);
+		std::vector<sTriangle> vctTriangles;
+		for (Lib3MF_uint32 i = 0; i + 2 < nVertexCount; i++)
+			vctTriangles.push_back(fnCreateTriangle(i, i + 1, i + 2));
+
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		ASSERT_EQ(mesh->GetVertexCount(), nVertexCount);
+		ASSERT_EQ(mesh->GetTriangleCount(), (Lib3MF_uint32)vctTriangles.size());
+		ASSERT_EQ(mesh->GetVertex(777).m_Coordinates[1], 0.5f * 777);
+		ASSERT_EQ(mesh->GetTriangle(500).m_Indices[2], 502u);
+		// every triangle has face data for properties
+		mesh->SetTriangleProperties(997, { 1, { 2, 3, 4 } });
+		sTriangleProperties properties;
+		mesh->GetTriangleProperties(997, properties);
+		ASSERT_EQ(properties.m_PropertyIDs[2], 4u);
+
+		std::vector<sPosition> vctReadVertices;
+		mesh->GetVertices(vctReadVertices);
+		ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+		for (Lib3MF_uint32 i = 0; i < nVertexCount; i++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctReadVertices[i].m_Coordinates[j], vctVertices[i].m_Coordinates[j]);
+
+		std::vector<sTriangle> vctReadTriangles;
+		mesh->GetTriangleIndices(vctReadTriangles);
+		ASSERT_EQ(vctReadTriangles.size(), vctTriangles.size());
+		for (size_t i = 0; i < vctTriangles.size(); i++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctReadTriangles[i].m_Indices[j], vctTriangles[i].m_Indices[j]);
+
+		std::vector<sTriangle> vctInvalidTriangles = vctTriangles;
+		vctInvalidTriangles.back().m_Indices[1] = nVertexCount;
+		ASSERT_SPECIFIC_THROW(mesh->SetGeometry(vctVertices, vctInvalidTriangles), ELib3MFException);
+		vctInvalidTriangles.back() = fnCreateTriangle(5, 6, 5);
+		ASSERT_SPECIFIC_THROW(mesh->SetGeometry(vctVertices, vctInvalidTriangles), ELib3MFException);
+		std::vector<sPosition> vctInvalidVertices = vctVertices;
+		vctInvalidVertices[600].m_Coordinates[0] = 1.0e30f;
+		ASSERT_SPECIFIC_THROW(mesh->SetGeometry(vctInvalidVertices, vctTriangles), ELib3MFException);
+	}
+
 	TEST_F(MeshObject, IsManifoldAndOriented)
 	{
 		ASSERT_FALSE(mesh->IsManifoldAndOriented());
@@ -198,6 +244,93 @@ namespace Lib3MF
 		ASSERT_TRUE(mesh->IsManifoldAndOriented());
 	}
 
+	TEST_F(MeshObject, IsManifoldAndOrientedLargeMesh)
+	{
+		// a closed torus with enough edges to be radix sorted
+		const Lib3MF_uint32 nRings = 200;
+		const Lib3MF_uint32 nSegments = 150;
+		std::vector<sPosition> vctVertices;
+		for (Lib3MF_uint32 i = 0; i < nRings; i++)
+			for (Lib3MF_uint32 j = 0; j < nSegments; j++)
+				vctVertices.push_back(fnCreateVertex((float)i, (float)j, (float)((i + j) % 7)));
+
+		std::vector<sTriangle> vctTriangles;
+		for (Lib3MF_uint32 i = 0; i < nRings; i++) {
+			for (Lib3MF_uint32 j = 0; j < nSegments; j++) {
+				Lib3MF_uint32 n00 = i * nSegments + j;
+				Lib3MF_uint32 n10 = ((i + 1) % nRings) * nSegments + j;
+				Lib3MF_uint32 n01 = i * nSegments + (j + 1) % nSegments;
+				Lib3MF_uint32 n11 = ((i + 1) % nRings) * nSegments + (j + 1) % nSegments;
+				vctTriangles.push_back(fnCreateTriangle(n00, n10, n11));
+				vctTriangles.push_back(fnCreateTriangle(n00, n11, n01));
+			}
+		}
+
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+
+		// one flipped triangle breaks the orientation
+		Lib3MF_uint32 nFlipped = 12345;
+		mesh->SetTriangle(nFlipped, fnCreateTriangle(vctTriangles[nFlipped].m_Indices[1], vctTriangles[nFlipped].m_Indices[0], vctTriangles[nFlipped].m_Indices[2]));
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+
+		// a missing triangle leaves open edges
+		vctTriangles.pop_back();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+
+		// a duplicated triangle makes edges non-manifold
+		vctTriangles.push_back(vctTriangles[0]);
+		vctTriangles.push_back(vctTriangles[1]);
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+	}
+
+	TEST_F(MeshObject, IsManifoldAndOrientedAfterModification)
+	{
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+
+		// every modification of the same object must invalidate the previous result
+		sTriangle flipped = fnCreateTriangle(pTriangles[0].m_Indices[1], pTriangles[0].m_Indices[0], pTriangles[0].m_Indices[2]);
+		mesh->SetTriangle(0, flipped);
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+		mesh->SetTriangle(0, pTriangles[0]);
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+
+		mesh->SetVertex(0, fnCreateVertex(-1.0f, -1.0f, -1.0f));
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+		ASSERT_TRUE(mesh->IsValid());
+
+		mesh->AddTriangle(pTriangles[0]);
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+	}
+
+	TEST_F(MeshObject, ComponentsIsValid)
+	{
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		auto components = model->AddComponentsObject();
+		ASSERT_FALSE(components->IsValid());
+
+		// many components share the same mesh
+		auto inner = model->AddComponentsObject();
+		for (int i = 0; i < 100; i++)
+			inner->AddComponent(mesh.get(), wrapper->GetTranslationTransform(10.0f * i, 0.0f, 0.0f));
+		components->AddComponent(inner.get(), wrapper->GetIdentityTransform());
+		components->AddComponent(mesh.get(), wrapper->GetIdentityTransform());
+		ASSERT_TRUE(components->IsValid());
+
+		// an empty components object anywhere makes the object invalid
+		auto empty = model->AddComponentsObject();
+		inner->AddComponent(empty.get(), wrapper->GetIdentityTransform());
+		ASSERT_FALSE(components->IsValid());
+	}
+
 	TEST_F(MeshObject, IsValid)
 	{
 		ASSERT_FALSE(mesh->IsValid());
@@ -33,6 +33,8 @@ UnitTest_Object.cpp: Defines Unittests for the object class and its descendants
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
 
+#include <random>
+
 namespace Lib3MF
 {
 	class Outbox : public Lib3MFTest {
@@ -146,6 +148,99 @@ namespace Lib3MF
 
 		CompareBoxes(sOutbox, sExpectedOutbox);
 	}
+
+	TEST_F(Outbox, CheckBuildItemOutboxes)
+	{
+		std::vector<Lib3MF::sBox> vctOutboxes;
+		model->GetBuildItemOutboxes(vctOutboxes);
+		ASSERT_EQ(vctOutboxes.size(), 2);
+
+		auto buildItems = model->GetBuildItems();
+		for (size_t i = 0; i < vctOutboxes.size(); i++) {
+			ASSERT_TRUE(buildItems->MoveNext());
+			CompareBoxes(vctOutboxes[i], buildItems->GetCurrent()->GetOutbox());
+		}
+	}
+
+	TEST_F(Outbox, CheckManyRotatedInstances)
+	{
+		auto newModel = wrapper->CreateModel();
+		auto mesh = newModel->AddMeshObject();
+
+		// a point cloud with many interior points, only the vertices matter for the outbox
+		std::mt19937 generator(20);
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+		std::vector<sPosition> vctVertices;
+		while (vctVertices.size() < 3000) {
+			sPosition vertex = { { distribution(generator), distribution(generator), distribution(generator) } };
+			if (vertex.m_Coordinates[0] * vertex.m_Coordinates[0] + vertex.m_Coordinates[1] * vertex.m_Coordinates[1] + vertex.m_Coordinates[2] * vertex.m_Coordinates[2] <= 100.0f)
+				vctVertices.push_back(vertex);
+		}
+		std::vector<sTriangle> vctTriangles;
+		for (Lib3MF_uint32 i = 0; i + 2 < (Lib3MF_uint32)vctVertices.size(); i += 3)
+			vctTriangles.push_back({ { i, i + 1, i + 2 } });
+		mesh->SetGeometry(vctVertices, vctTriangles);
+
+		std::vector<sTransform> vctTransforms;
+		for (int i = 0; i < 500; i++) {
+			float fAngle = 0.1f * i;
+			sTransform transform = wrapper->GetIdentityTransform();
+			transform.m_Fields[0][0] = std::cos(fAngle);
+			transform.m_Fields[0][1] = std::sin(fAngle);
+			transform.m_Fields[1][0] = -std::sin(fAngle);
+			transform.m_Fields[1][1] = std::cos(fAngle);
+			transform.m_Fields[3][0] = 25.0f * (i % 20);
+			transform.m_Fields[3][1] = 25.0f * (i / 20);
+			// every other instance is only translated
+			if (i % 2 == 0)
+				transform = wrapper->GetTranslationTransform(25.0f * (i % 20), 25.0f * (i / 20), 1.0f);
+			newModel->AddBuildItem(mesh.get(), transform);
+			vctTransforms.push_back(transform);
+		}
+
+		auto fnCheckOutboxes = [&]() {
+			std::vector<Lib3MF::sBox> vctOutboxes;
+			newModel->GetBuildItemOutboxes(vctOutboxes);
+			ASSERT_EQ(vctOutboxes.size(), vctTransforms.size());
+
+			Lib3MF::sBox sModelOutbox;
+			for (int j = 0; j < 3; j++) {
+				sModelOutbox.m_MinCoordinate[j] = std::numeric_limits<float>::max();
+				sModelOutbox.m_MaxCoordinate[j] = -std::numeric_limits<float>::max();
+			}
+
+			for (size_t i = 0; i < vctTransforms.size(); i++) {
+				Lib3MF::sBox sExpectedOutbox;
+				for (int j = 0; j < 3; j++) {
+					sExpectedOutbox.m_MinCoordinate[j] = std::numeric_limits<float>::max();
+					sExpectedOutbox.m_MaxCoordinate[j] = -std::numeric_limits<float>::max();
+				}
+				for (auto & vertex : vctVertices) {
+					for (int j = 0; j < 3; j++) {
+						float fValue = vctTransforms[i].m_Fields[0][j] * vertex.m_Coordinates[0] + vctTransforms[i].m_Fields[1][j] * vertex.m_Coordinates[1] +
+							vctTransforms[i].m_Fields[2][j] * vertex.m_Coordinates[2] + vctTransforms[i].m_Fields[3][j];
+						sExpectedOutbox.m_MinCoordinate[j] = std::min(sExpectedOutbox.m_MinCoordinate[j], fValue);
+						sExpectedOutbox.m_MaxCoordinate[j] = std::max(sExpectedOutbox.m_MaxCoordinate[j], fValue);
+					}
+				}
+				for (int j = 0; j < 3; j++) {
+					EXPECT_NEAR(vctOutboxes[i].m_MinCoordinate[j], sExpectedOutbox.m_MinCoordinate[j], 1E-4);
+					EXPECT_NEAR(vctOutboxes[i].m_MaxCoordinate[j], sExpectedOutbox.m_MaxCoordinate[j], 1E-4);
+					sModelOutbox.m_MinCoordinate[j] = std::min(sModelOutbox.m_MinCoordinate[j], vctOutboxes[i].m_MinCoordinate[j]);
+					sModelOutbox.m_MaxCoordinate[j] = std::max(sModelOutbox.m_MaxCoordinate[j], vctOutboxes[i].m_MaxCoordinate[j]);
+				}
+			}
+
+			CompareBoxes(newModel->GetOutbox(), sModelOutbox);
+		};
+
+		fnCheckOutboxes();
+
+		// moving a vertex outwards must be reflected by all instances
+		vctVertices[1234] = { { 15.0f, -12.0f, 3.0f } };
+		mesh->SetVertex(1234, vctVertices[1234]);
+		fnCheckOutboxes();
+	}
 }
 
 
@@ -206,4 +206,162 @@ namespace Lib3MF
 		ASSERT_EQ(3, modelAssert->GetObjects()->Count());
 		ASSERT_EQ(3, modelAssert->GetBuildItems()->Count());
 	}
+
+	// Describes everything the reader produced that must not depend on the sub-model thread count
+	static std::vector<std::string> fnReadAndDescribeModel(PWrapper pWrapper, const std::vector<Lib3MF_uint8> & buffer, Lib3MF_uint32 nThreadCount, bool bDescribeUUIDs)
+	{
+		std::vector<std::string> description;
+		auto readModel = pWrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->SetSubModelThreadCount(nThreadCount);
+		EXPECT_EQ(reader->GetSubModelThreadCount(), nThreadCount);
+		try {
+			reader->ReadFromBuffer(buffer);
+		}
+		catch (ELib3MFException & e) {
+			description.push_back("error " + std::to_string(e.getErrorCode()));
+		}
+
+		for (Lib3MF_uint32 iWarning = 0; iWarning < reader->GetWarningCount(); iWarning++) {
+			Lib3MF_uint32 nErrorCode = 0;
+			std::string sWarning = reader->GetWarning(iWarning, nErrorCode);
+			description.push_back("warning " + std::to_string(nErrorCode) + " " + sWarning);
+		}
+		description.push_back("unit " + std::to_string((int)readModel->GetUnit()));
+
+		auto resources = readModel->GetResources();
+		while (resources->MoveNext()) {
+			auto resource = resources->GetCurrent();
+			description.push_back("resource " + resource->PackagePart()->GetPath() + " " + std::to_string(resource->GetModelResourceID()) + " " + std::to_string(resource->GetUniqueResourceID()));
+		}
+
+		auto meshObjects = readModel->GetMeshObjects();
+		while (meshObjects->MoveNext()) {
+			auto meshObject = meshObjects->GetCurrentMeshObject();
+			std::string sMesh = "mesh " + std::to_string(meshObject->GetResourceID()) + " " + std::to_string(meshObject->GetVertexCount());
+			if (bDescribeUUIDs) {
+				bool bHasUUID = false;
+				sMesh += " " + meshObject->GetUUID(bHasUUID);
+			}
+			std::vector<sTriangleProperties> properties;
+			meshObject->GetAllTriangleProperties(properties);
+			for (auto property : properties)
+				sMesh += " " + std::to_string(property.m_ResourceID) + ":" + std::to_string(property.m_PropertyIDs[0]);
+			description.push_back(sMesh);
+		}
+
+		auto componentsObjects = readModel->GetComponentsObjects();
+		while (componentsObjects->MoveNext()) {
+			auto componentsObject = componentsObjects->GetCurrentComponentsObject();
+			std::string sComponents = "components " + std::to_string(componentsObject->GetResourceID());
+			for (Lib3MF_uint32 iComponent = 0; iComponent < componentsObject->GetComponentCount(); iComponent++)
+				sComponents += " " + std::to_string(componentsObject->GetComponent(iComponent)->GetObjectResourceID());
+			description.push_back(sComponents);
+		}
+
+		auto multiPropertyGroups = readModel->GetMultiPropertyGroups();
+		while (multiPropertyGroups->MoveNext()) {
+			auto multiPropertyGroup = multiPropertyGroups->GetCurrentMultiPropertyGroup();
+			std::string sLayers = "multiproperties " + std::to_string(multiPropertyGroup->GetResourceID());
+			for (Lib3MF_uint32 iLayer = 0; iLayer < multiPropertyGroup->GetLayerCount(); iLayer++)
+				sLayers += " " + std::to_string(multiPropertyGroup->GetLayer(iLayer).m_ResourceID);
+			description.push_back(sLayers);
+		}
+
+		return description;
+	}
+
+	TEST_F(ProductionExtension, ParallelSubModelReadMatchesSerialRead)
+	{
+		auto rootComponents = model->AddComponentsObject();
+		for (int iPart = 0; iPart < 16; iPart++) {
+			auto part = model->FindOrCreatePackagePart("/3D/part" + std::to_string(iPart) + ".model");
+
+			auto meshObject = model->AddMeshObject();
+			meshObject->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+			meshObject->SetPackagePart(part.get());
+
+			auto partComponents = model->AddComponentsObject();
+			partComponents->AddComponent(meshObject.get(), wrapper->GetTranslationTransform(0.0f, 0.0f, 10.0f));
+			partComponents->SetPackagePart(part.get());
+
+			rootComponents->AddComponent(partComponents.get(), wrapper->GetTranslationTransform(iPart * 150.0f, 0.0f, 0.0f));
+		}
+		model->AddBuildItem(rootComponents.get(), wrapper->GetIdentityTransform());
+
+		std::vector<Lib3MF_uint8> buffer;
+		model->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		auto serialDescription = fnReadAndDescribeModel(wrapper, buffer, 1, true);
+		ASSERT_EQ(serialDescription.size(), 1 + (2 * 16 + 1) + 16 + (16 + 1));
+		EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 4, true), serialDescription);
+		EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 0, true), serialDescription);
+	}
+
+	TEST_F(ProductionExtension, ParallelSubModelReadWithMaterials)
+	{
+		// part07 contains a texture and is merged by reading it serially, part05 switches the unit
+		std::vector<Lib3MF_uint8> buffer = ReadFileIntoBuffer(sTestFilesPath + "/Production/" + "ManyProductionParts.3mf");
+
+		auto serialDescription = fnReadAndDescribeModel(wrapper, buffer, 1, true);
+		ASSERT_EQ(serialDescription[0], "unit " + std::to_string((int)eModelUnit::Inch));
+		ASSERT_EQ(serialDescription.size(), 1 + (5 * 12 + 2 + 1) + 12 + (12 + 1) + 12);
+		EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 3, true), serialDescription);
+		EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 8, true), serialDescription);
+	}
+
+	TEST_F(ProductionExtension, ParallelSubModelReadOfTestFiles)
+	{
+		for (std::string sFileName : { "2ProductionBoxes.3mf", "2ProductionBoxes_OneSliceFile.3mf", "HierarchicalComponent.3mf", "Replaces_PP_701_04.3mf", "detachedmodel.3mf" }) {
+			std::vector<Lib3MF_uint8> buffer = ReadFileIntoBuffer(sTestFilesPath + "/Production/" + sFileName);
+			// objects without UUID get a random one
+			auto serialDescription = fnReadAndDescribeModel(wrapper, buffer, 1, false);
+			EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 4, false), serialDescription) << sFileName;
+		}
+	}
+
+	TEST_F(ProductionExtension, ParallelSubModelWriteMatchesSerialWrite)
+	{
+		auto rootComponents = model->AddComponentsObject();
+		for (int iPart = 0; iPart < 16; iPart++) {
+			auto part = model->FindOrCreatePackagePart("/3D/part" + std::to_string(iPart) + ".model");
+
+			auto meshObject = model->AddMeshObject();
+			meshObject->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+			meshObject->SetPackagePart(part.get());
+
+			auto partComponents = model->AddComponentsObject();
+			partComponents->AddComponent(meshObject.get(), wrapper->GetTranslationTransform(0.0f, 0.0f, 10.0f));
+			partComponents->SetPackagePart(part.get());
+
+			rootComponents->AddComponent(partComponents.get(), wrapper->GetTranslationTransform(iPart * 150.0f, 0.0f, 0.0f));
+		}
+		model->AddBuildItem(rootComponents.get(), wrapper->GetIdentityTransform());
+
+		auto writer = model->QueryWriter("3mf");
+		std::vector<Lib3MF_uint8> serialBuffer;
+		writer->WriteToBuffer(serialBuffer);
+		auto serialDescription = fnReadAndDescribeModel(wrapper, serialBuffer, 1, true);
+
+		for (Lib3MF_uint32 nThreadCount : { 4u, 0u }) {
+			writer->SetSubModelThreadCount(nThreadCount);
+			EXPECT_EQ(writer->GetSubModelThreadCount(), nThreadCount);
+
+			std::vector<Lib3MF_uint8> buffer;
+			writer->WriteToBuffer(buffer);
+			EXPECT_EQ(buffer.size(), serialBuffer.size());
+			EXPECT_EQ(fnReadAndDescribeModel(wrapper, buffer, 1, true), serialDescription);
+		}
+
+		// meshes that are parsed on first access are loaded before the parts are handed to the threads
+		auto lazyModel = wrapper->CreateModel();
+		auto lazyReader = lazyModel->QueryReader("3mf");
+		lazyReader->SetLazyMeshLoadingActive(true);
+		lazyReader->ReadFromBuffer(serialBuffer);
+		auto lazyWriter = lazyModel->QueryWriter("3mf");
+		lazyWriter->SetSubModelThreadCount(4);
+		std::vector<Lib3MF_uint8> lazyBuffer;
+		lazyWriter->WriteToBuffer(lazyBuffer);
+		EXPECT_EQ(fnReadAndDescribeModel(wrapper, lazyBuffer, 1, true), serialDescription);
+	}
 }
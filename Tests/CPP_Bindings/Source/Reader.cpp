@@ -34,6 +34,8 @@ UnitTest_Reader.cpp: Defines Unittests for the Reader classes
 #include "lib3mf_implicit.hpp"
 
 #include <algorithm>
+#include <cstdlib>
+#include <map>
 
 namespace Lib3MF
 {
@@ -138,6 +140,34 @@ namespace Lib3MF
 		CheckReaderWarnings(Reader::reader3MF, 0);
 	}
 
+	TEST_F(Reader, 3MFReadFromFileMatchesReadFromBuffer)
+	{
+		// files are memory mapped, buffers are wrapped. Both must read the same model.
+		Reader::reader3MF->ReadFromFile(sTestFilesPath + "/Production/" + "2ProductionBoxes.3mf");
+		CheckReaderWarnings(Reader::reader3MF, 0);
+
+		auto bufferModel = wrapper->CreateModel();
+		bufferModel->QueryReader("3mf")->ReadFromBuffer(ReadFileIntoBuffer(sTestFilesPath + "/Production/" + "2ProductionBoxes.3mf"));
+
+		auto fileMeshes = model->GetMeshObjects();
+		auto bufferMeshes = bufferModel->GetMeshObjects();
+		ASSERT_EQ(fileMeshes->Count(), bufferMeshes->Count());
+		while (fileMeshes->MoveNext() && bufferMeshes->MoveNext()) {
+			EXPECT_EQ(fileMeshes->GetCurrentMeshObject()->GetVertexCount(), bufferMeshes->GetCurrentMeshObject()->GetVertexCount());
+			EXPECT_EQ(fileMeshes->GetCurrentMeshObject()->GetTriangleCount(), bufferMeshes->GetCurrentMeshObject()->GetTriangleCount());
+		}
+		EXPECT_EQ(model->GetAttachmentCount(), bufferModel->GetAttachmentCount());
+	}
+
+	TEST_F(Reader, 3MFReadFromEmptyFile)
+	{
+		// empty files cannot be mapped and are read as a native stream instead
+		std::string sFileName = sOutFilesPath + "/Empty.3mf";
+		std::ofstream(sFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+		ASSERT_THROW(Reader::reader3MF->ReadFromFile(sFileName), ELib3MFException);
+		ASSERT_THROW(Reader::reader3MF->ReadFromFile(sOutFilesPath + "/DoesNotExist.3mf"), ELib3MFException);
+	}
+
 	TEST_F(Reader, Production)
 	{
 		auto buffer = ReadFileIntoBuffer(sTestFilesPath + "/Production/" + "2ProductionBoxes.3mf");
@@ -200,4 +230,363 @@ namespace Lib3MF
 		reader->ReadFromFile(sTestFilesPath + "/Reader/" + "cam_51476_test.3mf");
 		CheckReaderWarnings(Reader::reader3MF, 0);
 	}
-}
\ No newline at end of file
+
+	struct StreamedModel {
+		std::map<Lib3MF_uint32, Lib3MF_uint32> vertexCounts;
+		std::map<Lib3MF_uint32, Lib3MF_uint32> triangleCounts;
+		std::map<Lib3MF_uint32, Lib3MF_uint32> beamCounts;
+		Lib3MF_uint32 nComponents = 0;
+		Lib3MF_uint32 nBuildItems = 0;
+		Lib3MF_uint32 nInvalidIndices = 0;
+
+		static void vertexCallback(Lib3MF_uint32 nObjectID, Lib3MF_uint32 nCount, Lib3MF_uint64 nData, Lib3MF_pvoid pUserData)
+		{
+			auto pStreamed = reinterpret_cast<StreamedModel*>(pUserData);
+			ASSERT_NE(nData, 0u);
+			pStreamed->vertexCounts[nObjectID] += nCount;
+		}
+
+		static void triangleCallback(Lib3MF_uint32 nObjectID, Lib3MF_uint32 nCount, Lib3MF_uint64 nData, Lib3MF_pvoid pUserData)
+		{
+			auto pStreamed = reinterpret_cast<StreamedModel*>(pUserData);
+			auto pTriangles = reinterpret_cast<const sTriangle*>(nData);
+			for (Lib3MF_uint32 nIndex = 0; nIndex < nCount; nIndex++)
+				for (int j = 0; j < 3; j++)
+					if (pTriangles[nIndex].m_Indices[j] >= pStreamed->vertexCounts[nObjectID])
+						pStreamed->nInvalidIndices++;
+			pStreamed->triangleCounts[nObjectID] += nCount;
+		}
+
+		static void beamCallback(Lib3MF_uint32 nObjectID, Lib3MF_uint32 nCount, Lib3MF_uint64 nData, Lib3MF_pvoid pUserData)
+		{
+			auto pStreamed = reinterpret_cast<StreamedModel*>(pUserData);
+			auto pBeams = reinterpret_cast<const sBeam*>(nData);
+			for (Lib3MF_uint32 nIndex = 0; nIndex < nCount; nIndex++) {
+				if ((pBeams[nIndex].m_Indices[0] >= pStreamed->vertexCounts[nObjectID]) || (pBeams[nIndex].m_Radii[0] <= 0.0))
+					pStreamed->nInvalidIndices++;
+			}
+			pStreamed->beamCounts[nObjectID] += nCount;
+		}
+
+		static void componentCallback(Lib3MF_uint32 nObjectID, Lib3MF_uint32 nComponentObjectID, Lib3MF_uint64 nTransform, Lib3MF_pvoid pUserData)
+		{
+			ASSERT_NE(nObjectID, nComponentObjectID);
+			ASSERT_NE(nTransform, 0u);
+			reinterpret_cast<StreamedModel*>(pUserData)->nComponents++;
+		}
+
+		static void buildItemCallback(Lib3MF_uint32 nObjectID, Lib3MF_uint64 nTransform, Lib3MF_pvoid pUserData)
+		{
+			ASSERT_NE(nTransform, 0u);
+			reinterpret_cast<StreamedModel*>(pUserData)->nBuildItems++;
+		}
+
+		void stream(PReader reader)
+		{
+			reader->SetVertexStreamCallback(vertexCallback, this);
+			reader->SetTriangleStreamCallback(triangleCallback, this);
+			reader->SetBeamStreamCallback(beamCallback, this);
+			reader->SetComponentStreamCallback(componentCallback, this);
+			reader->SetBuildItemStreamCallback(buildItemCallback, this);
+		}
+	};
+
+	static void CompareStreamedModel(PModel streamedModel, StreamedModel & streamed, PModel model)
+	{
+		EXPECT_EQ(streamed.nInvalidIndices, 0u);
+
+		std::map<Lib3MF_uint32, PMeshObject> meshObjects;
+		auto meshes = model->GetMeshObjects();
+		while (meshes->MoveNext()) {
+			auto mesh = meshes->GetCurrentMeshObject();
+			meshObjects[mesh->GetModelResourceID()] = mesh;
+		}
+
+		auto streamedMeshes = streamedModel->GetMeshObjects();
+		ASSERT_EQ(streamedMeshes->Count(), meshes->Count());
+		while (streamedMeshes->MoveNext()) {
+			auto streamedMesh = streamedMeshes->GetCurrentMeshObject();
+			EXPECT_EQ(streamedMesh->GetVertexCount(), 0u);
+			EXPECT_EQ(streamedMesh->GetTriangleCount(), 0u);
+
+			auto mesh = meshObjects[streamedMesh->GetModelResourceID()];
+			ASSERT_TRUE(mesh);
+			Lib3MF_uint32 nUniqueID = streamedMesh->GetUniqueResourceID();
+			EXPECT_EQ(streamed.vertexCounts[nUniqueID], mesh->GetVertexCount());
+			EXPECT_EQ(streamed.triangleCounts[nUniqueID], mesh->GetTriangleCount());
+			EXPECT_EQ(streamed.beamCounts[nUniqueID], mesh->BeamLattice()->GetBeamCount());
+		}
+
+		Lib3MF_uint32 nComponents = 0;
+		auto componentsObjects = model->GetComponentsObjects();
+		while (componentsObjects->MoveNext())
+			nComponents += componentsObjects->GetCurrentComponentsObject()->GetComponentCount();
+		EXPECT_EQ(streamed.nComponents, nComponents);
+		EXPECT_EQ(streamed.nBuildItems, model->GetBuildItems()->Count());
+	}
+
+	TEST_F(Reader, 3MFStreamMeshesAndComponents)
+	{
+		Reader::reader3MF->ReadFromFile(sTestFilesPath + "/Reader/" + "Globo.3mf");
+
+		auto streamedModel = wrapper->CreateModel();
+		auto streamingReader = streamedModel->QueryReader("3mf");
+		StreamedModel streamed;
+		streamed.stream(streamingReader);
+		streamingReader->ReadFromFile(sTestFilesPath + "/Reader/" + "Globo.3mf");
+
+		EXPECT_GT(streamed.nComponents, 0u);
+		CompareStreamedModel(streamedModel, streamed, model);
+	}
+
+	TEST_F(Reader, 3MFStreamBeams)
+	{
+		Reader::reader3MF->ReadFromFile(sTestFilesPath + "/BeamLattice/" + "Box_Simple.3mf");
+
+		auto streamedModel = wrapper->CreateModel();
+		auto streamingReader = streamedModel->QueryReader("3mf");
+		StreamedModel streamed;
+		streamed.stream(streamingReader);
+		streamingReader->ReadFromFile(sTestFilesPath + "/BeamLattice/" + "Box_Simple.3mf");
+
+		EXPECT_FALSE(streamed.beamCounts.empty());
+		CompareStreamedModel(streamedModel, streamed, model);
+	}
+
+	// Describes the content of all meshes, visiting the meshes in reverse order
+	static std::vector<std::string> DescribeMeshes(PModel model)
+	{
+		std::vector<PMeshObject> meshObjects;
+		auto meshes = model->GetMeshObjects();
+		while (meshes->MoveNext())
+			meshObjects.push_back(meshes->GetCurrentMeshObject());
+
+		std::vector<std::string> description;
+		for (auto iMesh = meshObjects.rbegin(); iMesh != meshObjects.rend(); iMesh++) {
+			auto mesh = *iMesh;
+			std::vector<sPosition> vertices;
+			mesh->GetVertices(vertices);
+			std::vector<sTriangle> triangles;
+			mesh->GetTriangleIndices(triangles);
+			std::vector<sTriangleProperties> properties;
+			mesh->GetAllTriangleProperties(properties);
+
+			double dCoordinateSum = 0.0;
+			for (auto vertex : vertices)
+				dCoordinateSum += vertex.m_Coordinates[0] + vertex.m_Coordinates[1] + vertex.m_Coordinates[2];
+			Lib3MF_uint64 nIndexSum = 0;
+			for (auto triangle : triangles)
+				nIndexSum += triangle.m_Indices[0] + 2 * triangle.m_Indices[1] + 3 * triangle.m_Indices[2];
+			std::string sMesh = std::to_string(mesh->GetResourceID()) + " " + std::to_string(vertices.size()) + " " + std::to_string(dCoordinateSum)
+				+ " " + std::to_string(triangles.size()) + " " + std::to_string(nIndexSum) + " " + std::to_string(mesh->BeamLattice()->GetBeamCount())
+				+ " " + std::to_string(mesh->GetTriangleSetCount());
+			for (auto property : properties)
+				sMesh += " " + std::to_string(property.m_ResourceID) + ":" + std::to_string(property.m_PropertyIDs[0]);
+			description.push_back(sMesh);
+		}
+		return description;
+	}
+
+	TEST_F(Reader, 3MFLazyMeshLoading)
+	{
+		std::vector<std::string> files = { "Reader/Box.3mf", "Reader/Globo.3mf", "BeamLattice/Box_Simple.3mf",
+			"Production/2ProductionBoxes.3mf", "Properties/PyramidWithProperties.3mf" };
+		for (auto sFile : files) {
+			auto eagerModel = wrapper->CreateModel();
+			eagerModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/" + sFile);
+
+			auto lazyModel = wrapper->CreateModel();
+			auto lazyReader = lazyModel->QueryReader("3mf");
+			EXPECT_FALSE(lazyReader->GetLazyMeshLoadingActive());
+			lazyReader->SetLazyMeshLoadingActive(true);
+			EXPECT_TRUE(lazyReader->GetLazyMeshLoadingActive());
+			lazyReader->ReadFromFile(sTestFilesPath + "/" + sFile);
+
+			EXPECT_EQ(DescribeMeshes(lazyModel), DescribeMeshes(eagerModel)) << sFile;
+		}
+	}
+
+	TEST_F(Reader, 3MFLazyMeshLoadingDefersErrors)
+	{
+		// InvalidVerticesValidBuild.3mf is N_XXX_0422_01.3mf with a valid build item transform, only its vertices are invalid
+		ASSERT_SPECIFIC_THROW(Reader::reader3MF->ReadFromFile(sTestFilesPath + "/Reader/" + "InvalidVerticesValidBuild.3mf"), ELib3MFException);
+
+		model = wrapper->CreateModel();
+		Reader::reader3MF = model->QueryReader("3mf");
+		Reader::reader3MF->SetLazyMeshLoadingActive(true);
+		Reader::reader3MF->ReadFromFile(sTestFilesPath + "/Reader/" + "InvalidVerticesValidBuild.3mf");
+
+		auto meshes = model->GetMeshObjects();
+		ASSERT_TRUE(meshes->MoveNext());
+		auto mesh = meshes->GetCurrentMeshObject();
+		ASSERT_SPECIFIC_THROW(mesh->GetVertexCount(), ELib3MFException);
+		ASSERT_SPECIFIC_THROW(mesh->GetVertexCount(), ELib3MFException);
+	}
+
+	TEST_F(Reader, 3MFLazyMeshLoadingRejectsForwardReferences)
+	{
+		// The beam lattice of the first object is clipped by the object which is defined after it
+		for (bool bLazy : { false, true }) {
+			auto readModel = wrapper->CreateModel();
+			auto reader = readModel->QueryReader("3mf");
+			reader->SetLazyMeshLoadingActive(bLazy);
+			reader->ReadFromFile(sTestFilesPath + "/BeamLattice/Box_ClippingForwardReference.3mf");
+
+			auto meshes = readModel->GetMeshObjects();
+			ASSERT_TRUE(meshes->MoveNext());
+			auto mesh = meshes->GetCurrentMeshObject();
+			eBeamLatticeClipMode eClipMode;
+			Lib3MF_uint32 nClippingResourceID;
+			mesh->BeamLattice()->GetClipping(eClipMode, nClippingResourceID);
+			EXPECT_EQ(eClipMode, eBeamLatticeClipMode::NoClipMode) << bLazy;
+			EXPECT_EQ(reader->GetWarningCount(), 1u) << bLazy;
+		}
+	}
+
+	static void SetXmlScanner(const std::string & sLevel)
+	{
+#ifdef _WIN32
+		_putenv_s("LIB3MF_XML_SCANNER", sLevel.c_str());
+#else
+		if (sLevel.empty())
+			unsetenv("LIB3MF_XML_SCANNER");
+		else
+			setenv("LIB3MF_XML_SCANNER", sLevel.c_str(), 1);
+#endif
+	}
+
+	TEST_F(Reader, 3MFXmlScannerLevelsAgree)
+	{
+		std::vector<std::string> files = { "Reader/Box.3mf", "Reader/Globo.3mf", "BeamLattice/Box_Simple.3mf",
+			"Properties/PyramidWithProperties.3mf" };
+		for (auto sFile : files) {
+			SetXmlScanner("scalar");
+			auto scalarModel = wrapper->CreateModel();
+			scalarModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/" + sFile);
+
+			for (std::string sLevel : { "sse2", "" }) {
+				SetXmlScanner(sLevel);
+				auto vectorModel = wrapper->CreateModel();
+				vectorModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/" + sFile);
+				EXPECT_EQ(DescribeMeshes(vectorModel), DescribeMeshes(scalarModel)) << sFile << " " << sLevel;
+			}
+		}
+
+		for (std::string sLevel : { "scalar", "sse2", "" }) {
+			SetXmlScanner(sLevel);
+			auto invalidModel = wrapper->CreateModel();
+			EXPECT_ANY_THROW(invalidModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/Reader/" + "InvalidVerticesValidBuild.3mf")) << sLevel;
+		}
+		SetXmlScanner("");
+	}
+
+	// Writes a package with a grid mesh of 2 * nQuadsPerRow^2 triangles and a single triangle mesh
+	static PModel CreateGridModel(PWrapper wrapper, Lib3MF_uint32 nQuadsPerRow, std::vector<Lib3MF_uint8> & buffer)
+	{
+		std::vector<sPosition> vertices;
+		std::vector<sTriangle> triangles;
+		for (Lib3MF_uint32 nY = 0; nY <= nQuadsPerRow; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX <= nQuadsPerRow; nX++)
+				vertices.push_back({ { nX * 0.5f, nY * 0.5f, (float)((nX * nY) % 7) } });
+		}
+		for (Lib3MF_uint32 nY = 0; nY < nQuadsPerRow; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nQuadsPerRow; nX++) {
+				Lib3MF_uint32 nBase = nY * (nQuadsPerRow + 1) + nX;
+				triangles.push_back({ { nBase, nBase + 1, nBase + nQuadsPerRow + 1 } });
+				triangles.push_back({ { nBase + 1, nBase + nQuadsPerRow + 2, nBase + nQuadsPerRow + 1 } });
+			}
+		}
+
+		auto gridModel = wrapper->CreateModel();
+		gridModel->AddMeshObject()->SetGeometry(vertices, triangles);
+		std::vector<sPosition> smallVertices = { { { 0, 0, 0 } }, { { 1, 0, 0 } }, { { 0, 1, 0 } } };
+		std::vector<sTriangle> smallTriangles = { { { 0, 1, 2 } } };
+		gridModel->AddMeshObject()->SetGeometry(smallVertices, smallTriangles);
+
+		gridModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+		return gridModel;
+	}
+
+	TEST_F(Reader, 3MFReadLargeMesh)
+	{
+		// Large enough to span several chunks of the paged vectors
+		std::vector<Lib3MF_uint8> buffer;
+		auto writtenModel = CreateGridModel(wrapper, 256, buffer);
+
+		Reader::reader3MF->ReadFromBuffer(buffer);
+		EXPECT_EQ(DescribeMeshes(model), DescribeMeshes(writtenModel));
+	}
+
+	TEST_F(Reader, 3MFLazyLoadingFromReleasedBuffer)
+	{
+		const std::string sAttachmentType = "http://schemas.autodesk.com/dmg/testattachment/2017/08";
+		std::vector<Lib3MF_uint8> buffer;
+		auto writtenModel = CreateGridModel(wrapper, 16, buffer);
+		std::vector<Lib3MF_uint8> payload = { 1, 2, 3, 4, 5 };
+		writtenModel->AddAttachment("/Attachments/payload.bin", sAttachmentType)->ReadFromBuffer(payload);
+		buffer.clear();
+		writtenModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		Reader::reader3MF->SetLazyMeshLoadingActive(true);
+		Reader::reader3MF->SetLazyAttachmentLoadingActive(true);
+		Reader::reader3MF->AddRelationToRead(sAttachmentType);
+		Reader::reader3MF->ReadFromBuffer(buffer);
+
+		// The caller may release the buffer once the call returns
+		std::fill(buffer.begin(), buffer.end(), (Lib3MF_uint8)0);
+		buffer.clear();
+		buffer.shrink_to_fit();
+
+		EXPECT_EQ(DescribeMeshes(model), DescribeMeshes(writtenModel));
+		ASSERT_EQ(model->GetAttachmentCount(), 1u);
+		std::vector<Lib3MF_uint8> readPayload;
+		model->GetAttachment(0)->WriteToBuffer(readPayload);
+		EXPECT_EQ(readPayload, payload);
+	}
+
+	TEST_F(Reader, 3MFBackgroundDecompression)
+	{
+		std::vector<Lib3MF_uint8> buffer;
+		auto writtenModel = CreateGridModel(wrapper, 256, buffer);
+
+		EXPECT_FALSE(Reader::reader3MF->GetBackgroundDecompressionActive());
+		Reader::reader3MF->SetBackgroundDecompressionActive(true);
+		EXPECT_TRUE(Reader::reader3MF->GetBackgroundDecompressionActive());
+		Reader::reader3MF->ReadFromBuffer(buffer);
+		EXPECT_EQ(DescribeMeshes(model), DescribeMeshes(writtenModel));
+
+		// Small root model parts are read directly
+		auto smallModel = wrapper->CreateModel();
+		auto smallReader = smallModel->QueryReader("3mf");
+		smallReader->SetBackgroundDecompressionActive(true);
+		smallReader->ReadFromFile(sTestFilesPath + "/Reader/Box.3mf");
+		EXPECT_EQ(smallModel->GetMeshObjects()->Count(), 1);
+	}
+
+	static void CancelAfterFirstObject(bool* pAbort, Lib3MF_double dProgress, eProgressIdentifier identifier, Lib3MF_pvoid pUserData)
+	{
+		// Abort at the second object, while the producer still decompresses the root model part
+		Lib3MF_uint32 * pObjectCount = (Lib3MF_uint32 *)pUserData;
+		if (identifier == eProgressIdentifier::READRESOURCES)
+			(*pObjectCount)++;
+		*pAbort = (*pObjectCount > 1);
+	}
+
+	TEST_F(Reader, 3MFBackgroundDecompressionCancel)
+	{
+		std::vector<Lib3MF_uint8> buffer;
+		CreateGridModel(wrapper, 256, buffer);
+
+		Lib3MF_uint32 nObjectCount = 0;
+		Reader::reader3MF->SetBackgroundDecompressionActive(true);
+		Reader::reader3MF->SetProgressCallback(CancelAfterFirstObject, &nObjectCount);
+		try {
+			Reader::reader3MF->ReadFromBuffer(buffer);
+			EXPECT_TRUE(false);
+		}
+		catch (ELib3MFException & e) {
+			EXPECT_EQ(e.getErrorCode(), LIB3MF_ERROR_CALCULATIONABORTED) << e.what();
+		}
+		EXPECT_EQ(nObjectCount, 2u);
+	}
+}
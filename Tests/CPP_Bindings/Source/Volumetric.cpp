@@ -33,6 +33,8 @@ Vulometric.cpp: Defines Unittests for the Volumetric extension
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
 
+#include <cmath>
+
 namespace Lib3MF
 {
     namespace helper
@@ -107,6 +109,95 @@ namespace Lib3MF
             return gyroidFunction;
         }
 
+        // Signed distance to a sphere, negative inside
+        PImplicitFunction createSphereFunction(CModel& model,
+                                               sVector const& center,
+                                               double radius)
+        {
+            PImplicitFunction sphereFunction = model.AddImplicitFunction();
+            sphereFunction->SetDisplayName("sphere");
+            sphereFunction->AddInput("pos", "position",
+                                     Lib3MF::eImplicitPortType::Vector);
+
+            auto centerNode = sphereFunction->AddConstVecNode(
+                "center", "center of the sphere", "group_a");
+            centerNode->SetVector(center);
+
+            auto radiusNode = sphereFunction->AddConstantNode(
+                "radius", "radius of the sphere", "group_a");
+            radiusNode->SetConstant(radius);
+
+            auto translateNode = sphereFunction->AddSubtractionNode(
+                "translate", Lib3MF::eImplicitNodeConfiguration::VectorToVector,
+                "translation", "group_a");
+            sphereFunction->AddLink(sphereFunction->FindInput("pos"),
+                                    translateNode->GetInputA());
+            sphereFunction->AddLink(centerNode->GetOutputVector(),
+                                    translateNode->GetInputB());
+
+            auto lengthNode = sphereFunction->AddLengthNode(
+                "length", "distance to the center", "group_a");
+            sphereFunction->AddLink(translateNode->GetOutputResult(),
+                                    lengthNode->GetInputA());
+
+            auto distanceNode = sphereFunction->AddSubtractionNode(
+                "distance", Lib3MF::eImplicitNodeConfiguration::ScalarToScalar,
+                "distance to the surface", "group_a");
+            sphereFunction->AddLink(lengthNode->GetOutputResult(),
+                                    distanceNode->GetInputA());
+            sphereFunction->AddLink(radiusNode->GetOutputValue(),
+                                    distanceNode->GetInputB());
+
+            auto output = sphereFunction->AddOutput(
+                "shape", "signed distance to the surface",
+                Lib3MF::eImplicitPortType::Scalar);
+            sphereFunction->AddLink(distanceNode->GetOutputResult(), output);
+
+            return sphereFunction;
+        }
+
+        // Adds a level set of the function, bounded by a 100 mm box
+        PLevelSet addBoxedLevelSet(CModel& model, PImplicitFunction const& function)
+        {
+            std::vector<sPosition> vertices;
+            std::vector<sTriangle> triangles;
+            fnCreateBox(vertices, triangles);
+            auto boxMesh = model.AddMeshObject();
+            boxMesh->SetGeometry(vertices, triangles);
+
+            auto levelSet = model.AddLevelSet();
+            levelSet->SetMesh(boxMesh);
+            levelSet->SetFunction(function.get());
+            levelSet->SetChannelName("shape");
+            levelSet->SetMinFeatureSize(4.);
+            model.AddBuildItem(levelSet.get(), getIdentityTransform());
+            return levelSet;
+        }
+
+        double signedVolume(std::vector<sPosition> const& vertices,
+                            std::vector<sTriangle> const& triangles)
+        {
+            double volume = 0.;
+            for(auto const& triangle : triangles)
+            {
+                auto const& a = vertices[triangle.m_Indices[0]].m_Coordinates;
+                auto const& b = vertices[triangle.m_Indices[1]].m_Coordinates;
+                auto const& c = vertices[triangle.m_Indices[2]].m_Coordinates;
+                volume += (a[0] * (double(b[1]) * c[2] - double(b[2]) * c[1]) -
+                           a[1] * (double(b[0]) * c[2] - double(b[2]) * c[0]) +
+                           a[2] * (double(b[0]) * c[1] - double(b[1]) * c[0])) / 6.;
+            }
+            return volume;
+        }
+
+        PMeshObject getMergedMesh(CModel& model)
+        {
+            auto mergedModel = model.MergeToModel();
+            auto meshes = mergedModel->GetMeshObjects();
+            EXPECT_TRUE(meshes->MoveNext());
+            return meshes->GetCurrentMeshObject();
+        }
+
         PImplicitNode findNodeByName(PImplicitFunction const& function,
                                      std::string const& name)
         {
@@ -211,6 +302,7 @@ namespace Lib3MF
         static PWrapper wrapper;
 
         PImageStack SetupSheetsFromFile();
+        PImageStack SetupFormatSheets();
         PMeshObject GetMesh();
     };
     PWrapper Volumetric::wrapper;
@@ -1230,6 +1322,107 @@ namespace Lib3MF
         EXPECT_TRUE(helper::isTopologiallySorted(function));
     }
 
+    TEST_F(Volumetric, AddLinkByNames_RenamedRemovedAndDuplicateNodes_FindsCurrentNodes)
+    {
+        auto const function = model->AddImplicitFunction();
+        auto const constant = function->AddConstantNode("c", "constant", "");
+        auto const first = function->AddConstantNode("dup", "first", "");
+        auto const second = function->AddConstantNode("dup", "second", "");
+        auto const addition = function->AddAdditionNode(
+            "add", eImplicitNodeConfiguration::ScalarToScalar, "add", "");
+
+        // Renamed nodes are only found by their new identifier
+        constant->SetIdentifier("renamed");
+        EXPECT_THROW(function->AddLinkByNames("c.value", "add.A"), ELib3MFException);
+        function->AddLinkByNames("renamed.value", "add.A");
+        EXPECT_EQ(addition->GetInputA()->GetReference(), "renamed.value");
+
+        // Of nodes with the same identifier the first one is used, until it is removed
+        function->AddLinkByNames("dup.value", "add.B");
+        EXPECT_EQ(addition->GetInputB()->GetReference(), "dup.value");
+        first->SetDisplayName("removed");
+        function->RemoveNode(first.get());
+        second->SetConstant(2.);
+        function->AddLinkByNames("dup.value", "add.B");
+        function->AddOutput("sum", "sum", eImplicitPortType::Scalar)->SetReference("add.result");
+        function->SortNodesTopologically();
+
+        constant->SetConstant(1.);
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+        std::vector<double> const inputs = {0., 0., 0.};
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 1u);
+        EXPECT_DOUBLE_EQ(outputs[0], 3.);
+
+        // Removed nodes are not found anymore, renaming them has no effect
+        function->RemoveNode(second.get());
+        second->SetIdentifier("removed");
+        EXPECT_THROW(function->AddLinkByNames("dup.value", "add.B"), ELib3MFException);
+        EXPECT_THROW(function->AddLinkByNames("removed.value", "add.B"), ELib3MFException);
+        function->AddLinkByNames("renamed.value", "add.B");
+    }
+
+    TEST_F(Volumetric, AddLinkByNames_NodeReplacedBySameCount_FindsOnlyNewNode)
+    {
+        auto const function = model->AddImplicitFunction();
+        auto const addition = function->AddAdditionNode(
+            "add", eImplicitNodeConfiguration::ScalarToScalar, "add", "");
+        auto removed = function->AddConstantNode("a", "removed", "");
+        function->AddLinkByNames("a.value", "add.A");
+
+        // Removing a node and adding another keeps the node count unchanged
+        function->RemoveNode(removed.get());
+        removed.reset();
+        auto const added = function->AddConstantNode("b", "added", "");
+        added->SetConstant(2.);
+
+        EXPECT_THROW(function->AddLinkByNames("a.value", "add.A"), ELib3MFException);
+        function->AddLinkByNames("b.value", "add.A");
+        EXPECT_EQ(addition->GetInputA()->GetReference(), "b.value");
+    }
+
+    TEST_F(Volumetric, MergeModel_RenameAndChangeSourceNodes_MergedFunctionIsUnchanged)
+    {
+        auto const targetModel = wrapper->CreateModel();
+        auto const sourceModel = wrapper->CreateModel();
+        auto const function = sourceModel->AddImplicitFunction();
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+        auto const constant = function->AddConstantNode("c", "constant", "");
+        constant->SetConstant(1.);
+        function->AddOutput("value", "value", eImplicitPortType::Scalar)->SetReference("c.value");
+
+        targetModel->MergeFromModel(sourceModel.get());
+
+        auto functions = targetModel->GetFunctions();
+        ASSERT_TRUE(functions->MoveNext());
+        auto const mergedFunction =
+            std::dynamic_pointer_cast<CImplicitFunction>(functions->GetCurrentFunction());
+        ASSERT_TRUE(mergedFunction);
+
+        // The source finds its node by the new identifier only
+        constant->SetIdentifier("renamed");
+        constant->SetConstant(2.);
+        EXPECT_THROW(function->AddLinkByNames("c.value", "outputs.value"), ELib3MFException);
+        function->AddLinkByNames("renamed.value", "outputs.value");
+        EXPECT_EQ(function->FindOutput("value")->GetReference(), "renamed.value");
+
+        // The merged function keeps its own copy of the node
+        mergedFunction->AddLinkByNames("c.value", "outputs.value");
+        EXPECT_THROW(mergedFunction->AddLinkByNames("renamed.value", "outputs.value"),
+                     ELib3MFException);
+        EXPECT_EQ(mergedFunction->FindOutput("value")->GetReference(), "c.value");
+
+        std::vector<double> const inputs = {0., 0., 0.};
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 1u);
+        EXPECT_DOUBLE_EQ(outputs[0], 2.);
+        mergedFunction->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 1u);
+        EXPECT_DOUBLE_EQ(outputs[0], 1.);
+    }
+
 
 
     TEST_F(Volumetric,
@@ -1893,5 +2086,636 @@ namespace Lib3MF
     }
 
 
+    TEST_F(Volumetric, EvaluateBatch_Gyroid_MatchesDirectEvaluation)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+
+        size_t const pointCount = 1000;
+        std::vector<double> inputs(3 * pointCount);
+        for(size_t i = 0; i < pointCount; ++i)
+        {
+            inputs[i] = 0.01 * i;
+            inputs[pointCount + i] = -0.02 * i;
+            inputs[2 * pointCount + i] = 3. - 0.005 * i;
+        }
+
+        std::vector<double> outputs;
+        gyroidFunction->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), pointCount);
+
+        for(size_t i = 0; i < pointCount; ++i)
+        {
+            double const x = inputs[i];
+            double const y = inputs[pointCount + i];
+            double const z = inputs[2 * pointCount + i];
+            double const expected = std::sin(x) * std::cos(z) + std::sin(y) * std::cos(y) + std::sin(z) * std::cos(x);
+            EXPECT_NEAR(outputs[i], expected, 1E-12);
+        }
+    }
+
+    TEST_F(Volumetric, EvaluateBatch_MatrixInverse_RestoresPosition)
+    {
+        auto function = model->AddImplicitFunction();
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+
+        sMatrix4x4 matrix = {{{2., 0.5, 0., 10.},
+                              {0., 1., -1., 20.},
+                              {0.25, 0., 3., -5.},
+                              {0., 0., 0., 1.}}};
+        auto matrixNode = function->AddConstMatNode("M", "matrix", "");
+        matrixNode->SetMatrix(matrix);
+        function->AddInverseNode("inverse", "inverse", "");
+        function->AddMatVecMultiplicationNode("transformed", "M * pos", "");
+        function->AddMatVecMultiplicationNode("restored", "inverse * M * pos", "");
+
+        function->AddLinkByNames("M.matrix", "inverse.A");
+        function->AddLinkByNames("M.matrix", "transformed.A");
+        function->AddLinkByNames("inputs.pos", "transformed.B");
+        function->AddLinkByNames("inverse.result", "restored.A");
+        function->AddLinkByNames("transformed.result", "restored.B");
+
+        function->AddOutput("transformed", "transformed position", eImplicitPortType::Vector)
+            ->SetReference("transformed.result");
+        function->AddOutput("restored", "restored position", eImplicitPortType::Vector)
+            ->SetReference("restored.result");
+
+        size_t const pointCount = 300;
+        std::vector<double> inputs(3 * pointCount);
+        for(size_t i = 0; i < inputs.size(); ++i)
+        {
+            inputs[i] = 0.1 * static_cast<double>(i % 97) - 4.;
+        }
+
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 6 * pointCount);
+
+        for(size_t i = 0; i < pointCount; ++i)
+        {
+            for(size_t row = 0; row < 3; ++row)
+            {
+                double expected = matrix.m_Field[row][3];
+                for(size_t column = 0; column < 3; ++column)
+                {
+                    expected += matrix.m_Field[row][column] * inputs[column * pointCount + i];
+                }
+                EXPECT_NEAR(outputs[row * pointCount + i], expected, 1E-9);
+                EXPECT_NEAR(outputs[(3 + row) * pointCount + i], inputs[row * pointCount + i], 1E-9);
+            }
+        }
+    }
+
+    TEST_F(Volumetric, EvaluateBatch_FunctionCallAndMesh_MatchesDirectEvaluation)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+        auto mesh = GetMesh();
+
+        auto function = model->AddImplicitFunction();
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+
+        function->AddResourceIdNode("gyroidID", "gyroid", "")->SetResource(gyroidFunction.get());
+        auto gyroidNode = function->AddFunctionCallNode("gyroid", "gyroid", "");
+        gyroidNode->AddInput("pos", "position")->SetType(eImplicitPortType::Vector);
+        gyroidNode->AddOutput("shape", "gyroid")->SetType(eImplicitPortType::Scalar);
+        function->AddLinkByNames("gyroidID.value", "gyroid.functionID");
+        function->AddLinkByNames("inputs.pos", "gyroid.pos");
+
+        function->AddResourceIdNode("meshID", "mesh", "")->SetResource(mesh.get());
+        function->AddMeshNode("mesh", "mesh", "");
+        function->AddLinkByNames("meshID.value", "mesh.mesh");
+        function->AddLinkByNames("inputs.pos", "mesh.pos");
+
+        function->AddOutput("gyroid", "gyroid", eImplicitPortType::Scalar)
+            ->SetReference("gyroid.shape");
+        function->AddOutput("distance", "distance", eImplicitPortType::Scalar)
+            ->SetReference("mesh.distance");
+
+        // The centroid of the pyramid is inside, a point far above it outside
+        double centroid[3] = {0., 0., 0.};
+        std::vector<sPosition> vertices;
+        mesh->GetVertices(vertices);
+        for(auto const& vertex : vertices)
+        {
+            for(int k = 0; k < 3; ++k)
+            {
+                centroid[k] += vertex.m_Coordinates[k] / vertices.size();
+            }
+        }
+        std::vector<double> inputs = {centroid[0], centroid[0],
+                                      centroid[1], centroid[1],
+                                      centroid[2], centroid[2] + 1000.};
+
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 4u);
+
+        for(size_t i = 0; i < 2; ++i)
+        {
+            double const x = inputs[i];
+            double const y = inputs[2 + i];
+            double const z = inputs[4 + i];
+            EXPECT_NEAR(outputs[i], std::sin(x) * std::cos(z) + std::sin(y) * std::cos(y) + std::sin(z) * std::cos(x), 1E-12);
+        }
+        EXPECT_LT(outputs[2], 0.);
+        EXPECT_GT(outputs[3], 900.);
+    }
+
+    TEST_F(Volumetric, EvaluateBatch_InvalidInputCount_Throws)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+
+        std::vector<double> inputs(4, 0.);
+        std::vector<double> outputs;
+        EXPECT_THROW(gyroidFunction->EvaluateBatch(inputs, outputs), ELib3MFException);
+    }
+
+    TEST_F(Volumetric, EvaluateBatch_ChangedGraph_EvaluatesChanges)
+    {
+        auto const function = model->AddImplicitFunction();
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+        auto const a = function->AddConstantNode("a", "a", "");
+        auto const b = function->AddConstantNode("b", "b", "");
+        auto const addition = function->AddAdditionNode(
+            "add", eImplicitNodeConfiguration::ScalarToScalar, "add", "");
+        a->SetConstant(1.);
+        b->SetConstant(2.);
+        function->AddLinkByNames("a.value", "add.A");
+        function->AddLinkByNames("a.value", "add.B");
+        auto const output = function->AddOutput("result", "result", eImplicitPortType::Scalar);
+        output->SetReference("add.result");
+
+        std::vector<double> const inputs = {0., 0., 0.};
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 1u);
+        EXPECT_DOUBLE_EQ(outputs[0], 2.);
+
+        // Changed constants, links and outputs are evaluated by the next call
+        a->SetConstant(3.);
+        function->EvaluateBatch(inputs, outputs);
+        EXPECT_DOUBLE_EQ(outputs[0], 6.);
+
+        function->AddLinkByNames("b.value", "add.B");
+        function->EvaluateBatch(inputs, outputs);
+        EXPECT_DOUBLE_EQ(outputs[0], 5.);
+
+        output->SetReference("b.value");
+        function->EvaluateBatch(inputs, outputs);
+        EXPECT_DOUBLE_EQ(outputs[0], 2.);
+
+        function->AddOutput("sum", "sum", eImplicitPortType::Scalar)->SetReference("add.result");
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 2u);
+        EXPECT_DOUBLE_EQ(outputs[1], 5.);
+    }
+
+    TEST_F(Volumetric, EvaluateBatch_ChangedMeshAndCallee_EvaluatesChanges)
+    {
+        auto mesh = GetMesh();
+        auto callee = model->AddImplicitFunction();
+        callee->AddInput("pos", "position", eImplicitPortType::Vector);
+        auto const constant = callee->AddConstantNode("c", "c", "");
+        constant->SetConstant(1.);
+        callee->AddOutput("value", "value", eImplicitPortType::Scalar)->SetReference("c.value");
+
+        auto function = model->AddImplicitFunction();
+        function->AddInput("pos", "position", eImplicitPortType::Vector);
+        function->AddResourceIdNode("calleeID", "callee", "")->SetResource(callee.get());
+        auto callNode = function->AddFunctionCallNode("call", "call", "");
+        callNode->AddInput("pos", "position")->SetType(eImplicitPortType::Vector);
+        callNode->AddOutput("value", "value")->SetType(eImplicitPortType::Scalar);
+        function->AddLinkByNames("calleeID.value", "call.functionID");
+        function->AddLinkByNames("inputs.pos", "call.pos");
+        function->AddResourceIdNode("meshID", "mesh", "")->SetResource(mesh.get());
+        function->AddMeshNode("mesh", "mesh", "");
+        function->AddLinkByNames("meshID.value", "mesh.mesh");
+        function->AddLinkByNames("inputs.pos", "mesh.pos");
+        function->AddOutput("value", "value", eImplicitPortType::Scalar)->SetReference("call.value");
+        function->AddOutput("distance", "distance", eImplicitPortType::Scalar)
+            ->SetReference("mesh.distance");
+
+        // A point 1000 above the first vertex
+        std::vector<sPosition> vertices;
+        mesh->GetVertices(vertices);
+        std::vector<double> const inputs = {vertices.front().m_Coordinates[0],
+                                            vertices.front().m_Coordinates[1],
+                                            vertices.front().m_Coordinates[2] + 1000.};
+
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 2u);
+        EXPECT_DOUBLE_EQ(outputs[0], 1.);
+        EXPECT_GT(outputs[1], 1.);
+
+        // Moving the referenced mesh up to the point is evaluated by the next call
+        for(Lib3MF_uint32 index = 0; index < vertices.size(); ++index)
+        {
+            sPosition vertex = vertices[index];
+            vertex.m_Coordinates[2] += 1000.f;
+            mesh->SetVertex(index, vertex);
+        }
+        function->EvaluateBatch(inputs, outputs);
+        EXPECT_NEAR(outputs[1], 0., 1E-3);
+
+        // So is a change of the called function
+        constant->SetConstant(5.);
+        function->EvaluateBatch(inputs, outputs);
+        EXPECT_DOUBLE_EQ(outputs[0], 5.);
+    }
+
+    TEST_F(Volumetric, LevelSet_MergeToModel_MeshesSphere)
+    {
+        auto levelSetModel = wrapper->CreateModel();
+        double const radius = 30.;
+        auto sphereFunction = helper::createSphereFunction(*levelSetModel, {50., 50., 50.}, radius);
+        helper::addBoxedLevelSet(*levelSetModel, sphereFunction);
+
+        auto mesh = helper::getMergedMesh(*levelSetModel);
+        ASSERT_GT(mesh->GetTriangleCount(), 0u);
+        EXPECT_TRUE(mesh->IsManifoldAndOriented());
+
+        std::vector<sPosition> vertices;
+        std::vector<sTriangle> triangles;
+        mesh->GetVertices(vertices);
+        mesh->GetTriangleIndices(triangles);
+        for(auto const& vertex : vertices)
+        {
+            double const dx = vertex.m_Coordinates[0] - 50.;
+            double const dy = vertex.m_Coordinates[1] - 50.;
+            double const dz = vertex.m_Coordinates[2] - 50.;
+            EXPECT_NEAR(std::sqrt(dx * dx + dy * dy + dz * dz), radius, 0.1);
+        }
+
+        double const expectedVolume = 4. / 3. * 3.14159265358979 * radius * radius * radius;
+        EXPECT_NEAR(helper::signedVolume(vertices, triangles), expectedVolume, 0.02 * expectedVolume);
+    }
+
+    TEST_F(Volumetric, LevelSet_MergeToModel_ClipsToBoundingMesh)
+    {
+        auto levelSetModel = wrapper->CreateModel();
+        // The sphere covers the box except for its corners
+        auto sphereFunction = helper::createSphereFunction(*levelSetModel, {50., 50., 50.}, 70.);
+        auto levelSet = helper::addBoxedLevelSet(*levelSetModel, sphereFunction);
+
+        for(bool bBoxOnly : {false, true})
+        {
+            levelSet->SetMeshBBoxOnly(bBoxOnly);
+            auto mesh = helper::getMergedMesh(*levelSetModel);
+            EXPECT_TRUE(mesh->IsManifoldAndOriented());
+
+            std::vector<sPosition> vertices;
+            std::vector<sTriangle> triangles;
+            mesh->GetVertices(vertices);
+            mesh->GetTriangleIndices(triangles);
+            for(auto const& vertex : vertices)
+            {
+                for(int axis = 0; axis < 3; ++axis)
+                {
+                    EXPECT_GE(vertex.m_Coordinates[axis], -0.01f);
+                    EXPECT_LE(vertex.m_Coordinates[axis], 100.01f);
+                }
+            }
+
+            // The box without its corners outside of the sphere
+            EXPECT_NEAR(helper::signedVolume(vertices, triangles), 0.9595E6, 0.01E6);
+        }
+    }
+
+    TEST_F(Volumetric, LevelSet_MergeToModel_GyroidInPyramidIsClosed)
+    {
+        // Replace the build items of the pyramid by a level set bounded by it
+        auto buildItems = model->GetBuildItems();
+        while(buildItems->MoveNext())
+        {
+            model->RemoveBuildItem(buildItems->GetCurrent());
+        }
+
+        auto pyramid = GetMesh();
+        auto const pyramidBox = pyramid->GetOutbox();
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+        auto levelSet = model->AddLevelSet();
+        levelSet->SetMesh(pyramid);
+        levelSet->SetFunction(gyroidFunction.get());
+        levelSet->SetChannelName("shape");
+        levelSet->SetMinFeatureSize(2.);
+        model->AddBuildItem(levelSet.get(), getIdentityTransform());
+
+        auto mesh = helper::getMergedMesh(*model);
+        ASSERT_GT(mesh->GetTriangleCount(), 0u);
+        EXPECT_TRUE(mesh->IsManifoldAndOriented());
+
+        std::vector<sPosition> vertices;
+        mesh->GetVertices(vertices);
+        for(auto const& vertex : vertices)
+        {
+            for(int axis = 0; axis < 3; ++axis)
+            {
+                EXPECT_GE(vertex.m_Coordinates[axis], pyramidBox.m_MinCoordinate[axis] - 0.01f);
+                EXPECT_LE(vertex.m_Coordinates[axis], pyramidBox.m_MaxCoordinate[axis] + 0.01f);
+            }
+        }
+    }
+
+    TEST_F(Volumetric, LevelSet_GetOutbox_ReturnsBoundingMeshBox)
+    {
+        auto levelSetModel = wrapper->CreateModel();
+        auto sphereFunction = helper::createSphereFunction(*levelSetModel, {50., 50., 50.}, 30.);
+        helper::addBoxedLevelSet(*levelSetModel, sphereFunction);
+
+        auto buildItems = levelSetModel->GetBuildItems();
+        ASSERT_TRUE(buildItems->MoveNext());
+        auto box = buildItems->GetCurrent()->GetOutbox();
+        for(int axis = 0; axis < 3; ++axis)
+        {
+            EXPECT_FLOAT_EQ(box.m_MinCoordinate[axis], 0.f);
+            EXPECT_FLOAT_EQ(box.m_MaxCoordinate[axis], 100.f);
+        }
+    }
+
+    TEST_F(Volumetric, SampleGrid_Gyroid_MatchesDirectEvaluation)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+
+        // Counts that are no multiples of the tile size
+        sVector const origin = {{-1.f, -2.f, 0.5f}};
+        sVector const spacing = {{0.1f, 0.2f, 0.15f}};
+        Lib3MF_uint32 const counts[3] = {37, 21, 19};
+        std::vector<Lib3MF_single> values;
+        gyroidFunction->SampleGrid("shape", origin, spacing, counts[0], counts[1], counts[2], nullptr, nullptr, values);
+        ASSERT_EQ(values.size(), size_t(counts[0]) * counts[1] * counts[2]);
+
+        for(Lib3MF_uint32 k = 0; k < counts[2]; ++k)
+        {
+            for(Lib3MF_uint32 j = 0; j < counts[1]; ++j)
+            {
+                for(Lib3MF_uint32 i = 0; i < counts[0]; ++i)
+                {
+                    double const x = origin.m_Coordinates[0] + i * double(spacing.m_Coordinates[0]);
+                    double const y = origin.m_Coordinates[1] + j * double(spacing.m_Coordinates[1]);
+                    double const z = origin.m_Coordinates[2] + k * double(spacing.m_Coordinates[2]);
+                    double const expected = std::sin(x) * std::cos(z) + std::sin(y) * std::cos(y) + std::sin(z) * std::cos(x);
+                    EXPECT_NEAR(values[(size_t(k) * counts[1] + j) * counts[0] + i], expected, 1E-5);
+                }
+            }
+        }
+    }
+
+    TEST_F(Volumetric, SampleGrid_SingleLayer_MatchesSphereDistance)
+    {
+        auto sphereFunction = helper::createSphereFunction(*model, {50., 50., 50.}, 30.);
+
+        sVector const origin = {{0.f, 0.f, 40.f}};
+        sVector const spacing = {{0.5f, 0.75f, 1.f}};
+        Lib3MF_uint32 const countX = 201;
+        Lib3MF_uint32 const countY = 130;
+        std::vector<Lib3MF_single> values;
+        sphereFunction->SampleGrid("shape", origin, spacing, countX, countY, 1, nullptr, nullptr, values);
+        ASSERT_EQ(values.size(), size_t(countX) * countY);
+
+        for(Lib3MF_uint32 j = 0; j < countY; ++j)
+        {
+            for(Lib3MF_uint32 i = 0; i < countX; ++i)
+            {
+                double const dx = i * 0.5 - 50.;
+                double const dy = j * 0.75 - 50.;
+                double const expected = std::sqrt(dx * dx + dy * dy + 100.) - 30.;
+                EXPECT_NEAR(values[size_t(j) * countX + i], expected, 1E-4);
+            }
+        }
+    }
+
+    TEST_F(Volumetric, SampleGrid_UnknownOutput_Throws)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+        std::vector<Lib3MF_single> values;
+        EXPECT_THROW(gyroidFunction->SampleGrid("unknown", {{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}}, 4, 4, 4, nullptr, nullptr, values),
+                     ELib3MFException);
+    }
+
+    TEST_F(Volumetric, LevelSet_SampleGrid_IsNegativeInsideClippedShape)
+    {
+        auto levelSetModel = wrapper->CreateModel();
+        auto sphereFunction = helper::createSphereFunction(*levelSetModel, {50., 50., 50.}, 30.);
+        auto levelSet = helper::addBoxedLevelSet(*levelSetModel, sphereFunction);
+
+        // The grid extends beyond the bounding box of [0, 100]^3
+        Lib3MF_uint32 const count = 25;
+        std::vector<Lib3MF_single> values;
+        levelSet->SampleGrid({{-10.f, -10.f, -10.f}}, {{5.f, 5.f, 5.f}}, count, count, count, nullptr, nullptr, values);
+        ASSERT_EQ(values.size(), size_t(count) * count * count);
+
+        for(Lib3MF_uint32 k = 0; k < count; ++k)
+        {
+            for(Lib3MF_uint32 j = 0; j < count; ++j)
+            {
+                for(Lib3MF_uint32 i = 0; i < count; ++i)
+                {
+                    double const position[3] = {-10. + 5. * i, -10. + 5. * j, -10. + 5. * k};
+                    double distance = 0.;
+                    bool bInBox = true;
+                    for(int axis = 0; axis < 3; ++axis)
+                    {
+                        distance += (position[axis] - 50.) * (position[axis] - 50.);
+                        bInBox = bInBox && position[axis] > 0. && position[axis] < 100.;
+                    }
+                    distance = std::sqrt(distance) - 30.;
+                    float const value = values[(size_t(k) * count + j) * count + i];
+                    if(bInBox && distance < -1.)
+                    {
+                        EXPECT_LT(value, 0.f);
+                    }
+                    else if(!bInBox || distance > 1.)
+                    {
+                        EXPECT_GT(value, 0.f);
+                    }
+                }
+            }
+        }
+    }
+
+    void SampleGrid_AbortingCallback(bool* pAbort, Lib3MF_double dProgress, eProgressIdentifier identifier, Lib3MF_pvoid pUserData)
+    {
+        auto pCallCount = static_cast<int*>(pUserData);
+        ++*pCallCount;
+        *pAbort = dProgress > 0.1;
+    }
+
+    TEST_F(Volumetric, SampleGrid_AbortingCallback_Cancels)
+    {
+        auto gyroidFunction = helper::createGyroidFunction(*model);
+        int callCount = 0;
+
+        std::vector<Lib3MF_single> values;
+        try
+        {
+            gyroidFunction->SampleGrid("shape", {{0.f, 0.f, 0.f}}, {{0.1f, 0.1f, 0.1f}}, 128, 128, 128,
+                SampleGrid_AbortingCallback, &callCount, values);
+            FAIL() << "Sampling was not cancelled";
+        }
+        catch(ELib3MFException& e)
+        {
+            EXPECT_EQ(e.getErrorCode(), LIB3MF_ERROR_CALCULATIONABORTED) << e.what();
+        }
+        EXPECT_GT(callCount, 0);
+
+        // Sampling succeeds again without the callback
+        gyroidFunction->SampleGrid("shape", {{0.f, 0.f, 0.f}}, {{0.1f, 0.1f, 0.1f}}, 8, 8, 8, nullptr, nullptr, values);
+        EXPECT_EQ(values.size(), 512u);
+    }
+
+    namespace
+    {
+        // Channel of voxel (x, y) of the sheets of Volumetric::SetupFormatSheets in [0, 1]
+        double formatSheetVoxel(int x, int y, int sheet, int channel)
+        {
+            if(sheet == 0)
+            {
+                int const rgba[4] = {64 * x, 100 * y, 10 * (x + 4 * y), 255 - 20 * x};
+                return rgba[channel] / 255.;
+            }
+            if(sheet == 1)
+            {
+                return (channel == 3) ? 1. : (1000. * (x + 4 * y) + 7.) / 65535.;
+            }
+            int const index = (x + y) % 4;
+            double const palette[4][3] = {{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}, {1., 1., 1.}};
+            double const alpha[4] = {0., 128. / 255., 1., 1.};
+            return (channel == 3) ? alpha[index] : palette[index][channel];
+        }
+
+        // Implicit function with input uvw and outputs red and color from a function from an image stack
+        PImplicitFunction createImageCallFunction(CModel& model, CFunctionFromImage3D* pImageFunction)
+        {
+            auto function = model.AddImplicitFunction();
+            function->AddInput("uvw", "uvw", eImplicitPortType::Vector);
+            function->AddResourceIdNode("imageID", "image", "")->SetResource(pImageFunction);
+            auto callNode = function->AddFunctionCallNode("image", "image", "");
+            callNode->AddInput("uvw", "uvw")->SetType(eImplicitPortType::Vector);
+            callNode->AddOutput("red", "red")->SetType(eImplicitPortType::Scalar);
+            callNode->AddOutput("color", "color")->SetType(eImplicitPortType::Vector);
+            function->AddLinkByNames("imageID.value", "image.functionID");
+            function->AddLinkByNames("inputs.uvw", "image.uvw");
+            function->AddOutput("red", "red", eImplicitPortType::Scalar)->SetReference("image.red");
+            function->AddOutput("color", "color", eImplicitPortType::Vector)->SetReference("image.color");
+            return function;
+        }
+    }
+
+    PImageStack Volumetric::SetupFormatSheets()
+    {
+        PImageStack pImageStack = model->AddImageStack(4, 3, 3);
+        pImageStack->CreateSheetFromFile(0, "/volume/rgba8.png", InFolder + "Image3D_RGBA8.png");
+        pImageStack->CreateSheetFromFile(1, "/volume/gray16.png", InFolder + "Image3D_Gray16_Interlaced.png");
+        pImageStack->CreateSheetFromFile(2, "/volume/palette2.png", InFolder + "Image3D_Palette2.png");
+        return pImageStack;
+    }
+
+    TEST_F(Volumetric, FunctionFromImage3D_SampleGrid_NearestMatchesDecodedSheets)
+    {
+        auto imageFunction = model->AddFunctionFromImage3D(SetupFormatSheets().get());
+        imageFunction->SetFilter(eTextureFilter::Nearest);
+
+        // Voxel centers
+        sVector const origin = {{0.125f, 1.f / 6.f, 1.f / 6.f}};
+        sVector const spacing = {{0.25f, 1.f / 3.f, 1.f / 3.f}};
+        char const* const channels[4] = {"red", "green", "blue", "alpha"};
+        for(int channel = 0; channel < 4; ++channel)
+        {
+            std::vector<Lib3MF_single> values;
+            imageFunction->SampleGrid(channels[channel], origin, spacing, 4, 3, 3, nullptr, nullptr, values);
+            ASSERT_EQ(values.size(), 36u);
+            for(int sheet = 0; sheet < 3; ++sheet)
+            {
+                for(int y = 0; y < 3; ++y)
+                {
+                    for(int x = 0; x < 4; ++x)
+                    {
+                        EXPECT_NEAR(values[(sheet * 3 + y) * 4 + x], formatSheetVoxel(x, y, sheet, channel), 1E-6)
+                            << channels[channel] << " of voxel " << x << ", " << y << ", " << sheet;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_F(Volumetric, FunctionFromImage3D_FunctionCall_InterpolatesAndTiles)
+    {
+        auto imageFunction = model->AddFunctionFromImage3D(SetupFormatSheets().get());
+        imageFunction->SetFilter(eTextureFilter::Linear);
+        imageFunction->SetTileStyles(eTextureTileStyle::Wrap, eTextureTileStyle::Clamp, eTextureTileStyle::Mirror);
+        auto function = createImageCallFunction(*model, imageFunction.get());
+
+        double const v0 = 1. / 6.;
+        double const w0 = 1. / 6.;
+        std::vector<double> const u = {0.25, 1.375, 0.375, 0.375};
+        std::vector<double> const v = {v0, v0, 5., v0};
+        std::vector<double> const w = {w0, w0, w0, 1. + w0};
+        std::vector<double> inputs = u;
+        inputs.insert(inputs.end(), v.begin(), v.end());
+        inputs.insert(inputs.end(), w.begin(), w.end());
+
+        std::vector<double> outputs;
+        function->EvaluateBatch(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 16u);
+        auto red = [&outputs](size_t point) { return outputs[point]; };
+        auto color = [&outputs](size_t point, size_t channel) { return outputs[(1 + channel) * 4 + point]; };
+
+        // Halfway between the centers of the first two voxels
+        EXPECT_NEAR(red(0), 0.5 * (formatSheetVoxel(0, 0, 0, 0) + formatSheetVoxel(1, 0, 0, 0)), 1E-9);
+        // Wrapped in u
+        EXPECT_NEAR(red(1), formatSheetVoxel(1, 0, 0, 0), 1E-9);
+        // Clamped to the last row in v
+        EXPECT_NEAR(color(2, 1), formatSheetVoxel(1, 2, 0, 1), 1E-9);
+        // Mirrored at the last sheet in w
+        for(size_t channel = 0; channel < 3; ++channel)
+        {
+            EXPECT_NEAR(color(3, channel), formatSheetVoxel(1, 0, 2, int(channel)), 1E-9);
+        }
+        EXPECT_NEAR(red(3), color(3, 0), 1E-12);
+    }
+
+    TEST_F(Volumetric, FunctionFromImage3D_SampleGrid_AppliesOffsetAndScale)
+    {
+        auto imageFunction = model->AddFunctionFromImage3D(SetupFormatSheets().get());
+        imageFunction->SetFilter(eTextureFilter::Nearest);
+        imageFunction->SetOffset(-1.);
+        imageFunction->SetScale(2.);
+
+        std::vector<Lib3MF_single> values;
+        imageFunction->SampleGrid("green", {{0.125f, 1.f / 6.f, 0.5f}}, {{0.25f, 1.f / 3.f, 1.f}}, 4, 3, 1, nullptr, nullptr, values);
+        ASSERT_EQ(values.size(), 12u);
+        for(int y = 0; y < 3; ++y)
+        {
+            for(int x = 0; x < 4; ++x)
+            {
+                EXPECT_NEAR(values[y * 4 + x], -1. + 2. * formatSheetVoxel(x, y, 1, 1), 1E-6);
+            }
+        }
+
+        EXPECT_THROW(imageFunction->SampleGrid("color", {{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}}, 1, 1, 1, nullptr, nullptr, values),
+                     ELib3MFException);
+    }
+
+    TEST_F(Volumetric, FunctionFromImage3D_SampleGrid_DecodesImageStack)
+    {
+        auto imageFunction = model->AddFunctionFromImage3D(SetupSheetsFromFile().get());
+        imageFunction->SetFilter(eTextureFilter::Nearest);
+
+        // Pixels of the first sheet with the origin at the first image row
+        int const pixels[2][2] = {{410, 409}, {100, 200}};
+        double const expected[2][3] = {{217., 0., 0.}, {174., 168., 160.}};
+        char const* const channels[3] = {"red", "green", "blue"};
+        for(int pixel = 0; pixel < 2; ++pixel)
+        {
+            sVector const position = {{float((pixels[pixel][0] + 0.5) / 821.), float((pixels[pixel][1] + 0.5) / 819.), float(0.5 / 11.)}};
+            for(int channel = 0; channel < 3; ++channel)
+            {
+                std::vector<Lib3MF_single> values;
+                imageFunction->SampleGrid(channels[channel], position, {{1.f, 1.f, 1.f}}, 1, 1, 1, nullptr, nullptr, values);
+                ASSERT_EQ(values.size(), 1u);
+                EXPECT_NEAR(values[0], expected[pixel][channel] / 255., 1E-6);
+            }
+        }
+    }
 
 }  // namespace Lib3MF
@@ -31,6 +31,7 @@ UnitTest_Writer.cpp: Defines Unittests for the Writer classes
 --*/
 
 #include "UnitTest_Utilities.h"
+#include <algorithm>
 #include "lib3mf_implicit.hpp"
 
 namespace Lib3MF
@@ -109,6 +110,52 @@ namespace Lib3MF
 		Writer::writer3MF->WriteToBuffer(buffer);
 	}
 
+	TEST_F(Writer, 3MFWriteToInternalBuffer)
+	{
+		ASSERT_SPECIFIC_THROW(Writer::writer3MF->GetInternalBufferAddress(), ELib3MFException);
+
+		Lib3MF_uint64 nBufferSize = Writer::writer3MF->WriteToInternalBuffer();
+		ASSERT_EQ(nBufferSize, Writer::writer3MF->GetStreamSize());
+		const Lib3MF_uint8 * pBuffer = reinterpret_cast<const Lib3MF_uint8 *>(Writer::writer3MF->GetInternalBufferAddress());
+		ASSERT_TRUE(pBuffer != nullptr);
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_EQ(buffer.size(), nBufferSize);
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(std::vector<Lib3MF_uint8>(pBuffer, pBuffer + nBufferSize));
+		ASSERT_EQ(readModel->GetMeshObjects()->Count(), model->GetMeshObjects()->Count());
+	}
+
+	TEST_F(Writer, 3MFWriteToBufferAfterModelChange)
+	{
+		std::vector<Lib3MF_uint8> expected;
+		Writer::writer3MF->WriteToBuffer(expected);
+
+		// A too small buffer returns the size and is not written into
+		std::vector<Lib3MF_uint8> smallBuffer(expected.size() / 2, 0xff);
+		Lib3MF_uint64 nNeededCount = 0;
+		ASSERT_EQ(lib3mf_writer_writetobuffer(Writer::writer3MF->handle(), smallBuffer.size(), &nNeededCount, smallBuffer.data()), LIB3MF_SUCCESS);
+		ASSERT_EQ(nNeededCount, expected.size());
+		ASSERT_TRUE(std::all_of(smallBuffer.begin(), smallBuffer.end(), [](Lib3MF_uint8 nByte) { return nByte == 0xff; }));
+
+		// Neither the size query nor the too small buffer holds on to the package of the unchanged model
+		ASSERT_EQ(Writer::writer3MF->GetStreamSize(), expected.size());
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		model->AddBuildItem(mesh.get(), wrapper->GetIdentityTransform());
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_GT(buffer.size(), expected.size());
+		ASSERT_EQ(buffer.size(), Writer::writer3MF->GetStreamSize());
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		ASSERT_EQ(readModel->GetMeshObjects()->Count(), model->GetMeshObjects()->Count());
+	}
+
 	TEST_F(Writer, STLWriteToBuffer)
 	{
 		// This is a bit silly, as it essentially performs two writes!
@@ -183,4 +230,226 @@ namespace Lib3MF
 
 		ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), callbackBuffer.vec.begin()));
 	}
+
+	TEST_F(Writer, 3MFObjectThreadCount)
+	{
+		ASSERT_EQ(writer3MF->GetObjectThreadCount(), 1u);
+
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+
+		auto baseMaterialGroup = model->AddBaseMaterialGroup();
+		Lib3MF_uint32 nMaterial = baseMaterialGroup->AddMaterial("Red", wrapper->RGBAToColor(255, 0, 0, 255));
+
+		auto components = model->AddComponentsObject();
+		for (int nObject = 0; nObject < 12; nObject++) {
+			auto mesh = model->AddMeshObject();
+			mesh->SetName("Box" + std::to_string(nObject));
+			mesh->SetGeometry(vctVertices, vctTriangles);
+			mesh->GetMetaDataGroup()->AddMetaData("http://www.example.com/writer", "Index", std::to_string(nObject), "xs:string", false);
+			if (nObject % 3 == 0)
+				mesh->SetObjectLevelProperty(baseMaterialGroup->GetResourceID(), nMaterial);
+			components->AddComponent(mesh.get(), wrapper->GetTranslationTransform(10.0f * nObject, 0.0f, 0.0f));
+		}
+		model->AddBuildItem(components.get(), wrapper->GetIdentityTransform());
+
+		std::vector<Lib3MF_uint8> bufferSerial;
+		writer3MF->WriteToBuffer(bufferSerial);
+
+		for (Lib3MF_uint32 nThreadCount : { 4u, 0u }) {
+			writer3MF->SetObjectThreadCount(nThreadCount);
+			ASSERT_EQ(writer3MF->GetObjectThreadCount(), nThreadCount);
+
+			std::vector<Lib3MF_uint8> bufferParallel;
+			writer3MF->WriteToBuffer(bufferParallel);
+			ASSERT_EQ(bufferSerial.size(), bufferParallel.size());
+			ASSERT_TRUE(std::equal(bufferSerial.begin(), bufferSerial.end(), bufferParallel.begin()));
+		}
+	}
+
+	TEST_F(Writer, 3MFObjectThreadCountProduction)
+	{
+		auto productionModel = wrapper->CreateModel();
+		productionModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/Production/2ProductionBoxes.3mf");
+		auto writer = productionModel->QueryWriter("3mf");
+
+		std::vector<Lib3MF_uint8> bufferSerial;
+		writer->WriteToBuffer(bufferSerial);
+
+		writer->SetObjectThreadCount(3);
+		std::vector<Lib3MF_uint8> bufferParallel;
+		writer->WriteToBuffer(bufferParallel);
+		ASSERT_EQ(bufferSerial.size(), bufferParallel.size());
+		ASSERT_TRUE(std::equal(bufferSerial.begin(), bufferSerial.end(), bufferParallel.begin()));
+	}
+
+	void CancelAfterSecondObject(bool* pAbort, Lib3MF_double dProgress, eProgressIdentifier identifier, Lib3MF_pvoid pUserData)
+	{
+		Lib3MF_uint32 * pObjectCount = reinterpret_cast<Lib3MF_uint32 *>(pUserData);
+		if (identifier == eProgressIdentifier::WRITENOBJECTS)
+			(*pObjectCount)++;
+		*pAbort = (*pObjectCount > 1);
+	}
+
+	TEST_F(Writer, 3MFObjectThreadCountCancel)
+	{
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		for (int nObject = 0; nObject < 8; nObject++) {
+			auto mesh = model->AddMeshObject();
+			mesh->SetGeometry(vctVertices, vctTriangles);
+			model->AddBuildItem(mesh.get(), wrapper->GetIdentityTransform());
+		}
+
+		Lib3MF_uint32 nObjectCount = 0;
+		writer3MF->SetObjectThreadCount(4);
+		writer3MF->SetProgressCallback(CancelAfterSecondObject, &nObjectCount);
+		std::vector<Lib3MF_uint8> buffer;
+		ASSERT_SPECIFIC_THROW(writer3MF->WriteToBuffer(buffer), ELib3MFException);
+		ASSERT_EQ(nObjectCount, 2u);
+	}
+
+	TEST_F(Writer, 3MFCompressionThreadCount)
+	{
+		ASSERT_EQ(writer3MF->GetCompressionThreadCount(), 1u);
+
+		// a model part and an attachment that span several compression blocks
+		const Lib3MF_uint32 nGridSize = 200;
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++)
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++)
+				vctVertices.push_back(fnCreateVertex(0.5f * nX, 0.5f * nY, 0.01f * ((nX * nY) % 97)));
+		for (Lib3MF_uint32 nY = 0; nY + 1 < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX + 1 < nGridSize; nX++) {
+				Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+				vctTriangles.push_back(fnCreateTriangle(nIndex, nIndex + 1, nIndex + nGridSize + 1));
+				vctTriangles.push_back(fnCreateTriangle(nIndex, nIndex + nGridSize + 1, nIndex + nGridSize));
+			}
+		}
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+
+		const std::string sAttachmentType = "http://schemas.example.com/writer/payload";
+		std::vector<Lib3MF_uint8> vctPayload(3 * 1024 * 1024 + 12345);
+		Lib3MF_uint32 nSeed = 17;
+		for (auto & nByte : vctPayload) {
+			nSeed = nSeed * 1103515245 + 12345;
+			nByte = (Lib3MF_uint8)((nSeed >> 16) % 13);
+		}
+		model->AddAttachment("/Attachments/Payload.bin", sAttachmentType)->ReadFromBuffer(vctPayload);
+
+		for (Lib3MF_uint32 nThreadCount : { 4u, 0u }) {
+			writer3MF->SetCompressionThreadCount(nThreadCount);
+			ASSERT_EQ(writer3MF->GetCompressionThreadCount(), nThreadCount);
+
+			std::vector<Lib3MF_uint8> buffer;
+			writer3MF->WriteToBuffer(buffer);
+
+			auto readModel = wrapper->CreateModel();
+			auto reader = readModel->QueryReader("3mf");
+			reader->AddRelationToRead(sAttachmentType);
+			reader->ReadFromBuffer(buffer);
+
+			auto readMesh = readModel->GetMeshObjectByID(mesh->GetResourceID());
+			ASSERT_EQ(readMesh->GetVertexCount(), (Lib3MF_uint32)vctVertices.size());
+			ASSERT_EQ(readMesh->GetTriangleCount(), (Lib3MF_uint32)vctTriangles.size());
+			std::vector<sPosition> vctReadVertices;
+			readMesh->GetVertices(vctReadVertices);
+			for (size_t nIndex = 0; nIndex < vctVertices.size(); nIndex += 997)
+				for (int nCoordinate = 0; nCoordinate < 3; nCoordinate++)
+					ASSERT_NEAR(vctReadVertices[nIndex].m_Coordinates[nCoordinate], vctVertices[nIndex].m_Coordinates[nCoordinate], 1e-5);
+
+			ASSERT_EQ(readModel->GetAttachmentCount(), 1u);
+			std::vector<Lib3MF_uint8> vctReadPayload;
+			readModel->GetAttachment(0)->WriteToBuffer(vctReadPayload);
+			ASSERT_TRUE(vctReadPayload == vctPayload);
+		}
+	}
+
+	TEST_F(Writer, 3MFCompressionLevel)
+	{
+		ASSERT_EQ(writer3MF->GetModelCompressionLevel(), 1u);
+		ASSERT_EQ(writer3MF->GetTextureCompressionLevel(), 1u);
+		ASSERT_EQ(writer3MF->GetAttachmentCompressionLevel(), 1u);
+		ASSERT_SPECIFIC_THROW(writer3MF->SetModelCompressionLevel(10), ELib3MFException);
+		ASSERT_SPECIFIC_THROW(writer3MF->SetTextureCompressionLevel(10), ELib3MFException);
+		ASSERT_SPECIFIC_THROW(writer3MF->SetAttachmentCompressionLevel(10), ELib3MFException);
+
+		auto mesh = model->AddMeshObject();
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		mesh->SetGeometry(vctVertices, vctTriangles);
+
+		const std::string sAttachmentType = "http://schemas.example.com/writer/payload";
+		std::vector<Lib3MF_uint8> vctPayload(256 * 1024);
+		for (size_t nIndex = 0; nIndex < vctPayload.size(); nIndex++)
+			vctPayload[nIndex] = (Lib3MF_uint8)((nIndex / 7) % 11);
+		model->AddAttachment("/Attachments/Payload.bin", sAttachmentType)->ReadFromBuffer(vctPayload);
+
+		std::vector<Lib3MF_uint8> vctStoredBuffer;
+		std::vector<Lib3MF_uint8> vctDeflatedBuffer;
+		for (Lib3MF_uint32 nCompressionLevel : { 0u, 9u }) {
+			writer3MF->SetModelCompressionLevel(nCompressionLevel);
+			writer3MF->SetAttachmentCompressionLevel(nCompressionLevel);
+			ASSERT_EQ(writer3MF->GetModelCompressionLevel(), nCompressionLevel);
+			ASSERT_EQ(writer3MF->GetAttachmentCompressionLevel(), nCompressionLevel);
+			// stored entries are not handed to the compression threads
+			writer3MF->SetCompressionThreadCount(4);
+
+			std::vector<Lib3MF_uint8> & buffer = (nCompressionLevel == 0) ? vctStoredBuffer : vctDeflatedBuffer;
+			writer3MF->WriteToBuffer(buffer);
+
+			auto readModel = wrapper->CreateModel();
+			auto reader = readModel->QueryReader("3mf");
+			reader->AddRelationToRead(sAttachmentType);
+			reader->ReadFromBuffer(buffer);
+
+			ASSERT_EQ(readModel->GetMeshObjectByID(mesh->GetResourceID())->GetTriangleCount(), 12u);
+			ASSERT_EQ(readModel->GetAttachmentCount(), 1u);
+			std::vector<Lib3MF_uint8> vctReadPayload;
+			readModel->GetAttachment(0)->WriteToBuffer(vctReadPayload);
+			ASSERT_TRUE(vctReadPayload == vctPayload);
+		}
+
+		// stored entries contain the payload verbatim
+		ASSERT_TRUE(std::search(vctStoredBuffer.begin(), vctStoredBuffer.end(), vctPayload.begin(), vctPayload.end()) != vctStoredBuffer.end());
+		ASSERT_LT(vctDeflatedBuffer.size(), vctPayload.size() / 10);
+	}
+
+	TEST_F(Writer, 3MFNumberFormat)
+	{
+		std::vector<sPosition> vctVertices = {
+			fnCreateVertex(0.0f, 0.0f, 0.0f),
+			fnCreateVertex(-1.5f, 2.25f, 100.0f),
+			fnCreateVertex(0.125f, -0.5f, 0.0000001f)
+		};
+		std::vector<sTriangle> vctTriangles = { fnCreateTriangle(0, 1, 2) };
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		model->AddBuildItem(mesh.get(), wrapper->GetTranslationTransform(1.5f, -2.0f, 1000000.0f));
+
+		// stored entries make the model XML visible in the package
+		writer3MF->SetModelCompressionLevel(0);
+
+		auto fnContains = [](const std::vector<Lib3MF_uint8> & buffer, const std::string & sText) {
+			return std::search(buffer.begin(), buffer.end(), sText.begin(), sText.end()) != buffer.end();
+		};
+
+		std::vector<Lib3MF_uint8> buffer;
+		writer3MF->WriteToBuffer(buffer);
+		ASSERT_TRUE(fnContains(buffer, "<vertex x=\"0\" y=\"0\" z=\"0\" />"));
+		ASSERT_TRUE(fnContains(buffer, "<vertex x=\"-1.500000\" y=\"2.250000\" z=\"100.000000\" />"));
+		ASSERT_TRUE(fnContains(buffer, "<vertex x=\"0.125000\" y=\"-0.500000\" z=\"0\" />"));
+		ASSERT_TRUE(fnContains(buffer, "<triangle v1=\"0\" v2=\"1\" v3=\"2\" />"));
+		ASSERT_TRUE(fnContains(buffer, "transform=\"1 0 0 0 1 0 0 0 1 1.5 -2 1e+06\""));
+
+		writer3MF->SetDecimalPrecision(2);
+		writer3MF->WriteToBuffer(buffer);
+		ASSERT_TRUE(fnContains(buffer, "<vertex x=\"-1.50\" y=\"2.25\" z=\"100.00\" />"));
+		ASSERT_TRUE(fnContains(buffer, "<vertex x=\"0.12\" y=\"-0.50\" z=\"0\" />"));
+	}
 }